@@ -25,6 +25,20 @@ endif ()
 find_package(PCRE2 REQUIRED COMPONENTS 8BIT)
 
 
+#-----------------------------------------------------------------------
+# Threading
+
+find_package(Threads REQUIRED)
+
+
+#-----------------------------------------------------------------------
+# Micro-benchmarking
+
+if (OPENASSETIO_ENABLE_BENCHMARKS)
+    find_package(benchmark REQUIRED)
+endif ()
+
+
 #-----------------------------------------------------------------------
 # Python
 
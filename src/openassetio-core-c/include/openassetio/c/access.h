@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include "./namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_access oa_access
+ *
+ * C API equivalents of the access mode enumerations.
+ *
+ * Values are identical to the corresponding C++ enumerators.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_access_aliases Aliases
+ *
+ * @{
+ */
+#define oa_access_ResolveAccess_kRead OPENASSETIO_NS(access_ResolveAccess_kRead)
+#define oa_access_ResolveAccess_kManagerDriven OPENASSETIO_NS(access_ResolveAccess_kManagerDriven)
+#define oa_access_ResolveAccess OPENASSETIO_NS(access_ResolveAccess)
+#define oa_access_EntityTraitsAccess_kRead OPENASSETIO_NS(access_EntityTraitsAccess_kRead)
+#define oa_access_EntityTraitsAccess_kWrite OPENASSETIO_NS(access_EntityTraitsAccess_kWrite)
+#define oa_access_EntityTraitsAccess OPENASSETIO_NS(access_EntityTraitsAccess)
+
+/// @}
+// oa_access_aliases
+
+/// C equivalent of @fqref{access.ResolveAccess} "ResolveAccess".
+// NOLINTNEXTLINE(modernize-use-using)
+typedef enum {
+  /// @fqref{access.ResolveAccess.kRead} "kRead"
+  oa_access_ResolveAccess_kRead = 0,
+  /// @fqref{access.ResolveAccess.kManagerDriven} "kManagerDriven"
+  oa_access_ResolveAccess_kManagerDriven = 4
+} oa_access_ResolveAccess;
+
+/// C equivalent of @fqref{access.EntityTraitsAccess} "EntityTraitsAccess".
+// NOLINTNEXTLINE(modernize-use-using)
+typedef enum {
+  /// @fqref{access.EntityTraitsAccess.kRead} "kRead"
+  oa_access_EntityTraitsAccess_kRead = 0,
+  /// @fqref{access.EntityTraitsAccess.kWrite} "kWrite"
+  oa_access_EntityTraitsAccess_kWrite = 1
+} oa_access_EntityTraitsAccess;
+
+/// @}
+// oa_access
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+#include <stddef.h>   // NOLINT(modernize-deprecated-headers)
+#include <stdint.h>   // NOLINT(modernize-deprecated-headers)
+
+#include "./InfoDictionary.h"
+#include "./StringView.h"
+#include "./namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_batch oa_batch
+ *
+ * Caller-allocated storage for the results of batch C API functions.
+ *
+ * Batch functions write their results into pre-allocated arenas
+ * provided by the caller, such that no allocation is required per
+ * batch element. The same arenas can be re-used across calls.
+ *
+ * Each arena records the number of entries (and bytes) used in its
+ * `size` member(s). If any arena has insufficient capacity, the batch
+ * function returns @fqcref{ErrorCode_kLengthError} "kLengthError",
+ * and the `size` members are instead set to the capacity that would
+ * have been required. The caller can then allocate larger arenas and
+ * retry the call.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_batch_aliases Aliases
+ *
+ * @{
+ */
+#define oa_StringTable OPENASSETIO_NS(StringTable)
+#define oa_PropertyValue OPENASSETIO_NS(PropertyValue)
+#define oa_PropertyTable OPENASSETIO_NS(PropertyTable)
+#define oa_BatchElementResult OPENASSETIO_NS(BatchElementResult)
+
+/// @}
+// oa_batch_aliases
+
+/**
+ * Table of strings stored contiguously in a single character buffer.
+ *
+ * String `i` occupies the bytes `[offsets[i], offsets[i+1])` of
+ * `chars.data`. The `offsets` buffer must therefore hold
+ * `capacity + 1` entries.
+ *
+ * Initialize with a `size` of zero, and a `chars` view with a `size`
+ * of zero, e.g.
+ *
+ * @code{.c}
+ * char chars[4096];
+ * size_t offsets[65];
+ *
+ * oa_StringTable table = {64, offsets, 0, {sizeof chars, chars, 0}};
+ * @endcode
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Maximum number of strings that can be stored.
+  const size_t capacity;
+  /// Offsets of each string in `chars`, `capacity + 1` entries.
+  size_t* const offsets;
+  /// Number of strings stored.
+  size_t size;
+  /// Storage for the string data.
+  oa_StringView chars;
+} oa_StringTable;
+
+/**
+ * Storage for a non-string trait property value.
+ *
+ * The active member is determined by an accompanying
+ * @fqcref{InfoDictionary_ValueType} "value type".
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef union {
+  /// Value if type is @fqcref{InfoDictionary_ValueType_kBool} "kBool".
+  bool boolValue;
+  /// Value if type is @fqcref{InfoDictionary_ValueType_kInt} "kInt".
+  int64_t intValue;
+  /// Value if type is @fqcref{InfoDictionary_ValueType_kFloat} "kFloat".
+  double floatValue;
+} oa_PropertyValue;
+
+/**
+ * Table of trait properties, flattened into rows.
+ *
+ * Each row represents a single trait property. Row `i` has a trait ID,
+ * property key and (if a string) property value stored as strings
+ * `3*i`, `3*i + 1` and `3*i + 2`, respectively, of `strings`. The
+ * `strings` table must therefore have a capacity of at least
+ * `3 * capacity`.
+ *
+ * A trait with no properties is represented by a single row with an
+ * empty property key and a `type` of zero.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Maximum number of rows that can be stored.
+  const size_t capacity;
+  /// Number of rows stored.
+  size_t size;
+  /// Type of the value of each row, `capacity` entries.
+  oa_InfoDictionary_ValueType* const types;
+  /// Non-string value of each row, `capacity` entries.
+  oa_PropertyValue* const values;
+  /// Trait IDs, property keys and string values of each row.
+  oa_StringTable strings;
+} oa_PropertyTable;
+
+/**
+ * Result of a single element of a batch C API function.
+ *
+ * If `status` is zero, then the element succeeded and `first` and
+ * `count` describe the range of entries in the function's result
+ * table(s) for this element.
+ *
+ * Otherwise `status` is one of the `OPENASSETIO_BatchErrorCode_*`
+ * codes of the corresponding @fqref{errors.BatchElementError}
+ * "BatchElementError", and `first` is the index of the error message
+ * in the function's error message table.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Zero for success, a batch element error code otherwise.
+  int status;
+  /// Index of the first result table entry for this element.
+  size_t first;
+  /// Number of result table entries for this element.
+  size_t count;
+} oa_BatchElementResult;
+
+/// @}
+// oa_batch
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -6,6 +6,8 @@
 
 #include "../InfoDictionary.h"
 #include "../StringView.h"
+#include "../access.h"
+#include "../batch.h"
 #include "../errors.h"
 #include "../managerApi/HostSession.h"
 #include "../managerApi/ManagerInterface.h"
@@ -40,6 +42,9 @@ extern "C" {
 #define oa_hostApi_Manager_identifier OPENASSETIO_NS(hostApi_Manager_identifier)
 #define oa_hostApi_Manager_displayName OPENASSETIO_NS(hostApi_Manager_displayName)
 #define oa_hostApi_Manager_info OPENASSETIO_NS(hostApi_Manager_info)
+#define oa_hostApi_Manager_entityExists OPENASSETIO_NS(hostApi_Manager_entityExists)
+#define oa_hostApi_Manager_entityTraits OPENASSETIO_NS(hostApi_Manager_entityTraits)
+#define oa_hostApi_Manager_resolve OPENASSETIO_NS(hostApi_Manager_resolve)
 
 /// @}
 // oa_hostApi_Manager_aliases
@@ -139,6 +144,103 @@ OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_info(oa_StringView* er
                                                                oa_InfoDictionary_h out,
                                                                oa_hostApi_Manager_h handle);
 
+/**
+ * @name Batch functions
+ *
+ * C equivalents of batch member functions, writing results into
+ * caller-allocated arenas. See @ref oa_batch.
+ *
+ * The C API has no equivalent of a @fqref{Context} "Context", so a
+ * new context is created for each call, as if by
+ * @fqref{hostApi.Manager.createContext} "createContext".
+ *
+ * All result tables are cleared before use. The `results` array must
+ * have `numEntityReferences` entries, which are populated with
+ * the outcome of each element. Error messages for failed elements are
+ * written to the `errorMessages` table.
+ *
+ * If any table has insufficient capacity, then
+ * @fqcref{ErrorCode_kLengthError} "kLengthError" is returned and the
+ * `size` members of the tables hold the capacity required.
+ *
+ * @{
+ */
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.entityExists} "entityExists"
+ * member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for whether each entity exists,
+ * `numEntityReferences` entries.
+ * @param[out] results Storage for the outcome of each element.
+ * @param[out] errorMessages Storage for batch element error messages.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity references to query.
+ * @param numEntityReferences Number of entity references to query.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_entityExists(
+    oa_StringView* err, bool* out, oa_BatchElementResult* results, oa_StringTable* errorMessages,
+    oa_hostApi_Manager_h handle, const oa_ConstStringView* entityReferences,
+    size_t numEntityReferences);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.entityTraits} "entityTraits"
+ * member function.
+ *
+ * The trait IDs of a successful element are the strings
+ * `[first, first + count)` of `traitIds`.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] results Storage for the outcome of each element.
+ * @param[out] traitIds Storage for the trait IDs of each entity.
+ * @param[out] errorMessages Storage for batch element error messages.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity references to query.
+ * @param numEntityReferences Number of entity references to query.
+ * @param entityTraitsAccess Intended usage of the trait sets.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_entityTraits(
+    oa_StringView* err, oa_BatchElementResult* results, oa_StringTable* traitIds,
+    oa_StringTable* errorMessages, oa_hostApi_Manager_h handle,
+    const oa_ConstStringView* entityReferences, size_t numEntityReferences,
+    oa_access_EntityTraitsAccess entityTraitsAccess);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.resolve} "resolve"
+ * member function.
+ *
+ * The trait properties of a successful element are the rows
+ * `[first, first + count)` of `properties`.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] results Storage for the outcome of each element.
+ * @param[out] properties Storage for the resolved trait properties.
+ * @param[out] errorMessages Storage for batch element error messages.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity references to resolve.
+ * @param numEntityReferences Number of entity references to resolve.
+ * @param traitIds Trait set to resolve.
+ * @param numTraitIds Number of traits in the trait set.
+ * @param resolveAccess Intended usage of the resolved data.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_resolve(
+    oa_StringView* err, oa_BatchElementResult* results, oa_PropertyTable* properties,
+    oa_StringTable* errorMessages, oa_hostApi_Manager_h handle,
+    const oa_ConstStringView* entityReferences, size_t numEntityReferences,
+    const oa_ConstStringView* traitIds, size_t numTraitIds, oa_access_ResolveAccess resolveAccess);
+
+/// @}
+
 /// @}
 // oa_hostApi_Manager
 /// @}
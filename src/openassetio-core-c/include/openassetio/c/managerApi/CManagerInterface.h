@@ -93,8 +93,12 @@ typedef struct {
    *
    * @param[out] err Storage for error message, if any.
    * @param[out] out Storage for the identifier string, if no error
-   * occurred. @param handle Opaque handle representing
-   * `ManagerInterface` instance.
+   * occurred. If `out` has insufficient capacity, return
+   * @fqcref{ErrorCode_kLengthError} "kLengthError", optionally setting
+   * `size` to the capacity required, and the call will be retried
+   * with a larger buffer.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
    * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
    * error code otherwise.
    */
@@ -108,7 +112,10 @@ typedef struct {
    *
    * @param[out] err Storage for error message, if any.
    * @param[out] out Storage for the display name string, if no error
-   * occurred.
+   * occurred. If `out` has insufficient capacity, return
+   * @fqcref{ErrorCode_kLengthError} "kLengthError", optionally setting
+   * `size` to the capacity required, and the call will be retried
+   * with a larger buffer.
    * @param handle Opaque handle representing `ManagerInterface`
    * instance.
    * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <variant>
+
+#include <openassetio/c/InfoDictionary.h>
+#include <openassetio/c/batch.h>
+#include <openassetio/export.h>
+
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace batch {
+/// Clear a string table ready for re-use.
+inline void clear(oa_StringTable* table) {
+  table->size = 0;
+  table->chars.size = 0;
+}
+
+/// Clear a property table ready for re-use.
+inline void clear(oa_PropertyTable* table) {
+  table->size = 0;
+  clear(&table->strings);
+}
+
+/**
+ * Append a string to a string table.
+ *
+ * If the table has insufficient capacity, then nothing is written but
+ * the table's `size` members are still updated, such that they record
+ * the capacity required.
+ *
+ * @param table Table to append to.
+ * @param str String to append.
+ * @return Index of the string in the table.
+ */
+inline std::size_t appendString(oa_StringTable* table, const std::string_view str) {
+  const std::size_t index = table->size++;
+  const std::size_t begin = table->chars.size;
+  const std::size_t end = begin + str.size();
+  table->chars.size = end;
+
+  if (index < table->capacity) {
+    table->offsets[index] = begin;
+    table->offsets[index + 1] = end;
+  }
+  if (end <= table->chars.capacity) {
+    std::copy(str.begin(), str.end(), table->chars.data + begin);
+  }
+  return index;
+}
+
+/// Check if appending to a string table exceeded its capacity.
+inline bool isOverflowed(const oa_StringTable& table) {
+  return table.size > table.capacity || table.chars.size > table.chars.capacity;
+}
+
+/**
+ * Append a row to a property table.
+ *
+ * If the table has insufficient capacity, then nothing is written but
+ * the table's `size` members are still updated, such that they record
+ * the capacity required.
+ *
+ * @param table Table to append to.
+ * @param traitId Trait ID of the row.
+ * @param key Property key of the row, empty if the trait has no
+ * properties.
+ * @param value Property value of the row, null if the trait has no
+ * properties.
+ */
+inline void appendProperty(oa_PropertyTable* table, const std::string_view traitId,
+                           const std::string_view key, const trait::property::Value* value) {
+  const std::size_t row = table->size++;
+  const bool hasRow = row < table->capacity;
+
+  oa_InfoDictionary_ValueType type{};
+  oa_PropertyValue nonStrValue{};
+  std::string_view strValue;
+
+  if (value != nullptr) {
+    if (const auto* boolValue = std::get_if<Bool>(value)) {
+      type = oa_InfoDictionary_ValueType_kBool;
+      nonStrValue.boolValue = *boolValue;
+    } else if (const auto* intValue = std::get_if<Int>(value)) {
+      type = oa_InfoDictionary_ValueType_kInt;
+      nonStrValue.intValue = *intValue;
+    } else if (const auto* floatValue = std::get_if<Float>(value)) {
+      type = oa_InfoDictionary_ValueType_kFloat;
+      nonStrValue.floatValue = *floatValue;
+    } else {
+      type = oa_InfoDictionary_ValueType_kStr;
+      strValue = std::get<Str>(*value);
+    }
+  }
+
+  if (hasRow) {
+    table->types[row] = type;
+    table->values[row] = nonStrValue;
+  }
+  appendString(&table->strings, traitId);
+  appendString(&table->strings, key);
+  appendString(&table->strings, strValue);
+}
+
+/**
+ * Append all trait properties held by a TraitsData to a property
+ * table, one row per property.
+ *
+ * @return Number of rows appended.
+ */
+inline std::size_t appendTraitsData(oa_PropertyTable* table,
+                                    const trait::TraitsDataConstPtr& traitsData) {
+  const std::size_t first = table->size;
+  trait::property::Value value;
+
+  for (const trait::TraitId& traitId : traitsData->traitSet()) {
+    const trait::property::KeySet keys = traitsData->traitPropertyKeys(traitId);
+    if (keys.empty()) {
+      appendProperty(table, traitId, {}, nullptr);
+      continue;
+    }
+    for (const trait::property::Key& key : keys) {
+      traitsData->getTraitProperty(&value, traitId, key);
+      appendProperty(table, traitId, key, &value);
+    }
+  }
+  return table->size - first;
+}
+
+/// Check if appending to a property table exceeded its capacity.
+inline bool isOverflowed(const oa_PropertyTable& table) {
+  return table.size > table.capacity || isOverflowed(table.strings);
+}
+}  // namespace batch
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,19 +1,30 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
+#include <openassetio/c/access.h>
+#include <openassetio/c/batch.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/hostApi/Manager.h>
 #include <openassetio/c/managerApi/ManagerInterface.h>
 #include <openassetio/c/namespace.h>
 
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
 
 #include "../StringView.hpp"
+#include "../batch.hpp"
 #include "../errors.hpp"
 #include "../handles/InfoDictionary.hpp"
 #include "../handles/hostApi/Manager.hpp"
@@ -21,10 +32,61 @@
 #include "../handles/managerApi/ManagerInterface.hpp"
 #include "openassetio/c/managerApi/HostSession.h"
 
+namespace access = openassetio::access;
+namespace batch = openassetio::batch;
 namespace errors = openassetio::errors;
 namespace handles = openassetio::handles;
 namespace hostApi = openassetio::hostApi;
 namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+
+namespace {
+openassetio::EntityReferences toEntityReferences(const oa_ConstStringView* entityReferences,
+                                                 const std::size_t numEntityReferences) {
+  openassetio::EntityReferences result;
+  result.reserve(numEntityReferences);
+  std::for_each(
+      entityReferences, entityReferences + numEntityReferences,
+      [&result](const oa_ConstStringView& entityReference) {
+        result.emplace_back(openassetio::Str{entityReference.data, entityReference.size});
+      });
+  return result;
+}
+
+/**
+ * Reset the results of each element and clear the error message table,
+ * ready to begin a batch.
+ */
+void beginBatch(oa_BatchElementResult* results, const std::size_t numEntityReferences,
+                oa_StringTable* errorMessages) {
+  std::fill_n(results, numEntityReferences, oa_BatchElementResult{0, 0, 0});
+  batch::clear(errorMessages);
+}
+
+/**
+ * Create a batch element error callback that records the error code
+ * and message of the element.
+ */
+auto makeErrorCallback(oa_BatchElementResult* results, oa_StringTable* errorMessages) {
+  return [results, errorMessages](const std::size_t idx, const errors::BatchElementError& error) {
+    results[idx].status = static_cast<int>(error.code);
+    results[idx].first = batch::appendString(errorMessages, error.message);
+    results[idx].count = 1;
+  };
+}
+
+/**
+ * Complete a batch, returning an error if any of the result tables had
+ * insufficient capacity.
+ */
+oa_ErrorCode endBatch(oa_StringView* err, const bool isOverflowed) {
+  if (isOverflowed) {
+    openassetio::assignStringView(err, "Insufficient storage for batch results");
+    return oa_ErrorCode_kLengthError;
+  }
+  return oa_ErrorCode_kOK;
+}
+}  // namespace
 
 extern "C" {
 
@@ -81,4 +143,83 @@ oa_ErrorCode oa_hostApi_Manager_info(oa_StringView* err, oa_InfoDictionary_h out
     return oa_ErrorCode_kOK;
   });
 }
+
+oa_ErrorCode oa_hostApi_Manager_entityExists(oa_StringView* err, bool* out,
+                                             oa_BatchElementResult* results,
+                                             oa_StringTable* errorMessages,
+                                             oa_hostApi_Manager_h handle,
+                                             const oa_ConstStringView* entityReferences,
+                                             const size_t numEntityReferences) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    beginBatch(results, numEntityReferences, errorMessages);
+
+    manager->entityExists(
+        toEntityReferences(entityReferences, numEntityReferences), manager->createContext(),
+        [out](const std::size_t idx, const bool exists) { out[idx] = exists; },
+        makeErrorCallback(results, errorMessages));
+
+    return endBatch(err, batch::isOverflowed(*errorMessages));
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_entityTraits(
+    oa_StringView* err, oa_BatchElementResult* results, oa_StringTable* traitIds,
+    oa_StringTable* errorMessages, oa_hostApi_Manager_h handle,
+    const oa_ConstStringView* entityReferences, const size_t numEntityReferences,
+    const oa_access_EntityTraitsAccess entityTraitsAccess) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    beginBatch(results, numEntityReferences, errorMessages);
+    batch::clear(traitIds);
+
+    manager->entityTraits(
+        toEntityReferences(entityReferences, numEntityReferences),
+        static_cast<access::EntityTraitsAccess>(entityTraitsAccess), manager->createContext(),
+        [results, traitIds](const std::size_t idx, const trait::TraitSet& traitSet) {
+          results[idx].first = traitIds->size;
+          results[idx].count = traitSet.size();
+          for (const trait::TraitId& traitId : traitSet) {
+            batch::appendString(traitIds, traitId);
+          }
+        },
+        makeErrorCallback(results, errorMessages));
+
+    return endBatch(err, batch::isOverflowed(*traitIds) || batch::isOverflowed(*errorMessages));
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_resolve(oa_StringView* err, oa_BatchElementResult* results,
+                                        oa_PropertyTable* properties,
+                                        oa_StringTable* errorMessages,
+                                        oa_hostApi_Manager_h handle,
+                                        const oa_ConstStringView* entityReferences,
+                                        const size_t numEntityReferences,
+                                        const oa_ConstStringView* traitIds,
+                                        const size_t numTraitIds,
+                                        const oa_access_ResolveAccess resolveAccess) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr manager = *handles::hostApi::SharedManager::toInstance(handle);
+    beginBatch(results, numEntityReferences, errorMessages);
+    batch::clear(properties);
+
+    trait::TraitSet traitSet;
+    std::for_each(traitIds, traitIds + numTraitIds,
+                  [&traitSet](const oa_ConstStringView& traitId) {
+                    traitSet.emplace(traitId.data, traitId.size);
+                  });
+
+    manager->resolve(
+        toEntityReferences(entityReferences, numEntityReferences), traitSet,
+        static_cast<access::ResolveAccess>(resolveAccess), manager->createContext(),
+        [results, properties](const std::size_t idx, const trait::TraitsDataPtr& traitsData) {
+          results[idx].first = properties->size;
+          results[idx].count = batch::appendTraitsData(properties, traitsData);
+        },
+        makeErrorCallback(results, errorMessages));
+
+    return endBatch(err,
+                    batch::isOverflowed(*properties) || batch::isOverflowed(*errorMessages));
+  });
+}
 }  // extern "C"
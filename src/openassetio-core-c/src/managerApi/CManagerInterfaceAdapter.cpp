@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 
+#include <algorithm>
+#include <array>
 #include <stdexcept>
 #include <string>
 
@@ -15,6 +17,61 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
 
 constexpr size_t kStringBufferSize = 500;
+/// Limit on growth of string buffers, in case of a misbehaving plugin.
+constexpr size_t kMaxStringBufferSize = 1024 * 1024;
+
+namespace {
+/**
+ * Call a suite function that writes to a string out-parameter,
+ * returning the string.
+ *
+ * A stack buffer is used initially. If the suite function reports
+ * insufficient capacity via a @fqcref{ErrorCode_kLengthError}
+ * "kLengthError" code, then the call is retried with a larger heap
+ * buffer. The size required may be signalled by setting the `size` of
+ * the out-parameter to a value greater than its `capacity`, otherwise
+ * the buffer is doubled in size.
+ *
+ * @param suiteFn Callable taking error message and string
+ * out-parameters, returning an error code.
+ * @return String written to the out-parameter.
+ */
+template <class SuiteFn>
+Str callWithStringOut(const SuiteFn& suiteFn) {
+  // Buffer for error message.
+  std::array<char, kStringBufferSize> errorMessageBuffer{};
+  // Initial return value string buffer.
+  std::array<char, kStringBufferSize> stackBuffer{};
+  // Return value string buffer, if the initial buffer is too small.
+  Str heapBuffer;
+
+  char* outData = stackBuffer.data();
+  size_t outCapacity = stackBuffer.size();
+
+  while (true) {
+    // Error message.
+    oa_StringView errorMessage{errorMessageBuffer.size(), errorMessageBuffer.data(), 0};
+    // Return value.
+    oa_StringView out{outCapacity, outData, 0};
+
+    // Execute corresponding suite function.
+    const oa_ErrorCode errorCode = suiteFn(&errorMessage, &out);
+
+    if (errorCode == oa_ErrorCode_kLengthError && outCapacity < kMaxStringBufferSize) {
+      // Grow the buffer and try again.
+      heapBuffer.resize(std::min(std::max(outCapacity * 2, out.size), kMaxStringBufferSize));
+      outData = heapBuffer.data();
+      outCapacity = heapBuffer.size();
+      continue;
+    }
+
+    // Convert error code/message to exception.
+    errors::throwIfError(errorCode, errorMessage);
+
+    return {out.data, std::min(out.size, out.capacity)};
+  }
+}
+}  // namespace
 
 CManagerInterfaceAdapter::CManagerInterfaceAdapter(oa_managerApi_CManagerInterface_h handle,
                                                    oa_managerApi_CManagerInterface_s suite)
@@ -23,43 +80,15 @@ CManagerInterfaceAdapter::CManagerInterfaceAdapter(oa_managerApi_CManagerInterfa
 CManagerInterfaceAdapter::~CManagerInterfaceAdapter() { suite_.dtor(handle_); }
 
 Identifier CManagerInterfaceAdapter::identifier() const {
-  // Buffer for error message.
-  char errorMessageBuffer[kStringBufferSize];
-  // Error message.
-  oa_StringView errorMessage{kStringBufferSize, errorMessageBuffer, 0};
-
-  // Return value string buffer.
-  char outBuffer[kStringBufferSize];
-  // Return value.
-  oa_StringView out{kStringBufferSize, outBuffer, 0};
-
-  // Execute corresponding suite function.
-  const oa_ErrorCode errorCode = suite_.identifier(&errorMessage, &out, handle_);
-
-  // Convert error code/message to exception.
-  errors::throwIfError(errorCode, errorMessage);
-
-  return {out.data, out.size};
+  return callWithStringOut([this](oa_StringView* errorMessage, oa_StringView* out) {
+    return suite_.identifier(errorMessage, out, handle_);
+  });
 }
 
 Str CManagerInterfaceAdapter::displayName() const {
-  // Buffer for error message.
-  char errorMessageBuffer[kStringBufferSize];
-  // Error message.
-  oa_StringView errorMessage{kStringBufferSize, errorMessageBuffer, 0};
-
-  // Return value string buffer.
-  char outBuffer[kStringBufferSize];
-  // Return value.
-  oa_StringView out{kStringBufferSize, outBuffer, 0};
-
-  // Execute corresponding suite function.
-  const oa_ErrorCode errorCode = suite_.displayName(&errorMessage, &out, handle_);
-
-  // Convert error code/message to exception.
-  errors::throwIfError(errorCode, errorMessage);
-
-  return {out.data, out.size};
+  return callWithStringOut([this](oa_StringView* errorMessage, oa_StringView* out) {
+    return suite_.displayName(errorMessage, out, handle_);
+  });
 }
 
 InfoDictionary CManagerInterfaceAdapter::info() {
@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
+#include <array>
+#include <string_view>
+
+#include <openassetio/c/access.h>
+#include <openassetio/c/batch.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/hostApi/Manager.h>
 #include <openassetio/c/managerApi/HostSession.h>
@@ -9,12 +14,15 @@
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/typedefs.hpp>
 
 // Private headers.
@@ -29,6 +37,7 @@ namespace managerApi = openassetio::managerApi;
 namespace hostApi = openassetio::hostApi;
 namespace handles = openassetio::handles;
 
+using openassetio::errors::BatchElementError;
 using openassetio::log::LoggerInterface;
 using openassetio::log::LoggerInterfacePtr;
 
@@ -48,6 +57,7 @@ struct MockManagerInterface : trompeloeil::mock_interface<managerApi::ManagerInt
   IMPLEMENT_MOCK4(managementPolicy);
   IMPLEMENT_MOCK2(isEntityReferenceString);
   IMPLEMENT_MOCK5(entityExists);
+  IMPLEMENT_MOCK6(entityTraits);
   IMPLEMENT_MOCK7(resolve);
   IMPLEMENT_MOCK7(preflight);
   IMPLEMENT_MOCK7(register_);  // NOLINT(readability-identifier-naming)
@@ -70,6 +80,11 @@ struct MockHostInterface : trompeloeil::mock_interface<hostApi::HostInterface> {
 struct MockLoggerInterface : trompeloeil::mock_interface<LoggerInterface> {
   IMPLEMENT_MOCK2(log);
 };
+
+/// Get the string at the given index of a C string table.
+std::string_view stringAt(const oa_StringTable& table, const size_t idx) {
+  return {table.chars.data + table.offsets[idx], table.offsets[idx + 1] - table.offsets[idx]};
+}
 }  // namespace
 
 SCENARIO("A Manager is constructed and destructed") {
@@ -374,3 +389,302 @@ SCENARIO("A host calls Manager::info") {
     }
   }
 }
+
+SCENARIO("A host calls Manager::entityExists") {
+  using trompeloeil::_;
+
+  GIVEN("a Manager and its C handle") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = static_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    // Creating a default Context queries capabilities.
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(false);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    // Input entity references.
+    const openassetio::EntityReferences expectedEntityReferences{
+        openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"}};
+    const std::array<oa_ConstStringView, 2> entityReferences{{{"first", 5}, {"second", 6}}};
+
+    // Storage for batch results.
+    std::array<bool, 2> actualExists{};
+    std::array<oa_BatchElementResult, 2> actualResults{};
+    openassetio::Str errorMessagesStorage(kStringBufferSize, '\0');
+    std::array<size_t, 3> errorMessagesOffsets{};
+    oa_StringTable actualErrorMessages{
+        2,
+        errorMessagesOffsets.data(),
+        0,
+        {errorMessagesStorage.size(), errorMessagesStorage.data(), 0}};
+
+    AND_GIVEN(
+        "ManagerInterface::entityExists() will succeed for one element and fail for another") {
+      const BatchElementError expectedError{BatchElementError::ErrorCode::kInvalidEntityReference,
+                                            "Some error"};
+
+      REQUIRE_CALL(mockManagerInterface,
+                   entityExists(expectedEntityReferences, _, hostSessionPtr, _, _))
+          .LR_SIDE_EFFECT(_5(1, expectedError))
+          .LR_SIDE_EFFECT(_4(0, true));
+
+      WHEN("the Manager C API is queried for entity existence") {
+        // C API call.
+        const oa_ErrorCode code = oa_hostApi_Manager_entityExists(
+            &actualErrorMsg, actualExists.data(), actualResults.data(), &actualErrorMessages,
+            managerHandle, entityReferences.data(), entityReferences.size());
+
+        THEN("the results reflect the outcome of each element") {
+          CHECK(code == oa_ErrorCode_kOK);
+
+          CHECK(actualResults[0].status == 0);
+          CHECK(actualExists[0] == true);
+
+          CHECK(actualResults[1].status == OPENASSETIO_BatchErrorCode_kInvalidEntityReference);
+          CHECK(stringAt(actualErrorMessages, actualResults[1].first) == expectedError.message);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls Manager::entityTraits") {
+  using trompeloeil::_;
+
+  GIVEN("a Manager and its C handle") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = static_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    // Creating a default Context queries capabilities.
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(false);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    // Input entity references.
+    const openassetio::EntityReferences expectedEntityReferences{
+        openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"}};
+    const std::array<oa_ConstStringView, 2> entityReferences{{{"first", 5}, {"second", 6}}};
+
+    // Storage for batch results.
+    std::array<oa_BatchElementResult, 2> actualResults{};
+    openassetio::Str errorMessagesStorage(kStringBufferSize, '\0');
+    std::array<size_t, 3> errorMessagesOffsets{};
+    oa_StringTable actualErrorMessages{
+        2,
+        errorMessagesOffsets.data(),
+        0,
+        {errorMessagesStorage.size(), errorMessagesStorage.data(), 0}};
+
+    AND_GIVEN("ManagerInterface::entityTraits() will succeed") {
+      REQUIRE_CALL(mockManagerInterface,
+                   entityTraits(expectedEntityReferences,
+                                openassetio::access::EntityTraitsAccess::kWrite, _,
+                                hostSessionPtr, _, _))
+          .LR_SIDE_EFFECT(_5(1, openassetio::trait::TraitSet{"aTrait"}))
+          .LR_SIDE_EFFECT(_5(0, openassetio::trait::TraitSet{"anotherTrait"}));
+
+      AND_GIVEN("sufficient storage for the trait IDs") {
+        openassetio::Str traitIdsStorage(kStringBufferSize, '\0');
+        std::array<size_t, 3> traitIdsOffsets{};
+        oa_StringTable actualTraitIds{
+            2, traitIdsOffsets.data(), 0, {traitIdsStorage.size(), traitIdsStorage.data(), 0}};
+
+        WHEN("the Manager C API is queried for entity traits") {
+          // C API call.
+          const oa_ErrorCode code = oa_hostApi_Manager_entityTraits(
+              &actualErrorMsg, actualResults.data(), &actualTraitIds, &actualErrorMessages,
+              managerHandle, entityReferences.data(), entityReferences.size(),
+              oa_access_EntityTraitsAccess_kWrite);
+
+          THEN("the trait IDs of each element are written to the table") {
+            CHECK(code == oa_ErrorCode_kOK);
+            CHECK(actualTraitIds.size == 2);
+
+            CHECK(actualResults[0].status == 0);
+            CHECK(actualResults[0].count == 1);
+            CHECK(stringAt(actualTraitIds, actualResults[0].first) == "anotherTrait");
+
+            CHECK(actualResults[1].status == 0);
+            CHECK(actualResults[1].count == 1);
+            CHECK(stringAt(actualTraitIds, actualResults[1].first) == "aTrait");
+          }
+        }
+      }
+
+      AND_GIVEN("insufficient storage for the trait IDs") {
+        openassetio::Str traitIdsStorage(5, '\0');
+        std::array<size_t, 2> traitIdsOffsets{};
+        oa_StringTable actualTraitIds{
+            1, traitIdsOffsets.data(), 0, {traitIdsStorage.size(), traitIdsStorage.data(), 0}};
+
+        WHEN("the Manager C API is queried for entity traits") {
+          // C API call.
+          const oa_ErrorCode code = oa_hostApi_Manager_entityTraits(
+              &actualErrorMsg, actualResults.data(), &actualTraitIds, &actualErrorMessages,
+              managerHandle, entityReferences.data(), entityReferences.size(),
+              oa_access_EntityTraitsAccess_kWrite);
+
+          THEN("length error code is set and the table records the capacity required") {
+            CHECK(code == oa_ErrorCode_kLengthError);
+            CHECK(actualErrorMsg == "Insufficient storage for batch results");
+            CHECK(actualTraitIds.size == 2);
+            CHECK(actualTraitIds.chars.size == 18);
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls Manager::resolve") {
+  using trompeloeil::_;
+
+  GIVEN("a Manager and its C handle") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = static_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    // Creating a default Context queries capabilities.
+    ALLOW_CALL(mockManagerInterface, hasCapability(_)).RETURN(false);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    // Inputs.
+    const openassetio::EntityReferences expectedEntityReferences{
+        openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"},
+        openassetio::EntityReference{"third"}};
+    const std::array<oa_ConstStringView, 3> entityReferences{
+        {{"first", 5}, {"second", 6}, {"third", 5}}};
+    const openassetio::trait::TraitSet expectedTraitSet{"aTrait"};
+    const std::array<oa_ConstStringView, 1> traitSet{{{"aTrait", 6}}};
+
+    // Storage for batch results.
+    std::array<oa_BatchElementResult, 3> actualResults{};
+    openassetio::Str errorMessagesStorage(kStringBufferSize, '\0');
+    std::array<size_t, 4> errorMessagesOffsets{};
+    oa_StringTable actualErrorMessages{
+        3,
+        errorMessagesOffsets.data(),
+        0,
+        {errorMessagesStorage.size(), errorMessagesStorage.data(), 0}};
+
+    constexpr size_t kNumRows = 2;
+    std::array<oa_InfoDictionary_ValueType, kNumRows> actualTypes{};
+    std::array<oa_PropertyValue, kNumRows> actualValues{};
+    openassetio::Str propertyStringsStorage(kStringBufferSize, '\0');
+    std::array<size_t, 3 * kNumRows + 1> propertyStringsOffsets{};
+    oa_PropertyTable actualProperties{
+        kNumRows,
+        0,
+        actualTypes.data(),
+        actualValues.data(),
+        {3 * kNumRows,
+         propertyStringsOffsets.data(),
+         0,
+         {propertyStringsStorage.size(), propertyStringsStorage.data(), 0}}};
+
+    AND_GIVEN("ManagerInterface::resolve() will succeed for some elements and fail for another") {
+      const auto withProperty = openassetio::trait::TraitsData::make();
+      withProperty->setTraitProperty("aTrait", "aProperty", openassetio::Int{123});
+      const auto withoutProperty =
+          openassetio::trait::TraitsData::make(openassetio::trait::TraitSet{"aTrait"});
+      const BatchElementError expectedError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                            "Some error"};
+
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(expectedEntityReferences, expectedTraitSet,
+                           openassetio::access::ResolveAccess::kRead, _, hostSessionPtr, _, _))
+          .LR_SIDE_EFFECT(_6(2, withoutProperty))
+          .LR_SIDE_EFFECT(_7(1, expectedError))
+          .LR_SIDE_EFFECT(_6(0, withProperty));
+
+      WHEN("the Manager C API is used to resolve the entities") {
+        // C API call.
+        const oa_ErrorCode code = oa_hostApi_Manager_resolve(
+            &actualErrorMsg, actualResults.data(), &actualProperties, &actualErrorMessages,
+            managerHandle, entityReferences.data(), entityReferences.size(), traitSet.data(),
+            traitSet.size(), oa_access_ResolveAccess_kRead);
+
+        THEN("the properties of each element are written to the table") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(actualProperties.size == 2);
+
+          REQUIRE(actualResults[0].status == 0);
+          REQUIRE(actualResults[0].count == 1);
+          const size_t withPropertyRow = actualResults[0].first;
+          CHECK(actualTypes[withPropertyRow] == oa_InfoDictionary_ValueType_kInt);
+          CHECK(actualValues[withPropertyRow].intValue == 123);
+          CHECK(stringAt(actualProperties.strings, 3 * withPropertyRow) == "aTrait");
+          CHECK(stringAt(actualProperties.strings, 3 * withPropertyRow + 1) == "aProperty");
+
+          CHECK(actualResults[1].status == OPENASSETIO_BatchErrorCode_kEntityResolutionError);
+          CHECK(stringAt(actualErrorMessages, actualResults[1].first) == expectedError.message);
+
+          REQUIRE(actualResults[2].status == 0);
+          REQUIRE(actualResults[2].count == 1);
+          const size_t withoutPropertyRow = actualResults[2].first;
+          CHECK(actualTypes[withoutPropertyRow] == 0);
+          CHECK(stringAt(actualProperties.strings, 3 * withoutPropertyRow) == "aTrait");
+          CHECK(stringAt(actualProperties.strings, 3 * withoutPropertyRow + 1).empty());
+        }
+      }
+    }
+
+    AND_GIVEN("ManagerInterface::resolve() will fail with an exception") {
+      const openassetio::Str expectedErrorMsg = "Some error";
+      REQUIRE_CALL(mockManagerInterface, resolve(_, _, _, _, _, _, _))
+          .THROW(std::logic_error{expectedErrorMsg});
+
+      WHEN("the Manager C API is used to resolve the entities") {
+        // C API call.
+        const oa_ErrorCode code = oa_hostApi_Manager_resolve(
+            &actualErrorMsg, actualResults.data(), &actualProperties, &actualErrorMessages,
+            managerHandle, entityReferences.data(), entityReferences.size(), traitSet.data(),
+            traitSet.size(), oa_access_ResolveAccess_kRead);
+
+        THEN("generic exception error code and message is set") {
+          CHECK(code == oa_ErrorCode_kException);
+          CHECK(actualErrorMsg == expectedErrorMsg);
+        }
+      }
+    }
+  }
+}
@@ -78,6 +78,34 @@ SCENARIO("A host calls CManagerInterfaceAdapter::identifier") {
       }
     }
 
+    AND_GIVEN("the C suite's identifier() call reports insufficient capacity") {
+      const openassetio::Str expectedIdentifier(kStringBufferSize + 1, 'x');
+
+      using trompeloeil::_;
+
+      // Check that `identifier` is called with the default capacity,
+      // and report that it is insufficient.
+      REQUIRE_CALL(mockImpl, identifier(_, _, handle))
+          .LR_WITH(_2->capacity == kStringBufferSize)
+          .RETURN(oa_ErrorCode_kLengthError);
+
+      // Check that `identifier` is called again with a larger
+      // capacity, and update out-parameter.
+      REQUIRE_CALL(mockImpl, identifier(_, _, handle))
+          .LR_WITH(_2->capacity >= expectedIdentifier.size())
+          .LR_SIDE_EFFECT(strncpy(_2->data, expectedIdentifier.data(), expectedIdentifier.size()))
+          .LR_SIDE_EFFECT(_2->size = expectedIdentifier.size())
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the manager's identifier is queried") {
+        const openassetio::Identifier actualIdentifier = cManagerInterface.identifier();
+
+        THEN("the returned identifier matches expected identifier") {
+          CHECK(actualIdentifier == expectedIdentifier);
+        }
+      }
+    }
+
     AND_GIVEN("the C suite's identifier() call fails") {
       const std::string_view expectedErrorMsg = "some error happened";
       const auto expectedErrorCode = oa_ErrorCode_kUnknown;
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.hpp"
+
+namespace {
+// Relaxed ordering is sufficient, we only require eventual consistency
+// of the totals once the benchmark loop has completed.
+std::atomic<std::size_t> gAllocationCount{0};
+std::atomic<std::size_t> gAllocationBytes{0};
+
+void* countedAlloc(const std::size_t size) {
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  gAllocationBytes.fetch_add(size, std::memory_order_relaxed);
+  // malloc(0) may legitimately return nullptr, but operator new must
+  // not.
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {  // NOLINT(*-no-malloc,*-owning-memory)
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void* countedAlignedAlloc(const std::size_t size, const std::align_val_t alignment) {
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  gAllocationBytes.fetch_add(size, std::memory_order_relaxed);
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc requires size to be a multiple of the alignment.
+  const std::size_t paddedSize = ((size + align - 1) / align) * align;
+  if (void* ptr = std::aligned_alloc(align, paddedSize == 0 ? align : paddedSize)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+}  // namespace
+
+namespace openassetio::benchmarks {
+AllocationStats allocationStats() {
+  return {gAllocationCount.load(std::memory_order_relaxed),
+          gAllocationBytes.load(std::memory_order_relaxed)};
+}
+}  // namespace openassetio::benchmarks
+
+// Replacements for the global allocation functions. The array and
+// nothrow variants provided by the standard library forward to these.
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return countedAlignedAlloc(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }  // NOLINT(*-no-malloc,*-owning-memory)
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept {
+  std::free(ptr);  // NOLINT(*-no-malloc,*-owning-memory)
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::align_val_t alignment) noexcept {
+  std::free(ptr);  // NOLINT(*-no-malloc,*-owning-memory)
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size,
+                     [[maybe_unused]] std::align_val_t alignment) noexcept {
+  std::free(ptr);  // NOLINT(*-no-malloc,*-owning-memory)
+}
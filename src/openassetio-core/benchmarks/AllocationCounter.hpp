@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+namespace openassetio::benchmarks {
+/**
+ * Snapshot of the number of heap allocations made by the process.
+ *
+ * The benchmark executable replaces the global `operator new`, such
+ * that all allocations, including those made within the OpenAssetIO
+ * library, are counted.
+ */
+struct AllocationStats {
+  /// Number of calls to `operator new`.
+  std::size_t count;
+  /// Total number of bytes requested from `operator new`.
+  std::size_t bytes;
+};
+
+/**
+ * Get the current running totals of heap allocations.
+ */
+AllocationStats allocationStats();
+
+/**
+ * Record allocation counters for a benchmark, given a snapshot taken
+ * before the benchmark loop.
+ *
+ * Adds counters for allocations (and bytes allocated) per iteration
+ * and per batch element, so regressions in per-element overhead are
+ * visible independently of batch size.
+ *
+ * @param state Benchmark state to add counters to.
+ * @param before Snapshot taken immediately before the benchmark loop.
+ * @param batchSize Number of elements processed per iteration.
+ */
+inline void reportAllocations(benchmark::State& state, const AllocationStats& before,
+                              const std::size_t batchSize) {
+  const AllocationStats after = allocationStats();
+  const auto count = static_cast<double>(after.count - before.count);
+  const auto bytes = static_cast<double>(after.bytes - before.bytes);
+  const auto iterations = static_cast<double>(state.iterations());
+  const auto elements = iterations * static_cast<double>(batchSize);
+
+  state.counters["allocs"] = benchmark::Counter{count / iterations};
+  state.counters["allocBytes"] = benchmark::Counter{bytes / iterations};
+  state.counters["allocsPerElement"] = benchmark::Counter{count / elements};
+  state.counters["allocBytesPerElement"] = benchmark::Counter{bytes / elements};
+  state.SetItemsProcessed(static_cast<int64_t>(elements));
+}
+}  // namespace openassetio::benchmarks
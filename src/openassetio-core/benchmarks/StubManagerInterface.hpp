@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio::benchmarks {
+/**
+ * Trait ID and property used to populate resolve results. Modelled on
+ * the LocatableContent trait, which is the most commonly resolved
+ * trait in practice.
+ */
+inline const trait::TraitId kLocatableContentTraitId = "openassetio-mediacreation:content.LocatableContent";
+inline const trait::property::Key kLocationPropertyKey = "location";
+inline const Str kLocationValue = "file:///mnt/projects/show/seq/shot/publish/render/v001/beauty.exr";
+
+/**
+ * Entity reference prefixes advertised by the stub manager, modelled
+ * on a manager supporting a few URI schemes.
+ */
+inline const Str kEntityReferencePrefixes = "asset:// bal:/// shotgrid://";
+
+/**
+ * Pager returning a single page of a single reference.
+ */
+class StubEntityReferencePagerInterface final : public managerApi::EntityReferencePagerInterface {
+ public:
+  explicit StubEntityReferencePagerInterface(EntityReference entityReference)
+      : page_{std::move(entityReference)} {}
+
+  bool hasNext([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return false;
+  }
+
+  Page get([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return page_;
+  }
+
+  void next([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {}
+
+ private:
+  Page page_;
+};
+
+/**
+ * In-process manager implementation that responds immediately with
+ * trivial results.
+ *
+ * The intention is to measure the overhead of the host-facing
+ * Manager API (argument forwarding, callback dispatch, result
+ * construction), rather than any particular manager implementation.
+ *
+ * If constructed with a non-zero `errorStride`, every `errorStride`th
+ * element will result in a BatchElementError rather than a success.
+ *
+ * The stub is stateless, so declares itself thread-safe. It advertises
+ * its entity reference prefixes, so that the API can check entity
+ * reference strings without calling it.
+ */
+class StubManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  explicit StubManagerInterface(const std::size_t errorStride = 0) : errorStride_{errorStride} {}
+
+  [[nodiscard]] Identifier identifier() const override {
+    return "org.openassetio.benchmarks.stubManager";
+  }
+
+  [[nodiscard]] Str displayName() const override { return "Benchmark Stub Manager"; }
+
+  bool hasCapability([[maybe_unused]] Capability capability) override { return true; }
+
+  InfoDictionary info() override {
+    return {{Str{constants::kInfoKey_IsThreadSafe}, true},
+            {Str{constants::kInfoKey_EntityReferencesMatchPrefixes}, kEntityReferencePrefixes}};
+  }
+
+  void initialize([[maybe_unused]] InfoDictionary managerSettings,
+                  [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {}
+
+  bool isEntityReferenceString([[maybe_unused]] const Str& someString,
+                               [[maybe_unused]] const managerApi::HostSessionPtr& hostSession)
+      override {
+    return true;
+  }
+
+  void entityExists(const EntityReferences& entityReferences,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      if (isError(idx)) {
+        errorCallback(idx, makeError());
+      } else {
+        successCallback(idx, true);
+      }
+    }
+  }
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    [[maybe_unused]] access::EntityTraitsAccess entityTraitsAccess,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      if (isError(idx)) {
+        errorCallback(idx, makeError());
+      } else {
+        successCallback(idx, {kLocatableContentTraitId});
+      }
+    }
+  }
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               [[maybe_unused]] access::ResolveAccess resolveAccess,
+               [[maybe_unused]] const ContextConstPtr& context,
+               [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    const bool wantsLocation = traitSet.count(kLocatableContentTraitId) != 0;
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      if (isError(idx)) {
+        errorCallback(idx, makeError());
+        continue;
+      }
+      // Construct a new result per element, as a real manager would.
+      auto traitsData = trait::TraitsData::make();
+      if (wantsLocation) {
+        traitsData->setTraitProperty(kLocatableContentTraitId, kLocationPropertyKey,
+                                     kLocationValue);
+      }
+      successCallback(idx, std::move(traitsData));
+    }
+  }
+
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           [[maybe_unused]] const trait::TraitsDataPtr& relationshipTraitsData,
+                           [[maybe_unused]] const trait::TraitSet& resultTraitSet,
+                           [[maybe_unused]] std::size_t pageSize,
+                           [[maybe_unused]] access::RelationsAccess relationsAccess,
+                           [[maybe_unused]] const ContextConstPtr& context,
+                           [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      if (isError(idx)) {
+        errorCallback(idx, makeError());
+      } else {
+        successCallback(idx,
+                        std::make_shared<StubEntityReferencePagerInterface>(entityReferences[idx]));
+      }
+    }
+  }
+
+  void preflight(const EntityReferences& entityReferences,
+                 [[maybe_unused]] const trait::TraitsDatas& traitsHints,
+                 [[maybe_unused]] access::PublishingAccess publishingAccess,
+                 [[maybe_unused]] const ContextConstPtr& context,
+                 [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      if (isError(idx)) {
+        errorCallback(idx, makeError());
+      } else {
+        successCallback(idx, entityReferences[idx]);
+      }
+    }
+  }
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void register_(const EntityReferences& entityReferences,
+                 [[maybe_unused]] const trait::TraitsDatas& entityTraitsDatas,
+                 [[maybe_unused]] access::PublishingAccess publishingAccess,
+                 [[maybe_unused]] const ContextConstPtr& context,
+                 [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      if (isError(idx)) {
+        errorCallback(idx, makeError());
+      } else {
+        successCallback(idx, entityReferences[idx]);
+      }
+    }
+  }
+
+ private:
+  [[nodiscard]] bool isError(const std::size_t idx) const {
+    return errorStride_ != 0 && idx % errorStride_ == errorStride_ - 1;
+  }
+
+  static errors::BatchElementError makeError() {
+    return errors::BatchElementError{errors::BatchElementError::ErrorCode::kEntityResolutionError,
+                                     "Stub error"};
+  }
+
+  std::size_t errorStride_;
+};
+}  // namespace openassetio::benchmarks
@@ -0,0 +1,463 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of the batch-first hostApi::Manager methods, in both
+ * callback form and the convenience (exception/variant) forms.
+ *
+ * An in-process stub manager is used, so that the figures reflect
+ * the overhead of the Manager API itself, rather than that of any
+ * particular manager implementation.
+ */
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolvedBatch.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../AllocationCounter.hpp"
+#include "../StubManagerInterface.hpp"
+
+namespace {
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::benchmarks::allocationStats;
+using openassetio::benchmarks::AllocationStats;
+using openassetio::benchmarks::kLocatableContentTraitId;
+using openassetio::benchmarks::kLocationPropertyKey;
+using openassetio::benchmarks::reportAllocations;
+using openassetio::benchmarks::StubManagerInterface;
+using openassetio::errors::BatchElementError;
+using openassetio::hostApi::Manager;
+using openassetio::hostApi::ResolvedBatch;
+namespace access = openassetio::access;
+namespace trait = openassetio::trait;
+
+using ErrorPolicy = Manager::BatchElementErrorPolicyTag;
+
+/**
+ * Every nth element errors when benchmarking variant-returning
+ * convenience methods, so that both sides of the variant are
+ * exercised.
+ */
+constexpr std::size_t kVariantErrorStride = 10;
+
+struct StubHostInterface final : openassetio::hostApi::HostInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.benchmarks.stubHost";
+  }
+  [[nodiscard]] openassetio::Str displayName() const override { return "Benchmark Stub Host"; }
+};
+
+struct NullLogger final : openassetio::log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity,
+           [[maybe_unused]] const openassetio::Str& message) override {}
+};
+
+/**
+ * Objects required for making Manager API calls on a batch of a given
+ * size.
+ *
+ * Constructed outside the benchmark loop, so that set-up costs do not
+ * contribute to the measurements.
+ */
+struct ManagerFixture {
+  explicit ManagerFixture(const std::size_t batchSize, const std::size_t errorStride = 0)
+      : manager{Manager::make(
+            std::make_shared<StubManagerInterface>(errorStride),
+            openassetio::managerApi::HostSession::make(
+                openassetio::managerApi::Host::make(std::make_shared<StubHostInterface>()),
+                std::make_shared<NullLogger>()))},
+        context{openassetio::Context::make()},
+        relationship{trait::TraitsData::make({"openassetio-benchmark:relationship.Stub"})} {
+    manager->initialize({});
+    entityReferences.reserve(batchSize);
+    traitsDatas.reserve(batchSize);
+    for (std::size_t idx = 0; idx < batchSize; ++idx) {
+      entityReferences.emplace_back("bal:///benchmark/entity/" + std::to_string(idx));
+      traitsDatas.push_back(trait::TraitsData::make(traitSet));
+    }
+  }
+
+  openassetio::hostApi::ManagerPtr manager;
+  openassetio::ContextPtr context;
+  trait::TraitsDataPtr relationship;
+  trait::TraitSet traitSet{kLocatableContentTraitId};
+  EntityReferences entityReferences;
+  trait::TraitsDatas traitsDatas;
+};
+
+/**
+ * Run a benchmark of a batch operation, where the batch size is given
+ * by the benchmark's first argument.
+ *
+ * @param state Benchmark state.
+ * @param errorStride Configure the stub manager to emit an error for
+ * every nth element, or 0 for no errors.
+ * @param batchCall Callable taking a ManagerFixture, performing the
+ * operation under test.
+ */
+template <class BatchCall>
+void runBatchBenchmark(benchmark::State& state, const std::size_t errorStride,
+                       const BatchCall& batchCall) {
+  const auto batchSize = static_cast<std::size_t>(state.range(0));
+  ManagerFixture fixture{batchSize, errorStride};
+
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    batchCall(fixture);
+  }
+  reportAllocations(state, before, batchSize);
+}
+
+/**
+ * Error callback for callback-form benchmarks. The stub manager does
+ * not emit errors in these benchmarks, but the API requires one.
+ */
+void ignoreError([[maybe_unused]] std::size_t idx, BatchElementError error) {
+  benchmark::DoNotOptimize(error);
+}
+
+/// Batch sizes to benchmark: 1, 10, 100, ..., 1M.
+void batchSizes(benchmark::internal::Benchmark* benchmark) {
+  constexpr int kMultiplier = 10;
+  constexpr int kMaxBatchSize = 1'000'000;
+  benchmark->ArgName("batchSize")
+      ->RangeMultiplier(kMultiplier)
+      ->Range(1, kMaxBatchSize)
+      ->Unit(benchmark::kMicrosecond);
+}
+
+/******************************************
+ * resolve
+ ******************************************/
+
+void resolveCallback(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    fixture.manager->resolve(
+        fixture.entityReferences, fixture.traitSet, access::ResolveAccess::kRead, fixture.context,
+        []([[maybe_unused]] std::size_t idx, trait::TraitsDataPtr traitsData) {
+          benchmark::DoNotOptimize(traitsData);
+        },
+        ignoreError);
+  });
+}
+
+void resolveException(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->resolve(fixture.entityReferences, fixture.traitSet,
+                                            access::ResolveAccess::kRead, fixture.context,
+                                            ErrorPolicy::kException);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void resolveVariant(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->resolve(fixture.entityReferences, fixture.traitSet,
+                                            access::ResolveAccess::kRead, fixture.context,
+                                            ErrorPolicy::kVariant);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void resolveColumns(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->resolveColumns(
+        fixture.entityReferences,
+        {{kLocatableContentTraitId, kLocationPropertyKey, ResolvedBatch::ColumnType::kStr}},
+        access::ResolveAccess::kRead, fixture.context);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void resolveParallel(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    if (!fixture.manager->isParallelDispatchEnabled()) {
+      fixture.manager->enableParallelDispatch();
+    }
+    fixture.manager->resolve(
+        fixture.entityReferences, fixture.traitSet, access::ResolveAccess::kRead, fixture.context,
+        []([[maybe_unused]] std::size_t idx, trait::TraitsDataPtr traitsData) {
+          benchmark::DoNotOptimize(traitsData);
+        },
+        ignoreError);
+  });
+}
+
+BENCHMARK(resolveCallback)->Name("Manager/resolve/callback")->Apply(batchSizes);
+BENCHMARK(resolveException)->Name("Manager/resolve/exception")->Apply(batchSizes);
+BENCHMARK(resolveVariant)->Name("Manager/resolve/variant")->Apply(batchSizes);
+BENCHMARK(resolveColumns)->Name("Manager/resolve/columns")->Apply(batchSizes);
+BENCHMARK(resolveParallel)
+    ->Name("Manager/resolve/parallel")
+    ->Apply(batchSizes)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
+/******************************************
+ * entityExists
+ ******************************************/
+
+void entityExistsCallback(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    fixture.manager->entityExists(
+        fixture.entityReferences, fixture.context,
+        []([[maybe_unused]] std::size_t idx, bool exists) { benchmark::DoNotOptimize(exists); },
+        ignoreError);
+  });
+}
+
+void entityExistsException(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->entityExists(fixture.entityReferences, fixture.context,
+                                                 ErrorPolicy::kException);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void entityExistsVariant(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->entityExists(fixture.entityReferences, fixture.context,
+                                                 ErrorPolicy::kVariant);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+BENCHMARK(entityExistsCallback)->Name("Manager/entityExists/callback")->Apply(batchSizes);
+BENCHMARK(entityExistsException)->Name("Manager/entityExists/exception")->Apply(batchSizes);
+BENCHMARK(entityExistsVariant)->Name("Manager/entityExists/variant")->Apply(batchSizes);
+
+/******************************************
+ * entityTraits
+ ******************************************/
+
+void entityTraitsCallback(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    fixture.manager->entityTraits(
+        fixture.entityReferences, access::EntityTraitsAccess::kRead, fixture.context,
+        []([[maybe_unused]] std::size_t idx, trait::TraitSet traitSet) {
+          benchmark::DoNotOptimize(traitSet);
+        },
+        ignoreError);
+  });
+}
+
+void entityTraitsException(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    auto results =
+        fixture.manager->entityTraits(fixture.entityReferences, access::EntityTraitsAccess::kRead,
+                                      fixture.context, ErrorPolicy::kException);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void entityTraitsVariant(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results =
+        fixture.manager->entityTraits(fixture.entityReferences, access::EntityTraitsAccess::kRead,
+                                      fixture.context, ErrorPolicy::kVariant);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+BENCHMARK(entityTraitsCallback)->Name("Manager/entityTraits/callback")->Apply(batchSizes);
+BENCHMARK(entityTraitsException)->Name("Manager/entityTraits/exception")->Apply(batchSizes);
+BENCHMARK(entityTraitsVariant)->Name("Manager/entityTraits/variant")->Apply(batchSizes);
+
+/******************************************
+ * preflight
+ ******************************************/
+
+void preflightCallback(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    fixture.manager->preflight(
+        fixture.entityReferences, fixture.traitsDatas, access::PublishingAccess::kWrite,
+        fixture.context,
+        []([[maybe_unused]] std::size_t idx, EntityReference entityReference) {
+          benchmark::DoNotOptimize(entityReference);
+        },
+        ignoreError);
+  });
+}
+
+void preflightException(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->preflight(fixture.entityReferences, fixture.traitsDatas,
+                                              access::PublishingAccess::kWrite, fixture.context,
+                                              ErrorPolicy::kException);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void preflightVariant(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->preflight(fixture.entityReferences, fixture.traitsDatas,
+                                              access::PublishingAccess::kWrite, fixture.context,
+                                              ErrorPolicy::kVariant);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+BENCHMARK(preflightCallback)->Name("Manager/preflight/callback")->Apply(batchSizes);
+BENCHMARK(preflightException)->Name("Manager/preflight/exception")->Apply(batchSizes);
+BENCHMARK(preflightVariant)->Name("Manager/preflight/variant")->Apply(batchSizes);
+
+/******************************************
+ * register_
+ ******************************************/
+
+void registerCallback(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    fixture.manager->register_(
+        fixture.entityReferences, fixture.traitsDatas, access::PublishingAccess::kWrite,
+        fixture.context,
+        []([[maybe_unused]] std::size_t idx, EntityReference entityReference) {
+          benchmark::DoNotOptimize(entityReference);
+        },
+        ignoreError);
+  });
+}
+
+void registerException(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->register_(fixture.entityReferences, fixture.traitsDatas,
+                                              access::PublishingAccess::kWrite, fixture.context,
+                                              ErrorPolicy::kException);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void registerVariant(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->register_(fixture.entityReferences, fixture.traitsDatas,
+                                              access::PublishingAccess::kWrite, fixture.context,
+                                              ErrorPolicy::kVariant);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+BENCHMARK(registerCallback)->Name("Manager/register_/callback")->Apply(batchSizes);
+BENCHMARK(registerException)->Name("Manager/register_/exception")->Apply(batchSizes);
+BENCHMARK(registerVariant)->Name("Manager/register_/variant")->Apply(batchSizes);
+
+/******************************************
+ * getWithRelationship
+ ******************************************/
+
+constexpr std::size_t kPageSize = 10;
+
+void getWithRelationshipCallback(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    fixture.manager->getWithRelationship(
+        fixture.entityReferences, fixture.relationship, kPageSize, access::RelationsAccess::kRead,
+        fixture.context,
+        []([[maybe_unused]] std::size_t idx, openassetio::hostApi::EntityReferencePagerPtr pager) {
+          benchmark::DoNotOptimize(pager);
+        },
+        ignoreError);
+  });
+}
+
+void getWithRelationshipException(benchmark::State& state) {
+  runBatchBenchmark(state, 0, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->getWithRelationship(
+        fixture.entityReferences, fixture.relationship, kPageSize, access::RelationsAccess::kRead,
+        fixture.context, {}, ErrorPolicy::kException);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+void getWithRelationshipVariant(benchmark::State& state) {
+  runBatchBenchmark(state, kVariantErrorStride, [](ManagerFixture& fixture) {
+    auto results = fixture.manager->getWithRelationship(
+        fixture.entityReferences, fixture.relationship, kPageSize, access::RelationsAccess::kRead,
+        fixture.context, {}, ErrorPolicy::kVariant);
+    benchmark::DoNotOptimize(results);
+  });
+}
+
+BENCHMARK(getWithRelationshipCallback)
+    ->Name("Manager/getWithRelationship/callback")
+    ->Apply(batchSizes);
+BENCHMARK(getWithRelationshipException)
+    ->Name("Manager/getWithRelationship/exception")
+    ->Apply(batchSizes);
+BENCHMARK(getWithRelationshipVariant)
+    ->Name("Manager/getWithRelationship/variant")
+    ->Apply(batchSizes);
+
+/******************************************
+ * isEntityReferenceString
+ ******************************************/
+
+/**
+ * Strings to check, every other one being an entity reference. Views
+ * into the fixture's entity references and a parallel set of file
+ * paths.
+ */
+struct StringsFixture {
+  explicit StringsFixture(const ManagerFixture& fixture) {
+    paths.reserve(fixture.entityReferences.size());
+    views.reserve(fixture.entityReferences.size());
+    for (std::size_t idx = 0; idx < fixture.entityReferences.size(); ++idx) {
+      paths.push_back("/mnt/projects/show/" + std::to_string(idx) + ".exr");
+      views.emplace_back(idx % 2 == 0 ? fixture.entityReferences[idx].toString() : paths.back());
+    }
+  }
+  std::vector<openassetio::Str> paths;
+  std::vector<std::string_view> views;
+};
+
+void isEntityReferenceStringLoop(benchmark::State& state) {
+  const auto batchSize = static_cast<std::size_t>(state.range(0));
+  ManagerFixture fixture{batchSize};
+  const StringsFixture strings{fixture};
+  // Loop over Str, as the singular method requires.
+  std::vector<openassetio::Str> someStrings{strings.views.begin(), strings.views.end()};
+
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    for (const openassetio::Str& someString : someStrings) {
+      benchmark::DoNotOptimize(fixture.manager->isEntityReferenceString(someString));
+    }
+  }
+  reportAllocations(state, before, batchSize);
+}
+
+void areEntityReferenceStrings(benchmark::State& state) {
+  const auto batchSize = static_cast<std::size_t>(state.range(0));
+  ManagerFixture fixture{batchSize};
+  const StringsFixture strings{fixture};
+
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    auto results = fixture.manager->areEntityReferenceStrings(strings.views);
+    benchmark::DoNotOptimize(results);
+  }
+  reportAllocations(state, before, batchSize);
+}
+
+BENCHMARK(isEntityReferenceStringLoop)
+    ->Name("Manager/isEntityReferenceString/loop")
+    ->Apply(batchSizes);
+BENCHMARK(areEntityReferenceStrings)
+    ->Name("Manager/areEntityReferenceStrings/batch")
+    ->Apply(batchSizes);
+}  // namespace
@@ -0,0 +1,5 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+/**
+ * Benchmarks of trait::TraitsData construction and property access,
+ * modelled on a typical resolve result.
+ */
+#include <benchmark/benchmark.h>
+
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../AllocationCounter.hpp"
+#include "../StubManagerInterface.hpp"
+
+namespace {
+using openassetio::benchmarks::allocationStats;
+using openassetio::benchmarks::AllocationStats;
+using openassetio::benchmarks::kLocatableContentTraitId;
+using openassetio::benchmarks::kLocationPropertyKey;
+using openassetio::benchmarks::kLocationValue;
+using openassetio::benchmarks::reportAllocations;
+namespace trait = openassetio::trait;
+
+const trait::TraitId kEntityTraitId = "openassetio-mediacreation:usage.Entity";
+const trait::property::Key kIsTemplatedPropertyKey = "isTemplated";
+const trait::property::Key kMimeTypePropertyKey = "mimeType";
+
+trait::TraitsDataPtr makePopulatedTraitsData() {
+  auto traitsData = trait::TraitsData::make();
+  traitsData->addTrait(kEntityTraitId);
+  traitsData->setTraitProperty(kLocatableContentTraitId, kLocationPropertyKey, kLocationValue);
+  traitsData->setTraitProperty(kLocatableContentTraitId, kIsTemplatedPropertyKey,
+                               openassetio::Bool{false});
+  traitsData->setTraitProperty(kLocatableContentTraitId, kMimeTypePropertyKey,
+                               openassetio::Str{"image/x-exr"});
+  return traitsData;
+}
+
+void construct(benchmark::State& state) {
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    auto traitsData = makePopulatedTraitsData();
+    benchmark::DoNotOptimize(traitsData);
+  }
+  reportAllocations(state, before, 1);
+}
+
+void copy(benchmark::State& state) {
+  const trait::TraitsDataConstPtr original = makePopulatedTraitsData();
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    auto traitsData = trait::TraitsData::make(original);
+    benchmark::DoNotOptimize(traitsData);
+  }
+  reportAllocations(state, before, 1);
+}
+
+void getTraitProperty(benchmark::State& state) {
+  const trait::TraitsDataConstPtr traitsData = makePopulatedTraitsData();
+  trait::property::Value value;
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        traitsData->getTraitProperty(&value, kLocatableContentTraitId, kMimeTypePropertyKey));
+  }
+  reportAllocations(state, before, 1);
+}
+
+void hasTrait(benchmark::State& state) {
+  const trait::TraitsDataConstPtr traitsData = makePopulatedTraitsData();
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(traitsData->hasTrait(kEntityTraitId));
+  }
+  reportAllocations(state, before, 1);
+}
+
+void equality(benchmark::State& state) {
+  const trait::TraitsDataConstPtr first = makePopulatedTraitsData();
+  const trait::TraitsDataConstPtr second = makePopulatedTraitsData();
+  const AllocationStats before = allocationStats();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(*first == *second);
+  }
+  reportAllocations(state, before, 1);
+}
+
+BENCHMARK(construct)->Name("TraitsData/construct");
+BENCHMARK(copy)->Name("TraitsData/copy");
+BENCHMARK(getTraitProperty)->Name("TraitsData/getTraitProperty");
+BENCHMARK(hasTrait)->Name("TraitsData/hasTrait");
+BENCHMARK(equality)->Name("TraitsData/equality");
+}  // namespace
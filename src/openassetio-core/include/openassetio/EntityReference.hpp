@@ -2,10 +2,17 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/typedefs.hpp>
 
 namespace openassetio {
@@ -31,6 +38,15 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
  * reference. See
  * @fqref{errors.BatchElementError.ErrorCode.kInvalidEntityReference}
  * "kInvalidEntityReference".
+ *
+ * A hash of the string is computed on construction, making hashing
+ * and (unequal) comparisons cheap, so EntityReferences can be used
+ * efficiently as keys of unordered containers.
+ *
+ * The string is either owned by the reference, or shared between all
+ * references constructed from the same interned string. Copying a
+ * reference to a shared string does not allocate. See
+ * @ref EntityReferenceInterner.
  */
 class EntityReference final {
  public:
@@ -38,26 +54,101 @@ class EntityReference final {
    * Constructs an EntityReference around the supplied string.
    */
   explicit EntityReference(Str entityReferenceString)
-      : entityReferenceString_(std::move(entityReferenceString)) {}
+      : hash_{hashOf(entityReferenceString)}, storage_{std::move(entityReferenceString)} {}
+
+  /**
+   * Constructs an EntityReference sharing the supplied string.
+   *
+   * Copies of the resulting reference share the same string, rather
+   * than copying it.
+   *
+   * @param entityReferenceString Non-null shared string.
+   *
+   * @throws errors.InputValidationException if the string is null.
+   */
+  explicit EntityReference(std::shared_ptr<const Str> entityReferenceString)
+      : hash_{hashOf(checkedString(entityReferenceString))},
+        storage_{std::move(entityReferenceString)} {}
+
+  EntityReference(const EntityReference&) = default;
+  EntityReference& operator=(const EntityReference&) = default;
+
+  /**
+   * Move constructor.
+   *
+   * The moved-from reference is left holding an empty string, with a
+   * consistent hash.
+   */
+  EntityReference(EntityReference&& other) noexcept
+      : hash_{std::exchange(other.hash_, hashOf({}))},
+        storage_{std::exchange(other.storage_, Str{})} {}
+
+  /**
+   * Move assignment operator.
+   *
+   * The moved-from reference is left holding an empty string, with a
+   * consistent hash.
+   */
+  EntityReference& operator=(EntityReference&& other) noexcept {
+    hash_ = std::exchange(other.hash_, hashOf({}));
+    storage_ = std::exchange(other.storage_, Str{});
+    return *this;
+  }
+
+  ~EntityReference() = default;
 
   /**
    * Compare the contents of this reference with another for equality.
    *
+   * The precomputed hashes are compared first, so the strings are only
+   * compared if the references are likely to be equal.
+   *
    * @param other Entity refernce to compare against.
    *
    * @return `true` if contents are equal, `false` otherwise.
    */
   bool operator==(const EntityReference& other) const {
-    return other.entityReferenceString_ == entityReferenceString_;
+    if (hash_ != other.hash_) {
+      return false;
+    }
+    const Str& string = toString();
+    const Str& otherString = other.toString();
+    return &string == &otherString || string == otherString;
   }
 
   /**
    * @return The string representation of this entity reference.
    */
-  [[nodiscard]] const Str& toString() const { return entityReferenceString_; }
+  [[nodiscard]] const Str& toString() const {
+    if (const auto* sharedString = std::get_if<SharedStr>(&storage_)) {
+      return **sharedString;
+    }
+    return std::get<Str>(storage_);
+  }
+
+  /**
+   * @return Hash of the string representation of this entity
+   * reference, as computed on construction.
+   */
+  [[nodiscard]] std::size_t hash() const { return hash_; }
 
  private:
-  Str entityReferenceString_;
+  using SharedStr = std::shared_ptr<const Str>;
+
+  static const Str& checkedString(const SharedStr& entityReferenceString) {
+    if (!entityReferenceString) {
+      throw errors::InputValidationException{
+          "Cannot construct an EntityReference from a null string"};
+    }
+    return *entityReferenceString;
+  }
+
+  static std::size_t hashOf(std::string_view entityReferenceString) {
+    return std::hash<std::string_view>{}(entityReferenceString);
+  }
+
+  std::size_t hash_;
+  std::variant<Str, SharedStr> storage_;
 };
 
 static_assert(std::is_move_constructible_v<EntityReference>);
@@ -67,3 +158,16 @@ static_assert(std::is_move_assignable_v<EntityReference>);
 using EntityReferences = std::vector<EntityReference>;
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
+
+/**
+ * Specialisation of `std::hash` for EntityReference, using the hash
+ * precomputed on construction.
+ */
+namespace std {
+template <>
+struct hash<openassetio::EntityReference> {
+  std::size_t operator()(const openassetio::EntityReference& entityReference) const noexcept {
+    return entityReference.hash();
+  }
+};
+}  // namespace std
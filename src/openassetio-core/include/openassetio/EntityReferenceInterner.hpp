@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+
+OPENASSETIO_DECLARE_PTR(EntityReferenceInterner)
+
+/**
+ * Pool of entity reference strings, shared between the
+ * @ref EntityReference "EntityReferences" constructed from them.
+ *
+ * References created from the same string share a single heap
+ * allocation, and copying them does not allocate. This reduces memory
+ * and allocations for large batches of references, especially those
+ * containing duplicates, or that are copied, e.g. when passed across
+ * the Python boundary or split for parallel dispatch.
+ *
+ * Strings remain in the pool until @ref clear is called, or the pool
+ * is destroyed. References hold ownership of their strings, so remain
+ * valid regardless.
+ *
+ * An interner can be passed to
+ * @fqref{hostApi.Manager.createEntityReferences}
+ * "createEntityReferences", so that the resulting references are
+ * interned.
+ *
+ * All methods are safe to call concurrently.
+ */
+class OPENASSETIO_CORE_EXPORT EntityReferenceInterner final {
+ public:
+  OPENASSETIO_ALIAS_PTR(EntityReferenceInterner)
+
+  /// Construct an empty pool.
+  [[nodiscard]] static EntityReferenceInternerPtr make();
+
+  /**
+   * Construct an EntityReference sharing the pooled copy of the given
+   * string, adding it to the pool if not already present.
+   *
+   * @warning As with the EntityReference constructor, the string is
+   * not validated.
+   */
+  [[nodiscard]] EntityReference intern(Str entityReferenceString);
+
+  /// Number of distinct strings in the pool.
+  [[nodiscard]] std::size_t size() const;
+
+  /// Remove all strings from the pool.
+  void clear();
+
+ private:
+  EntityReferenceInterner();
+
+  mutable std::mutex mutex_;
+  /// Pooled strings, keyed on views of themselves.
+  std::unordered_map<std::string_view, std::shared_ptr<const Str>> strings_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
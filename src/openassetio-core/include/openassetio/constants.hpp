@@ -44,6 +44,33 @@ inline constexpr std::string_view kInfoKey_Icon = "icon";
 inline constexpr std::string_view kInfoKey_EntityReferencesMatchPrefix =
     "entityReferencesMatchPrefix";
 
+/**
+ * Whitespace-separated list of prefixes, any of which may begin an
+ * entity reference of a particular manager.
+ *
+ * As for @ref kInfoKey_EntityReferencesMatchPrefix, but for managers
+ * whose entity references take one of several forms. If both are
+ * provided, all prefixes are used.
+ */
+inline constexpr std::string_view kInfoKey_EntityReferencesMatchPrefixes =
+    "entityReferencesMatchPrefixes";
+
+// Threading
+
+/**
+ * Whether the manager's batch methods may be called concurrently.
+ *
+ * If present and `true`, the manager declares that its resolve,
+ * entityExists and entityTraits implementations are safe to call from
+ * multiple threads at the same time, including with different subsets
+ * of the same batch. This allows the API to split large batches across
+ * threads where the host has opted in to parallel dispatch.
+ *
+ * @see @fqref{hostApi.Manager.enableParallelDispatch}
+ * "Manager.enableParallelDispatch"
+ */
+inline constexpr std::string_view kInfoKey_IsThreadSafe = "isThreadSafe";
+
 /// @}
 }  // namespace constants
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(trait, TraitsData)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Handle to the results of an asynchronous batch request, as returned
+ * by the `...Async` methods of @ref Manager.
+ *
+ * The request runs on a background thread. Results for individual
+ * elements become available as the manager produces them, and can be
+ * polled with @ref isElementReady and @ref numCompleted, or waited on
+ * with @ref element. The batch as a whole can be waited on with @ref
+ * wait, @ref waitFor or @ref get, or via the `std::shared_future`
+ * returned by @ref completion, for integration with other
+ * future-based code.
+ *
+ * If the manager does not provide a result for an element, then that
+ * element holds a default-constructed BatchElementError, as per the
+ * equivalent @fqref{hostApi.Manager.BatchElementErrorPolicyTag.kVariant}
+ * "kVariant" overloads.
+ *
+ * A request can be abandoned using @ref cancel. If the manager has not
+ * yet been called, then it never will be. Otherwise, any results
+ * produced after cancellation are discarded. In either case, all
+ * elements not yet complete immediately complete with an
+ * @ref errors.BatchElementError.ErrorCode.kUnknown "kUnknown"
+ * BatchElementError.
+ *
+ * Handles are cheap to copy, with copies referring to the same
+ * request. All methods are safe to call concurrently.
+ *
+ * @tparam Value Type of a successful result for a single element.
+ */
+template <class Value>
+class OPENASSETIO_CORE_EXPORT BatchFuture {
+ public:
+  /// Result of a single element of the batch.
+  using ElementResult = std::variant<errors::BatchElementError, Value>;
+  /// Results for all elements of the batch.
+  using Results = std::vector<ElementResult>;
+
+  /// Message of the BatchElementError given to cancelled elements.
+  static constexpr std::string_view kCancelledMessage = "Request was cancelled.";
+
+  /// Shared state between the handle and the background request.
+  class State;
+  using StatePtr = std::shared_ptr<State>;
+
+  /**
+   * Construct a handle to the given request state.
+   *
+   * Not intended to be called directly by hosts.
+   */
+  explicit BatchFuture(StatePtr state);
+
+  /// Number of elements in the batch.
+  [[nodiscard]] std::size_t size() const;
+
+  /// Number of elements with a result available.
+  [[nodiscard]] std::size_t numCompleted() const;
+
+  /// Whether the result for the element at the given index is available.
+  [[nodiscard]] bool isElementReady(std::size_t index) const;
+
+  /// Whether the request has completed, failed, or been cancelled.
+  [[nodiscard]] bool isReady() const;
+
+  /// Block until the request has completed, failed or been cancelled.
+  void wait() const;
+
+  /**
+   * Block until the request has completed, failed or been cancelled,
+   * or until the timeout expires.
+   *
+   * @return Whether the request is ready.
+   */
+  [[nodiscard]] bool waitFor(std::chrono::nanoseconds timeout) const;
+
+  /**
+   * Block until the result for the element at the given index is
+   * available, then return it.
+   *
+   * @throws errors.InputValidationException If the index is out of
+   * range.
+   *
+   * @throws Any exception thrown by the manager, if the request failed
+   * before this element completed.
+   */
+  [[nodiscard]] ElementResult element(std::size_t index) const;
+
+  /**
+   * Block until the request is ready, then return the results for all
+   * elements.
+   *
+   * @throws Any exception thrown by the manager whilst processing the
+   * request.
+   */
+  [[nodiscard]] const Results& get() const&;
+
+  /**
+   * Overload of @ref get for temporary handles, returning a copy of
+   * the results, so that they outlive the handle.
+   */
+  [[nodiscard]] Results get() &&;
+
+  /**
+   * Future that becomes ready when the request is ready.
+   *
+   * The future holds no value. Use @ref get to retrieve results, or
+   * any exception thrown by the manager.
+   */
+  [[nodiscard]] std::shared_future<void> completion() const;
+
+  /**
+   * Abandon the request, completing any outstanding elements with a
+   * cancellation error.
+   *
+   * Has no effect if the request is already ready.
+   */
+  void cancel();
+
+  /// Whether @ref cancel was called before the request was ready.
+  [[nodiscard]] bool isCancelled() const;
+
+ private:
+  StatePtr state_;
+};
+
+extern template class OPENASSETIO_CORE_EXPORT BatchFuture<bool>;
+extern template class OPENASSETIO_CORE_EXPORT BatchFuture<EntityReference>;
+extern template class OPENASSETIO_CORE_EXPORT BatchFuture<EntityReferencePagerPtr>;
+extern template class OPENASSETIO_CORE_EXPORT BatchFuture<trait::TraitsDataPtr>;
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
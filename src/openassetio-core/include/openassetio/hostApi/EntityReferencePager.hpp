@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/typedefs.hpp>
 
@@ -36,12 +41,44 @@ OPENASSETIO_DECLARE_PTR(EntityReferencePager)
  * Destruction of this object is a signal to the manager that the
  * connection query is finished. For this reason you should avoid
  * keeping hold of this object for longer than necessary.
+ *
+ * By default, each call is a blocking round-trip to the manager.
+ * Hosts walking many pages can opt in to read-ahead using
+ * @ref enablePrefetch, such that subsequent pages are fetched on a
+ * background thread whilst the host consumes the current page.
+ * All remaining pages can be retrieved in a single call using
+ * @ref drainAll.
  */
 class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
  public:
   OPENASSETIO_ALIAS_PTR(EntityReferencePager)
   using Page = EntityReferences;
 
+  /// Default number of pages fetched ahead of the current page.
+  static constexpr std::size_t kDefaultPrefetchDepth = 2;
+
+  /**
+   * Function wrapping the wait for a prefetching background thread to
+   * exit, given the wait to perform.
+   *
+   * @see setJoinHook
+   */
+  using JoinHook = std::function<void(const std::function<void()>& join)>;
+
+  /**
+   * Set the function used to wait for prefetching background threads
+   * to exit on destruction.
+   *
+   * This allows language bindings to release resources required by
+   * the background thread whilst waiting, regardless of which object
+   * releases the last reference to the pager. The Python bindings
+   * install a hook that releases the GIL, if held.
+   *
+   * @param hook Hook to use, or an empty function to wait directly,
+   * which is the default.
+   */
+  static void setJoinHook(JoinHook hook);
+
   /**
    * Constructs a new EntityReferencePager wrapping a @ref manager
    * plugin's implementation.
@@ -81,6 +118,11 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
 
   /**
    *  Destruction of this object is tantamount to closing the query.
+   *
+   *  If prefetching is enabled, the background thread is stopped and
+   *  joined first, blocking until its current call to the manager (if
+   *  any) completes. The wait is wrapped by any hook set using
+   *  @ref setJoinHook.
    */
   ~EntityReferencePager();
 
@@ -111,12 +153,59 @@ class OPENASSETIO_CORE_EXPORT EntityReferencePager final {
    */
   void next();
 
+  /**
+   * Retrieve the current page and all subsequent pages, concatenated
+   * into a single list.
+   *
+   * Afterwards, the pager is advanced beyond the last page, such that
+   * @ref get returns an empty page and @ref hasNext returns `false`.
+   *
+   * Pages are moved, rather than copied, into the result.
+   *
+   * @param sizeHint Expected total number of entity references, used
+   * to preallocate the result. Zero if unknown.
+   *
+   * @return All remaining entity references.
+   */
+  Page drainAll(std::size_t sizeHint = 0);
+
+  /**
+   * Opt in to fetching pages ahead of the current page, on a
+   * background thread.
+   *
+   * Once enabled, all calls to the underlying pager are made from the
+   * background thread. The current page and up to `depth` subsequent
+   * pages are buffered, so that @ref get, @ref hasNext and @ref next
+   * only block if the manager has not yet produced the required page.
+   *
+   * Any exception thrown by the manager is rethrown by the call that
+   * requires the page that failed to be fetched.
+   *
+   * Prefetching cannot be disabled once enabled.
+   *
+   * @param depth Maximum number of pages to fetch ahead of the
+   * current page.
+   *
+   * @throws errors.InputValidationException If `depth` is zero, or
+   * prefetching is already enabled.
+   */
+  void enablePrefetch(std::size_t depth = kDefaultPrefetchDepth);
+
+  /**
+   * @return Whether @ref enablePrefetch has been called.
+   */
+  [[nodiscard]] bool isPrefetchEnabled() const;
+
  private:
   EntityReferencePager(managerApi::EntityReferencePagerInterfacePtr pagerInterface,
                        managerApi::HostSessionPtr hostSession);
 
+  /// Pages buffered by the background thread, when prefetching.
+  class PrefetchState;
+
   managerApi::EntityReferencePagerInterfacePtr pagerInterface_;
   managerApi::HostSessionPtr hostSession_;
+  std::shared_ptr<PrefetchState> prefetchState_;
 };
 static_assert(!std::is_default_constructible_v<EntityReferencePager>);
 static_assert(!std::is_copy_constructible_v<EntityReferencePager>);
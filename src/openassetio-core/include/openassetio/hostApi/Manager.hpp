@@ -2,10 +2,13 @@
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -14,7 +17,10 @@
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
 #include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/BatchFuture.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/hostApi/ResolveStream.hpp>
+#include <openassetio/hostApi/ResolvedBatch.hpp>
 #include <openassetio/internal.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
@@ -22,6 +28,15 @@
 OPENASSETIO_FWD_DECLARE(managerApi, ManagerInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, HostSession)
 OPENASSETIO_FWD_DECLARE(Context)
+OPENASSETIO_FWD_DECLARE(EntityReferenceInterner)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+class PrefixMatcher;
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -59,7 +74,7 @@ OPENASSETIO_DECLARE_PTR(Manager)
  * The Manager API is threadsafe and can be called from multiple
  * threads concurrently.
  */
-class OPENASSETIO_CORE_EXPORT Manager final {
+class OPENASSETIO_CORE_EXPORT Manager final : public std::enable_shared_from_this<Manager> {
  public:
   OPENASSETIO_ALIAS_PTR(Manager)
 
@@ -332,6 +347,72 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   void flushCaches();
 
+  /**
+   * @}
+   */
+
+  /**
+   * @name Parallel dispatch
+   *
+   * By default, batch methods pass the whole batch to the manager in a
+   * single call on the calling thread. Hosts can opt in to splitting
+   * large batches into shards that are passed to the manager
+   * concurrently, using a shared pool of worker threads.
+   *
+   * Parallel dispatch only takes effect for managers that declare
+   * themselves thread-safe, by setting the
+   * @fqref{constants.kInfoKey_IsThreadSafe} "kInfoKey_IsThreadSafe"
+   * key in their @ref info dictionary to `true`. This is checked
+   * during @ref initialize.
+   *
+   * Only @ref resolve, @ref entityExists and @ref entityTraits are
+   * dispatched in parallel. Other batch methods may have
+   * batch-level semantics, so are always dispatched as a whole.
+   *
+   * When dispatched in parallel, callbacks are still called on the
+   * calling thread, and with the index of the element in the original
+   * batch. However, the order in which elements are reported is
+   * unspecified. Should a callback or the manager throw, no further
+   * shards are started, and the exception is rethrown once all
+   * in-progress shards are complete.
+   *
+   * @{
+   */
+
+  /// Default minimum number of elements in each shard.
+  static constexpr std::size_t kDefaultMinShardSize = 1024;
+
+  /**
+   * Opt in to parallel dispatch of large batches.
+   *
+   * A batch is split into as many shards as possible, up to
+   * `maxShards`, such that each shard has at least `minShardSize`
+   * elements. Batches too small to split are dispatched as usual.
+   *
+   * @param maxShards Maximum number of shards to split a batch into.
+   * Zero means one per available hardware thread.
+   *
+   * @param minShardSize Minimum number of elements in each shard.
+   *
+   * @throws errors.InputValidationException If `minShardSize` is zero.
+   */
+  void enableParallelDispatch(std::size_t maxShards = 0,
+                              std::size_t minShardSize = kDefaultMinShardSize);
+
+  /**
+   * Opt out of parallel dispatch, such that all batches are passed to
+   * the manager whole, on the calling thread.
+   */
+  void disableParallelDispatch();
+
+  /**
+   * Whether parallel dispatch has been opted in to by the host.
+   *
+   * Note that batches are only dispatched in parallel if the manager
+   * also declares itself thread-safe.
+   */
+  [[nodiscard]] bool isParallelDispatchEnabled() const;
+
   /**
    * @}
    */
@@ -634,6 +715,19 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    * @{
    */
 
+  /**
+   * Type to use in place of bool in `vector<bool>` so that the "dynamic
+   * bitset" specialisation of std::vector is not used.
+   *
+   * `std::vector<bool>` is a specialisation that uses a single bit per
+   * element, which is more memory efficient but limits the use of
+   * the vector for certain operations.
+   *
+   * As a workaround, we can use an integral type as the vector element,
+   * such that zero represents false and non-zero represents true.
+   */
+  using BoolAsUint = std::uint_fast8_t;
+
   /**
    * @warning It is essential, as a host, that only valid references are
    * supplied to Manager API calls. Before any reference is passed to
@@ -675,6 +769,34 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   [[nodiscard]] bool isEntityReferenceString(const Str& someString);
 
+  /**
+   * Determine which of a batch of strings are @ref entity_reference
+   * "entity references" for this manager.
+   *
+   * Equivalent to calling @ref isEntityReferenceString for each string,
+   * but substantially cheaper for large batches where the manager
+   * advertises its entity reference prefixes, via
+   * @fqref{constants.kInfoKey_EntityReferencesMatchPrefix}
+   * "kInfoKey_EntityReferencesMatchPrefix" and/or
+   * @fqref{constants.kInfoKey_EntityReferencesMatchPrefixes}
+   * "kInfoKey_EntityReferencesMatchPrefixes". In that case the strings
+   * are matched in bulk against a matcher built at @ref initialize,
+   * without copying them or calling the manager.
+   *
+   * Otherwise, the manager's
+   * @fqref{managerApi.ManagerInterface.areEntityReferenceStrings}
+   * "areEntityReferenceStrings" implementation is called once for the
+   * whole batch.
+   *
+   * @param someStrings Strings to be inspected. Views need only remain
+   * valid for the duration of the call.
+   *
+   * @return One element per input string, non-zero if that string
+   * should be considered an entity reference.
+   */
+  [[nodiscard]] std::vector<BoolAsUint> areEntityReferenceStrings(
+      const std::vector<std::string_view>& someStrings);
+
   /**
    * Create an @ref EntityReference object wrapping a given
    * @ref entity_reference string.
@@ -713,6 +835,56 @@ class OPENASSETIO_CORE_EXPORT Manager final {
   [[nodiscard]] std::optional<EntityReference> createEntityReferenceIfValid(
       Str entityReferenceString);
 
+  /**
+   * Create @ref EntityReference objects wrapping a batch of
+   * @ref entity_reference strings, discarding any that are not valid
+   * according to @ref areEntityReferenceStrings.
+   *
+   * Strings are validated together, so at most one call is made to
+   * the manager, however large the batch. Valid strings are moved
+   * into the returned references, so no string data is copied.
+   *
+   * @param entityReferenceStrings Raw string representations of the
+   * entity references. Taken by value to enable move semantics.
+   *
+   * @param errorCallback Callback called with the index (in
+   * `entityReferenceStrings`) of each invalid string, along with a
+   * @ref errors.BatchElementError.ErrorCode.kInvalidEntityReference
+   * "kInvalidEntityReference" error.
+   *
+   * @return Validated entity reference objects, in the same order as
+   * the input strings, omitting invalid strings.
+   *
+   * @see @ref createEntityReference
+   */
+  [[nodiscard]] EntityReferences createEntityReferences(
+      std::vector<Str> entityReferenceStrings, const BatchElementErrorCallback& errorCallback);
+
+  /**
+   * Create @ref EntityReference objects wrapping a batch of
+   * @ref entity_reference strings, sharing string storage via the
+   * given interner.
+   *
+   * As the other overload, except that valid strings are interned,
+   * so that duplicates share a single allocation, and copying the
+   * resulting references does not allocate.
+   *
+   * @param entityReferenceStrings Raw string representations of the
+   * entity references.
+   *
+   * @param errorCallback Callback called with the index of each
+   * invalid string.
+   *
+   * @param interner Pool of strings to share. If null, strings are
+   * owned by each reference, as per the other overload.
+   *
+   * @return Validated entity reference objects, in the same order as
+   * the input strings, omitting invalid strings.
+   */
+  [[nodiscard]] EntityReferences createEntityReferences(
+      std::vector<Str> entityReferenceStrings, const BatchElementErrorCallback& errorCallback,
+      const EntityReferenceInternerPtr& interner);
+
   /**
    * Callback signature used for a successful entity existence query.
    */
@@ -852,19 +1024,6 @@ class OPENASSETIO_CORE_EXPORT Manager final {
       const EntityReference& entityReference, const ContextConstPtr& context,
       const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
 
-  /**
-   * Type to use in place of bool in `vector<bool>` so that the "dynamic
-   * bitset" specialisation of std::vector is not used.
-   *
-   * `std::vector<bool>` is a specialisation that uses a single bit per
-   * element, which is more memory efficient but limits the use of
-   * the vector for certain operations.
-   *
-   * As a workaround, we can use an integral type as the vector element,
-   * such that zero represents false and non-zero represents true.
-   */
-  using BoolAsUint = std::uint_fast8_t;
-
   /**
    * Determines if each supplied @ref entity_reference points to an
    * entity that exists in the @ref asset_management_system.
@@ -1473,6 +1632,54 @@ class OPENASSETIO_CORE_EXPORT Manager final {
       access::ResolveAccess resolveAccess, const ContextConstPtr& context,
       const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
 
+  /**
+   * Resolve specific properties for a batch of entities into columnar
+   * storage.
+   *
+   * Rather than a @fqref{trait.TraitsData} "TraitsData" per entity,
+   * the result holds a contiguous column of values per requested
+   * property. This avoids the per-entity overhead of the other
+   * `resolve` overloads when only a few properties are needed for a
+   * large number of entities.
+   *
+   * The set of traits to resolve is the set of traits referenced by
+   * the column specifications.
+   *
+   * Errors specific to an entity are recorded in the result against
+   * that entity's index, see @ref ResolvedBatch.error. Errors that are
+   * not specific to an entity will be thrown as an exception, failing
+   * the whole batch.
+   *
+   * See documentation for the <!--
+   * --> @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   * "callback variation" for more details on resolution behaviour.
+   *
+   * @param entityReferences Entity references to query.
+   *
+   * @param columnSpecs The trait properties to extract, and their
+   * expected types, one per column of the result.
+   *
+   * @param resolveAccess The intended usage of the data.
+   *
+   * @param context The calling context.
+   *
+   * @return Columnar results, with a row per entity reference.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kResolution.
+   *
+   * @see @ref Capability.kResolution
+   */
+  ResolvedBatch resolveColumns(const EntityReferences& entityReferences,
+                               ResolvedBatch::ColumnSpecs columnSpecs,
+                               access::ResolveAccess resolveAccess,
+                               const ContextConstPtr& context);
+
   /**
    * Callback signature used for a successful default entity reference query.
    */
@@ -2117,6 +2324,195 @@ class OPENASSETIO_CORE_EXPORT Manager final {
                        const trait::TraitSet& resultTraitSet,
                        const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
 
+  /**
+   * Query for entity references that are related to each of the input
+   * references by each of the relationships defined by sets of traits
+   * and their properties.
+   *
+   * This is the cross product of @ref getWithRelationship and
+   * @ref getWithRelationships, such that, for example, a dependency
+   * graph builder can query several relationships for many entities
+   * in a single call, rather than one call per entity. Managers may
+   * service the whole query at once, otherwise at most
+   * `min(entityReferences.size(), relationshipTraitsDatas.size())`
+   * calls are made to the manager.
+   *
+   * Results are identified by a flattened, row-major index: the result
+   * for the entity at index `i` in @p entityReferences and the
+   * relationship at index `j` in @p relationshipTraitsDatas has index
+   * `i * relationshipTraitsDatas.size() + j`. That is, the results
+   * form an edge list, grouped by entity.
+   *
+   * See documentation for the <!--
+   * --> @ref getWithRelationship(const EntityReferences&, <!--
+   * --> const trait::TraitsDataPtr&, size_t, <!--
+   * --> access::RelationsAccess, const ContextConstPtr&, <!--
+   * --> const RelationshipQuerySuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback, <!--
+   * --> const trait::TraitSet&)
+   * "callback variation" of getWithRelationship for more details on
+   * relationship behaviour.
+   *
+   * @param entityReferences The @ref entity_reference "entity
+   * references" to query the specified relationships for.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * query.
+   *
+   * @param pageSize The size of each page of data. Must be greater
+   * than zero.
+   *
+   * @param relationsAccess The intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param successCallback Callback that will be called for each
+   * successful relationship query, with the flattened index of the
+   * query and a pager over the related entities. The callback will be
+   * called on the same thread that initiated the call.
+   *
+   * @param errorCallback Callback that will be called for each failed
+   * relationship query, with the flattened index of the query and a
+   * populated BatchElementError. The callback will be called on the
+   * same thread that initiated the call.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have.
+   *
+   * @throws errors.InputValidationException if @p pageSize is zero.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager. Check that this method is
+   * implemented before use by calling @ref hasCapability with @ref
+   * Capability.kRelationshipQueries.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  size_t pageSize, access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback,
+                                  const trait::TraitSet& resultTraitSet = {});
+
+  /**
+   * Query for entity references that are related to each of the input
+   * references by each of the relationships defined by sets of traits
+   * and their properties.
+   *
+   * See documentation for the <!--
+   * --> @ref getWithRelationshipsMatrix(const EntityReferences&, <!--
+   * --> const trait::TraitsDatas&, size_t, <!--
+   * --> access::RelationsAccess, const ContextConstPtr&, <!--
+   * --> const RelationshipQuerySuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback, <!--
+   * --> const trait::TraitSet&)
+   * "callback variation" for more details.
+   *
+   * Any errors that occur during the query will be immediately thrown
+   * as an exception, either from the @ref manager plugin (for errors
+   * not specific to the entity relationship) or as a
+   * @fqref{errors.BatchElementException}
+   * "BatchElementException"-derived error, whose index is the
+   * flattened index of the failed query.
+   *
+   * @param entityReferences The @ref entity_reference "entity
+   * references" to query the specified relationships for.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * query.
+   *
+   * @param pageSize The size of each page of data. Must be greater
+   * than zero.
+   *
+   * @param relationsAccess The intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have.
+   *
+   * @param errorPolicyTag  Parameter for selecting the appropriate
+   * overload (tagged dispatch idiom). See @ref
+   * BatchElementErrorPolicyTag::Exception.
+   *
+   * @return Row-major grid of @ref EntityReferencePager pointers,
+   * flattened into a list, with one row per entity reference and one
+   * column per relationship.
+   *
+   * @throws errors.InputValidationException if @p pageSize is zero.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  std::vector<EntityReferencePagerPtr> getWithRelationshipsMatrix(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+      size_t pageSize, access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+      const trait::TraitSet& resultTraitSet,
+      const BatchElementErrorPolicyTag::Exception& errorPolicyTag = {});
+
+  /**
+   * Query for entity references that are related to each of the input
+   * references by each of the relationships defined by sets of traits
+   * and their properties.
+   *
+   * See documentation for the <!--
+   * --> @ref getWithRelationshipsMatrix(const EntityReferences&, <!--
+   * --> const trait::TraitsDatas&, size_t, <!--
+   * --> access::RelationsAccess, const ContextConstPtr&, <!--
+   * --> const RelationshipQuerySuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback, <!--
+   * --> const trait::TraitSet&)
+   * "callback variation" for more details.
+   *
+   * Errors that are not specific to an entity relationship will be
+   * thrown as an exception, failing the whole batch.
+   *
+   * @param entityReferences The @ref entity_reference "entity
+   * references" to query the specified relationships for.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * query.
+   *
+   * @param pageSize The size of each page of data. Must be greater
+   * than zero.
+   *
+   * @param relationsAccess The intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have.
+   *
+   * @param errorPolicyTag  Parameter for selecting the appropriate
+   * overload (tagged dispatch idiom). See @ref
+   * BatchElementErrorPolicyTag::Variant.
+   *
+   * @return Row-major grid, flattened into a list, with one row per
+   * entity reference and one column per relationship. Each element
+   * contains either an EntityReferencePager pointer or an error.
+   *
+   * @throws errors.InputValidationException if @p pageSize is zero.
+   *
+   * @throws errors.NotImplementedException Thrown when this method is
+   * not implemented by the manager.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  std::vector<std::variant<errors::BatchElementError, EntityReferencePagerPtr>>
+  getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                             const trait::TraitsDatas& relationshipTraitsDatas, size_t pageSize,
+                             access::RelationsAccess relationsAccess,
+                             const ContextConstPtr& context,
+                             const trait::TraitSet& resultTraitSet,
+                             const BatchElementErrorPolicyTag::Variant& errorPolicyTag);
+
   /// @}
 
   /**
@@ -2844,14 +3240,171 @@ class OPENASSETIO_CORE_EXPORT Manager final {
 
   /// @}
 
+  /**
+   * @name Asynchronous requests
+   *
+   * Non-blocking variants of batch methods, allowing a host to have
+   * several requests in flight at once, without managing its own
+   * worker threads.
+   *
+   * Each method starts the request on a background thread, and
+   * immediately returns a @ref BatchFuture handle, through which
+   * results can be retrieved as they become available.
+   *
+   * Arguments are copied, so need not outlive the call. However,
+   * objects held by pointer (the Context and any TraitsData) are
+   * shared with the request, so must not be modified until the
+   * request is ready.
+   *
+   * Any exception, including those due to invalid arguments, is
+   * captured and rethrown from @ref BatchFuture.get.
+   *
+   * Cancelling a request causes the manager's call to be interrupted
+   * the next time it reports a result, by throwing from the callback.
+   *
+   * See the corresponding callback-based methods for details of each
+   * query.
+   *
+   * @{
+   */
+
+  /// Handle to an in-flight @ref resolveAsync request.
+  using ResolveFuture = BatchFuture<trait::TraitsDataPtr>;
+  /// Handle to an in-flight @ref entityExistsAsync request.
+  using EntityExistsFuture = BatchFuture<bool>;
+  /// Handle to an in-flight @ref preflightAsync or @ref registerAsync request.
+  using PublishFuture = BatchFuture<EntityReference>;
+  /// Handle to an in-flight @ref getWithRelationshipAsync request.
+  using RelationshipQueryFuture = BatchFuture<EntityReferencePagerPtr>;
+
+  /**
+   * Asynchronously resolve a batch of entity references.
+   *
+   * @see @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   */
+  [[nodiscard]] ResolveFuture resolveAsync(EntityReferences entityReferences,
+                                           trait::TraitSet traitSet,
+                                           access::ResolveAccess resolveAccess,
+                                           ContextConstPtr context);
+
+  /**
+   * Resolve a batch of entity references, streaming the results.
+   *
+   * Unlike @ref resolveAsync, results are not retained once consumed
+   * by the host. The manager is blocked whilst `maxQueueSize` results
+   * are waiting to be consumed, so memory use does not grow with the
+   * size of the batch.
+   *
+   * @param maxQueueSize Maximum number of results queued ahead of the
+   * host.
+   *
+   * @throws errors.InputValidationException If `maxQueueSize` is zero.
+   *
+   * @see @ref ResolveStream
+   * @see @ref resolve(const EntityReferences&, <!--
+   * --> const trait::TraitSet&, access::ResolveAccess, <!--
+   * --> const ContextConstPtr&, const ResolveSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback& errorCallback)
+   */
+  [[nodiscard]] ResolveStreamPtr resolveStream(
+      EntityReferences entityReferences, trait::TraitSet traitSet,
+      access::ResolveAccess resolveAccess, ContextConstPtr context,
+      std::size_t maxQueueSize = ResolveStream::kDefaultMaxQueueSize);
+
+  /**
+   * Asynchronously query the existence of a batch of entities.
+   *
+   * @see @ref entityExists(const EntityReferences&, <!--
+   * --> const ContextConstPtr&, const ExistsSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&)
+   */
+  [[nodiscard]] EntityExistsFuture entityExistsAsync(EntityReferences entityReferences,
+                                                     ContextConstPtr context);
+
+  /**
+   * Asynchronously query the relations of a batch of entities.
+   *
+   * @see @ref getWithRelationship(const EntityReferences&, <!--
+   * --> const trait::TraitsDataPtr&, size_t, access::RelationsAccess, <!--
+   * --> const ContextConstPtr&, const RelationshipQuerySuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&, const trait::TraitSet&)
+   */
+  [[nodiscard]] RelationshipQueryFuture getWithRelationshipAsync(
+      EntityReferences entityReferences, trait::TraitsDataPtr relationshipTraitsData,
+      size_t pageSize, access::RelationsAccess relationsAccess, ContextConstPtr context,
+      trait::TraitSet resultTraitSet = {});
+
+  /**
+   * Asynchronously preflight a batch of entities for publishing.
+   *
+   * @see @ref preflight(const EntityReferences&, <!--
+   * --> const trait::TraitsDatas&, access::PublishingAccess, <!--
+   * --> const ContextConstPtr&, const PreflightSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&)
+   */
+  [[nodiscard]] PublishFuture preflightAsync(EntityReferences entityReferences,
+                                             trait::TraitsDatas traitsHints,
+                                             access::PublishingAccess publishingAccess,
+                                             ContextConstPtr context);
+
+  /**
+   * Asynchronously register a batch of entities.
+   *
+   * @see @ref register_(const EntityReferences&, <!--
+   * --> const trait::TraitsDatas&, access::PublishingAccess, <!--
+   * --> const ContextConstPtr&, const RegisterSuccessCallback&, <!--
+   * --> const BatchElementErrorCallback&)
+   */
+  [[nodiscard]] PublishFuture registerAsync(EntityReferences entityReferences,
+                                            trait::TraitsDatas entityTraitsDatas,
+                                            access::PublishingAccess publishingAccess,
+                                            ContextConstPtr context);
+
+  /**
+   * Cancel all asynchronous requests, then wait for the background
+   * threads running them to exit.
+   *
+   * Requests yet to start are cancelled without calling the manager.
+   * Requests in progress are interrupted the next time the manager
+   * reports a result, so this blocks until each in-progress manager
+   * call returns. Requests made after shutdown are immediately
+   * cancelled.
+   *
+   * Background threads are otherwise only joined during static
+   * destruction, which may be too late if a request depends on
+   * resources that are torn down earlier, such as a Python
+   * interpreter. The Python bindings call this automatically at
+   * interpreter exit.
+   *
+   * Has no effect on streams returned by @ref resolveStream, which
+   * are joined on destruction.
+   *
+   * @warning This is a process-wide, irreversible operation.
+   */
+  static void shutdownAsyncRequests();
+
+  /// @}
+
  private:
   explicit Manager(managerApi::ManagerInterfacePtr managerInterface,
                    managerApi::HostSessionPtr hostSession);
 
+  /// Number of shards to split a batch into for parallel dispatch.
+  [[nodiscard]] std::size_t numShardsFor(std::size_t batchSize) const;
+
   managerApi::ManagerInterfacePtr managerInterface_;
   managerApi::HostSessionPtr hostSession_;
 
-  std::optional<openassetio::Str> entityReferencePrefix_;
+  /// Matcher for advertised entity reference prefixes, if any.
+  std::shared_ptr<const utils::PrefixMatcher> entityReferenceMatcher_;
+
+  bool isManagerThreadSafe_{false};
+  /// Maximum shards per batch, or zero if parallel dispatch disabled.
+  std::atomic<std::size_t> parallelMaxShards_{0};
+  std::atomic<std::size_t> parallelMinShardSize_{kDefaultMinShardSize};
 };
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
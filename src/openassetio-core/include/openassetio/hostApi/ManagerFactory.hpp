@@ -129,6 +129,11 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
    * For example, this may be presented as part of a manager picker UI
    * widget.
    *
+   * Managers are only instantiated if their details are not otherwise
+   * known to the manager interface factory. See
+   * @fqref{hostApi.ManagerImplementationFactoryInterface.managerDetail}
+   * "ManagerImplementationFactoryInterface.managerDetail".
+   *
    * @see @ref ManagerDetail
    *
    * @return A @ref ManagerDetail instance for each available @ref
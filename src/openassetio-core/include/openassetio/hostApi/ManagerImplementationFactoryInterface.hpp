@@ -3,9 +3,11 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
@@ -71,6 +73,25 @@ class OPENASSETIO_CORE_EXPORT ManagerImplementationFactoryInterface {
   [[nodiscard]] virtual managerApi::ManagerInterfacePtr instantiate(
       const Identifier& identifier) = 0;
 
+  /**
+   * Details of the manager with the specified identifier, if they
+   * can be determined without instantiating it.
+   *
+   * This allows @fqref{hostApi.ManagerFactory.availableManagers}
+   * "ManagerFactory.availableManagers" to avoid instantiating (and so
+   * loading and executing the code of) every available manager, e.g.
+   * if the details are declared in a plugin manifest.
+   *
+   * The default implementation returns an empty optional, in which
+   * case the manager is instantiated to query its details.
+   *
+   * @param identifier The identifier of the manager to query.
+   *
+   * @return Manager details, if available without instantiation.
+   */
+  [[nodiscard]] virtual std::optional<ManagerFactory::ManagerDetail> managerDetail(
+      const Identifier& identifier);
+
  protected:
   /// Get logger instance.
   [[nodiscard]] const log::LoggerInterfacePtr& logger() const;
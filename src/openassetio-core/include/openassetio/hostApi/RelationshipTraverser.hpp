@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(Context)
+OPENASSETIO_FWD_DECLARE(trait, TraitsData)
+OPENASSETIO_FWD_DECLARE(hostApi, Manager)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+OPENASSETIO_DECLARE_PTR(RelationshipTraverser)
+
+/**
+ * Computes the transitive closure of a relationship, starting from a
+ * set of root entities.
+ *
+ * For example, this can be used to find all the upstream dependencies
+ * of an entity, rather than looping over @ref
+ * Manager.getWithRelationship "getWithRelationship" and
+ * @ref EntityReferencePager by hand.
+ *
+ * The graph is expanded breadth-first, one level at a time. All the
+ * entities at the frontier of the traversal are batched into a single
+ * @ref Manager.getWithRelationship "getWithRelationship" call, such
+ * that a graph of depth `d` costs at most `d` relationship queries,
+ * regardless of the number of entities it contains. Each returned
+ * pager is then drained in full.
+ *
+ * Each entity is visited at most once, so traversal terminates even if
+ * the graph contains cycles. Whether any cycles were encountered is
+ * reported in the resulting @ref Traversal.
+ *
+ * The related entities of each visited entity are memoised, such that
+ * subsequent traversals that overlap previous ones do not query the
+ * manager again for the same entities. Use @ref clearCache to discard
+ * memoised results, e.g. if the relationships may have changed.
+ *
+ * None of the functions of this class should be considered
+ * thread-safe. Hosts should add their own synchronization around
+ * concurrent usage.
+ */
+class OPENASSETIO_CORE_EXPORT RelationshipTraverser final {
+ public:
+  OPENASSETIO_ALIAS_PTR(RelationshipTraverser)
+
+  /// Depth limit that expands the graph until no new entities are found.
+  static constexpr std::size_t kUnlimitedDepth = std::numeric_limits<std::size_t>::max();
+
+  /// Default size of each page requested from the manager.
+  static constexpr std::size_t kDefaultPageSize = 256;
+
+  /// An entity visited during a traversal.
+  struct Node {
+    /// Reference to the entity.
+    EntityReference entityReference;
+    /// Length of the shortest path from a root entity.
+    std::size_t depth;
+  };
+
+  /// A relationship between two visited entities.
+  struct Edge {
+    /// Index of the source entity in @ref Traversal.nodes.
+    std::size_t source;
+    /// Index of the related entity in @ref Traversal.nodes.
+    std::size_t target;
+  };
+
+  /// Result of a traversal.
+  struct Traversal {
+    /**
+     * Visited entities, in breadth-first order.
+     *
+     * The (de-duplicated) root entities come first, with a depth of
+     * zero.
+     */
+    std::vector<Node> nodes;
+    /// Relationships found between visited entities.
+    std::vector<Edge> edges;
+    /**
+     * Errors querying the relationships of visited entities, keyed on
+     * the index of the entity in @ref nodes.
+     *
+     * Entities in error are not expanded further.
+     */
+    std::vector<std::pair<std::size_t, errors::BatchElementError>> errors;
+    /// Whether the visited entities and edges contain a cycle.
+    bool hasCycle{false};
+  };
+
+  /**
+   * Construct a traverser for the given relationship.
+   *
+   * @param manager Manager to query relationships with.
+   *
+   * @param relationshipTraitsData The traits of the relationship to
+   * follow.
+   *
+   * @param relationsAccess The intended usage of the related
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param resultTraitSet A hint as to what traits the related entities
+   * should have.
+   *
+   * @param pageSize The size of each page requested from the manager.
+   * Must be greater than zero.
+   *
+   * @throws errors.InputValidationException if @p pageSize is zero.
+   */
+  [[nodiscard]] static RelationshipTraverserPtr make(
+      ManagerPtr manager, trait::TraitsDataPtr relationshipTraitsData,
+      access::RelationsAccess relationsAccess, ContextConstPtr context,
+      trait::TraitSet resultTraitSet = {}, std::size_t pageSize = kDefaultPageSize);
+
+  /**
+   * Visit all entities reachable from the given root entities.
+   *
+   * @param entityReferences Root entities to start from.
+   *
+   * @param maxDepth Maximum length of path to follow from a root
+   * entity. Entities at this depth are visited, but their
+   * relationships are not queried.
+   *
+   * @return Entities and relationships visited.
+   *
+   * @throws Any exception thrown by the manager that is not specific
+   * to a single entity.
+   */
+  Traversal traverse(const EntityReferences& entityReferences,
+                     std::size_t maxDepth = kUnlimitedDepth);
+
+  /**
+   * Number of relationship queries made to the manager by this
+   * traverser so far.
+   */
+  [[nodiscard]] std::size_t queryCount() const;
+
+  /// Discard memoised relationships.
+  void clearCache();
+
+ private:
+  RelationshipTraverser(ManagerPtr manager, trait::TraitsDataPtr relationshipTraitsData,
+                        access::RelationsAccess relationsAccess, ContextConstPtr context,
+                        trait::TraitSet resultTraitSet, std::size_t pageSize);
+
+  ManagerPtr manager_;
+  trait::TraitsDataPtr relationshipTraitsData_;
+  access::RelationsAccess relationsAccess_;
+  ContextConstPtr context_;
+  trait::TraitSet resultTraitSet_;
+  std::size_t pageSize_;
+  std::size_t queryCount_{0};
+  std::unordered_map<EntityReference, EntityReferences> relatedCache_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
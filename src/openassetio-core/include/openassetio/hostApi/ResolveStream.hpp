@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <variant>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(trait, TraitsData)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+OPENASSETIO_DECLARE_PTR(ResolveStream)
+
+/**
+ * Pull-based stream of the results of a resolve, as returned by
+ * @ref Manager.resolveStream.
+ *
+ * The manager's resolve runs on a dedicated background thread, feeding
+ * a bounded queue that the host consumes using @ref next, or by iterating over
+ * the stream. Results are yielded in the order the manager produces
+ * them, paired with the index of the corresponding entity reference.
+ *
+ * When the queue is full, the manager is blocked until the host
+ * consumes a result. Memory use is therefore bounded by the maximum
+ * queue size, regardless of the size of the batch.
+ *
+ * If the manager does not provide a result for an element, then that
+ * element is yielded last, holding a default-constructed
+ * BatchElementError, as per the equivalent
+ * @fqref{hostApi.Manager.BatchElementErrorPolicyTag.kVariant}
+ * "kVariant" overloads.
+ *
+ * Destroying the stream, or calling @ref cancel, abandons the request.
+ * The manager's call is interrupted the next time it reports a result.
+ * Destruction then waits for the background thread to exit, i.e. for
+ * the manager's call to return.
+ *
+ * If the manager reports a result for an index outside the batch,
+ * an @ref errors.InputValidationException "InputValidationException"
+ * is thrown from @ref next, in place of any further results.
+ *
+ * @note Instances of this class should not be constructed directly by
+ * the host.
+ *
+ * None of the functions of this class should be considered
+ * thread-safe. Hosts should add their own synchronization around
+ * concurrent usage.
+ */
+class OPENASSETIO_CORE_EXPORT ResolveStream final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ResolveStream)
+
+  /// Result of resolving a single entity reference.
+  using ElementResult = std::variant<errors::BatchElementError, trait::TraitsDataPtr>;
+
+  /// Result of resolving a single entity reference, with its index.
+  struct Element {
+    /// Index of the entity reference in the original batch.
+    std::size_t index;
+    /// Resolved traits, or the error resolving the entity reference.
+    ElementResult result;
+  };
+
+  /// Default maximum number of results queued ahead of the host.
+  static constexpr std::size_t kDefaultMaxQueueSize = 1024;
+
+  /// Shared state between the stream and the background request.
+  class State;
+  using StatePtr = std::shared_ptr<State>;
+
+  /**
+   * Input iterator over the remaining results of a stream.
+   *
+   * Advancing the iterator consumes the next result from the stream.
+   */
+  class OPENASSETIO_CORE_EXPORT Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Element;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Element*;
+    using reference = const Element&;
+
+    /// Construct an end iterator.
+    Iterator() = default;
+    /// Construct an iterator at the next result of the given stream.
+    explicit Iterator(ResolveStream* stream);
+
+    reference operator*() const { return *current_; }
+    pointer operator->() const { return &*current_; }
+    Iterator& operator++();
+
+    /// Iterators are equal only if both are at the end of a stream.
+    bool operator==(const Iterator& other) const { return !current_ && !other.current_; }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+   private:
+    ResolveStream* stream_{nullptr};
+    std::optional<Element> current_;
+  };
+
+  /**
+   * Construct a stream fed by the given request state.
+   *
+   * @note Instances of this class should not be constructed directly
+   * by the host.
+   */
+  explicit ResolveStream(StatePtr state);
+
+  /**
+   * Cancels the request, if still in progress, and waits for the
+   * background thread to exit.
+   */
+  ~ResolveStream();
+
+  /**
+   * Deleted copy constructor.
+   *
+   * ResolveStream cannot be copied, as each object represents a
+   * single request.
+   */
+  ResolveStream(const ResolveStream&) = delete;
+
+  /**
+   * Deleted copy assignment operator.
+   *
+   * ResolveStream cannot be copied, as each object represents a
+   * single request.
+   */
+  ResolveStream& operator=(const ResolveStream&) = delete;
+
+  /// Deleted move constructor.
+  ResolveStream(ResolveStream&&) noexcept = delete;
+
+  /// Deleted move assignment operator.
+  ResolveStream& operator=(ResolveStream&&) noexcept = delete;
+
+  /// Number of elements in the batch.
+  [[nodiscard]] std::size_t size() const;
+
+  /// Maximum number of results queued ahead of the host.
+  [[nodiscard]] std::size_t maxQueueSize() const;
+
+  /**
+   * Block until the next result is available, then remove it from the
+   * stream and return it.
+   *
+   * @return The next result, or an empty optional if all results have
+   * been consumed, or the request was cancelled.
+   *
+   * @throws Any exception thrown by the manager, once all results
+   * produced before the exception have been consumed.
+   */
+  [[nodiscard]] std::optional<Element> next();
+
+  /**
+   * Abandon the request, discarding any queued results.
+   *
+   * Subsequent calls to @ref next return an empty optional.
+   */
+  void cancel();
+
+  /// Iterator at the next result of the stream.
+  [[nodiscard]] Iterator begin();
+
+  /// Iterator at the end of the stream.
+  [[nodiscard]] Iterator end();
+
+ private:
+  StatePtr state_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(trait, TraitsData)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Columnar storage for the results of a batch resolve.
+ *
+ * Rather than holding a @fqref{trait.TraitsData} "TraitsData" per
+ * entity, a ResolvedBatch holds one contiguous column per requested
+ * trait property, with one row per entity reference in the batch.
+ *
+ * This is intended for bulk workflows that only need a few specific
+ * property values (e.g. the location of each entity) for a large
+ * number of entities, where the cost of a TraitsData per entity
+ * dominates.
+ *
+ * Each column has a fixed @ref ColumnType. Numeric and boolean columns
+ * are exposed as contiguous vectors, and string columns as a single
+ * character buffer with per-row offsets and lengths. A value is only
+ * meaningful if @ref isValid is `true` for that row, i.e. the manager
+ * provided a value of the expected type for the property. Otherwise
+ * the value is default-initialised.
+ *
+ * Entities that failed to resolve have no valid values, and the
+ * reason for failure is available via @ref error.
+ *
+ * @see @ref Manager.resolveColumns
+ */
+class OPENASSETIO_CORE_EXPORT ResolvedBatch final {
+ public:
+  /**
+   * Type of the values held in a column.
+   *
+   * Enumerators are in the same order as the alternatives of
+   * @ref trait::property::Value.
+   */
+  enum class ColumnType { kBool, kInt, kFloat, kStr };
+
+  /**
+   * Specification of a single column: the property to extract and
+   * the expected type of its values.
+   */
+  struct ColumnSpec {
+    /// ID of the trait holding the property.
+    trait::TraitId traitId;
+    /// Key of the property within the trait.
+    trait::property::Key propertyKey;
+    /// Expected type of the property's values.
+    ColumnType type;
+  };
+  /// List of column specifications.
+  using ColumnSpecs = std::vector<ColumnSpec>;
+
+  /// Map of batch index to error, for entities that failed to resolve.
+  using BatchElementErrors = std::unordered_map<std::size_t, errors::BatchElementError>;
+
+  /**
+   * Construct an empty result for a batch of the given size, with
+   * columns matching the given specifications.
+   *
+   * All rows are initially invalid and not in error.
+   *
+   * @param columnSpecs Specification of each column, in order.
+   *
+   * @param size Number of rows, i.e. the batch size.
+   */
+  ResolvedBatch(ColumnSpecs columnSpecs, std::size_t size);
+
+  /// Number of rows, i.e. the batch size.
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  /// Specification of each column, in order.
+  [[nodiscard]] const ColumnSpecs& columnSpecs() const { return columnSpecs_; }
+
+  /**
+   * Populate a row from the given resolved data.
+   *
+   * Only the properties matching the column specifications are
+   * extracted. Properties with a value of an unexpected type are left
+   * invalid.
+   *
+   * @param index Row to populate.
+   *
+   * @param traitsData Resolved data for the entity at `index`.
+   *
+   * @throws errors.InputValidationException If `index` is out of
+   * range, or the row has already been populated or marked as an
+   * error.
+   */
+  void setValues(std::size_t index, const trait::TraitsData& traitsData);
+
+  /**
+   * Mark a row as having failed to resolve.
+   *
+   * @param index Row that failed.
+   *
+   * @param error Reason for the failure.
+   *
+   * @throws errors.InputValidationException If `index` is out of
+   * range, or the row has already been populated or marked as an
+   * error.
+   */
+  void setError(std::size_t index, errors::BatchElementError error);
+
+  /**
+   * Whether a column holds a value for the given row.
+   *
+   * @param column Column index.
+   *
+   * @param index Row index.
+   *
+   * @throws errors.InputValidationException If `column` or `index` is
+   * out of range.
+   */
+  [[nodiscard]] bool isValid(std::size_t column, std::size_t index) const;
+
+  /**
+   * Whether the entity at the given row failed to resolve.
+   *
+   * @param index Row index.
+   *
+   * @throws errors.InputValidationException If `index` is out of
+   * range.
+   */
+  [[nodiscard]] bool isError(std::size_t index) const;
+
+  /**
+   * Get the error for an entity that failed to resolve.
+   *
+   * @param index Row index.
+   *
+   * @throws errors.InputValidationException If the row is not in
+   * error.
+   */
+  [[nodiscard]] const errors::BatchElementError& error(std::size_t index) const;
+
+  /// All errors, keyed by row index.
+  [[nodiscard]] const BatchElementErrors& errors() const { return errors_; }
+
+  /**
+   * @name Column access
+   *
+   * Accessors for the values of a column. All throw
+   * errors.InputValidationException if the column index is out of
+   * range or the column is not of the corresponding type.
+   *
+   * @{
+   */
+  /// Values of a @ref ColumnType.kBool column, as `0` or `1`.
+  [[nodiscard]] const std::vector<std::uint8_t>& boolColumn(std::size_t column) const;
+  /// Values of a @ref ColumnType.kInt column.
+  [[nodiscard]] const std::vector<Int>& intColumn(std::size_t column) const;
+  /// Values of a @ref ColumnType.kFloat column.
+  [[nodiscard]] const std::vector<Float>& floatColumn(std::size_t column) const;
+  /**
+   * Character data of a @ref ColumnType.kStr column.
+   *
+   * Values are not null-terminated, see @ref strOffsets and
+   * @ref strLengths.
+   */
+  [[nodiscard]] const Str& strBuffer(std::size_t column) const;
+  /// Offset into @ref strBuffer of each row of a string column.
+  [[nodiscard]] const std::vector<std::size_t>& strOffsets(std::size_t column) const;
+  /// Length of each row of a string column.
+  [[nodiscard]] const std::vector<std::size_t>& strLengths(std::size_t column) const;
+  /**
+   * Value of a row of a @ref ColumnType.kStr column.
+   *
+   * The view is valid for as long as this ResolvedBatch is alive and
+   * unmodified.
+   *
+   * Additionally throws errors.InputValidationException if `index` is
+   * out of range.
+   */
+  [[nodiscard]] std::string_view strValue(std::size_t column, std::size_t index) const;
+  /**
+   * @}
+   */
+
+ private:
+  /// Storage for a single column. Only the members relevant to the
+  /// column's type are populated.
+  struct Column {
+    std::vector<bool> validity;
+    std::vector<std::uint8_t> bools;
+    std::vector<Int> ints;
+    std::vector<Float> floats;
+    Str strBuffer;
+    std::vector<std::size_t> strOffsets;
+    std::vector<std::size_t> strLengths;
+  };
+
+  void checkIndex(std::size_t index) const;
+  /// Check a row is in range and has not yet been set, then mark it
+  /// as set. Rows cannot be overwritten, since string data appended
+  /// to the shared buffer cannot be reclaimed.
+  void markSet(std::size_t index);
+  [[nodiscard]] const Column& checkedColumn(std::size_t column) const;
+  [[nodiscard]] const Column& checkedColumn(std::size_t column, ColumnType type) const;
+
+  ColumnSpecs columnSpecs_;
+  std::size_t size_;
+  std::vector<Column> columns_;
+  std::vector<bool> errorFlags_;
+  std::vector<bool> setFlags_;
+  BatchElementErrors errors_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
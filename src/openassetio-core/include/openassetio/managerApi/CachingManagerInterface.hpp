@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+OPENASSETIO_DECLARE_PTR(CachingManagerInterface)
+
+/**
+ * A ManagerInterface that wraps another, memoising the results of
+ * read-only queries.
+ *
+ * The results of @ref resolve, @ref entityExists, @ref entityTraits
+ * and @ref managementPolicy are cached per element, so that repeated
+ * queries for the same entities are answered without calling the
+ * @ref upstreamInterface. A batch containing a mix of cached and
+ * uncached elements results in a single upstream call for the
+ * uncached elements only.
+ *
+ * Results are keyed on the entity reference, the requested trait
+ * set, the access mode, and the content of the Context's
+ * @fqref{Context.locale} "locale". Results are assumed not to depend
+ * on the Context's @fqref{Context.managerState} "managerState".
+ *
+ * Only successful results are cached. @ref
+ * errors.BatchElementError "BatchElementErrors" are always relayed
+ * from the upstream interface.
+ *
+ * Each kind of query is cached separately, each holding at most
+ * `capacity` entries, evicting the least recently used. Entries can
+ * optionally expire after a time-to-live. All entries are discarded
+ * on @ref flushCaches.
+ *
+ * Publishing via @ref preflight or @ref register_ through this
+ * interface discards any cached existence, trait and resolve results
+ * for both the given and the returned entity references, so that
+ * subsequent queries reflect the newly published data. Publishing
+ * that bypasses this interface is not detected, and requires a call
+ * to @ref flushCaches.
+ *
+ * Element indices provided by the upstream interface to callbacks
+ * are validated, and an out of range index results in an
+ * @ref errors.InputValidationException "InputValidationException".
+ *
+ * All other methods are forwarded to the upstream interface
+ * unmodified.
+ *
+ * This class is safe to call from multiple threads concurrently,
+ * assuming the upstream interface is.
+ */
+class OPENASSETIO_CORE_EXPORT CachingManagerInterface final : public ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(CachingManagerInterface)
+
+  /// Clock used to determine whether cached entries have expired.
+  using Clock = std::chrono::steady_clock;
+
+  /// Default maximum number of entries in each cache.
+  static constexpr std::size_t kDefaultCapacity = 100'000;
+
+  /**
+   * Construct a caching wrapper around the given interface.
+   *
+   * @param upstreamInterface Manager interface to wrap.
+   *
+   * @param capacity Maximum number of entries in each cache.
+   *
+   * @param timeToLive Duration after which cached entries expire, or
+   * zero for entries to persist until evicted or flushed.
+   *
+   * @throws errors.InputValidationException If `upstreamInterface` is
+   * null or `capacity` is zero.
+   */
+  [[nodiscard]] static CachingManagerInterfacePtr make(
+      ManagerInterfacePtr upstreamInterface, std::size_t capacity = kDefaultCapacity,
+      Clock::duration timeToLive = Clock::duration::zero());
+
+  ~CachingManagerInterface() override;
+
+  /// Returns the interface wrapped by this instance.
+  [[nodiscard]] const ManagerInterfacePtr& upstreamInterface() const;
+
+  /**
+   * @name Forwarded methods
+   *
+   * Methods forwarded directly to the @ref upstreamInterface.
+   *
+   * @{
+   */
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] StrMap updateTerminology(StrMap terms, const HostSessionPtr& hostSession) override;
+  [[nodiscard]] InfoDictionary settings(const HostSessionPtr& hostSession) override;
+  void initialize(InfoDictionary managerSettings, const HostSessionPtr& hostSession) override;
+  [[nodiscard]] ManagerStateBasePtr createState(const HostSessionPtr& hostSession) override;
+  [[nodiscard]] ManagerStateBasePtr createChildState(const ManagerStateBasePtr& parentState,
+                                                     const HostSessionPtr& hostSession) override;
+  [[nodiscard]] Str persistenceTokenForState(const ManagerStateBasePtr& state,
+                                             const HostSessionPtr& hostSession) override;
+  [[nodiscard]] ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(const Str& someString,
+                                             const HostSessionPtr& hostSession) override;
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<std::string_view>& someStrings,
+      const HostSessionPtr& hostSession) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, size_t pageSize,
+                           access::RelationsAccess relationsAccess,
+                           const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context, const HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  /**
+   * @}
+   */
+
+  /**
+   * @name Cached methods
+   *
+   * Methods whose successful results are cached. Only elements not
+   * found in the cache are forwarded to the @ref upstreamInterface.
+   *
+   * @{
+   */
+  [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
+                                                    access::PolicyAccess policyAccess,
+                                                    const ContextConstPtr& context,
+                                                    const HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  /**
+   * @}
+   */
+
+  /**
+   * Discard all cached results, then forward to the @ref
+   * upstreamInterface.
+   *
+   * @param hostSession The API session.
+   */
+  void flushCaches(const HostSessionPtr& hostSession) override;
+
+ private:
+  CachingManagerInterface(ManagerInterfacePtr upstreamInterface, std::size_t capacity,
+                          Clock::duration timeToLive);
+
+  ManagerInterfacePtr upstreamInterface_;
+
+  class Caches;
+  std::unique_ptr<Caches> caches_;
+};
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -255,6 +256,8 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
      * This capability means the manager implements the following
      * methods:
      * - @ref isEntityReferenceString
+     * - @ref areEntityReferenceStrings (optionally, since it defaults
+     *   to calling @ref isEntityReferenceString)
      */
     kEntityReferenceIdentification =
         internal::capability::manager::Capability::kEntityReferenceIdentification,
@@ -343,6 +346,10 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
      * This capability means the manager implements the following methods:
      * - @ref getWithRelationship
      * - @ref getWithRelationships
+     *
+     * Optionally, the manager may also implement
+     * @ref getWithRelationshipsMatrix, which otherwise defaults to
+     * making multiple calls to the above.
      */
     kRelationshipQueries = internal::capability::manager::Capability::kRelationshipQueries,
     /**
@@ -900,6 +907,31 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
   [[nodiscard]] virtual bool isEntityReferenceString(const Str& someString,
                                                      const HostSessionPtr& hostSession);
 
+  /**
+   * Determine which of a batch of strings are @ref entity_reference
+   * "entity references" for this manager.
+   *
+   * Batch variant of @ref isEntityReferenceString, allowing a batch to
+   * be checked in a single call. This is particularly beneficial when
+   * the call must bridge languages, as for Python managers.
+   *
+   * The default implementation calls @ref isEntityReferenceString for
+   * each string in turn. Managers may override this method where they
+   * can check a batch more efficiently.
+   *
+   * @param someStrings Strings to be inspected. Views are only valid
+   * for the duration of the call.
+   *
+   * @param hostSession HostSession The API session.
+   *
+   * @return One element per input string, `true` if that string
+   * should be considered as an @ref entity_reference.
+   *
+   * @see @ref isEntityReferenceString
+   */
+  [[nodiscard]] virtual std::vector<bool> areEntityReferenceStrings(
+      const std::vector<std::string_view>& someStrings, const HostSessionPtr& hostSession);
+
   /**
    * Callback signature used for a successful entity existence query.
    */
@@ -1430,6 +1462,68 @@ class OPENASSETIO_CORE_EXPORT ManagerInterface {
                                     const RelationshipQuerySuccessCallback& successCallback,
                                     const BatchElementErrorCallback& errorCallback);
 
+  /**
+   * Queries entity references that are related to each of the input
+   * references by each of the relationships defined by a set of traits
+   * and their properties.
+   *
+   * This is the cross product of @ref getWithRelationship and
+   * @ref getWithRelationships, allowing a manager to service many
+   * relationship queries for many entities in a single call.
+   *
+   * Results are identified by a flattened, row-major index: the result
+   * for the entity at index `i` in @p entityReferences and the
+   * relationship at index `j` in @p relationshipTraitsDatas has index
+   * `i * relationshipTraitsDatas.size() + j`.
+   *
+   * The default implementation makes whichever of multiple calls to
+   * @ref getWithRelationship (one per relationship) or
+   * @ref getWithRelationships (one per entity) requires fewer calls.
+   * Managers that can service the whole query more efficiently may
+   * override this method.
+   *
+   * @param entityReferences The @ref entity_reference "entity
+   * references" to query the specified relationships for.
+   *
+   * @param relationshipTraitsDatas The traits of the relationships to
+   * query.
+   *
+   * @param resultTraitSet A hint as to what traits the returned
+   * entities should have.
+   *
+   * @param pageSize The size of each page of data. Guaranteed to be
+   * greater than zero.
+   *
+   * @param relationsAccess The host's intended usage of the returned
+   * references.
+   *
+   * @param context The calling context.
+   *
+   * @param hostSession The host session that maps to the caller.
+   *
+   * @param successCallback Callback that should be called for each
+   * successful relationship query, with the flattened index of the
+   * query and a pager over the related entities.
+   *
+   * @param errorCallback Callback that should be called for each failed
+   * relationship query, with the flattened index of the query and a
+   * populated BatchElementError.
+   *
+   * @throws errors.NotImplementedException by default when
+   * @ref getWithRelationship or @ref getWithRelationships is not
+   * implemented by the manager.
+   *
+   * @see @ref Capability.kRelationshipQueries
+   */
+  virtual void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                          const trait::TraitsDatas& relationshipTraitsDatas,
+                                          const trait::TraitSet& resultTraitSet, size_t pageSize,
+                                          access::RelationsAccess relationsAccess,
+                                          const ContextConstPtr& context,
+                                          const HostSessionPtr& hostSession,
+                                          const RelationshipQuerySuccessCallback& successCallback,
+                                          const BatchElementErrorCallback& errorCallback);
+
   /// @}
   /**
    * @name Publishing
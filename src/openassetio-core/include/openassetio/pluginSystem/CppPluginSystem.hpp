@@ -1,8 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2024 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -11,6 +13,7 @@
 #include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
 #include <openassetio/typedefs.hpp>
 
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
@@ -38,6 +41,49 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
   /// Pair of absolute path to plugin and shared_ptr to plugin instance.
   using PathAndPlugin = std::pair<std::filesystem::path, CppPluginSystemPluginPtr>;
 
+  /**
+   * File name extension of plugin manifests.
+   *
+   * The manifest of a plugin library replaces the library's extension,
+   * e.g. `libmyplugin.so` is accompanied by
+   * `libmyplugin.openassetio-plugin.toml`.
+   *
+   * @see PluginManifest
+   */
+  static constexpr std::string_view kManifestExtension = ".openassetio-plugin.toml";
+
+  /**
+   * Metadata declared by a plugin manifest.
+   *
+   * A manifest is a TOML file accompanying a plugin library, allowing
+   * the plugin to be discovered without loading the library, e.g.
+   *
+   * @code{.toml}
+   * [plugin]
+   * identifier = "org.example.myplugin"
+   * kind = "manager"
+   * displayName = "My Plugin"
+   *
+   * [plugin.info]
+   * someKey = "some value"
+   * @endcode
+   *
+   * The `identifier` and `kind` are required. The `info` table may
+   * contain string, integer, floating point and boolean values.
+   *
+   * @see kManifestExtension
+   */
+  struct PluginManifest {
+    /// Identifier of the plugin provided by the library.
+    openassetio::Identifier identifier;
+    /// Kind of plugin, e.g. @ref CppPluginSystemManagerPlugin.kPluginKind.
+    openassetio::Str kind;
+    /// Human readable name of the plugin, empty if not declared.
+    openassetio::Str displayName;
+    /// Arbitrary key-value information about the plugin.
+    openassetio::InfoDictionary info;
+  };
+
   /**
    * Constructs a new CppPluginSystem.
    *
@@ -77,16 +123,70 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
    * Discovered plugins are registered by their exposed identifier, and
    * subsequent registrations with the same identifier will be skipped.
    *
+   * If a library is accompanied by a valid @ref PluginManifest
+   * "manifest", then it is registered using the manifest's identifier,
+   * without being loaded. Loading is then deferred until the plugin is
+   * requested via @ref plugin. An invalid manifest is logged and
+   * ignored, and the library loaded as usual.
+   *
    * No attempt is made to catch exceptions during static initialisation
    * or during the call to the provided @ref PluginFactory, and any such
    * exception will almost definitely terminate the process.
    *
+   * If @ref enableParallelLoading "parallel loading" is enabled, then
+   * candidate libraries are loaded concurrently. Plugins are still
+   * registered, and progress logged, in search path order on the
+   * calling thread.
+   *
+   * If a @ref setScanCachePath "scan cache" is set, then libraries
+   * whose path, modification time and size match a cache entry are
+   * registered using the cached identifier, without being loaded.
+   * Loading is then deferred until the plugin is requested via
+   * @ref plugin. Newly loaded libraries are added to the cache, which
+   * is written back to disk before returning.
+   *
    * @param paths A list of paths to search, delimited by operating
    * system specific path separator (i.e. `:` for POSIX, `;` for
    * Windows).
    */
   void scan(std::string_view paths);
 
+  /**
+   * Load candidate libraries concurrently during @ref scan.
+   *
+   * This is opt-in, since it requires that the static initialisation
+   * and entry point of every plugin in the search paths is safe to run
+   * concurrently with others.
+   */
+  void enableParallelLoading();
+
+  /**
+   * Load candidate libraries one at a time during @ref scan. This is
+   * the default.
+   */
+  void disableParallelLoading();
+
+  /// Whether candidate libraries are loaded concurrently during scan.
+  [[nodiscard]] bool isParallelLoadingEnabled() const;
+
+  /**
+   * Set the path of an on-disk cache of plugin identifiers, used to
+   * avoid loading libraries during @ref scan.
+   *
+   * The cache maps each library's path, modification time and size to
+   * the identifier of the plugin it provides. Entries are invalidated
+   * when a library is modified. The file is created if it does not
+   * exist, and may be shared by multiple processes and search paths.
+   * A cache file that cannot be read or written is logged and ignored.
+   *
+   * @param cachePath Path of the cache file, or an empty path to
+   * disable caching (the default).
+   */
+  void setScanCachePath(std::filesystem::path cachePath);
+
+  /// Path of the scan cache file, empty if caching is disabled.
+  [[nodiscard]] const std::filesystem::path& scanCachePath() const;
+
   /**
    * Returns the identifiers known to the plugin system.
    *
@@ -97,24 +197,76 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
   /**
    * Retrieves the plugin that provides the given identifier.
    *
+   * If the plugin was registered from its @ref PluginManifest
+   * "manifest" or the @ref setScanCachePath "scan cache", then its
+   * library is loaded first.
+   *
+   * This may be called concurrently from multiple threads, in which
+   * case deferred loading is serialised, such that each library is
+   * loaded at most once. It must not be called concurrently with
+   * @ref scan, @ref reset or @ref setScanCachePath.
+   *
    * @param identifier Identifier to look up.
    *
    * @return A pair of plugin path and instance.
    *
    * @exception errors.InputValidationException Raised if no plugin
-   * provides the specified identifier.
+   * provides the specified identifier, or if a plugin registered from
+   * a manifest or the scan cache fails to load or does not provide the
+   * identifier.
    */
   const PathAndPlugin& plugin(const openassetio::Identifier& identifier) const;
 
+  /**
+   * Retrieves the manifest of the plugin that provides the given
+   * identifier, without loading the plugin.
+   *
+   * @param identifier Identifier to look up.
+   *
+   * @return The plugin's manifest, or an empty optional if the plugin
+   * was not registered from a manifest.
+   *
+   * @exception errors.InputValidationException Raised if no plugin
+   * provides the specified identifier.
+   */
+  [[nodiscard]] std::optional<PluginManifest> manifest(
+      const openassetio::Identifier& identifier) const;
+
  private:
-  /// Mapping of plugin identifier to file path and instance.
+  /// Scan cache entry for a single library.
+  struct ScanCacheEntry {
+    /// Library modification time, as a file clock tick count.
+    std::int64_t modificationTime;
+    /// Library size in bytes.
+    std::uintmax_t size;
+    /// Identifier of the plugin provided by the library.
+    openassetio::Identifier identifier;
+  };
+
+  /// Mapping of plugin identifier to file path and instance. The
+  /// instance is null for plugins registered from a manifest or the
+  /// scan cache that have not yet been loaded.
   using PluginMap = std::unordered_map<openassetio::Identifier, PathAndPlugin>;
-  /// Optional pair of plugin identifier and instance.
-  using MaybeIdentifierAndPlugin =
-      std::optional<std::pair<openassetio::Identifier, CppPluginSystemPluginPtr>>;
-  /// Attempt to load a plugin at a given path, returning nullopt on
-  /// failure.
-  MaybeIdentifierAndPlugin maybeLoadPlugin(const std::filesystem::path& filePath);
+  /// Mapping of plugin identifier to manifest.
+  using ManifestMap = std::unordered_map<openassetio::Identifier, PluginManifest>;
+  /// Mapping of library path to scan cache entry.
+  using ScanCache = std::unordered_map<openassetio::Str, ScanCacheEntry>;
+
+  /// Check if a plugin identifier has already been registered, logging
+  /// that the given library is skipped if so.
+  bool isAlreadyRegistered(const openassetio::Identifier& identifier,
+                           const std::filesystem::path& filePath) const;
+
+  /// Read the scan cache file, if set.
+  void readScanCache();
+
+  /// Write the scan cache file, if set.
+  void writeScanCache() const;
+
+  /// Load the library of a plugin registered from a manifest or the
+  /// scan cache.
+  void loadDeferredPlugin(const openassetio::Identifier& identifier,
+                          PathAndPlugin& pathAndPlugin) const;
 
   /// Private constructor. See @ref make.
   explicit CppPluginSystem(log::LoggerInterfacePtr logger);
@@ -122,8 +274,21 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
   /// Logger for logging progress, warnings and errors.
   log::LoggerInterfacePtr logger_;
   /// Map of discovered plugin identifiers to their file path and
-  /// instance.
-  PluginMap plugins_;
+  /// instance. Mutable, since plugins registered from a manifest or
+  /// the scan cache are loaded lazily on first access.
+  mutable PluginMap plugins_;
+  /// Manifests of plugins registered from a manifest.
+  ManifestMap manifests_;
+  /// Whether to load candidate libraries concurrently.
+  bool isParallelLoadingEnabled_{false};
+  /// Path of the scan cache file, empty if disabled.
+  std::filesystem::path scanCachePath_;
+  /// In-memory copy of the scan cache. Mutable, since stale entries
+  /// are discovered when lazily loading plugins.
+  mutable ScanCache scanCache_;
+  /// Guards lazy loading of plugins, and the resulting updates to
+  /// `plugins_` and the scan cache, in @ref plugin.
+  mutable std::mutex deferredLoadMutex_;
 };
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include <openassetio/export.h>
+#include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/typedefs.hpp>
 
@@ -39,6 +40,15 @@ OPENASSETIO_DECLARE_PTR(CppPluginSystemManagerImplementationFactory)
  * openassetio.pluginSystem.PythonPluginSystemManagerImplementationFactory
  * "PythonPluginSystemManagerImplementationFactory".
  *
+ * @envvar **OPENASSETIO_CPP_PLUGIN_SCAN_CACHE** *str* Path to a file
+ * used to cache the identifiers of plugin libraries between runs, such
+ * that subsequent scans need only load the plugin that is
+ * instantiated. See @ref CppPluginSystem.setScanCachePath.
+ *
+ * @envvar **OPENASSETIO_CPP_PLUGIN_PARALLEL_SCAN** *int* If set to
+ * `1`, plugin libraries not found in the scan cache are loaded
+ * concurrently. See @ref CppPluginSystem.enableParallelLoading.
+ *
  * Plugins are scanned and loaded lazily when required. In particular,
  * this means no plugin scanning is done on construction.
  *
@@ -52,6 +62,11 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerImplementationFactory
 
   /// Environment variable to read the plugin search path from.
   static constexpr std::string_view kPluginEnvVar = "OPENASSETIO_PLUGIN_PATH";
+  /// Environment variable to read the plugin scan cache path from.
+  static constexpr std::string_view kPluginScanCacheEnvVar = "OPENASSETIO_CPP_PLUGIN_SCAN_CACHE";
+  /// Environment variable to enable parallel plugin loading.
+  static constexpr std::string_view kPluginParallelScanEnvVar =
+      "OPENASSETIO_CPP_PLUGIN_PARALLEL_SCAN";
 
   /**
    * Construct a new instance.
@@ -81,6 +96,9 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerImplementationFactory
   /**
    * Get a list of all manager plugin identifiers known to the factory.
    *
+   * Plugins with a @ref CppPluginSystem.PluginManifest "manifest" are
+   * filtered by their declared kind, without being loaded.
+   *
    * @return List of known manager plugin identifiers.
    */
   Identifiers identifiers() override;
@@ -99,6 +117,23 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerImplementationFactory
    */
   managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
 
+  /**
+   * Get the details of the manager with the specified identifier from
+   * its plugin's @ref CppPluginSystem.PluginManifest "manifest",
+   * without loading the plugin.
+   *
+   * @param identifier Identifier of the manager to query.
+   *
+   * @return Manager details, or an empty optional if the plugin has no
+   * manifest, or its manifest does not declare a manager plugin with a
+   * display name.
+   *
+   * @throws InputValidationException if the requested identifier has
+   * not been registered.
+   */
+  std::optional<hostApi::ManagerFactory::ManagerDetail> managerDetail(
+      const Identifier& identifier) override;
+
  private:
   /// Private constructor. See @ref make.
   explicit CppPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger);
@@ -106,6 +141,9 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerImplementationFactory
   CppPluginSystemManagerImplementationFactory(openassetio::Str paths,
                                               log::LoggerInterfacePtr logger);
 
+  /// Scan the search paths, if not already done.
+  void scanIfRequired();
+
   /// Search paths provided on construction.
   openassetio::Str paths_;
 
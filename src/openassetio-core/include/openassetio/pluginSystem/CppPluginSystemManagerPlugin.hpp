@@ -2,6 +2,8 @@
 // Copyright 2023 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <string_view>
+
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
 #include <openassetio/typedefs.hpp>
@@ -31,6 +33,12 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerPlugin : public CppPluginSys
  public:
   OPENASSETIO_ALIAS_PTR(CppPluginSystemManagerPlugin)
 
+  /**
+   * Plugin kind to declare in the @ref CppPluginSystem.PluginManifest
+   * "manifest" of a manager plugin.
+   */
+  static constexpr std::string_view kPluginKind = "manager";
+
   /// No-op destructor.
   ~CppPluginSystemManagerPlugin() override;
 
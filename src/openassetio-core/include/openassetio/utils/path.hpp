@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
@@ -34,6 +35,12 @@ enum class PathType : std::uint8_t {
  * (internally, multiple regex patterns are compiled). Once constructed,
  * an instance can be used to process any number of URLs/paths.
  *
+ * Simple POSIX paths and URLs (i.e. the vast majority in practice) are
+ * converted by a single-pass scanner, with only more complex cases
+ * falling back to regex matching and full URL parsing. When converting
+ * many paths/URLs, prefer the batch @ref pathsToUrls and
+ * @ref pathsFromUrls functions.
+ *
  * Conversion of Windows UNC paths to file URLs is supported, including
  * `\\?\` device paths. However, conversion of file URLs back to Windows
  * paths only supports drive paths or standard UNC share paths, not
@@ -98,6 +105,41 @@ class OPENASSETIO_CORE_EXPORT FileUrlPathConverter {
   [[nodiscard]] Str pathFromUrl(std::string_view fileUrl,
                                 PathType pathType = PathType::kSystem) const;
 
+  /**
+   * Construct file URLs from a batch of paths.
+   *
+   * Equivalent to calling @ref pathToUrl for each path.
+   *
+   * @param absolutePaths Path strings.
+   *
+   * @param pathType Platform associated with all paths.
+   *
+   * @return Converted file URLs, in the same order as the paths.
+   *
+   * @throws InputValidationException if any path is invalid or
+   * unsupported. The exception relates to the first such path.
+   */
+  [[nodiscard]] std::vector<Str> pathsToUrls(const std::vector<std::string_view>& absolutePaths,
+                                             PathType pathType = PathType::kSystem) const;
+
+  /**
+   * Construct paths from a batch of file URLs.
+   *
+   * Equivalent to calling @ref pathFromUrl for each URL.
+   *
+   * @param fileUrls URLs to convert.
+   *
+   * @param pathType Platform associated with all paths.
+   *
+   * @return Extracted paths, in the same order as the URLs.
+   *
+   * @throws InputValidationException if any URL, or path that it
+   * decodes to, is invalid or unsupported. The exception relates to
+   * the first such URL.
+   */
+  [[nodiscard]] std::vector<Str> pathsFromUrls(const std::vector<std::string_view>& fileUrls,
+                                               PathType pathType = PathType::kSystem) const;
+
  private:
   std::unique_ptr<struct FileUrlPathConverterImpl> impl_;
 };
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
 #include <string_view>
+#include <vector>
 
 #include <openassetio/export.h>
 
@@ -45,6 +47,102 @@ namespace utils {
  */
 OPENASSETIO_CORE_EXPORT openassetio::Str substitute(
     std::string_view input, const openassetio::InfoDictionary& substitutions);
+
+/**
+ * Pre-compiled form of an input string for @ref substitute, for
+ * efficient repeated substitution.
+ *
+ * The input string is parsed once on construction into a sequence of
+ * literal text and placeholder segments. Rendering then only requires
+ * a dictionary lookup per placeholder, rather than re-parsing the input
+ * string and converting the whole dictionary for every substitution.
+ *
+ * Placeholders follow the same syntax as @ref substitute, with the
+ * exception that only named placeholders are supported, i.e. `{}` and
+ * `{0}` are not, and nor are placeholders nested within format
+ * specifiers.
+ *
+ * Instances are immutable once constructed, and so can be safely
+ * rendered from multiple threads.
+ */
+class OPENASSETIO_CORE_EXPORT SubstitutionTemplate {
+ public:
+  /**
+   * Construct by compiling the given input string.
+   *
+   * @param input The string in which substitutions are to be made.
+   *
+   * @throws errors.InputValidationException if the input string is
+   * malformed or contains unsupported placeholders.
+   */
+  explicit SubstitutionTemplate(std::string_view input);
+
+  /**
+   * Substitute placeholders using the provided dictionary mapping of
+   * tokens to values.
+   *
+   * @param substitutions The dictionary containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @return The input string with all substitutions made.
+   *
+   * @throws errors.InputValidationException if a substitution variable
+   * is not found in the dictionary, or its value cannot be formatted.
+   */
+  [[nodiscard]] openassetio::Str render(const openassetio::InfoDictionary& substitutions) const;
+
+  /**
+   * Substitute placeholders using the provided dictionary, writing the
+   * result to a caller-provided string.
+   *
+   * As above, but re-uses the existing capacity of @p output, avoiding
+   * allocation if it is already large enough.
+   *
+   * @param substitutions The dictionary containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @param[out] output String to assign the result to.
+   *
+   * @throws errors.InputValidationException if a substitution variable
+   * is not found in the dictionary, or its value cannot be formatted.
+   */
+  void render(const openassetio::InfoDictionary& substitutions, openassetio::Str& output) const;
+
+  /**
+   * Substitute placeholders using each of a batch of dictionaries.
+   *
+   * @param substitutionsList Dictionaries containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @return One substituted string per dictionary, in the same order.
+   *
+   * @throws errors.InputValidationException if a substitution variable
+   * is not found in any dictionary, or its value cannot be formatted.
+   */
+  [[nodiscard]] std::vector<openassetio::Str> renderMany(
+      const std::vector<openassetio::InfoDictionary>& substitutionsList) const;
+
+  /// The input string this template was compiled from.
+  [[nodiscard]] const openassetio::Str& input() const { return input_; }
+
+ private:
+  /**
+   * A run of literal text, followed by an optional placeholder.
+   */
+  struct Segment {
+    /// Literal text, with `{{` and `}}` escapes already collapsed.
+    openassetio::Str literal;
+    /// Dictionary key of the placeholder, empty if none.
+    openassetio::Str key;
+    /// libfmt format string for the placeholder's value, empty if the
+    /// placeholder has no format specifier.
+    openassetio::Str valueFormat;
+  };
+
+  openassetio::Str input_;
+  std::vector<Segment> segments_;
+  std::size_t literalSize_{0};
+};
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
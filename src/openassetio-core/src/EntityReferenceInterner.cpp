@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/EntityReferenceInterner.hpp>
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+EntityReferenceInternerPtr EntityReferenceInterner::make() {
+  return std::shared_ptr<EntityReferenceInterner>(new EntityReferenceInterner());
+}
+
+EntityReferenceInterner::EntityReferenceInterner() = default;
+
+EntityReference EntityReferenceInterner::intern(Str entityReferenceString) {
+  const std::lock_guard lock{mutex_};
+  if (const auto iter = strings_.find(entityReferenceString); iter != strings_.end()) {
+    return EntityReference{iter->second};
+  }
+  auto sharedString = std::make_shared<const Str>(std::move(entityReferenceString));
+  strings_.emplace(*sharedString, sharedString);
+  return EntityReference{std::move(sharedString)};
+}
+
+std::size_t EntityReferenceInterner::size() const {
+  const std::lock_guard lock{mutex_};
+  return strings_.size();
+}
+
+void EntityReferenceInterner::clear() {
+  const std::lock_guard lock{mutex_};
+  strings_.clear();
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
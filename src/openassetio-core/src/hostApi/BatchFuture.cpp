@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/hostApi/BatchFuture.hpp>
+
+#include <string>
+#include <utility>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "./BatchFutureState.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+template <class Value>
+BatchFuture<Value>::BatchFuture(StatePtr state) : state_{std::move(state)} {}
+
+template <class Value>
+std::size_t BatchFuture<Value>::size() const {
+  return state_->size();
+}
+
+template <class Value>
+std::size_t BatchFuture<Value>::numCompleted() const {
+  return state_->numCompleted();
+}
+
+template <class Value>
+bool BatchFuture<Value>::isElementReady(const std::size_t index) const {
+  if (index >= state_->size()) {
+    return false;
+  }
+  return state_->isElementReady(index);
+}
+
+template <class Value>
+bool BatchFuture<Value>::isReady() const {
+  return state_->isDone();
+}
+
+template <class Value>
+void BatchFuture<Value>::wait() const {
+  state_->wait();
+}
+
+template <class Value>
+bool BatchFuture<Value>::waitFor(const std::chrono::nanoseconds timeout) const {
+  return state_->waitFor(timeout);
+}
+
+template <class Value>
+typename BatchFuture<Value>::ElementResult BatchFuture<Value>::element(
+    const std::size_t index) const {
+  if (index >= state_->size()) {
+    throw errors::InputValidationException{"Index " + std::to_string(index) +
+                                           " out of range for batch of size " +
+                                           std::to_string(state_->size()) + "."};
+  }
+  return state_->element(index);
+}
+
+template <class Value>
+const typename BatchFuture<Value>::Results& BatchFuture<Value>::get() const& {
+  return state_->get();
+}
+
+template <class Value>
+typename BatchFuture<Value>::Results BatchFuture<Value>::get() && {
+  return state_->get();
+}
+
+template <class Value>
+std::shared_future<void> BatchFuture<Value>::completion() const {
+  return state_->completion();
+}
+
+template <class Value>
+void BatchFuture<Value>::cancel() {
+  state_->cancel();
+}
+
+template <class Value>
+bool BatchFuture<Value>::isCancelled() const {
+  return state_->isCancelled();
+}
+
+template class BatchFuture<bool>;
+template class BatchFuture<EntityReference>;
+template class BatchFuture<EntityReferencePagerPtr>;
+template class BatchFuture<trait::TraitsDataPtr>;
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
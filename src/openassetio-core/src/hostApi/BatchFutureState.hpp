@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/BatchFuture.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * State shared between a BatchFuture and the background task
+ * fulfilling it.
+ *
+ * The background task reports results via @ref setResult, then
+ * finishes with exactly one of @ref complete or @ref fail. The first
+ * of these, or a @ref cancel by the host, makes the state "done",
+ * after which results are immutable and further reports are ignored.
+ */
+template <class Value>
+class BatchFuture<Value>::State {
+ public:
+  explicit State(const std::size_t size)
+      : results_(size), isReady_(size, false), done_{donePromise_.get_future().share()} {}
+
+  /**
+   * @name Producer interface
+   * @{
+   */
+
+  /// Lock-free, so cheap enough to check per element.
+  [[nodiscard]] bool isCancelled() const { return isCancelled_; }
+
+  void setResult(const std::size_t index, ElementResult result) {
+    {
+      const std::lock_guard lock{mutex_};
+      if (isDone_) {
+        return;
+      }
+      results_[index] = std::move(result);
+      if (!isReady_[index]) {
+        isReady_[index] = true;
+        ++numCompleted_;
+      }
+    }
+    condition_.notify_all();
+  }
+
+  /// Mark all elements complete, including any not reported.
+  void complete() {
+    finish([] {});
+  }
+
+  /// Mark the request as failed, leaving unreported elements pending.
+  void fail(std::exception_ptr exception) {
+    finish([&] { exception_ = std::move(exception); });
+  }
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Consumer interface
+   * @{
+   */
+
+  /// Complete all unreported elements with a cancellation error.
+  void cancel() {
+    finish([this] {
+      isCancelled_ = true;
+      for (std::size_t index = 0; index < results_.size(); ++index) {
+        if (!isReady_[index]) {
+          results_[index] = errors::BatchElementError{
+              errors::BatchElementError::ErrorCode::kUnknown, Str{kCancelledMessage}};
+        }
+      }
+    });
+  }
+
+  [[nodiscard]] std::size_t size() const { return results_.size(); }
+
+  [[nodiscard]] std::size_t numCompleted() const {
+    const std::lock_guard lock{mutex_};
+    return numCompleted_;
+  }
+
+  [[nodiscard]] bool isElementReady(const std::size_t index) const {
+    const std::lock_guard lock{mutex_};
+    return isReady_[index];
+  }
+
+  [[nodiscard]] bool isDone() const {
+    const std::lock_guard lock{mutex_};
+    return isDone_;
+  }
+
+  void wait() const {
+    std::unique_lock lock{mutex_};
+    condition_.wait(lock, [this] { return isDone_; });
+  }
+
+  [[nodiscard]] bool waitFor(const std::chrono::nanoseconds timeout) const {
+    std::unique_lock lock{mutex_};
+    return condition_.wait_for(lock, timeout, [this] { return isDone_; });
+  }
+
+  [[nodiscard]] ElementResult element(const std::size_t index) const {
+    std::unique_lock lock{mutex_};
+    condition_.wait(lock, [this, index] { return isReady_[index] || isDone_; });
+    if (!isReady_[index]) {
+      std::rethrow_exception(exception_);
+    }
+    return results_[index];
+  }
+
+  [[nodiscard]] const Results& get() const {
+    wait();
+    // Safe to read without the lock, since results are immutable once
+    // done.
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+    return results_;
+  }
+
+  [[nodiscard]] std::shared_future<void> completion() const { return done_; }
+
+  /**
+   * @}
+   */
+
+ private:
+  /**
+   * Transition to done, if not already, applying the given update to
+   * the state whilst locked.
+   */
+  template <class Update>
+  void finish(const Update& update) {
+    {
+      const std::lock_guard lock{mutex_};
+      if (isDone_) {
+        return;
+      }
+      update();
+      if (!exception_) {
+        isReady_.assign(isReady_.size(), true);
+        numCompleted_ = isReady_.size();
+      }
+      isDone_ = true;
+    }
+    condition_.notify_all();
+    donePromise_.set_value();
+  }
+
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  Results results_;
+  std::vector<bool> isReady_;
+  std::size_t numCompleted_{0};
+  bool isDone_{false};
+  std::atomic<bool> isCancelled_{false};
+  std::exception_ptr exception_;
+
+  std::promise<void> donePromise_;
+  std::shared_future<void> done_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
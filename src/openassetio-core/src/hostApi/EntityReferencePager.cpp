@@ -1,7 +1,19 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
 
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 #include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
@@ -10,6 +22,233 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace hostApi {
+namespace {
+/**
+ * Close the query, logging rather than propagating any error, since
+ * this is called from the destructor.
+ */
+void closeQuietly(const managerApi::EntityReferencePagerInterfacePtr& pagerInterface,
+                  const managerApi::HostSessionPtr& hostSession) {
+  try {
+    pagerInterface->close(hostSession);
+  } catch (const std::exception& ex) {
+    hostSession->logger()->error(ex.what());
+  } catch (...) {
+    hostSession->logger()->error(
+        "Unknown non-exception object caught during destruction of EntityReferencePager");
+  }
+}
+
+/// Hook set by EntityReferencePager::setJoinHook.
+struct JoinHookRegistry {
+  std::mutex mutex;
+  EntityReferencePager::JoinHook hook;
+};
+
+JoinHookRegistry& joinHookRegistry() {
+  static JoinHookRegistry registry;
+  return registry;
+}
+
+/// Append the elements of a page to another, without copying.
+void appendPage(EntityReferencePager::Page& dest, EntityReferencePager::Page&& page) {
+  if (dest.empty()) {
+    // Avoid a copy of the first page, unless preallocated.
+    if (page.size() >= dest.capacity()) {
+      dest = std::move(page);
+      return;
+    }
+  }
+  dest.insert(dest.end(), std::make_move_iterator(page.begin()),
+              std::make_move_iterator(page.end()));
+}
+}  // namespace
+
+/**
+ * Bounded queue of pages, shared between a pager and the background
+ * thread feeding it, which is owned by this instance.
+ *
+ * The front of the queue is the host's current page. Once the host
+ * advances beyond the last page, the pager is exhausted.
+ *
+ * On destruction of the pager, the background thread is signalled to
+ * stop via @ref cancel, then joined via @ref join, so that the pager
+ * can close the query once the thread's current call to the manager
+ * (if any) completes.
+ */
+class EntityReferencePager::PrefetchState {
+ public:
+  explicit PrefetchState(const std::size_t depth) : depth_{depth} {}
+
+  ~PrefetchState() { join(); }
+
+  PrefetchState(const PrefetchState&) = delete;
+  PrefetchState(PrefetchState&&) noexcept = delete;
+  PrefetchState& operator=(const PrefetchState&) = delete;
+  PrefetchState& operator=(PrefetchState&&) noexcept = delete;
+
+  /// Run the producer on the background thread.
+  template <class Producer>
+  void start(Producer producer) {
+    thread_ = std::thread{std::move(producer)};
+  }
+
+  /// Wait for the background thread to exit.
+  void join() {
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  /**
+   * @name Producer interface
+   * @{
+   */
+
+  /**
+   * Block until there is room in the queue for another page.
+   *
+   * Called before fetching a page, so that no more than `depth` pages
+   * beyond the current page are fetched.
+   *
+   * @return `false` if the pager was destroyed.
+   */
+  bool waitForSpace() {
+    std::unique_lock lock{mutex_};
+    notFull_.wait(lock, [this] { return isCancelled_ || queue_.size() <= depth_; });
+    return !isCancelled_;
+  }
+
+  /**
+   * Queue a page.
+   *
+   * @return `false` if the pager was destroyed, in which case the page
+   * is discarded.
+   */
+  bool push(Page page, const bool hasNext) {
+    {
+      const std::lock_guard lock{mutex_};
+      if (isCancelled_) {
+        return false;
+      }
+      queue_.push_back({std::move(page), hasNext});
+    }
+    notEmpty_.notify_one();
+    return true;
+  }
+
+  /**
+   * Mark the background thread as finished, optionally with an
+   * exception.
+   */
+  void finish(std::exception_ptr exception) {
+    {
+      const std::lock_guard lock{mutex_};
+      isFinished_ = true;
+      exception_ = std::move(exception);
+    }
+    notEmpty_.notify_one();
+  }
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Consumer interface
+   * @{
+   */
+
+  bool hasNext() {
+    std::unique_lock lock{mutex_};
+    if (isExhausted_) {
+      return false;
+    }
+    return waitForFront(lock).hasNext;
+  }
+
+  Page get() {
+    std::unique_lock lock{mutex_};
+    if (isExhausted_) {
+      return {};
+    }
+    return waitForFront(lock).page;
+  }
+
+  void next() {
+    std::unique_lock lock{mutex_};
+    if (isExhausted_) {
+      return;
+    }
+    popFront(waitForFront(lock).hasNext, lock);
+  }
+
+  /// Move the current page and all subsequent pages into `pages`.
+  void drainAll(Page& pages) {
+    std::unique_lock lock{mutex_};
+    while (!isExhausted_) {
+      Entry& entry = waitForFront(lock);
+      appendPage(pages, std::move(entry.page));
+      popFront(entry.hasNext, lock);
+      lock.lock();
+    }
+  }
+
+  /**
+   * Abandon the query, discarding any buffered pages, and signal the
+   * background thread to stop before fetching another page.
+   */
+  void cancel() {
+    {
+      const std::lock_guard lock{mutex_};
+      isCancelled_ = true;
+      queue_.clear();
+    }
+    notFull_.notify_one();
+  }
+
+  /**
+   * @}
+   */
+
+ private:
+  struct Entry {
+    Page page;
+    bool hasNext;
+  };
+
+  /// Block until the current page is available, rethrowing any error.
+  Entry& waitForFront(std::unique_lock<std::mutex>& lock) {
+    notEmpty_.wait(lock, [this] { return isFinished_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      // The background thread only finishes without error after
+      // queueing the last page, so the queue can only be empty here
+      // if fetching failed.
+      std::rethrow_exception(exception_);
+    }
+    return queue_.front();
+  }
+
+  /// Advance beyond the current page, unlocking the given lock.
+  void popFront(const bool hasNext, std::unique_lock<std::mutex>& lock) {
+    queue_.pop_front();
+    isExhausted_ = !hasNext;
+    lock.unlock();
+    notFull_.notify_one();
+  }
+
+  const std::size_t depth_;
+
+  std::mutex mutex_;
+  std::condition_variable notFull_;
+  std::condition_variable notEmpty_;
+  std::deque<Entry> queue_;
+  bool isExhausted_{false};
+  bool isFinished_{false};
+  bool isCancelled_{false};
+  std::exception_ptr exception_;
+  std::thread thread_;
+};
 
 typename EntityReferencePager::Ptr EntityReferencePager::make(
     managerApi::EntityReferencePagerInterfacePtr pagerInterface,
@@ -24,23 +263,108 @@ EntityReferencePager::EntityReferencePager(
     : pagerInterface_(std::move(pagerInterface)), hostSession_(std::move(hostSession)) {}
 
 EntityReferencePager::~EntityReferencePager() {
-  try {
-    pagerInterface_->close(hostSession_);
-  } catch (const std::exception& ex) {
-    hostSession_->logger()->error(ex.what());
-  } catch (...) {
-    hostSession_->logger()->error(
-        "Unknown non-exception object caught during destruction of EntityReferencePager");
+  if (prefetchState_) {
+    // Wait for the background thread's current call to the manager
+    // (if any) to complete, so that the query is not closed whilst in
+    // use.
+    prefetchState_->cancel();
+    const std::function<void()> join = [this] { prefetchState_->join(); };
+    JoinHook hook;
+    {
+      JoinHookRegistry& registry = joinHookRegistry();
+      const std::lock_guard lock{registry.mutex};
+      hook = registry.hook;
+    }
+    if (hook) {
+      hook(join);
+    } else {
+      join();
+    }
   }
+  closeQuietly(pagerInterface_, hostSession_);
 }
 
-bool EntityReferencePager::hasNext() { return pagerInterface_->hasNext(hostSession_); }
+void EntityReferencePager::setJoinHook(JoinHook hook) {
+  JoinHookRegistry& registry = joinHookRegistry();
+  const std::lock_guard lock{registry.mutex};
+  registry.hook = std::move(hook);
+}
+
+bool EntityReferencePager::hasNext() {
+  if (prefetchState_) {
+    return prefetchState_->hasNext();
+  }
+  return pagerInterface_->hasNext(hostSession_);
+}
 
 typename EntityReferencePager::Page EntityReferencePager::get() {
+  if (prefetchState_) {
+    return prefetchState_->get();
+  }
   return pagerInterface_->get(hostSession_);
 }
 
-void EntityReferencePager::next() { pagerInterface_->next(hostSession_); }
+void EntityReferencePager::next() {
+  if (prefetchState_) {
+    prefetchState_->next();
+    return;
+  }
+  pagerInterface_->next(hostSession_);
+}
+
+typename EntityReferencePager::Page EntityReferencePager::drainAll(const std::size_t sizeHint) {
+  Page pages;
+  pages.reserve(sizeHint);
+
+  if (prefetchState_) {
+    prefetchState_->drainAll(pages);
+    return pages;
+  }
+
+  bool hasMore = true;
+  while (hasMore) {
+    appendPage(pages, pagerInterface_->get(hostSession_));
+    hasMore = pagerInterface_->hasNext(hostSession_);
+    pagerInterface_->next(hostSession_);
+  }
+  return pages;
+}
+
+void EntityReferencePager::enablePrefetch(const std::size_t depth) {
+  if (depth == 0) {
+    throw errors::InputValidationException{"Prefetch depth must be greater than zero."};
+  }
+  if (prefetchState_) {
+    throw errors::InputValidationException{"Prefetch is already enabled."};
+  }
+  auto prefetchState = std::make_shared<PrefetchState>(depth);
+
+  // The thread is joined before the state is destroyed, but the pager
+  // itself may be moved, so the thread must not reference it.
+  prefetchState->start([pagerInterface = pagerInterface_, hostSession = hostSession_,
+                        state = prefetchState.get()] {
+    std::exception_ptr exception;
+    try {
+      bool hasNext = true;
+      while (hasNext && state->waitForSpace()) {
+        Page page = pagerInterface->get(hostSession);
+        hasNext = pagerInterface->hasNext(hostSession);
+        if (!state->push(std::move(page), hasNext)) {
+          break;
+        }
+        if (hasNext) {
+          pagerInterface->next(hostSession);
+        }
+      }
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    state->finish(std::move(exception));
+  });
+  prefetchState_ = std::move(prefetchState);
+}
+
+bool EntityReferencePager::isPrefetchEnabled() const { return prefetchState_ != nullptr; }
 
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -1,13 +1,25 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2024 The Foundry Visionmongers Ltd
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <fmt/format.h>
 
 #include <openassetio/Context.hpp>
+#include <openassetio/EntityReferenceInterner.hpp>
 #include <openassetio/constants.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
@@ -19,6 +31,9 @@
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/typedefs.hpp>
 
+#include "../utils/PrefixMatcher.hpp"
+#include "../utils/ThreadPool.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace {
@@ -60,11 +75,13 @@ void verifyRequiredCapabilities(const managerApi::ManagerInterfacePtr &interface
 }
 
 /**
- * Extract the entity reference prefix from a manager plugin's info
- * dictionary, if available.
+ * Build a matcher for the entity reference prefixes in a manager
+ * plugin's info dictionary, if available.
  */
-std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &logger,
-                                                 const InfoDictionary &info) {
+std::shared_ptr<const utils::PrefixMatcher> entityReferenceMatcherFromInfo(
+    const log::LoggerInterfacePtr &logger, const InfoDictionary &info) {
+  std::vector<Str> prefixes;
+
   // Check if the info dict has the prefix key.
   if (auto iter = info.find(Str{constants::kInfoKey_EntityReferencesMatchPrefix});
       iter != info.end()) {
@@ -75,14 +92,272 @@ std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &
                       " manager's implementation.",
                       *prefixPtr));
 
-      return *prefixPtr;
+      prefixes.push_back(*prefixPtr);
+    } else {
+      logger->warning(
+          "Entity reference prefix given but is an invalid type: should be a string.");
     }
+  }
 
-    logger->warning("Entity reference prefix given but is an invalid type: should be a string.");
+  // Check if the info dict has the multiple prefixes key.
+  if (auto iter = info.find(Str{constants::kInfoKey_EntityReferencesMatchPrefixes});
+      iter != info.end()) {
+    if (const auto *prefixesPtr = std::get_if<openassetio::Str>(&iter->second)) {
+      logger->debugApi(
+          fmt::format("Entity reference prefixes '{}' provided by manager's info() dict."
+                      " Subsequent calls to isEntityReferenceString will use these prefixes"
+                      " rather than call the manager's implementation.",
+                      *prefixesPtr));
+
+      std::istringstream stream{*prefixesPtr};
+      std::copy(std::istream_iterator<Str>{stream}, std::istream_iterator<Str>{},
+                std::back_inserter(prefixes));
+    } else {
+      logger->warning(
+          "Entity reference prefixes given but is an invalid type: should be a string.");
+    }
   }
 
-  // Prefix string not found, so return unset optional.
-  return {};
+  // No prefixes found, so return null matcher.
+  if (prefixes.empty()) {
+    return nullptr;
+  }
+  return std::make_shared<const utils::PrefixMatcher>(std::move(prefixes));
+}
+
+/**
+ * Extract whether the manager declares itself thread-safe from a
+ * manager plugin's info dictionary.
+ */
+bool isThreadSafeFromInfo(const log::LoggerInterfacePtr &logger, const InfoDictionary &info) {
+  if (auto iter = info.find(Str{constants::kInfoKey_IsThreadSafe}); iter != info.end()) {
+    if (const auto *isThreadSafePtr = std::get_if<openassetio::Bool>(&iter->second)) {
+      return *isThreadSafePtr;
+    }
+    logger->warning("Thread safety declared but is an invalid type: should be a boolean.");
+  }
+  return false;
+}
+
+/**
+ * State shared between the calling thread and worker threads during a
+ * sharded batch call.
+ *
+ * Held by shared pointer, since pool tasks may outlive the call, if
+ * they start only after all shards have been claimed.
+ */
+template <class Value>
+struct ShardedDispatchState {
+  struct Result {
+    std::size_t index;
+    std::variant<Value, errors::BatchElementError> value;
+  };
+
+  explicit ShardedDispatchState(const std::size_t numShards_) : numShards{numShards_} {}
+
+  /**
+   * Claim the next shard to run, if any remain. Must only be called
+   * by a worker between @ref beginWorker and @ref endWorker, so that
+   * the calling thread cannot miss the claim.
+   */
+  bool claim(std::size_t &shardIdx) {
+    shardIdx = nextShard.fetch_add(1);
+    return shardIdx < numShards;
+  }
+
+  /// Prevent any further shards from being claimed.
+  void cancel() {
+    cancelled = true;
+    nextShard = numShards;
+  }
+
+  void beginWorker() {
+    const std::lock_guard lock{mutex};
+    ++numActiveWorkers;
+  }
+
+  void endWorker() {
+    {
+      const std::lock_guard lock{mutex};
+      --numActiveWorkers;
+    }
+    condition.notify_one();
+  }
+
+  void post(std::vector<Result> &newResults) {
+    {
+      const std::lock_guard lock{mutex};
+      if (results.empty()) {
+        results.swap(newResults);
+      } else {
+        std::move(newResults.begin(), newResults.end(), std::back_inserter(results));
+      }
+    }
+    newResults.clear();
+    condition.notify_one();
+  }
+
+  void fail(std::exception_ptr newException) {
+    {
+      const std::lock_guard lock{mutex};
+      if (!exception) {
+        exception = std::move(newException);
+      }
+    }
+    cancel();
+  }
+
+  /// Block until all workers have finished their claimed shards.
+  void waitForWorkers() {
+    std::unique_lock lock{mutex};
+    condition.wait(lock, [this] { return numActiveWorkers == 0; });
+  }
+
+  const std::size_t numShards;
+  std::atomic<std::size_t> nextShard{0};
+  std::atomic<bool> cancelled{false};
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::size_t numActiveWorkers{0};
+  std::vector<Result> results;
+  std::exception_ptr exception;
+};
+
+/**
+ * Split a batch into shards, dispatching them concurrently across the
+ * shared thread pool and the calling thread.
+ *
+ * Results from worker threads are queued, and relayed to the callbacks
+ * on the calling thread, offset to their index in the full batch.
+ *
+ * @param dispatch Callable taking a shard of entity references, a
+ * success callback and an error callback, which forwards to the
+ * manager.
+ */
+template <class Value, class Dispatch>
+void dispatchSharded(const EntityReferences &entityReferences, const std::size_t numShards,
+                     const Dispatch &dispatch,
+                     const std::function<void(std::size_t, Value)> &successCallback,
+                     const hostApi::Manager::BatchElementErrorCallback &errorCallback) {
+  using State = ShardedDispatchState<Value>;
+  using Result = typename State::Result;
+  // Number of results a worker accumulates before passing them to the
+  // calling thread, to limit lock contention.
+  static constexpr std::size_t kPostBatchSize = 64;
+
+  const std::size_t numRefs = entityReferences.size();
+  const auto shardBegin = [numRefs, numShards](const std::size_t shardIdx) {
+    return shardIdx * numRefs / numShards;
+  };
+  const auto shardRefs = [&entityReferences, &shardBegin](const std::size_t shardIdx) {
+    return EntityReferences(
+        entityReferences.begin() + static_cast<std::ptrdiff_t>(shardBegin(shardIdx)),
+        entityReferences.begin() + static_cast<std::ptrdiff_t>(shardBegin(shardIdx + 1)));
+  };
+
+  const auto state = std::make_shared<State>(numShards);
+
+  // Shards run by workers. Note that `runWorker` captures references
+  // to this stack frame, which are only dereferenced after a shard has
+  // been claimed, which in turn guarantees this frame is still live.
+  const auto runWorker = [state, &shardBegin, &shardRefs, &dispatch] {
+    state->beginWorker();
+    std::size_t shardIdx = 0;
+    while (state->claim(shardIdx)) {
+      const std::size_t offset = shardBegin(shardIdx);
+      std::vector<Result> results;
+      results.reserve(kPostBatchSize);
+      const auto postIfFull = [&] {
+        if (results.size() >= kPostBatchSize) {
+          state->post(results);
+        }
+      };
+      try {
+        dispatch(
+            shardRefs(shardIdx),
+            [&](std::size_t idx, Value value) {
+              if (!state->cancelled) {
+                results.push_back({offset + idx, std::move(value)});
+                postIfFull();
+              }
+            },
+            [&](std::size_t idx, errors::BatchElementError error) {
+              if (!state->cancelled) {
+                results.push_back({offset + idx, std::move(error)});
+                postIfFull();
+              }
+            });
+        state->post(results);
+      } catch (...) {
+        state->fail(std::current_exception());
+      }
+    }
+    state->endWorker();
+  };
+
+  for (std::size_t workerIdx = 1; workerIdx < numShards; ++workerIdx) {
+    utils::ThreadPool::shared().submit([state, runWorker] {
+      // Avoid touching the (possibly dead) caller frame if all shards
+      // have already been claimed.
+      if (state->nextShard < state->numShards) {
+        runWorker();
+      }
+    });
+  }
+
+  try {
+    std::vector<Result> results;
+    while (true) {
+      {
+        const std::lock_guard lock{state->mutex};
+        results.swap(state->results);
+      }
+      for (Result &result : results) {
+        if (auto *value = std::get_if<Value>(&result.value)) {
+          successCallback(result.index, std::move(*value));
+        } else {
+          errorCallback(result.index, std::get<errors::BatchElementError>(result.value));
+        }
+      }
+      results.clear();
+
+      // The calling thread claims shards like any other worker, but
+      // can call the callbacks directly.
+      if (std::size_t shardIdx = 0; state->claim(shardIdx)) {
+        const std::size_t offset = shardBegin(shardIdx);
+        dispatch(
+            shardRefs(shardIdx),
+            [&](std::size_t idx, Value value) { successCallback(offset + idx, std::move(value)); },
+            [&](std::size_t idx, errors::BatchElementError error) {
+              errorCallback(offset + idx, std::move(error));
+            });
+        continue;
+      }
+
+      std::unique_lock lock{state->mutex};
+      state->condition.wait(
+          lock, [&state] { return !state->results.empty() || state->numActiveWorkers == 0; });
+      if (state->results.empty()) {
+        break;
+      }
+    }
+  } catch (...) {
+    state->cancel();
+    state->waitForWorkers();
+    throw;
+  }
+
+  // Take ownership, rather than share, so that the exception's
+  // lifetime is not tied to that of any lingering pool tasks.
+  std::exception_ptr exception;
+  {
+    const std::lock_guard lock{state->mutex};
+    exception.swap(state->exception);
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
 }
 }  // namespace
 
@@ -124,12 +399,37 @@ void Manager::initialize(InfoDictionary managerSettings) {
   // implementation
   verifyRequiredCapabilities(managerInterface_);
 
-  entityReferencePrefix_ =
-      entityReferencePrefixFromInfo(hostSession_->logger(), managerInterface_->info());
+  const InfoDictionary info = managerInterface_->info();
+  entityReferenceMatcher_ = entityReferenceMatcherFromInfo(hostSession_->logger(), info);
+  isManagerThreadSafe_ = isThreadSafeFromInfo(hostSession_->logger(), info);
 }
 
 void Manager::flushCaches() { managerInterface_->flushCaches(hostSession_); }
 
+void Manager::enableParallelDispatch(std::size_t maxShards, const std::size_t minShardSize) {
+  if (minShardSize == 0) {
+    throw errors::InputValidationException{"minShardSize must be greater than zero."};
+  }
+  if (maxShards == 0) {
+    // Workers plus the calling thread.
+    maxShards = utils::ThreadPool::shared().size() + 1;
+  }
+  parallelMinShardSize_ = minShardSize;
+  parallelMaxShards_ = maxShards;
+}
+
+void Manager::disableParallelDispatch() { parallelMaxShards_ = 0; }
+
+bool Manager::isParallelDispatchEnabled() const { return parallelMaxShards_ != 0; }
+
+std::size_t Manager::numShardsFor(const std::size_t batchSize) const {
+  if (!isManagerThreadSafe_) {
+    return 1;
+  }
+  return std::max<std::size_t>(
+      std::min<std::size_t>(parallelMaxShards_, batchSize / parallelMinShardSize_), 1);
+}
+
 trait::TraitsDatas Manager::managementPolicy(const trait::TraitSets &traitSets,
                                              const access::PolicyAccess policyAccess,
                                              const ContextConstPtr &context) {
@@ -172,11 +472,34 @@ ContextPtr Manager::contextFromPersistenceToken(const Str &token) {
 }
 
 bool Manager::isEntityReferenceString(const Str &someString) {
-  if (!entityReferencePrefix_) {
+  if (!entityReferenceMatcher_) {
     return managerInterface_->isEntityReferenceString(someString, hostSession_);
   }
 
-  return someString.rfind(*entityReferencePrefix_, 0) != Str::npos;
+  return entityReferenceMatcher_->matches(someString);
+}
+
+std::vector<Manager::BoolAsUint> Manager::areEntityReferenceStrings(
+    const std::vector<std::string_view> &someStrings) {
+  std::vector<BoolAsUint> results(someStrings.size());
+
+  if (!entityReferenceMatcher_) {
+    const std::vector<bool> areValid =
+        managerInterface_->areEntityReferenceStrings(someStrings, hostSession_);
+    if (areValid.size() != someStrings.size()) {
+      throw errors::OpenAssetIOException{fmt::format(
+          "Manager returned {} results from areEntityReferenceStrings for a batch of {}",
+          areValid.size(), someStrings.size())};
+    }
+    std::copy(areValid.begin(), areValid.end(), results.begin());
+    return results;
+  }
+
+  std::transform(someStrings.begin(), someStrings.end(), results.begin(),
+                 [&matcher = *entityReferenceMatcher_](const std::string_view someString) {
+                   return static_cast<BoolAsUint>(matcher.matches(someString));
+                 });
+  return results;
 }
 
 const Str kCreateEntityReferenceErrorMessage = "Invalid entity reference: ";
@@ -196,10 +519,51 @@ std::optional<EntityReference> Manager::createEntityReferenceIfValid(Str entityR
   return EntityReference{std::move(entityReferenceString)};
 }
 
+EntityReferences Manager::createEntityReferences(std::vector<Str> entityReferenceStrings,
+                                                 const BatchElementErrorCallback &errorCallback) {
+  return createEntityReferences(std::move(entityReferenceStrings), errorCallback, nullptr);
+}
+
+EntityReferences Manager::createEntityReferences(std::vector<Str> entityReferenceStrings,
+                                                 const BatchElementErrorCallback &errorCallback,
+                                                 const EntityReferenceInternerPtr &interner) {
+  const std::vector<std::string_view> someStrings(entityReferenceStrings.begin(),
+                                                  entityReferenceStrings.end());
+  const std::vector<BoolAsUint> areValid = areEntityReferenceStrings(someStrings);
+
+  EntityReferences entityReferences;
+  entityReferences.reserve(static_cast<std::size_t>(
+      std::count_if(areValid.begin(), areValid.end(), [](BoolAsUint isValid) { return isValid; })));
+
+  for (std::size_t idx = 0; idx < entityReferenceStrings.size(); ++idx) {
+    if (!areValid[idx]) {
+      errorCallback(idx, errors::BatchElementError{
+                             errors::BatchElementError::ErrorCode::kInvalidEntityReference,
+                             kCreateEntityReferenceErrorMessage + entityReferenceStrings[idx]});
+    } else if (interner) {
+      entityReferences.push_back(interner->intern(std::move(entityReferenceStrings[idx])));
+    } else {
+      entityReferences.emplace_back(std::move(entityReferenceStrings[idx]));
+    }
+  }
+  return entityReferences;
+}
+
 void Manager::entityExists(const EntityReferences &entityReferences,
                            const ContextConstPtr &context,
                            const ExistsSuccessCallback &successCallback,
                            const BatchElementErrorCallback &errorCallback) {
+  if (const std::size_t numShards = numShardsFor(entityReferences.size()); numShards > 1) {
+    dispatchSharded(
+        entityReferences, numShards,
+        [&](const EntityReferences &shard, const auto &shardSuccessCallback,
+            const auto &shardErrorCallback) {
+          managerInterface_->entityExists(shard, context, hostSession_, shardSuccessCallback,
+                                          shardErrorCallback);
+        },
+        successCallback, errorCallback);
+    return;
+  }
   managerInterface_->entityExists(entityReferences, context, hostSession_, successCallback,
                                   errorCallback);
 }
@@ -209,6 +573,17 @@ void Manager::entityTraits(const EntityReferences &entityReferences,
                            const ContextConstPtr &context,
                            const EntityTraitsSuccessCallback &successCallback,
                            const BatchElementErrorCallback &errorCallback) {
+  if (const std::size_t numShards = numShardsFor(entityReferences.size()); numShards > 1) {
+    dispatchSharded(
+        entityReferences, numShards,
+        [&](const EntityReferences &shard, const auto &shardSuccessCallback,
+            const auto &shardErrorCallback) {
+          managerInterface_->entityTraits(shard, entityTraitsAccess, context, hostSession_,
+                                          shardSuccessCallback, shardErrorCallback);
+        },
+        successCallback, errorCallback);
+    return;
+  }
   managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context, hostSession_,
                                   successCallback, errorCallback);
 }
@@ -217,6 +592,17 @@ void Manager::resolve(const EntityReferences &entityReferences, const trait::Tra
                       const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
                       const ResolveSuccessCallback &successCallback,
                       const BatchElementErrorCallback &errorCallback) {
+  if (const std::size_t numShards = numShardsFor(entityReferences.size()); numShards > 1) {
+    dispatchSharded(
+        entityReferences, numShards,
+        [&](const EntityReferences &shard, const auto &shardSuccessCallback,
+            const auto &shardErrorCallback) {
+          managerInterface_->resolve(shard, traitSet, resolveAccess, context, hostSession_,
+                                     shardSuccessCallback, shardErrorCallback);
+        },
+        successCallback, errorCallback);
+    return;
+  }
   managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context, hostSession_,
                              successCallback, errorCallback);
 }
@@ -285,6 +671,28 @@ void Manager::getWithRelationships(
                                           convertingPagerSuccessCallback, errorCallback);
 }
 
+void Manager::getWithRelationshipsMatrix(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &relationshipTraitsDatas,
+    size_t pageSize, const access::RelationsAccess relationsAccess, const ContextConstPtr &context,
+    const Manager::RelationshipQuerySuccessCallback &successCallback,
+    const Manager::BatchElementErrorCallback &errorCallback,
+    const trait::TraitSet &resultTraitSet) {
+  if (pageSize == 0) {
+    throw errors::InputValidationException{"pageSize must be greater than zero."};
+  }
+
+  // See getWithRelationships.
+  const auto convertingPagerSuccessCallback =
+      [&hostSession = this->hostSession_, &successCallback](
+          std::size_t idx, managerApi::EntityReferencePagerInterfacePtr pagerInterface) {
+        auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface), hostSession);
+        successCallback(idx, std::move(pager));
+      };
+  managerInterface_->getWithRelationshipsMatrix(
+      entityReferences, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+      context, hostSession_, convertingPagerSuccessCallback, errorCallback);
+}
+
 void Manager::preflight(const EntityReferences &entityReferences,
                         const trait::TraitsDatas &traitsHints,
                         const access::PublishingAccess publishingAccess,
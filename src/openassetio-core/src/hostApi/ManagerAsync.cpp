@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/BatchFuture.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveStream.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../utils/ThreadPool.hpp"
+#include "./BatchFutureState.hpp"
+#include "./ResolveStreamState.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+// The definitions below are the asynchronous variants of the core
+// batch-first callback-based member functions found in `Manager.cpp`.
+
+namespace {
+/**
+ * Pool on which asynchronous requests are run.
+ *
+ * Separate from the pool used for parallel dispatch, since requests
+ * may spend most of their time blocked on I/O. Hence there are at
+ * least a few workers, even on machines with few cores.
+ */
+utils::ThreadPool &asyncRequestPool() {
+  static constexpr unsigned kMinWorkers = 4;
+  static utils::ThreadPool pool{std::max(std::thread::hardware_concurrency(), kMinWorkers)};
+  return pool;
+}
+
+/// Set by Manager::shutdownAsyncRequests.
+std::atomic<bool> isAsyncShutDown{false};
+
+/// Thrown from callbacks to interrupt a cancelled request.
+struct RequestCancelled {};
+
+/**
+ * Run a batch request on the async request pool, returning a handle
+ * to its results.
+ *
+ * @param size Number of elements in the batch.
+ * @param request Callable taking a success and error callback, making
+ * the (blocking) batch call.
+ */
+template <class Value, class Request>
+BatchFuture<Value> launch(const std::size_t size, Request request) {
+  using State = typename BatchFuture<Value>::State;
+  auto state = std::make_shared<State>(size);
+
+  const bool isSubmitted = asyncRequestPool().submit([state, request = std::move(request)] {
+    // Requests are cancelled on shutdown rather than up front, since
+    // they are not tracked.
+    const auto isCancelled = [&state] {
+      if (isAsyncShutDown) {
+        state->cancel();
+      }
+      return state->isCancelled();
+    };
+    const auto checkIndex = [&state](const std::size_t idx) {
+      if (idx >= state->size()) {
+        throw errors::InputValidationException{
+            "Manager provided index " + std::to_string(idx) +
+            " out of range for batch of size " + std::to_string(state->size()) + "."};
+      }
+    };
+
+    if (isCancelled()) {
+      return;
+    }
+    try {
+      request(
+          [&](std::size_t idx, Value value) {
+            if (isCancelled()) {
+              throw RequestCancelled{};
+            }
+            checkIndex(idx);
+            state->setResult(idx, std::move(value));
+          },
+          [&](std::size_t idx, errors::BatchElementError error) {
+            if (isCancelled()) {
+              throw RequestCancelled{};
+            }
+            checkIndex(idx);
+            state->setResult(idx, std::move(error));
+          });
+      state->complete();
+    } catch (...) {
+      // Has no effect if the exception is due to cancellation, since
+      // the state will already be done.
+      state->fail(std::current_exception());
+    }
+  });
+  if (!isSubmitted) {
+    state->cancel();
+  }
+
+  return BatchFuture<Value>{std::move(state)};
+}
+}  // namespace
+
+void Manager::shutdownAsyncRequests() {
+  isAsyncShutDown = true;
+  asyncRequestPool().shutdown();
+}
+
+Manager::ResolveFuture Manager::resolveAsync(EntityReferences entityReferences,
+                                             trait::TraitSet traitSet,
+                                             const access::ResolveAccess resolveAccess,
+                                             ContextConstPtr context) {
+  const std::size_t size = entityReferences.size();
+  return launch<trait::TraitsDataPtr>(
+      size, [manager = shared_from_this(), entityReferences = std::move(entityReferences),
+             traitSet = std::move(traitSet), resolveAccess,
+             context = std::move(context)](const auto &successCallback,
+                                           const auto &errorCallback) {
+        manager->resolve(entityReferences, traitSet, resolveAccess, context, successCallback,
+                         errorCallback);
+      });
+}
+
+ResolveStreamPtr Manager::resolveStream(EntityReferences entityReferences,
+                                        trait::TraitSet traitSet,
+                                        const access::ResolveAccess resolveAccess,
+                                        ContextConstPtr context, const std::size_t maxQueueSize) {
+  if (maxQueueSize == 0) {
+    throw errors::InputValidationException{"maxQueueSize must be greater than zero."};
+  }
+  auto state = std::make_shared<ResolveStream::State>(entityReferences.size(), maxQueueSize);
+  // Constructed before the producer is started, so that the stream
+  // always exists to join it.
+  auto stream = std::make_shared<ResolveStream>(state);
+
+  // The producer blocks whilst the queue is full, for as long as the
+  // host takes to consume it, so it runs on its own thread rather than
+  // the request pool, where it could starve other requests (including
+  // any the host is waiting on in order to make progress).
+  state->start([state, manager = shared_from_this(),
+                entityReferences = std::move(entityReferences), traitSet = std::move(traitSet),
+                resolveAccess, context = std::move(context)] {
+    if (state->isCancelled()) {
+      return;
+    }
+    try {
+      // Track elements the manager responded to, so that any it did
+      // not can be given a default error, as per the kVariant policy.
+      std::vector<bool> isReported(entityReferences.size(), false);
+      const auto push = [&](const std::size_t idx, ResolveStream::ElementResult result) {
+        if (idx >= isReported.size()) {
+          throw errors::InputValidationException{
+              "Manager provided index " + std::to_string(idx) +
+              " out of range for batch of size " + std::to_string(isReported.size()) + "."};
+        }
+        if (!state->push({idx, std::move(result)})) {
+          throw RequestCancelled{};
+        }
+        isReported[idx] = true;
+      };
+
+      manager->resolve(
+          entityReferences, traitSet, resolveAccess, context,
+          [&push](std::size_t idx, trait::TraitsDataPtr traitsData) {
+            push(idx, std::move(traitsData));
+          },
+          [&push](std::size_t idx, errors::BatchElementError error) {
+            push(idx, std::move(error));
+          });
+
+      for (std::size_t idx = 0; idx < isReported.size(); ++idx) {
+        if (!isReported[idx]) {
+          push(idx, errors::BatchElementError{});
+        }
+      }
+      state->finish();
+    } catch (const RequestCancelled&) {
+      state->finish();
+    } catch (...) {
+      state->finish(std::current_exception());
+    }
+  });
+
+  return stream;
+}
+
+Manager::EntityExistsFuture Manager::entityExistsAsync(EntityReferences entityReferences,
+                                                       ContextConstPtr context) {
+  const std::size_t size = entityReferences.size();
+  return launch<bool>(
+      size, [manager = shared_from_this(), entityReferences = std::move(entityReferences),
+             context = std::move(context)](const auto &successCallback,
+                                           const auto &errorCallback) {
+        manager->entityExists(entityReferences, context, successCallback, errorCallback);
+      });
+}
+
+Manager::RelationshipQueryFuture Manager::getWithRelationshipAsync(
+    EntityReferences entityReferences, trait::TraitsDataPtr relationshipTraitsData,
+    const size_t pageSize, const access::RelationsAccess relationsAccess, ContextConstPtr context,
+    trait::TraitSet resultTraitSet) {
+  const std::size_t size = entityReferences.size();
+  return launch<EntityReferencePagerPtr>(
+      size, [manager = shared_from_this(), entityReferences = std::move(entityReferences),
+             relationshipTraitsData = std::move(relationshipTraitsData), pageSize,
+             relationsAccess, context = std::move(context),
+             resultTraitSet = std::move(resultTraitSet)](const auto &successCallback,
+                                                         const auto &errorCallback) {
+        manager->getWithRelationship(entityReferences, relationshipTraitsData, pageSize,
+                                     relationsAccess, context, successCallback, errorCallback,
+                                     resultTraitSet);
+      });
+}
+
+Manager::PublishFuture Manager::preflightAsync(EntityReferences entityReferences,
+                                               trait::TraitsDatas traitsHints,
+                                               const access::PublishingAccess publishingAccess,
+                                               ContextConstPtr context) {
+  const std::size_t size = entityReferences.size();
+  return launch<EntityReference>(
+      size, [manager = shared_from_this(), entityReferences = std::move(entityReferences),
+             traitsHints = std::move(traitsHints), publishingAccess,
+             context = std::move(context)](const auto &successCallback,
+                                           const auto &errorCallback) {
+        manager->preflight(entityReferences, traitsHints, publishingAccess, context,
+                           successCallback, errorCallback);
+      });
+}
+
+Manager::PublishFuture Manager::registerAsync(EntityReferences entityReferences,
+                                              trait::TraitsDatas entityTraitsDatas,
+                                              const access::PublishingAccess publishingAccess,
+                                              ContextConstPtr context) {
+  const std::size_t size = entityReferences.size();
+  return launch<EntityReference>(
+      size, [manager = shared_from_this(), entityReferences = std::move(entityReferences),
+             entityTraitsDatas = std::move(entityTraitsDatas), publishingAccess,
+             context = std::move(context)](const auto &successCallback,
+                                           const auto &errorCallback) {
+        manager->register_(entityReferences, entityTraitsDatas, publishingAccess, context,
+                           successCallback, errorCallback);
+      });
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
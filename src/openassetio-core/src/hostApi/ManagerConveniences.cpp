@@ -266,6 +266,30 @@ hostApi::Manager::resolve(
   return resolveResult;
 }
 
+// Columnar
+hostApi::ResolvedBatch hostApi::Manager::resolveColumns(
+    const EntityReferences &entityReferences, ResolvedBatch::ColumnSpecs columnSpecs,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr &context) {
+  trait::TraitSet traitSet;
+  for (const auto &columnSpec : columnSpecs) {
+    traitSet.insert(columnSpec.traitId);
+  }
+
+  ResolvedBatch resolveResult{std::move(columnSpecs), entityReferences.size()};
+  // Values are extracted as each entity is resolved, so the
+  // TraitsData is released immediately after the callback.
+  resolve(
+      entityReferences, traitSet, resolveAccess, context,
+      [&resolveResult](std::size_t index, const trait::TraitsDataPtr &data) {
+        resolveResult.setValues(index, *data);
+      },
+      [&resolveResult](std::size_t index, errors::BatchElementError error) {
+        resolveResult.setError(index, std::move(error));
+      });
+
+  return resolveResult;
+}
+
 /******************************************
  * preflight
  ******************************************/
@@ -578,6 +602,57 @@ hostApi::Manager::getWithRelationships(
   return result;
 }
 
+/******************************************
+ * getWithRelationshipsMatrix
+ ******************************************/
+
+// Multi Except
+std::vector<EntityReferencePagerPtr> hostApi::Manager::getWithRelationshipsMatrix(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &relationshipTraitsDatas,
+    const size_t pageSize, const access::RelationsAccess relationsAccess,
+    const ContextConstPtr &context, const trait::TraitSet &resultTraitSet,
+    [[maybe_unused]] const BatchElementErrorPolicyTag::Exception &errorPolicyTag) {
+  std::vector<EntityReferencePagerPtr> result;
+  result.resize(entityReferences.size() * relationshipTraitsDatas.size(), nullptr);
+  getWithRelationshipsMatrix(
+      entityReferences, relationshipTraitsDatas, pageSize, relationsAccess, context,
+      [&result](std::size_t index, EntityReferencePagerPtr pager) {
+        result[index] = std::move(pager);
+      },
+      [&entityReferences, numRelationships = relationshipTraitsDatas.size(), relationsAccess](
+          std::size_t index, errors::BatchElementError error) {
+        auto msg = errors::createBatchElementExceptionMessage(
+            error, index, entityReferences[index / numRelationships],
+            static_cast<internal::access::Access>(relationsAccess));
+        throw errors::BatchElementException(index, std::move(error), msg);
+      },
+      resultTraitSet);
+
+  return result;
+}
+
+// Multi Variant
+std::vector<std::variant<errors::BatchElementError, EntityReferencePagerPtr>>
+hostApi::Manager::getWithRelationshipsMatrix(
+    const EntityReferences &entityReferences, const trait::TraitsDatas &relationshipTraitsDatas,
+    const size_t pageSize, const access::RelationsAccess relationsAccess,
+    const ContextConstPtr &context, const trait::TraitSet &resultTraitSet,
+    [[maybe_unused]] const BatchElementErrorPolicyTag::Variant &errorPolicyTag) {
+  std::vector<std::variant<errors::BatchElementError, EntityReferencePagerPtr>> result;
+  result.resize(entityReferences.size() * relationshipTraitsDatas.size());
+  getWithRelationshipsMatrix(
+      entityReferences, relationshipTraitsDatas, pageSize, relationsAccess, context,
+      [&result](std::size_t index, EntityReferencePagerPtr pager) {
+        result[index] = std::move(pager);
+      },
+      [&result](std::size_t index, errors::BatchElementError error) {
+        result[index] = std::move(error);
+      },
+      resultTraitSet);
+
+  return result;
+}
+
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -2,7 +2,9 @@
 // Copyright 2022 The Foundry Visionmongers Ltd
 #include <cstdlib>
 #include <filesystem>
+#include <optional>
 #include <string_view>
+#include <utility>
 
 #include <toml++/toml.h>
 
@@ -57,6 +59,14 @@ ManagerFactory::ManagerDetails ManagerFactory::availableManagers() const {
   ManagerDetails managerDetails;
 
   for (const Identifier& identifier : ids) {
+    // Avoid instantiating the manager if the factory already knows
+    // its details.
+    if (std::optional<ManagerDetail> managerDetail =
+            managerImplementationFactory_->managerDetail(identifier)) {
+      managerDetails.insert({identifier, std::move(*managerDetail)});
+      continue;
+    }
+
     const managerApi::ManagerInterfacePtr managerInterface =
         managerImplementationFactory_->instantiate(identifier);
 
@@ -12,6 +12,11 @@ ManagerImplementationFactoryInterface::ManagerImplementationFactoryInterface(
     log::LoggerInterfacePtr logger)
     : logger_{std::move(logger)} {}
 
+std::optional<ManagerFactory::ManagerDetail> ManagerImplementationFactoryInterface::managerDetail(
+    [[maybe_unused]] const Identifier& identifier) {
+  return std::nullopt;
+}
+
 const log::LoggerInterfacePtr& ManagerImplementationFactoryInterface::logger() const {
   return logger_;
 }
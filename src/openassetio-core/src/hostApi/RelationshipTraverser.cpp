@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/hostApi/RelationshipTraverser.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+namespace {
+/**
+ * Whether the directed graph with the given number of nodes and edges
+ * contains a cycle.
+ *
+ * Iterative depth-first search, where reaching a node that is still
+ * on the stack indicates a back edge.
+ */
+bool containsCycle(const std::size_t numNodes,
+                   const std::vector<RelationshipTraverser::Edge>& edges) {
+  // Compressed adjacency lists: the targets of node `n` are
+  // targets[offsets[n]:offsets[n+1]].
+  std::vector<std::size_t> offsets(numNodes + 1, 0);
+  for (const auto& edge : edges) {
+    ++offsets[edge.source + 1];
+  }
+  for (std::size_t node = 0; node < numNodes; ++node) {
+    offsets[node + 1] += offsets[node];
+  }
+  std::vector<std::size_t> targets(edges.size());
+  {
+    std::vector<std::size_t> fill{offsets.begin(), offsets.end() - 1};
+    for (const auto& edge : edges) {
+      targets[fill[edge.source]++] = edge.target;
+    }
+  }
+
+  enum class Colour : std::uint8_t { kUnvisited, kOnStack, kDone };
+  std::vector<Colour> colours(numNodes, Colour::kUnvisited);
+  // Stack of (node, index of next target to explore).
+  std::vector<std::pair<std::size_t, std::size_t>> stack;
+
+  for (std::size_t root = 0; root < numNodes; ++root) {
+    if (colours[root] != Colour::kUnvisited) {
+      continue;
+    }
+    colours[root] = Colour::kOnStack;
+    stack.emplace_back(root, offsets[root]);
+
+    while (!stack.empty()) {
+      auto& [node, nextTarget] = stack.back();
+      if (nextTarget == offsets[node + 1]) {
+        colours[node] = Colour::kDone;
+        stack.pop_back();
+        continue;
+      }
+      const std::size_t target = targets[nextTarget++];
+      if (colours[target] == Colour::kOnStack) {
+        return true;
+      }
+      if (colours[target] == Colour::kUnvisited) {
+        colours[target] = Colour::kOnStack;
+        stack.emplace_back(target, offsets[target]);
+      }
+    }
+  }
+  return false;
+}
+}  // namespace
+
+RelationshipTraverserPtr RelationshipTraverser::make(ManagerPtr manager,
+                                                     trait::TraitsDataPtr relationshipTraitsData,
+                                                     access::RelationsAccess relationsAccess,
+                                                     ContextConstPtr context,
+                                                     trait::TraitSet resultTraitSet,
+                                                     std::size_t pageSize) {
+  if (pageSize == 0) {
+    throw errors::InputValidationException{"pageSize must be greater than zero."};
+  }
+  return RelationshipTraverserPtr{new RelationshipTraverser{
+      std::move(manager), std::move(relationshipTraitsData), relationsAccess, std::move(context),
+      std::move(resultTraitSet), pageSize}};
+}
+
+RelationshipTraverser::RelationshipTraverser(ManagerPtr manager,
+                                             trait::TraitsDataPtr relationshipTraitsData,
+                                             access::RelationsAccess relationsAccess,
+                                             ContextConstPtr context,
+                                             trait::TraitSet resultTraitSet, std::size_t pageSize)
+    : manager_{std::move(manager)},
+      relationshipTraitsData_{std::move(relationshipTraitsData)},
+      relationsAccess_{relationsAccess},
+      context_{std::move(context)},
+      resultTraitSet_{std::move(resultTraitSet)},
+      pageSize_{pageSize} {}
+
+RelationshipTraverser::Traversal RelationshipTraverser::traverse(
+    const EntityReferences& entityReferences, const std::size_t maxDepth) {
+  Traversal traversal;
+  // Index into traversal.nodes of each visited entity.
+  std::unordered_map<EntityReference, std::size_t> nodeIndices;
+
+  const auto visit = [&](const EntityReference& entityReference, const std::size_t depth) {
+    const auto [iter, inserted] =
+        nodeIndices.try_emplace(entityReference, traversal.nodes.size());
+    if (inserted) {
+      traversal.nodes.push_back(Node{entityReference, depth});
+    }
+    return iter->second;
+  };
+
+  for (const auto& entityReference : entityReferences) {
+    visit(entityReference, 0);
+  }
+
+  std::size_t levelBegin = 0;
+  for (std::size_t depth = 0; depth < maxDepth && levelBegin < traversal.nodes.size();
+       ++depth) {
+    const std::size_t levelEnd = traversal.nodes.size();
+
+    // Batch all frontier entities not already memoised into a single
+    // query.
+    EntityReferences toQuery;
+    std::vector<std::size_t> toQueryNodeIndices;
+    for (std::size_t nodeIdx = levelBegin; nodeIdx < levelEnd; ++nodeIdx) {
+      const EntityReference& entityReference = traversal.nodes[nodeIdx].entityReference;
+      if (relatedCache_.find(entityReference) == relatedCache_.end()) {
+        toQuery.push_back(entityReference);
+        toQueryNodeIndices.push_back(nodeIdx);
+      }
+    }
+
+    if (!toQuery.empty()) {
+      std::vector<EntityReferencePagerPtr> pagers(toQuery.size());
+      ++queryCount_;
+      manager_->getWithRelationship(
+          toQuery, relationshipTraitsData_, pageSize_, relationsAccess_, context_,
+          [&pagers](const std::size_t idx, EntityReferencePagerPtr pager) {
+            pagers[idx] = std::move(pager);
+          },
+          [&traversal, &toQueryNodeIndices](const std::size_t idx,
+                                            errors::BatchElementError error) {
+            traversal.errors.emplace_back(toQueryNodeIndices[idx], std::move(error));
+          },
+          resultTraitSet_);
+
+      for (std::size_t idx = 0; idx < toQuery.size(); ++idx) {
+        if (pagers[idx]) {
+          relatedCache_.insert_or_assign(std::move(toQuery[idx]), pagers[idx]->drainAll());
+        }
+      }
+    }
+
+    // Expand in node order, so that the result is deterministic
+    // regardless of the order the manager responded in.
+    for (std::size_t nodeIdx = levelBegin; nodeIdx < levelEnd; ++nodeIdx) {
+      const auto cached = relatedCache_.find(traversal.nodes[nodeIdx].entityReference);
+      if (cached == relatedCache_.end()) {
+        // Entity in error, so treat as a leaf.
+        continue;
+      }
+      for (const EntityReference& related : cached->second) {
+        traversal.edges.push_back(Edge{nodeIdx, visit(related, depth + 1)});
+      }
+    }
+
+    levelBegin = levelEnd;
+  }
+
+  std::sort(traversal.errors.begin(), traversal.errors.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  traversal.hasCycle = containsCycle(traversal.nodes.size(), traversal.edges);
+
+  return traversal;
+}
+
+std::size_t RelationshipTraverser::queryCount() const { return queryCount_; }
+
+void RelationshipTraverser::clearCache() { relatedCache_.clear(); }
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
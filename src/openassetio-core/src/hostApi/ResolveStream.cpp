@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/hostApi/ResolveStream.hpp>
+
+#include <optional>
+#include <utility>
+
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "./ResolveStreamState.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+ResolveStream::Iterator::Iterator(ResolveStream* stream)
+    : stream_{stream}, current_{stream->next()} {}
+
+ResolveStream::Iterator& ResolveStream::Iterator::operator++() {
+  current_ = stream_->next();
+  return *this;
+}
+
+ResolveStream::ResolveStream(StatePtr state) : state_{std::move(state)} {}
+
+ResolveStream::~ResolveStream() {
+  state_->cancel();
+  state_->join();
+}
+
+std::size_t ResolveStream::size() const { return state_->size(); }
+
+std::size_t ResolveStream::maxQueueSize() const { return state_->maxQueueSize(); }
+
+std::optional<ResolveStream::Element> ResolveStream::next() { return state_->pop(); }
+
+void ResolveStream::cancel() { state_->cancel(); }
+
+ResolveStream::Iterator ResolveStream::begin() { return Iterator{this}; }
+
+ResolveStream::Iterator ResolveStream::end() { return Iterator{}; }
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include <openassetio/hostApi/ResolveStream.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+/**
+ * Bounded queue shared between a ResolveStream and the background
+ * task feeding it.
+ *
+ * The background task runs on a dedicated thread owned by this
+ * instance (see @ref start), since it blocks whilst the queue is full
+ * and so must not occupy a worker of a shared pool. It reports results
+ * via @ref push, then finishes with @ref finish. The host consumes
+ * results via @ref pop, or abandons the stream via @ref cancel.
+ *
+ * The producer thread holds a reference to this instance, so the
+ * consumer must @ref join it before releasing its own reference. This
+ * ensures the last reference is never released on the producer
+ * thread.
+ */
+class ResolveStream::State {
+ public:
+  State(const std::size_t size, const std::size_t maxQueueSize)
+      : size_{size}, maxQueueSize_{maxQueueSize} {}
+
+  ~State() = default;
+
+  State(const State&) = delete;
+  State(State&&) noexcept = delete;
+  State& operator=(const State&) = delete;
+  State& operator=(State&&) noexcept = delete;
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t maxQueueSize() const { return maxQueueSize_; }
+
+  /**
+   * @name Producer interface
+   * @{
+   */
+
+  /**
+   * Run the producer on a dedicated thread.
+   *
+   * Must be called at most once, before the instance is shared with
+   * the consumer.
+   */
+  template <class Producer>
+  void start(Producer producer) {
+    producer_ = std::thread{std::move(producer)};
+  }
+
+  /**
+   * Queue a result, blocking whilst the queue is full.
+   *
+   * @return `false` if the stream was cancelled, in which case the
+   * result is discarded.
+   */
+  bool push(Element element) {
+    {
+      std::unique_lock lock{mutex_};
+      notFull_.wait(lock, [this] { return isCancelled_ || queue_.size() < maxQueueSize_; });
+      if (isCancelled_) {
+        return false;
+      }
+      queue_.push_back(std::move(element));
+    }
+    notEmpty_.notify_one();
+    return true;
+  }
+
+  [[nodiscard]] bool isCancelled() const {
+    const std::lock_guard lock{mutex_};
+    return isCancelled_;
+  }
+
+  /// Mark the request as finished, optionally with an exception.
+  void finish(std::exception_ptr exception = {}) {
+    {
+      const std::lock_guard lock{mutex_};
+      isFinished_ = true;
+      exception_ = std::move(exception);
+    }
+    notEmpty_.notify_one();
+  }
+
+  /**
+   * @}
+   */
+
+  /**
+   * @name Consumer interface
+   * @{
+   */
+
+  std::optional<Element> pop() {
+    std::unique_lock lock{mutex_};
+    notEmpty_.wait(lock, [this] { return isCancelled_ || isFinished_ || !queue_.empty(); });
+    if (isCancelled_) {
+      return std::nullopt;
+    }
+    if (!queue_.empty()) {
+      std::optional<Element> element{std::move(queue_.front())};
+      queue_.pop_front();
+      lock.unlock();
+      notFull_.notify_one();
+      return element;
+    }
+    if (exception_) {
+      // Only surface the exception once.
+      std::exception_ptr exception;
+      std::swap(exception, exception_);
+      std::rethrow_exception(exception);
+    }
+    return std::nullopt;
+  }
+
+  void cancel() {
+    {
+      const std::lock_guard lock{mutex_};
+      isCancelled_ = true;
+      queue_.clear();
+    }
+    notFull_.notify_one();
+    notEmpty_.notify_one();
+  }
+
+  /**
+   * Wait for the producer thread to exit.
+   *
+   * Blocks until the manager's call returns, so should typically be
+   * preceded by @ref cancel.
+   */
+  void join() {
+    if (producer_.joinable()) {
+      producer_.join();
+    }
+  }
+
+  /**
+   * @}
+   */
+
+ private:
+  const std::size_t size_;
+  const std::size_t maxQueueSize_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable notFull_;
+  std::condition_variable notEmpty_;
+  std::deque<Element> queue_;
+  bool isFinished_{false};
+  bool isCancelled_{false};
+  std::exception_ptr exception_;
+  std::thread producer_;
+};
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ResolvedBatch.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace hostApi {
+
+ResolvedBatch::ResolvedBatch(ColumnSpecs columnSpecs, const std::size_t size)
+    : columnSpecs_{std::move(columnSpecs)}, size_{size}, errorFlags_(size), setFlags_(size) {
+  columns_.resize(columnSpecs_.size());
+
+  for (std::size_t columnIdx = 0; columnIdx < columns_.size(); ++columnIdx) {
+    Column& column = columns_[columnIdx];
+    column.validity.resize(size);
+
+    switch (columnSpecs_[columnIdx].type) {
+      case ColumnType::kBool:
+        column.bools.resize(size);
+        break;
+      case ColumnType::kInt:
+        column.ints.resize(size);
+        break;
+      case ColumnType::kFloat:
+        column.floats.resize(size);
+        break;
+      case ColumnType::kStr:
+        column.strOffsets.resize(size);
+        column.strLengths.resize(size);
+        break;
+    }
+  }
+}
+
+void ResolvedBatch::setValues(const std::size_t index, const trait::TraitsData& traitsData) {
+  markSet(index);
+  trait::property::Value value;
+
+  for (std::size_t columnIdx = 0; columnIdx < columns_.size(); ++columnIdx) {
+    const ColumnSpec& spec = columnSpecs_[columnIdx];
+
+    if (!traitsData.getTraitProperty(&value, spec.traitId, spec.propertyKey) ||
+        value.index() != static_cast<std::size_t>(spec.type)) {
+      continue;
+    }
+
+    Column& column = columns_[columnIdx];
+    column.validity[index] = true;
+
+    switch (spec.type) {
+      case ColumnType::kBool:
+        column.bools[index] = static_cast<std::uint8_t>(std::get<Bool>(value));
+        break;
+      case ColumnType::kInt:
+        column.ints[index] = std::get<Int>(value);
+        break;
+      case ColumnType::kFloat:
+        column.floats[index] = std::get<Float>(value);
+        break;
+      case ColumnType::kStr: {
+        // Rows may be populated in any order, so each row records its
+        // own extent within the shared buffer.
+        const Str& str = std::get<Str>(value);
+        column.strOffsets[index] = column.strBuffer.size();
+        column.strLengths[index] = str.size();
+        column.strBuffer += str;
+        break;
+      }
+    }
+  }
+}
+
+void ResolvedBatch::setError(const std::size_t index, errors::BatchElementError error) {
+  markSet(index);
+  errorFlags_[index] = true;
+  errors_.emplace(index, std::move(error));
+}
+
+bool ResolvedBatch::isValid(const std::size_t column, const std::size_t index) const {
+  const Column& validityColumn = checkedColumn(column);
+  checkIndex(index);
+  return validityColumn.validity[index];
+}
+
+bool ResolvedBatch::isError(const std::size_t index) const {
+  checkIndex(index);
+  return errorFlags_[index];
+}
+
+const errors::BatchElementError& ResolvedBatch::error(const std::size_t index) const {
+  const auto iter = errors_.find(index);
+  if (iter == errors_.end()) {
+    throw errors::InputValidationException{
+        fmt::format("ResolvedBatch has no error for index {}.", index)};
+  }
+  return iter->second;
+}
+
+const std::vector<std::uint8_t>& ResolvedBatch::boolColumn(const std::size_t column) const {
+  return checkedColumn(column, ColumnType::kBool).bools;
+}
+
+const std::vector<Int>& ResolvedBatch::intColumn(const std::size_t column) const {
+  return checkedColumn(column, ColumnType::kInt).ints;
+}
+
+const std::vector<Float>& ResolvedBatch::floatColumn(const std::size_t column) const {
+  return checkedColumn(column, ColumnType::kFloat).floats;
+}
+
+const Str& ResolvedBatch::strBuffer(const std::size_t column) const {
+  return checkedColumn(column, ColumnType::kStr).strBuffer;
+}
+
+const std::vector<std::size_t>& ResolvedBatch::strOffsets(const std::size_t column) const {
+  return checkedColumn(column, ColumnType::kStr).strOffsets;
+}
+
+const std::vector<std::size_t>& ResolvedBatch::strLengths(const std::size_t column) const {
+  return checkedColumn(column, ColumnType::kStr).strLengths;
+}
+
+std::string_view ResolvedBatch::strValue(const std::size_t column, const std::size_t index) const {
+  const Column& strColumn = checkedColumn(column, ColumnType::kStr);
+  checkIndex(index);
+  return std::string_view{strColumn.strBuffer}.substr(strColumn.strOffsets[index],
+                                                      strColumn.strLengths[index]);
+}
+
+void ResolvedBatch::checkIndex(const std::size_t index) const {
+  if (index >= size_) {
+    throw errors::InputValidationException{
+        fmt::format("Row index {} is out of range for ResolvedBatch of size {}.", index, size_)};
+  }
+}
+
+void ResolvedBatch::markSet(const std::size_t index) {
+  checkIndex(index);
+  if (setFlags_[index]) {
+    throw errors::InputValidationException{
+        fmt::format("Row index {} of ResolvedBatch has already been set.", index)};
+  }
+  setFlags_[index] = true;
+}
+
+const ResolvedBatch::Column& ResolvedBatch::checkedColumn(const std::size_t column) const {
+  if (column >= columns_.size()) {
+    throw errors::InputValidationException{fmt::format(
+        "Column index {} is out of range for ResolvedBatch with {} columns.", column,
+        columns_.size())};
+  }
+  return columns_[column];
+}
+
+const ResolvedBatch::Column& ResolvedBatch::checkedColumn(const std::size_t column,
+                                                          const ColumnType type) const {
+  const Column& checked = checkedColumn(column);
+  if (columnSpecs_[column].type != type) {
+    throw errors::InputValidationException{fmt::format(
+        "Column {} ('{}' of trait '{}') is not of the requested type.", column,
+        columnSpecs_[column].propertyKey, columnSpecs_[column].traitId)};
+  }
+  return checked;
+}
+}  // namespace hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,594 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/CachingManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+namespace {
+using Clock = CachingManagerInterface::Clock;
+
+/**
+ * Thread-safe, size-bounded, least-recently-used cache with optional
+ * expiry of entries.
+ */
+template <class Value>
+class LruCache {
+ public:
+  LruCache(const std::size_t capacity, const Clock::duration timeToLive)
+      : capacity_{capacity}, timeToLive_{timeToLive} {}
+
+  /**
+   * Get a copy of the value for the given key, if present and not
+   * expired, marking it as most recently used.
+   */
+  std::optional<Value> get(const Str& key) {
+    const std::lock_guard lock{mutex_};
+    const auto indexIter = index_.find(key);
+    if (indexIter == index_.end()) {
+      return std::nullopt;
+    }
+    const auto entryIter = indexIter->second;
+    if (entryIter->expiry <= Clock::now()) {
+      eraseEntry(entryIter);
+      return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, entryIter);
+    return entryIter->value;
+  }
+
+  /**
+   * Insert or update the value for the given key, evicting the least
+   * recently used entry if at capacity.
+   *
+   * If an entity reference is given, then the entry can later be
+   * discarded using @ref erase.
+   */
+  void put(Str key, Value value, Str entityReference = {}) {
+    const Clock::time_point expiry = timeToLive_ == Clock::duration::zero()
+                                         ? Clock::time_point::max()
+                                         : Clock::now() + timeToLive_;
+    const std::lock_guard lock{mutex_};
+    if (const auto indexIter = index_.find(key); indexIter != index_.end()) {
+      const auto entryIter = indexIter->second;
+      entryIter->value = std::move(value);
+      entryIter->expiry = expiry;
+      entries_.splice(entries_.begin(), entries_, entryIter);
+      return;
+    }
+    if (entries_.size() == capacity_) {
+      eraseEntry(std::prev(entries_.end()));
+    }
+    entries_.push_front(
+        Entry{std::move(key), std::move(entityReference), std::move(value), expiry});
+    // Keys are owned by the list nodes, which are address-stable.
+    index_.emplace(entries_.front().key, entries_.begin());
+    if (!entries_.front().entityReference.empty()) {
+      entityIndex_.emplace(entries_.front().entityReference, entries_.begin());
+    }
+  }
+
+  /// Discard all entries for the given entity reference.
+  void erase(const std::string_view entityReference) {
+    const std::lock_guard lock{mutex_};
+    auto [first, last] = entityIndex_.equal_range(entityReference);
+    std::vector<typename Entries::iterator> entryIters;
+    for (; first != last; ++first) {
+      entryIters.push_back(first->second);
+    }
+    for (const auto& entryIter : entryIters) {
+      eraseEntry(entryIter);
+    }
+  }
+
+  /// Discard all entries.
+  void clear() {
+    const std::lock_guard lock{mutex_};
+    index_.clear();
+    entityIndex_.clear();
+    entries_.clear();
+  }
+
+ private:
+  struct Entry {
+    Str key;
+    Str entityReference;
+    Value value;
+    Clock::time_point expiry;
+  };
+  using Entries = std::list<Entry>;
+
+  /// Remove an entry and its index entries. The mutex must be held.
+  void eraseEntry(const typename Entries::iterator entryIter) {
+    index_.erase(entryIter->key);
+    if (!entryIter->entityReference.empty()) {
+      auto [first, last] = entityIndex_.equal_range(entryIter->entityReference);
+      for (; first != last; ++first) {
+        if (first->second == entryIter) {
+          entityIndex_.erase(first);
+          break;
+        }
+      }
+    }
+    entries_.erase(entryIter);
+  }
+
+  const std::size_t capacity_;
+  const Clock::duration timeToLive_;
+  std::mutex mutex_;
+  // Most recently used first.
+  Entries entries_;
+  std::unordered_map<std::string_view, typename Entries::iterator> index_;
+  // Entries keyed on entity reference, for those that have one.
+  std::unordered_multimap<std::string_view, typename Entries::iterator> entityIndex_;
+};
+
+/**
+ * Append a length-prefixed field to a cache key, such that distinct
+ * sequences of fields always result in distinct keys.
+ */
+void appendField(Str& key, const std::string_view field) {
+  key += std::to_string(field.size());
+  key += ':';
+  key += field;
+}
+
+/// Append a trait set to a cache key, independent of iteration order.
+void appendTraitSet(Str& key, const trait::TraitSet& traitSet) {
+  std::vector<std::string_view> traitIds{traitSet.begin(), traitSet.end()};
+  std::sort(traitIds.begin(), traitIds.end());
+  appendField(key, std::to_string(traitIds.size()));
+  for (const auto& traitId : traitIds) {
+    appendField(key, traitId);
+  }
+}
+
+/// Append the full content of a Context's locale to a cache key.
+void appendLocale(Str& key, const ContextConstPtr& context) {
+  if (!context || !context->locale) {
+    appendField(key, "");
+    return;
+  }
+  const trait::TraitsData& locale = *context->locale;
+  const trait::TraitSet traitSet = locale.traitSet();
+  appendTraitSet(key, traitSet);
+
+  std::vector<trait::TraitId> traitIds{traitSet.begin(), traitSet.end()};
+  std::sort(traitIds.begin(), traitIds.end());
+  trait::property::Value value;
+  for (const auto& traitId : traitIds) {
+    const trait::property::KeySet keySet = locale.traitPropertyKeys(traitId);
+    std::vector<trait::property::Key> keys{keySet.begin(), keySet.end()};
+    std::sort(keys.begin(), keys.end());
+    appendField(key, std::to_string(keys.size()));
+    for (const auto& propertyKey : keys) {
+      locale.getTraitProperty(&value, traitId, propertyKey);
+      appendField(key, propertyKey);
+      appendField(key, std::to_string(value.index()));
+      appendField(key, std::visit([](const auto& alt) { return fmt::format("{}", alt); }, value));
+    }
+  }
+}
+
+/// Common prefix of cache keys for all elements of a batch query.
+template <class Access>
+Str makeKeyPrefix(const Access access, const ContextConstPtr& context) {
+  Str key;
+  appendField(key, std::to_string(static_cast<int>(access)));
+  appendLocale(key, context);
+  return key;
+}
+
+/**
+ * Elements of a batch that were not found in the cache, and so must
+ * be queried upstream.
+ */
+struct Misses {
+  EntityReferences entityReferences;
+  /// Index of each missed element in the original batch.
+  std::vector<std::size_t> indices;
+  /// Cache key of each missed element.
+  std::vector<Str> keys;
+};
+
+/**
+ * Check that an index provided by the upstream interface to a
+ * callback is within the bounds of the batch it was given.
+ */
+void checkCallbackIndex(const std::size_t idx, const std::size_t batchSize) {
+  if (idx >= batchSize) {
+    throw errors::InputValidationException{
+        fmt::format("Upstream manager provided index {} out of range for batch of size {}.",
+                    idx, batchSize)};
+  }
+}
+
+/**
+ * Look up each entity reference in the cache, passing hits to
+ * `onHit`, and collecting misses.
+ */
+template <class Value, class OnHit>
+Misses lookUp(LruCache<Value>& cache, const Str& keyPrefix,
+              const EntityReferences& entityReferences, const OnHit& onHit) {
+  Misses misses;
+  Str key;
+  for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+    key = keyPrefix;
+    appendField(key, entityReferences[idx].toString());
+    if (std::optional<Value> cached = cache.get(key)) {
+      onHit(idx, std::move(*cached));
+      continue;
+    }
+    misses.entityReferences.push_back(entityReferences[idx]);
+    misses.indices.push_back(idx);
+    misses.keys.push_back(std::move(key));
+  }
+  return misses;
+}
+}  // namespace
+
+/**
+ * Per-query caches. Hidden from the public header to keep the
+ * implementation details out of the ABI.
+ */
+class CachingManagerInterface::Caches {
+ public:
+  Caches(const std::size_t capacity, const Clock::duration timeToLive)
+      : existence{capacity, timeToLive},
+        entityTraits{capacity, timeToLive},
+        resolve{capacity, timeToLive},
+        managementPolicy{capacity, timeToLive} {}
+
+  void clear() {
+    existence.clear();
+    entityTraits.clear();
+    resolve.clear();
+    managementPolicy.clear();
+  }
+
+  /// Discard all entries for an entity, e.g. after it is published.
+  void erase(const EntityReference& entityReference) {
+    existence.erase(entityReference.toString());
+    entityTraits.erase(entityReference.toString());
+    resolve.erase(entityReference.toString());
+  }
+
+  LruCache<bool> existence;
+  LruCache<trait::TraitSet> entityTraits;
+  // Cached TraitsData are never handed out directly, since the
+  // recipient may modify them.
+  LruCache<trait::TraitsDataConstPtr> resolve;
+  LruCache<trait::TraitsDataConstPtr> managementPolicy;
+};
+
+CachingManagerInterfacePtr CachingManagerInterface::make(ManagerInterfacePtr upstreamInterface,
+                                                         const std::size_t capacity,
+                                                         const Clock::duration timeToLive) {
+  if (!upstreamInterface) {
+    throw errors::InputValidationException{
+        "CachingManagerInterface cannot wrap a null ManagerInterface."};
+  }
+  if (capacity == 0) {
+    throw errors::InputValidationException{
+        "CachingManagerInterface capacity must be greater than zero."};
+  }
+  return std::shared_ptr<CachingManagerInterface>(
+      new CachingManagerInterface{std::move(upstreamInterface), capacity, timeToLive});
+}
+
+CachingManagerInterface::CachingManagerInterface(ManagerInterfacePtr upstreamInterface,
+                                                 const std::size_t capacity,
+                                                 const Clock::duration timeToLive)
+    : upstreamInterface_{std::move(upstreamInterface)},
+      caches_{std::make_unique<Caches>(capacity, timeToLive)} {}
+
+CachingManagerInterface::~CachingManagerInterface() = default;
+
+const ManagerInterfacePtr& CachingManagerInterface::upstreamInterface() const {
+  return upstreamInterface_;
+}
+
+/******************************************
+ * Forwarded methods
+ ******************************************/
+
+Identifier CachingManagerInterface::identifier() const {
+  return upstreamInterface_->identifier();
+}
+
+Str CachingManagerInterface::displayName() const { return upstreamInterface_->displayName(); }
+
+bool CachingManagerInterface::hasCapability(const Capability capability) {
+  return upstreamInterface_->hasCapability(capability);
+}
+
+InfoDictionary CachingManagerInterface::info() { return upstreamInterface_->info(); }
+
+StrMap CachingManagerInterface::updateTerminology(StrMap terms,
+                                                  const HostSessionPtr& hostSession) {
+  return upstreamInterface_->updateTerminology(std::move(terms), hostSession);
+}
+
+InfoDictionary CachingManagerInterface::settings(const HostSessionPtr& hostSession) {
+  return upstreamInterface_->settings(hostSession);
+}
+
+void CachingManagerInterface::initialize(InfoDictionary managerSettings,
+                                         const HostSessionPtr& hostSession) {
+  // Settings may affect query results.
+  caches_->clear();
+  upstreamInterface_->initialize(std::move(managerSettings), hostSession);
+}
+
+ManagerStateBasePtr CachingManagerInterface::createState(const HostSessionPtr& hostSession) {
+  return upstreamInterface_->createState(hostSession);
+}
+
+ManagerStateBasePtr CachingManagerInterface::createChildState(
+    const ManagerStateBasePtr& parentState, const HostSessionPtr& hostSession) {
+  return upstreamInterface_->createChildState(parentState, hostSession);
+}
+
+Str CachingManagerInterface::persistenceTokenForState(const ManagerStateBasePtr& state,
+                                                      const HostSessionPtr& hostSession) {
+  return upstreamInterface_->persistenceTokenForState(state, hostSession);
+}
+
+ManagerStateBasePtr CachingManagerInterface::stateFromPersistenceToken(
+    const Str& token, const HostSessionPtr& hostSession) {
+  return upstreamInterface_->stateFromPersistenceToken(token, hostSession);
+}
+
+bool CachingManagerInterface::isEntityReferenceString(const Str& someString,
+                                                      const HostSessionPtr& hostSession) {
+  return upstreamInterface_->isEntityReferenceString(someString, hostSession);
+}
+
+std::vector<bool> CachingManagerInterface::areEntityReferenceStrings(
+    const std::vector<std::string_view>& someStrings, const HostSessionPtr& hostSession) {
+  return upstreamInterface_->areEntityReferenceStrings(someStrings, hostSession);
+}
+
+void CachingManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  upstreamInterface_->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession,
+                                             successCallback, errorCallback);
+}
+
+void CachingManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  upstreamInterface_->getWithRelationship(entityReferences, relationshipTraitsData,
+                                          resultTraitSet, pageSize, relationsAccess, context,
+                                          hostSession, successCallback, errorCallback);
+}
+
+void CachingManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  upstreamInterface_->getWithRelationships(entityReference, relationshipTraitsDatas,
+                                           resultTraitSet, pageSize, relationsAccess, context,
+                                           hostSession, successCallback, errorCallback);
+}
+
+void CachingManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  upstreamInterface_->getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                 resultTraitSet, pageSize, relationsAccess,
+                                                 context, hostSession, successCallback,
+                                                 errorCallback);
+}
+
+void CachingManagerInterface::preflight(const EntityReferences& entityReferences,
+                                        const trait::TraitsDatas& traitsHints,
+                                        const access::PublishingAccess publishingAccess,
+                                        const ContextConstPtr& context,
+                                        const HostSessionPtr& hostSession,
+                                        const PreflightSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  // Publishing changes what is cached for both the given and returned
+  // references.
+  upstreamInterface_->preflight(
+      entityReferences, traitsHints, publishingAccess, context, hostSession,
+      [&](const std::size_t idx, EntityReference entityReference) {
+        checkCallbackIndex(idx, entityReferences.size());
+        caches_->erase(entityReferences[idx]);
+        caches_->erase(entityReference);
+        successCallback(idx, std::move(entityReference));
+      },
+      errorCallback);
+}
+
+void CachingManagerInterface::register_(const EntityReferences& entityReferences,
+                                        const trait::TraitsDatas& entityTraitsDatas,
+                                        const access::PublishingAccess publishingAccess,
+                                        const ContextConstPtr& context,
+                                        const HostSessionPtr& hostSession,
+                                        const RegisterSuccessCallback& successCallback,
+                                        const BatchElementErrorCallback& errorCallback) {
+  // Publishing changes what is cached for both the given and returned
+  // references.
+  upstreamInterface_->register_(
+      entityReferences, entityTraitsDatas, publishingAccess, context, hostSession,
+      [&](const std::size_t idx, EntityReference entityReference) {
+        checkCallbackIndex(idx, entityReferences.size());
+        caches_->erase(entityReferences[idx]);
+        caches_->erase(entityReference);
+        successCallback(idx, std::move(entityReference));
+      },
+      errorCallback);
+}
+
+/******************************************
+ * Cached methods
+ ******************************************/
+
+trait::TraitsDatas CachingManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession) {
+  const Str keyPrefix = makeKeyPrefix(policyAccess, context);
+
+  trait::TraitsDatas policies(traitSets.size());
+  trait::TraitSets missedTraitSets;
+  std::vector<std::size_t> missedIndices;
+  std::vector<Str> missedKeys;
+
+  Str key;
+  for (std::size_t idx = 0; idx < traitSets.size(); ++idx) {
+    key = keyPrefix;
+    appendTraitSet(key, traitSets[idx]);
+    if (const auto cached = caches_->managementPolicy.get(key)) {
+      policies[idx] = trait::TraitsData::make(*cached);
+      continue;
+    }
+    missedTraitSets.push_back(traitSets[idx]);
+    missedIndices.push_back(idx);
+    missedKeys.push_back(std::move(key));
+  }
+
+  if (missedTraitSets.empty()) {
+    return policies;
+  }
+
+  trait::TraitsDatas missedPolicies =
+      upstreamInterface_->managementPolicy(missedTraitSets, policyAccess, context, hostSession);
+
+  const std::size_t numResults = std::min(missedPolicies.size(), missedIndices.size());
+  for (std::size_t missedIdx = 0; missedIdx < numResults; ++missedIdx) {
+    trait::TraitsDataPtr& policy = missedPolicies[missedIdx];
+    if (policy) {
+      caches_->managementPolicy.put(std::move(missedKeys[missedIdx]),
+                                    trait::TraitsData::make(policy));
+    }
+    policies[missedIndices[missedIdx]] = std::move(policy);
+  }
+  return policies;
+}
+
+void CachingManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                           const ContextConstPtr& context,
+                                           const HostSessionPtr& hostSession,
+                                           const ExistsSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  // No access mode for existence queries.
+  const Str keyPrefix = makeKeyPrefix(0, context);
+
+  Misses misses = lookUp(caches_->existence, keyPrefix, entityReferences, successCallback);
+  if (misses.entityReferences.empty()) {
+    return;
+  }
+
+  upstreamInterface_->entityExists(
+      misses.entityReferences, context, hostSession,
+      [&](const std::size_t missedIdx, const bool exists) {
+        checkCallbackIndex(missedIdx, misses.indices.size());
+        caches_->existence.put(std::move(misses.keys[missedIdx]), exists,
+                               misses.entityReferences[missedIdx].toString());
+        successCallback(misses.indices[missedIdx], exists);
+      },
+      [&](const std::size_t missedIdx, errors::BatchElementError error) {
+        checkCallbackIndex(missedIdx, misses.indices.size());
+        errorCallback(misses.indices[missedIdx], std::move(error));
+      });
+}
+
+void CachingManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                           const access::EntityTraitsAccess entityTraitsAccess,
+                                           const ContextConstPtr& context,
+                                           const HostSessionPtr& hostSession,
+                                           const EntityTraitsSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  const Str keyPrefix = makeKeyPrefix(entityTraitsAccess, context);
+
+  Misses misses = lookUp(caches_->entityTraits, keyPrefix, entityReferences, successCallback);
+  if (misses.entityReferences.empty()) {
+    return;
+  }
+
+  upstreamInterface_->entityTraits(
+      misses.entityReferences, entityTraitsAccess, context, hostSession,
+      [&](const std::size_t missedIdx, trait::TraitSet traitSet) {
+        checkCallbackIndex(missedIdx, misses.indices.size());
+        caches_->entityTraits.put(std::move(misses.keys[missedIdx]), traitSet,
+                                  misses.entityReferences[missedIdx].toString());
+        successCallback(misses.indices[missedIdx], std::move(traitSet));
+      },
+      [&](const std::size_t missedIdx, errors::BatchElementError error) {
+        checkCallbackIndex(missedIdx, misses.indices.size());
+        errorCallback(misses.indices[missedIdx], std::move(error));
+      });
+}
+
+void CachingManagerInterface::resolve(const EntityReferences& entityReferences,
+                                      const trait::TraitSet& traitSet,
+                                      const access::ResolveAccess resolveAccess,
+                                      const ContextConstPtr& context,
+                                      const HostSessionPtr& hostSession,
+                                      const ResolveSuccessCallback& successCallback,
+                                      const BatchElementErrorCallback& errorCallback) {
+  Str keyPrefix = makeKeyPrefix(resolveAccess, context);
+  appendTraitSet(keyPrefix, traitSet);
+
+  Misses misses =
+      lookUp(caches_->resolve, keyPrefix, entityReferences,
+             [&](const std::size_t idx, const trait::TraitsDataConstPtr& cached) {
+               successCallback(idx, trait::TraitsData::make(cached));
+             });
+  if (misses.entityReferences.empty()) {
+    return;
+  }
+
+  upstreamInterface_->resolve(
+      misses.entityReferences, traitSet, resolveAccess, context, hostSession,
+      [&](const std::size_t missedIdx, trait::TraitsDataPtr traitsData) {
+        checkCallbackIndex(missedIdx, misses.indices.size());
+        if (traitsData) {
+          caches_->resolve.put(std::move(misses.keys[missedIdx]),
+                               trait::TraitsData::make(traitsData),
+                               misses.entityReferences[missedIdx].toString());
+        }
+        successCallback(misses.indices[missedIdx], std::move(traitsData));
+      },
+      [&](const std::size_t missedIdx, errors::BatchElementError error) {
+        checkCallbackIndex(missedIdx, misses.indices.size());
+        errorCallback(misses.indices[missedIdx], std::move(error));
+      });
+}
+
+void CachingManagerInterface::flushCaches(const HostSessionPtr& hostSession) {
+  caches_->clear();
+  upstreamInterface_->flushCaches(hostSession);
+}
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2023 The Foundry Visionmongers Ltd
+#include <cstddef>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -121,6 +125,16 @@ bool ManagerInterface::isEntityReferenceString(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kEntityReferenceIdentification)};
 }
 
+std::vector<bool> ManagerInterface::areEntityReferenceStrings(
+    const std::vector<std::string_view>& someStrings, const HostSessionPtr& hostSession) {
+  std::vector<bool> results;
+  results.reserve(someStrings.size());
+  for (const std::string_view someString : someStrings) {
+    results.push_back(isEntityReferenceString(Str{someString}, hostSession));
+  }
+  return results;
+}
+
 // To avoid changing this to non-static in the not too distant, when we
 // add manager validation (see https://github.com/OpenAssetIO/OpenAssetIO/issues/553).
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
@@ -165,6 +179,45 @@ void ManagerInterface::getWithRelationships(
       UNIMPLEMENTED_ERROR(ManagerInterface::Capability::kRelationshipQueries)};
 }
 
+void ManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  const std::size_t numRelationships = relationshipTraitsDatas.size();
+
+  if (numRelationships <= entityReferences.size()) {
+    // One call per relationship, each batching all entities.
+    for (std::size_t relationshipIdx = 0; relationshipIdx < numRelationships;
+         ++relationshipIdx) {
+      getWithRelationship(
+          entityReferences, relationshipTraitsDatas[relationshipIdx], resultTraitSet, pageSize,
+          relationsAccess, context, hostSession,
+          [&](const std::size_t entityIdx, EntityReferencePagerInterfacePtr pager) {
+            successCallback(entityIdx * numRelationships + relationshipIdx, std::move(pager));
+          },
+          [&](const std::size_t entityIdx, errors::BatchElementError error) {
+            errorCallback(entityIdx * numRelationships + relationshipIdx, std::move(error));
+          });
+    }
+    return;
+  }
+
+  // One call per entity, each batching all relationships.
+  for (std::size_t entityIdx = 0; entityIdx < entityReferences.size(); ++entityIdx) {
+    getWithRelationships(
+        entityReferences[entityIdx], relationshipTraitsDatas, resultTraitSet, pageSize,
+        relationsAccess, context, hostSession,
+        [&](const std::size_t relationshipIdx, EntityReferencePagerInterfacePtr pager) {
+          successCallback(entityIdx * numRelationships + relationshipIdx, std::move(pager));
+        },
+        [&](const std::size_t relationshipIdx, errors::BatchElementError error) {
+          errorCallback(entityIdx * numRelationships + relationshipIdx, std::move(error));
+        });
+  }
+}
+
 void ManagerInterface::preflight(
     [[maybe_unused]] const EntityReferences& entityReferences,
     [[maybe_unused]] const trait::TraitsDatas& traitsHints,
@@ -10,15 +10,28 @@
 #include <dlfcn.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <system_error>
 
 #include <fmt/format.h>
+#include <toml++/toml.h>
 
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/pluginSystem/CppPluginSystem.hpp>
 #include <openassetio/pluginSystem/CppPluginSystemPlugin.hpp>
 
+#include "../utils/ThreadPool.hpp"
+
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace pluginSystem {
@@ -89,87 +102,65 @@ constexpr std::string_view kLibExt = ".so";
 // Path separator for encoding multiple search paths in a single string.
 constexpr char kPathSep = ':';
 #endif
-}  // namespace
-
-CppPluginSystemPtr CppPluginSystem::make(log::LoggerInterfacePtr logger) {
-  return std::make_shared<CppPluginSystem>(CppPluginSystem{std::move(logger)});
-}
-
-void CppPluginSystem::reset() {
-  // Note: do not dlclose plugins - they may be in use.
-  plugins_.clear();
-}
-
-CppPluginSystem::CppPluginSystem(log::LoggerInterfacePtr logger) : logger_{std::move(logger)} {}
-
-void CppPluginSystem::scan(const std::string_view paths) {
-  std::size_t pathsStartIdx = 0;
-  std::size_t pathsEndIdx = 0;
-
-  // Loop through each path in ';'/:'-delimited paths string.
-  while ((pathsStartIdx = paths.find_first_not_of(kPathSep, pathsEndIdx)) != std::string::npos) {
-    pathsEndIdx = paths.find(kPathSep, pathsStartIdx);
-    const std::filesystem::path directoryPath =
-        paths.substr(pathsStartIdx, pathsEndIdx - pathsStartIdx);
-
-    // Check the provided path is actually a searchable directory.
-    if (!std::filesystem::is_directory(directoryPath)) {
-      logger_->debug(fmt::format("CppPluginSystem: Skipping as not a directory '{}'",
-                                 directoryPath.string()));
-      continue;
-    }
 
-    // Loop each item in the provided search path.
-    for (const std::filesystem::directory_entry& directoryEntry :
-         std::filesystem::directory_iterator{directoryPath}) {
-      std::filesystem::path filePath = directoryEntry.path();
-
-      // Assume the item in the search path is a plugin file and attempt
-      // to load it.
-      if (MaybeIdentifierAndPlugin idAndPlugin = maybeLoadPlugin(filePath)) {
-        logger_->debug(fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'",
-                                   idAndPlugin->first, filePath.string()));
-        // Register the successfully loaded plugin.
-        plugins_[std::move(idAndPlugin->first)] = {std::move(filePath),
-                                                   std::move(idAndPlugin->second)};
-      }
-    }
-  }
-}
+// First line of a scan cache file, to be bumped if the format changes.
+constexpr std::string_view kScanCacheHeader = "openassetio-cpp-plugin-scan-cache 1";
+
+/// Log message deferred until back on the calling thread.
+struct LogMessage {
+  log::LoggerInterface::Severity severity;
+  Str message;
+};
+
+/// Outcome of attempting to load a candidate plugin library.
+struct LoadResult {
+  /// Messages to log, in order.
+  std::vector<LogMessage> logs;
+  /// Library handle, null if the library failed to provide a plugin.
+  void* handle{nullptr};
+  /// Identifier of the loaded plugin.
+  Identifier identifier;
+  /// Loaded plugin, null if the library failed to provide a plugin.
+  CppPluginSystemPluginPtr plugin;
+  /// Exception thrown whilst loading, to be rethrown on the calling
+  /// thread.
+  std::exception_ptr exception;
+};
 
-openassetio::Identifiers CppPluginSystem::identifiers() const {
-  openassetio::Identifiers result;
-  result.reserve(plugins_.size());
-  std::transform(begin(plugins_), end(plugins_), std::back_inserter(result),
-                 [](const auto& iter) { return iter.first; });
-  return result;
-}
-
-const CppPluginSystem::PathAndPlugin& CppPluginSystem::plugin(const Identifier& identifier) const {
-  const auto iter = plugins_.find(identifier);
-  if (iter == plugins_.end()) {
-    throw errors::InputValidationException{fmt::format(
-        "CppPluginSystem: No plug-in registered with the identifier '{}'", identifier)};
-  }
-
-  return iter->second;
-}
-
-CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
-    const std::filesystem::path& filePath) {
+/**
+ * Check if a directory entry looks like a plugin library, logging
+ * if not.
+ */
+bool isCandidateLibrary(const std::filesystem::path& filePath,
+                        const log::LoggerInterfacePtr& logger) {
   // Check the proposed path is actually a file.
   if (!std::filesystem::is_regular_file(filePath)) {
-    logger_->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
-                               filePath.string()));
-    return {};
+    logger->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
+                              filePath.string()));
+    return false;
   }
 
   // Check the proposed file name looks like a shared library.
   if (filePath.extension() != kLibExt) {
-    logger_->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
-                               filePath.string()));
-    return {};
+    logger->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
+                              filePath.string()));
+    return false;
   }
+  return true;
+}
+
+/**
+ * Attempt to load a plugin from a library.
+ *
+ * Log messages are collected in the result rather than logged
+ * directly, so that libraries can be loaded on worker threads.
+ */
+LoadResult loadLibrary(const std::filesystem::path& filePath) {
+  LoadResult result;
+  const auto log = [&result](log::LoggerInterface::Severity severity, Str message) {
+    result.logs.push_back({severity, std::move(message)});
+  };
+  using Severity = log::LoggerInterface::Severity;
 
   // Open the binary.
   //
@@ -183,18 +174,18 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
   void* handle = dlopen(filePath.c_str(), RTLD_LAZY | RTLD_LOCAL);
 
   if (!handle) {
-    logger_->debug(fmt::format("CppPluginSystem: Failed to open library '{}': {}",
-                               filePath.string(), dlerror()));
-    return {};
+    log(Severity::kDebug, fmt::format("CppPluginSystem: Failed to open library '{}': {}",
+                                      filePath.string(), dlerror()));
+    return result;
   }
 
   // Get the entrypoint function.
   void* entrypoint = dlsym(handle, kEntrypointFnName);
   if (!entrypoint) {
-    logger_->debug(fmt::format("CppPluginSystem: No top-level '{}' function in '{}': {}",
-                               kEntrypointFnName, filePath.string(), dlerror()));
+    log(Severity::kDebug, fmt::format("CppPluginSystem: No top-level '{}' function in '{}': {}",
+                                      kEntrypointFnName, filePath.string(), dlerror()));
     dlclose(handle);
-    return {};
+    return result;
   }
 
   // Load the plugin object.
@@ -220,11 +211,11 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
 
   // Check if the shared_ptr contains nullptr.
   if (!plugin) {
-    logger_->warning(
+    log(Severity::kWarning,
         fmt::format("CppPluginSystem: Null plugin returned by '{}'", filePath.string()));
 
     dlclose(handle);
-    return {};
+    return result;
   }
 
   // Get plugin's unique identifier.
@@ -232,12 +223,12 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
   try {
     identifier = plugin->identifier();
   } catch (const std::exception& exc) {
-    logger_->warning(
+    log(Severity::kWarning,
         fmt::format("CppPluginSystem: Caught exception calling 'identifier' of '{}': {}",
                     filePath.string(), exc.what()));
     plugin.reset();
   } catch (...) {
-    logger_->warning(
+    log(Severity::kWarning,
         fmt::format("CppPluginSystem: Caught exception calling 'identifier' of '{}':"
                     " <unknown non-exception value caught>",
                     filePath.string()));
@@ -252,20 +243,447 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
   // loaded.
   if (!plugin) {
     dlclose(handle);
-    return {};
+    return result;
   }
 
-  // Ensure it's not already been registered.
-  if (const auto iter = plugins_.find(identifier); iter != plugins_.end()) {
-    logger_->debug(
-        fmt::format("CppPluginSystem: Skipping '{}' defined in '{}'. Already registered by '{}'",
-                    identifier, filePath.string(), iter->second.first.string()));
-    plugin.reset();  // Must destroy _before_ closing lib.
-    dlclose(handle);
-    return {};
+  result.handle = handle;
+  result.identifier = std::move(identifier);
+  result.plugin = std::move(plugin);
+  return result;
+}
+
+/**
+ * Load many libraries concurrently, using the shared thread pool as
+ * well as the calling thread.
+ *
+ * @return Results in the same order as the given paths.
+ */
+std::vector<LoadResult> loadLibrariesConcurrently(
+    const std::vector<std::filesystem::path>& filePaths) {
+  struct State {
+    explicit State(const std::vector<std::filesystem::path>& paths)
+        : filePaths{paths}, results(paths.size()) {}
+
+    void run() {
+      for (std::size_t idx = 0; (idx = nextIdx.fetch_add(1)) < filePaths.size();) {
+        try {
+          results[idx] = loadLibrary(filePaths[idx]);
+        } catch (...) {
+          results[idx].exception = std::current_exception();
+        }
+        {
+          const std::lock_guard lock{mutex};
+          ++numDone;
+        }
+        condition.notify_all();
+      }
+    }
+
+    std::vector<std::filesystem::path> filePaths;
+    std::vector<LoadResult> results;
+    std::atomic<std::size_t> nextIdx{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t numDone{0};
+  };
+
+  const auto state = std::make_shared<State>(filePaths);
+  utils::ThreadPool& pool = utils::ThreadPool::shared();
+  const std::size_t numWorkers = std::min(filePaths.size(), pool.size() + 1);
+
+  // The calling thread is one of the workers.
+  for (std::size_t workerIdx = 1; workerIdx < numWorkers; ++workerIdx) {
+    pool.submit([state] { state->run(); });
+  }
+  state->run();
+
+  std::unique_lock lock{state->mutex};
+  state->condition.wait(lock, [&state] { return state->numDone == state->filePaths.size(); });
+  return std::move(state->results);
+}
+
+/// Modification time and size of a file, if available.
+std::optional<std::pair<std::int64_t, std::uintmax_t>> fileStamp(
+    const std::filesystem::path& filePath) {
+  std::error_code errorCode;
+  const auto modificationTime = std::filesystem::last_write_time(filePath, errorCode);
+  if (errorCode) {
+    return std::nullopt;
+  }
+  const std::uintmax_t size = std::filesystem::file_size(filePath, errorCode);
+  if (errorCode) {
+    return std::nullopt;
+  }
+  return {{static_cast<std::int64_t>(modificationTime.time_since_epoch().count()), size}};
+}
+
+/**
+ * Read the manifest accompanying a plugin library, if any.
+ *
+ * An invalid manifest is logged and ignored, such that the library is
+ * loaded instead.
+ */
+std::optional<CppPluginSystem::PluginManifest> readManifest(
+    const std::filesystem::path& filePath, const log::LoggerInterfacePtr& logger) {
+  std::filesystem::path manifestPath = filePath;
+  manifestPath.replace_extension(CppPluginSystem::kManifestExtension);
+
+  std::error_code errorCode;
+  if (!std::filesystem::is_regular_file(manifestPath, errorCode)) {
+    return std::nullopt;
+  }
+
+  toml::parse_result document;
+  try {
+    document = toml::parse_file(manifestPath.string());
+  } catch (const std::exception& exc) {
+    logger->warning(fmt::format("CppPluginSystem: Ignoring invalid manifest '{}': {}",
+                                manifestPath.string(), exc.what()));
+    return std::nullopt;
   }
 
-  return {{std::move(identifier), std::move(plugin)}};
+  CppPluginSystem::PluginManifest manifest;
+  manifest.identifier = Str{document["plugin"]["identifier"].value_or("")};
+  manifest.kind = Str{document["plugin"]["kind"].value_or("")};
+  manifest.displayName = Str{document["plugin"]["displayName"].value_or("")};
+
+  if (manifest.identifier.empty() || manifest.kind.empty()) {
+    logger->warning(fmt::format(
+        "CppPluginSystem: Ignoring invalid manifest '{}': a plug-in identifier and kind are"
+        " required",
+        manifestPath.string()));
+    return std::nullopt;
+  }
+
+  if (toml::table* infoTable = document["plugin"]["info"].as_table()) {
+    for (const auto& [key, val] : *infoTable) {
+      if (val.is_integer()) {
+        manifest.info.insert({Str{key}, val.as_integer()->get()});
+      } else if (val.is_floating_point()) {
+        manifest.info.insert({Str{key}, val.as_floating_point()->get()});
+      } else if (val.is_string()) {
+        manifest.info.insert({Str{key}, val.as_string()->get()});
+      } else if (val.is_boolean()) {
+        manifest.info.insert({Str{key}, val.as_boolean()->get()});
+      } else {
+        logger->warning(fmt::format(
+            "CppPluginSystem: Ignoring invalid manifest '{}': unsupported value type for '{}'",
+            manifestPath.string(), key.str()));
+        return std::nullopt;
+      }
+    }
+  }
+  return manifest;
+}
+
+/// Check if a string can be stored in a line-based scan cache file.
+bool isCacheable(const std::string_view str) {
+  return str.find_first_of("\t\n\r") == std::string_view::npos;
+}
+}  // namespace
+
+CppPluginSystemPtr CppPluginSystem::make(log::LoggerInterfacePtr logger) {
+  return CppPluginSystemPtr{new CppPluginSystem{std::move(logger)}};
+}
+
+void CppPluginSystem::reset() {
+  // Note: do not dlclose plugins - they may be in use.
+  plugins_.clear();
+  manifests_.clear();
+}
+
+CppPluginSystem::CppPluginSystem(log::LoggerInterfacePtr logger) : logger_{std::move(logger)} {}
+
+void CppPluginSystem::scan(const std::string_view paths) {
+  std::vector<std::filesystem::path> candidatePaths;
+  std::size_t pathsStartIdx = 0;
+  std::size_t pathsEndIdx = 0;
+
+  // Loop through each path in ';'/:'-delimited paths string.
+  while ((pathsStartIdx = paths.find_first_not_of(kPathSep, pathsEndIdx)) != std::string::npos) {
+    pathsEndIdx = paths.find(kPathSep, pathsStartIdx);
+    const std::filesystem::path directoryPath =
+        paths.substr(pathsStartIdx, pathsEndIdx - pathsStartIdx);
+
+    // Check the provided path is actually a searchable directory.
+    if (!std::filesystem::is_directory(directoryPath)) {
+      logger_->debug(fmt::format("CppPluginSystem: Skipping as not a directory '{}'",
+                                 directoryPath.string()));
+      continue;
+    }
+
+    // Loop each item in the provided search path, gathering those that
+    // look like plugin libraries.
+    for (const std::filesystem::directory_entry& directoryEntry :
+         std::filesystem::directory_iterator{directoryPath}) {
+      if (isCandidateLibrary(directoryEntry.path(), logger_)) {
+        candidatePaths.push_back(directoryEntry.path());
+      }
+    }
+  }
+
+  // Look up candidates' manifests, then the scan cache, such that only
+  // libraries with neither need to be loaded.
+  readScanCache();
+  std::vector<std::optional<PluginManifest>> manifests(candidatePaths.size());
+  std::vector<std::optional<std::pair<std::int64_t, std::uintmax_t>>> stamps(
+      candidatePaths.size());
+  std::vector<const Identifier*> cachedIdentifiers(candidatePaths.size(), nullptr);
+  std::vector<std::filesystem::path> uncachedPaths;
+
+  for (std::size_t idx = 0; idx < candidatePaths.size(); ++idx) {
+    manifests[idx] = readManifest(candidatePaths[idx], logger_);
+    if (manifests[idx]) {
+      continue;
+    }
+    if (!scanCachePath_.empty()) {
+      stamps[idx] = fileStamp(candidatePaths[idx]);
+      const auto cacheIter = scanCache_.find(candidatePaths[idx].string());
+      if (stamps[idx] && cacheIter != scanCache_.end() &&
+          cacheIter->second.modificationTime == stamps[idx]->first &&
+          cacheIter->second.size == stamps[idx]->second) {
+        cachedIdentifiers[idx] = &cacheIter->second.identifier;
+        continue;
+      }
+    }
+    uncachedPaths.push_back(candidatePaths[idx]);
+  }
+
+  std::vector<LoadResult> preloaded;
+  if (isParallelLoadingEnabled_ && uncachedPaths.size() > 1) {
+    preloaded = loadLibrariesConcurrently(uncachedPaths);
+  }
+
+  // Register plugins in search path order.
+  bool isScanCacheModified = false;
+  std::size_t uncachedIdx = 0;
+
+  for (std::size_t idx = 0; idx < candidatePaths.size(); ++idx) {
+    std::filesystem::path& filePath = candidatePaths[idx];
+
+    if (std::optional<PluginManifest>& manifest = manifests[idx]) {
+      if (isAlreadyRegistered(manifest->identifier, filePath)) {
+        continue;
+      }
+      logger_->debug(
+          fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}' using its manifest",
+                      manifest->identifier, filePath.string()));
+      // Defer loading until the plugin is requested.
+      plugins_[manifest->identifier] = {std::move(filePath), nullptr};
+      Identifier identifier = manifest->identifier;
+      manifests_[std::move(identifier)] = std::move(*manifest);
+      continue;
+    }
+
+    if (const Identifier* identifier = cachedIdentifiers[idx]) {
+      if (isAlreadyRegistered(*identifier, filePath)) {
+        continue;
+      }
+      logger_->debug(fmt::format(
+          "CppPluginSystem: Registered plug-in '{}' from '{}' using the scan cache", *identifier,
+          filePath.string()));
+      // Defer loading until the plugin is requested.
+      plugins_[*identifier] = {std::move(filePath), nullptr};
+      continue;
+    }
+
+    LoadResult result = preloaded.empty() ? loadLibrary(filePath)
+                                          : std::move(preloaded[uncachedIdx]);
+    ++uncachedIdx;
+
+    for (LogMessage& logMessage : result.logs) {
+      logger_->log(logMessage.severity, std::move(logMessage.message));
+    }
+    if (result.exception) {
+      std::rethrow_exception(result.exception);
+    }
+    if (!result.plugin) {
+      continue;
+    }
+
+    if (stamps[idx] && isCacheable(filePath.string()) && isCacheable(result.identifier)) {
+      scanCache_[filePath.string()] = {stamps[idx]->first, stamps[idx]->second,
+                                       result.identifier};
+      isScanCacheModified = true;
+    }
+
+    // Ensure it's not already been registered.
+    if (isAlreadyRegistered(result.identifier, filePath)) {
+      result.plugin.reset();  // Must destroy _before_ closing lib.
+      dlclose(result.handle);
+      continue;
+    }
+
+    logger_->debug(fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'",
+                               result.identifier, filePath.string()));
+    // Register the successfully loaded plugin.
+    plugins_[std::move(result.identifier)] = {std::move(filePath), std::move(result.plugin)};
+  }
+
+  if (isScanCacheModified) {
+    writeScanCache();
+  }
+}
+
+void CppPluginSystem::enableParallelLoading() { isParallelLoadingEnabled_ = true; }
+
+void CppPluginSystem::disableParallelLoading() { isParallelLoadingEnabled_ = false; }
+
+bool CppPluginSystem::isParallelLoadingEnabled() const { return isParallelLoadingEnabled_; }
+
+void CppPluginSystem::setScanCachePath(std::filesystem::path cachePath) {
+  scanCachePath_ = std::move(cachePath);
+  scanCache_.clear();
+}
+
+const std::filesystem::path& CppPluginSystem::scanCachePath() const { return scanCachePath_; }
+
+openassetio::Identifiers CppPluginSystem::identifiers() const {
+  openassetio::Identifiers result;
+  result.reserve(plugins_.size());
+  std::transform(begin(plugins_), end(plugins_), std::back_inserter(result),
+                 [](const auto& iter) { return iter.first; });
+  return result;
+}
+
+const CppPluginSystem::PathAndPlugin& CppPluginSystem::plugin(const Identifier& identifier) const {
+  const auto iter = plugins_.find(identifier);
+  if (iter == plugins_.end()) {
+    throw errors::InputValidationException{fmt::format(
+        "CppPluginSystem: No plug-in registered with the identifier '{}'", identifier)};
+  }
+
+  const std::lock_guard lock{deferredLoadMutex_};
+  if (!iter->second.second) {
+    loadDeferredPlugin(identifier, iter->second);
+  }
+  return iter->second;
+}
+
+std::optional<CppPluginSystem::PluginManifest> CppPluginSystem::manifest(
+    const Identifier& identifier) const {
+  if (plugins_.find(identifier) == plugins_.end()) {
+    throw errors::InputValidationException{fmt::format(
+        "CppPluginSystem: No plug-in registered with the identifier '{}'", identifier)};
+  }
+
+  if (const auto iter = manifests_.find(identifier); iter != manifests_.end()) {
+    return iter->second;
+  }
+  return std::nullopt;
+}
+
+bool CppPluginSystem::isAlreadyRegistered(const Identifier& identifier,
+                                          const std::filesystem::path& filePath) const {
+  const auto iter = plugins_.find(identifier);
+  if (iter == plugins_.end()) {
+    return false;
+  }
+  logger_->debug(
+      fmt::format("CppPluginSystem: Skipping '{}' defined in '{}'. Already registered by '{}'",
+                  identifier, filePath.string(), iter->second.first.string()));
+  return true;
+}
+
+void CppPluginSystem::loadDeferredPlugin(const Identifier& identifier,
+                                         PathAndPlugin& pathAndPlugin) const {
+  const std::filesystem::path& filePath = pathAndPlugin.first;
+  LoadResult result = loadLibrary(filePath);
+
+  for (LogMessage& logMessage : result.logs) {
+    logger_->log(logMessage.severity, std::move(logMessage.message));
+  }
+  if (result.exception) {
+    std::rethrow_exception(result.exception);
+  }
+
+  if (result.plugin && result.identifier == identifier) {
+    pathAndPlugin.second = std::move(result.plugin);
+    return;
+  }
+
+  // Any cache entry is stale, so remove it, such that the library is
+  // loaded during the next scan.
+  if (scanCache_.erase(filePath.string()) != 0) {
+    writeScanCache();
+  }
+
+  if (result.plugin) {
+    result.plugin.reset();  // Must destroy _before_ closing lib.
+    dlclose(result.handle);
+    throw errors::InputValidationException{
+        fmt::format("CppPluginSystem: Plug-in '{}' is no longer provided by '{}' (provides '{}')",
+                    identifier, filePath.string(), result.identifier)};
+  }
+  throw errors::InputValidationException{fmt::format(
+      "CppPluginSystem: Failed to load plug-in '{}' from '{}'", identifier, filePath.string())};
+}
+
+void CppPluginSystem::readScanCache() {
+  if (scanCachePath_.empty()) {
+    return;
+  }
+  scanCache_.clear();
+
+  std::ifstream cacheFile{scanCachePath_};
+  if (!cacheFile) {
+    logger_->debug(fmt::format("CppPluginSystem: No scan cache found at '{}'",
+                               scanCachePath_.string()));
+    return;
+  }
+
+  Str line;
+  if (!std::getline(cacheFile, line) || line != kScanCacheHeader) {
+    logger_->warning(fmt::format("CppPluginSystem: Ignoring unrecognised scan cache '{}'",
+                                 scanCachePath_.string()));
+    return;
+  }
+
+  // Each line is `<modification time>\t<size>\t<identifier>\t<path>`.
+  while (std::getline(cacheFile, line)) {
+    std::istringstream fields{line};
+    ScanCacheEntry entry{};
+    Str filePath;
+    if (fields >> entry.modificationTime >> entry.size && fields.get() == '\t' &&
+        std::getline(fields, entry.identifier, '\t') && std::getline(fields, filePath) &&
+        !entry.identifier.empty() && !filePath.empty()) {
+      scanCache_[std::move(filePath)] = std::move(entry);
+    }
+  }
+}
+
+void CppPluginSystem::writeScanCache() const {
+  if (scanCachePath_.empty()) {
+    return;
+  }
+
+  // Write to a uniquely named temporary file then rename, such that
+  // concurrent readers never see a partially written cache.
+  std::filesystem::path tempPath = scanCachePath_;
+  tempPath += fmt::format(".{:x}.tmp", std::random_device{}());
+  {
+    std::ofstream cacheFile{tempPath, std::ios::trunc};
+    cacheFile << kScanCacheHeader << '\n';
+    for (const auto& [filePath, entry] : scanCache_) {
+      cacheFile << entry.modificationTime << '\t' << entry.size << '\t' << entry.identifier
+                << '\t' << filePath << '\n';
+    }
+    if (!cacheFile) {
+      logger_->warning(fmt::format("CppPluginSystem: Failed to write scan cache '{}'",
+                                   scanCachePath_.string()));
+      std::error_code errorCode;
+      std::filesystem::remove(tempPath, errorCode);
+      return;
+    }
+  }
+
+  std::error_code errorCode;
+  std::filesystem::rename(tempPath, scanCachePath_, errorCode);
+  if (errorCode) {
+    logger_->warning(fmt::format("CppPluginSystem: Failed to write scan cache '{}': {}",
+                                 scanCachePath_.string(), errorCode.message()));
+    std::filesystem::remove(tempPath, errorCode);
+  }
 }
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
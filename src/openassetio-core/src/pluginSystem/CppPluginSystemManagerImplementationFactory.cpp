@@ -4,6 +4,8 @@
 
 #include <cstdlib>
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 
@@ -49,12 +51,25 @@ CppPluginSystemManagerImplementationFactory::CppPluginSystemManagerImplementatio
           [paths = std::getenv(kPluginEnvVar.data())] { return paths ? paths : ""; }(),
           std::move(logger)} {}
 
-Identifiers CppPluginSystemManagerImplementationFactory::identifiers() {
-  if (!pluginSystem_) {
-    // Lazy load plugins.
-    pluginSystem_ = CppPluginSystem::make(logger());
-    pluginSystem_->scan(paths_);
+void CppPluginSystemManagerImplementationFactory::scanIfRequired() {
+  if (pluginSystem_) {
+    return;
+  }
+  // Lazy load plugins.
+  pluginSystem_ = CppPluginSystem::make(logger());
+  if (const char* scanCachePath = std::getenv(kPluginScanCacheEnvVar.data());
+      scanCachePath && *scanCachePath) {
+    pluginSystem_->setScanCachePath(scanCachePath);
   }
+  if (const char* parallelScan = std::getenv(kPluginParallelScanEnvVar.data());
+      parallelScan && std::string_view{parallelScan} == "1") {
+    pluginSystem_->enableParallelLoading();
+  }
+  pluginSystem_->scan(paths_);
+}
+
+Identifiers CppPluginSystemManagerImplementationFactory::identifiers() {
+  scanIfRequired();
 
   // Get all OpenAssetIO plugins, whether manager plugins or otherwise.
   openassetio::Identifiers pluginIds = pluginSystem_->identifiers();
@@ -64,6 +79,21 @@ Identifiers CppPluginSystemManagerImplementationFactory::identifiers() {
       std::remove_if(
           begin(pluginIds), end(pluginIds),
           [&](const auto& identifier) {
+            // Avoid loading plugins that declare their kind in a
+            // manifest.
+            if (const std::optional<CppPluginSystem::PluginManifest> manifest =
+                    pluginSystem_->manifest(identifier)) {
+              const bool isManagerPlugin =
+                  manifest->kind == CppPluginSystemManagerPlugin::kPluginKind;
+              if (!isManagerPlugin) {
+                logger()->log(log::LoggerInterface::Severity::kWarning,
+                              fmt::format("Plugin '{}' is not a manager plugin as its manifest"
+                                          " declares it to be of kind '{}'",
+                                          identifier, manifest->kind));
+              }
+              return !isManagerPlugin;
+            }
+
             const auto& [path, plugin] = pluginSystem_->plugin(identifier);
 
             auto managerPlugin = std::dynamic_pointer_cast<CppPluginSystemManagerPlugin>(plugin);
@@ -85,11 +115,7 @@ Identifiers CppPluginSystemManagerImplementationFactory::identifiers() {
 
 managerApi::ManagerInterfacePtr CppPluginSystemManagerImplementationFactory::instantiate(
     const Identifier& identifier) {
-  if (!pluginSystem_) {
-    // Lazy load plugins.
-    pluginSystem_ = CppPluginSystem::make(logger());
-    pluginSystem_->scan(paths_);
-  }
+  scanIfRequired();
   const auto& [path, plugin] = pluginSystem_->plugin(identifier);
 
   auto managerPlugin = std::dynamic_pointer_cast<CppPluginSystemManagerPlugin>(plugin);
@@ -103,6 +129,20 @@ managerApi::ManagerInterfacePtr CppPluginSystemManagerImplementationFactory::ins
 
   return managerPlugin->interface();
 }
+
+std::optional<hostApi::ManagerFactory::ManagerDetail>
+CppPluginSystemManagerImplementationFactory::managerDetail(const Identifier& identifier) {
+  scanIfRequired();
+  const std::optional<CppPluginSystem::PluginManifest> manifest =
+      pluginSystem_->manifest(identifier);
+
+  if (!manifest || manifest->kind != CppPluginSystemManagerPlugin::kPluginKind ||
+      manifest->displayName.empty()) {
+    return std::nullopt;
+  }
+  return hostApi::ManagerFactory::ManagerDetail{identifier, manifest->displayName,
+                                                manifest->info};
+}
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -1,7 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2024 The Foundry Visionmongers Ltd
 
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/trait/TraitsData.hpp>
@@ -10,6 +17,114 @@ namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace trait {
 
+namespace {
+/**
+ * Process-wide table of interned trait IDs and property keys.
+ *
+ * The vocabulary of trait IDs and property keys in use by any given
+ * process is small and fixed (typically defined by generated trait
+ * views), whereas the number of TraitsData instances may be very large
+ * (e.g. one per entity in a batch resolve). Interning allows each
+ * TraitsData to reference a trait ID/property key by pointer, rather
+ * than each instance holding (and hashing) its own string copies.
+ *
+ * Symbols are pointers to strings owned by the table. Elements of an
+ * `unordered_set` are never relocated, so symbols are valid for the
+ * lifetime of the process and can be dereferenced without locking.
+ *
+ * Interned strings are never released, so memory held by the table
+ * grows with the number of distinct trait IDs and property keys ever
+ * used by the process. This is bounded for the intended use, but
+ * hosts/managers that synthesise unbounded unique keys (e.g. embedding
+ * entity-specific data in a key) will grow the table indefinitely.
+ */
+class SymbolTable {
+ public:
+  using Symbol = const Str*;
+
+  /**
+   * Get the process-wide instance.
+   *
+   * Deliberately leaked, so that TraitsData instances destroyed during
+   * static destruction (e.g. held by a Python interpreter) are safe.
+   * The table is reclaimed by the OS at process exit, and so will be
+   * reported as reachable (but not lost) by leak checkers.
+   */
+  static SymbolTable& instance() {
+    static auto* table = new SymbolTable{};  // NOLINT(cppcoreguidelines-owning-memory)
+    return *table;
+  }
+
+  /**
+   * Get the symbol for a string, adding it to the table if not yet
+   * present.
+   *
+   * A thread-local cache is consulted first, so that repeated
+   * interning of the same (small) vocabulary does not contend on the
+   * table's lock when many threads are constructing TraitsData
+   * concurrently.
+   *
+   * The cache is capped at @ref kMaxThreadCacheSize entries per
+   * thread. Once full, further symbols are looked up in the table
+   * directly, so an unusually large vocabulary costs a shared lock
+   * rather than unbounded per-thread memory.
+   */
+  Symbol intern(const Str& str) {
+    thread_local std::unordered_map<Str, Symbol> cache;
+    if (const auto iter = cache.find(str); iter != cache.end()) {
+      return iter->second;
+    }
+    const Symbol symbol = internUncached(str);
+    if (cache.size() < kMaxThreadCacheSize) {
+      cache.emplace(str, symbol);
+    }
+    return symbol;
+  }
+
+ private:
+  /// Maximum number of symbols cached per thread.
+  static constexpr std::size_t kMaxThreadCacheSize = 1024;
+
+  SymbolTable() = default;
+
+  Symbol internUncached(const Str& str) {
+    {
+      const std::shared_lock lock{mutex_};
+      if (const auto iter = symbols_.find(str); iter != symbols_.end()) {
+        return &*iter;
+      }
+    }
+    const std::unique_lock lock{mutex_};
+    return &*symbols_.insert(str).first;
+  }
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_set<Str> symbols_;
+};
+
+using Symbol = SymbolTable::Symbol;
+}  // namespace
+
+/**
+ * Flat storage for a TraitsData's traits and property values.
+ *
+ * All data is held in a single contiguous vector of entries, sorted
+ * by (trait ID, property key). Each trait held by the instance has a
+ * marker entry with a null property key, which sorts before any
+ * property entries for that trait. Hence a trait with no properties is
+ * still represented, and the properties of a given trait are a
+ * contiguous range immediately following its marker.
+ *
+ * Instances typically hold a handful of traits and properties, so a
+ * binary search over a contiguous vector is cheaper than hashing, and
+ * costs a single allocation, rather than several per trait and per
+ * property.
+ *
+ * Trait IDs and property keys are interned when written, so entries
+ * hold only pointers, and equality of IDs/keys between instances is a
+ * pointer comparison. Queries compare by string content, so never need
+ * to consult the symbol table.
+ */
 class TraitsData::Impl {
  public:
   Impl() = default;
@@ -22,66 +137,177 @@ class TraitsData::Impl {
 
   [[nodiscard]] trait::TraitSet traitSet() const {
     trait::TraitSet ids;
-    ids.reserve(data_.size());
-    for (const auto& item : data_) {
-      ids.insert(item.first);
+    for (const auto& entry : entries_) {
+      if (entry.propertyKey == nullptr) {
+        ids.insert(*entry.traitId);
+      }
     }
     return ids;
   }
 
   [[nodiscard]] bool hasTrait(const trait::TraitId& traitId) const {
-    return static_cast<bool>(data_.count(traitId));
+    return findEntry(traitId, nullptr) != entries_.end();
   }
 
-  void addTrait(const trait::TraitId& traitId) { data_[traitId]; }
+  void addTrait(const trait::TraitId& traitId) {
+    const auto iter = lowerBound(traitId, nullptr);
+    if (matches(iter, traitId, nullptr)) {
+      return;
+    }
+    if (entries_.capacity() == 0) {
+      entries_.reserve(kInitialCapacity);
+      // Reserving invalidated `iter`, but the vector is empty.
+      entries_.push_back(Entry{SymbolTable::instance().intern(traitId), nullptr, {}});
+      return;
+    }
+    entries_.insert(iter, Entry{SymbolTable::instance().intern(traitId), nullptr, {}});
+  }
 
   void addTraits(const trait::TraitSet& traitSet) {
+    entries_.reserve(entries_.size() + traitSet.size());
     for (const auto& traitId : traitSet) {
-      data_[traitId];
+      addTrait(traitId);
     }
   }
 
   // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
   bool getTraitProperty(trait::property::Value* out, const trait::TraitId& traitId,
                         const trait::property::Key& propertyKey) const {
-    const auto& traitIter = data_.find(traitId);
-    if (traitIter == data_.end()) {
-      return false;
-    }
-    const auto& traitDict = traitIter->second;
-    const auto& propertyIter = traitDict.find(propertyKey);
-    if (propertyIter == traitDict.end()) {
+    const auto iter = findEntry(traitId, &propertyKey);
+    if (iter == entries_.end()) {
       return false;
     }
-    *out = propertyIter->second;
+    *out = iter->value;
     return true;
   }
 
   void setTraitProperty(const trait::TraitId& traitId, const trait::property::Key& propertyKey,
                         trait::property::Value propertyValue) {
-    // Use subscript to ensure the trait is added if it is missing
-    data_[traitId][propertyKey] = std::move(propertyValue);
+    // Ensure the trait is added if it is missing.
+    addTrait(traitId);
+
+    const auto iter = lowerBound(traitId, &propertyKey);
+    if (matches(iter, traitId, &propertyKey)) {
+      iter->value = std::move(propertyValue);
+      return;
+    }
+    // The trait's marker entry precedes `iter`, so reuse its symbol.
+    const Symbol traitSymbol = std::prev(iter)->traitId;
+    const Symbol keySymbol = SymbolTable::instance().intern(propertyKey);
+    entries_.insert(iter, Entry{traitSymbol, keySymbol, std::move(propertyValue)});
   }
 
   [[nodiscard]] trait::property::KeySet traitPropertyKeys(const trait::TraitId& traitId) const {
-    const auto& traitEntry = data_.find(traitId);
-    if (traitEntry == data_.end()) {
-      return {};
-    }
     trait::property::KeySet propertyKeys;
-    propertyKeys.reserve(traitEntry->second.size());
-    for (const auto& propIter : traitEntry->second) {
-      propertyKeys.insert(propIter.first);
+    // Properties immediately follow the trait's marker entry.
+    for (auto iter = lowerBound(traitId, nullptr);
+         iter != entries_.end() && *iter->traitId == traitId; ++iter) {
+      if (iter->propertyKey != nullptr) {
+        propertyKeys.insert(*iter->propertyKey);
+      }
     }
     return propertyKeys;
   }
 
-  bool operator==(const Impl& other) const { return data_ == other.data_; }
+  // Symbols are unique per string, and entries are kept sorted, so
+  // equal content implies equal vectors.
+  bool operator==(const Impl& other) const { return entries_ == other.entries_; }
 
  private:
-  using Properties = std::unordered_map<trait::property::Key, trait::property::Value>;
-  using PropertiesByTrait = std::unordered_map<trait::TraitId, Properties>;
-  PropertiesByTrait data_;
+  struct Entry {
+    Symbol traitId;
+    // Null for the marker entry signifying the trait is present.
+    Symbol propertyKey;
+    trait::property::Value value;
+
+    bool operator==(const Entry& other) const {
+      return traitId == other.traitId && propertyKey == other.propertyKey &&
+             value == other.value;
+    }
+  };
+  using Entries = std::vector<Entry>;
+
+  /**
+   * Capacity to reserve on first insertion, sufficient for common
+   * resolve results without reallocation.
+   */
+  static constexpr std::size_t kInitialCapacity = 4;
+
+  /**
+   * Entry count at or below which lookups scan linearly rather than
+   * binary search.
+   */
+  static constexpr std::size_t kLinearSearchThreshold = 16;
+
+  /// A (trait ID, property key) query, where a null key denotes the
+  /// trait's marker entry.
+  using Query = std::pair<const trait::TraitId&, const trait::property::Key*>;
+
+  /**
+   * Ordering of entries by trait ID then property key, where a null
+   * property key sorts first, so a trait's marker entry precedes its
+   * properties.
+   */
+  static bool entryLess(const Entry& entry, const Query& query) {
+    if (const int traitCmp = entry.traitId->compare(query.first); traitCmp != 0) {
+      return traitCmp < 0;
+    }
+    if (query.second == nullptr) {
+      return false;
+    }
+    return entry.propertyKey == nullptr || *entry.propertyKey < *query.second;
+  }
+
+  template <class Iterator>
+  [[nodiscard]] bool matches(const Iterator& iter, const trait::TraitId& traitId,
+                             const trait::property::Key* propertyKey) const {
+    if (iter == entries_.end() || *iter->traitId != traitId) {
+      return false;
+    }
+    if (propertyKey == nullptr || iter->propertyKey == nullptr) {
+      return propertyKey == iter->propertyKey;
+    }
+    return *iter->propertyKey == *propertyKey;
+  }
+
+  [[nodiscard]] Entries::iterator lowerBound(const trait::TraitId& traitId,
+                                             const trait::property::Key* propertyKey) {
+    return std::lower_bound(entries_.begin(), entries_.end(), Query{traitId, propertyKey},
+                            &entryLess);
+  }
+
+  [[nodiscard]] Entries::const_iterator lowerBound(
+      const trait::TraitId& traitId, const trait::property::Key* propertyKey) const {
+    return std::lower_bound(entries_.begin(), entries_.end(), Query{traitId, propertyKey},
+                            &entryLess);
+  }
+
+  [[nodiscard]] Entries::const_iterator findEntry(
+      const trait::TraitId& traitId, const trait::property::Key* propertyKey) const {
+    if (entries_.size() <= kLinearSearchThreshold) {
+      // Trait IDs commonly share a long prefix, making the ordered
+      // comparisons of a binary search costly relative to equality
+      // checks, which first compare lengths. Once the trait's marker
+      // entry is found, its properties are identified by symbol.
+      auto iter = std::find_if(entries_.begin(), entries_.end(), [&](const Entry& entry) {
+        return entry.propertyKey == nullptr && *entry.traitId == traitId;
+      });
+      if (iter == entries_.end() || propertyKey == nullptr) {
+        return iter;
+      }
+      const Symbol traitSymbol = iter->traitId;
+      for (++iter; iter != entries_.end() && iter->traitId == traitSymbol; ++iter) {
+        if (*iter->propertyKey == *propertyKey) {
+          return iter;
+        }
+      }
+      return entries_.end();
+    }
+    const auto iter = lowerBound(traitId, propertyKey);
+    return matches(iter, traitId, propertyKey) ? iter : entries_.end();
+  }
+
+  Entries entries_;
 };
 
 TraitsDataPtr TraitsData::make() { return std::shared_ptr<TraitsData>(new TraitsData()); }
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include "PrefixMatcher.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+namespace {
+std::size_t bucketIndex(const std::string_view str) {
+  return static_cast<unsigned char>(str.front());
+}
+
+bool startsWith(const std::string_view str, const std::string_view prefix) {
+  return str.size() >= prefix.size() && str.compare(0, prefix.size(), prefix) == 0;
+}
+}  // namespace
+
+PrefixMatcher::PrefixMatcher(std::vector<Str> prefixes) {
+  std::sort(prefixes.begin(), prefixes.end());
+
+  // After sorting, a prefix is immediately preceded by any shorter
+  // prefix that it extends, or by another string that also extends
+  // that shorter prefix. So comparing with the last kept prefix is
+  // sufficient to discard all redundant prefixes.
+  for (Str& prefix : prefixes) {
+    if (!prefixes_.empty() && startsWith(prefix, prefixes_.back())) {
+      continue;
+    }
+    prefixes_.push_back(std::move(prefix));
+  }
+
+  if (!prefixes_.empty() && prefixes_.front().empty()) {
+    matchesAll_ = true;
+    return;
+  }
+
+  // Sorted prefixes sharing a first byte are contiguous.
+  for (std::size_t idx = 0; idx < prefixes_.size(); ++idx) {
+    Bucket& bucket = buckets_[bucketIndex(prefixes_[idx])];
+    if (bucket.first == bucket.second) {
+      bucket.first = idx;
+    }
+    bucket.second = idx + 1;
+  }
+}
+
+bool PrefixMatcher::matches(const std::string_view str) const {
+  if (matchesAll_) {
+    return true;
+  }
+  if (str.empty()) {
+    return false;
+  }
+  const auto [first, second] = buckets_[bucketIndex(str)];
+  const auto begin = std::next(prefixes_.begin(), static_cast<std::ptrdiff_t>(first));
+  const auto end = std::next(prefixes_.begin(), static_cast<std::ptrdiff_t>(second));
+
+  // Find the greatest prefix not greater than the string. This is the
+  // only prefix that can match, since no prefix extends another.
+  const auto candidate = std::upper_bound(
+      begin, end, str, [](const std::string_view lhs, const Str& rhs) { return lhs < rhs; });
+  if (candidate == begin) {
+    return false;
+  }
+  return startsWith(str, *std::prev(candidate));
+}
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+
+/**
+ * Precomputed matcher testing whether strings start with any of a set
+ * of prefixes.
+ *
+ * On construction, redundant prefixes (those that extend another
+ * prefix in the set) are discarded and the remainder sorted, then
+ * bucketed by first byte. Since no remaining prefix is a prefix of
+ * another, the only candidate match for a string is the greatest
+ * prefix not greater than it, found by binary search within the
+ * bucket for the string's first byte. Matching is therefore a table
+ * lookup, a handful of comparisons and a single `memcmp`, however many
+ * prefixes there are.
+ *
+ * Instances of this class are immutable, so are thread-safe.
+ */
+class PrefixMatcher {
+ public:
+  /**
+   * Construct a matcher for the given prefixes.
+   *
+   * An empty prefix matches every string. An empty list of prefixes
+   * matches no strings.
+   */
+  explicit PrefixMatcher(std::vector<Str> prefixes);
+
+  /// Whether the given string starts with any of the prefixes.
+  [[nodiscard]] bool matches(std::string_view str) const;
+
+  /**
+   * Minimal set of prefixes used for matching, in lexicographical
+   * order.
+   */
+  [[nodiscard]] const std::vector<Str>& prefixes() const { return prefixes_; }
+
+ private:
+  /// Range of indices into `prefixes_`, [first, second).
+  using Bucket = std::pair<std::size_t, std::size_t>;
+  static constexpr std::size_t kNumBuckets = 256;
+
+  std::vector<Str> prefixes_;
+  std::array<Bucket, kNumBuckets> buckets_{};
+  bool matchesAll_{false};
+};
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
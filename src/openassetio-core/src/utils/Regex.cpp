@@ -2,6 +2,7 @@
 // Copyright 2023 The Foundry Visionmongers Ltd
 #include "Regex.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 #include <fmt/format.h>
@@ -22,6 +23,29 @@ Str errorCodeToMessage(int errorCode) {
   errorMessage.resize(static_cast<Str::size_type>(errorMessageLength));
   return errorMessage;
 }
+
+struct MatchDataDeleter {
+  void operator()(pcre2_match_data* ptr) const { pcre2_match_data_free(ptr); }
+};
+
+/**
+ * Get a match data buffer with at least the given number of pairs,
+ * re-used by all Regex instances on the current thread.
+ *
+ * The buffer is only valid until the next call on the same thread, so
+ * must not be retained beyond a single match/substitute.
+ */
+pcre2_match_data* threadLocalMatchData(const std::uint32_t numPairs) {
+  thread_local std::unique_ptr<pcre2_match_data, MatchDataDeleter> matchData;
+
+  if (!matchData || pcre2_get_ovector_count(matchData.get()) < numPairs) {
+    matchData.reset(pcre2_match_data_create(numPairs, nullptr));
+    if (!matchData) {
+      throw errors::InputValidationException{"Failed to construct regex match data buffer"};
+    }
+  }
+  return matchData.get();
+}
 }  // namespace
 
 Regex::Regex(const std::string_view pattern) {
@@ -49,58 +73,88 @@ Regex::Regex(const std::string_view pattern) {
     throw errors::InputValidationException{fmt::format(
         "Error {} JIT compiling '{}': {}", errorCode, pattern, errorCodeToMessage(errorCode))};
   }
+
+  std::uint32_t captureCount = 0;
+  pcre2_pattern_info(code_, PCRE2_INFO_CAPTURECOUNT, &captureCount);
+  numMatchPairs_ = captureCount + 1;
 }
 
 Regex::~Regex() { pcre2_code_free(code_); }
 
 std::optional<Regex::Match> Regex::match(const std::string_view subject) const {
   Match matchObj{code_};
+  if (match(subject, matchObj)) {
+    return matchObj;
+  }
+  return std::nullopt;
+}
+
+bool Regex::match(const std::string_view subject, Match& matchObj) const {
+  return matchInto(subject, matchObj.data().get()) > 0;
+}
 
+bool Regex::matches(const std::string_view subject) const {
+  return matchInto(subject, threadLocalMatchData(numMatchPairs_)) > 0;
+}
+
+std::vector<bool> Regex::matchMany(const std::vector<std::string_view>& subjects) const {
+  pcre2_match_data* matchData = threadLocalMatchData(numMatchPairs_);
+  std::vector<bool> result(subjects.size());
+  std::transform(
+      subjects.begin(), subjects.end(), result.begin(),
+      [&](const std::string_view subject) { return matchInto(subject, matchData) > 0; });
+  return result;
+}
+
+int Regex::matchInto(const std::string_view subject, pcre2_match_data* matchData) const {
   const int numMatches =
       pcre2_jit_match(code_,                                         /* regex object */
                       reinterpret_cast<PCRE2_SPTR8>(subject.data()), /* subject */
                       subject.size(),                                /* length of subject */
-                      0,                     /* start at offset 0 in the subject */
-                      0,                     /* default options */
-                      matchObj.data().get(), /* block for storing the result */
-                      nullptr);              /* use default match context */
+                      0,         /* start at offset 0 in the subject */
+                      0,         /* default options */
+                      matchData, /* block for storing the result */
+                      nullptr);  /* use default match context */
 
   if (numMatches < 0 && numMatches != PCRE2_ERROR_NOMATCH) {
     throw errors::InputValidationException{fmt::format("Error {} matching regex to '{}': {}",
                                                        numMatches, subject,
                                                        errorCodeToMessage(numMatches))};
   }
-
-  if (numMatches > 0) {
-    return matchObj;
-  }
-
-  return std::nullopt;
+  return numMatches;
 }
 
 Str Regex::substituteToReduceSize(const std::string_view& subject,
                                   const std::string_view& replacement) const {
+  Str result;
+  substituteToReduceSize(subject, replacement, result);
+  return result;
+}
+
+void Regex::substituteToReduceSize(const std::string_view& subject,
+                                   const std::string_view& replacement, Str& result) const {
   if (subject.empty()) {
     // Zero-size buffer is immediately an error in pcre, so just short-circuit.
-    return {};
+    result.clear();
+    return;
   }
   // `+ 1` so pcre knows it has enough space for a null terminator.
-  Str result(subject.size() + 1, '\0');
+  result.resize(subject.size() + 1);
   std::size_t resultSize = result.size();
 
-  int numSubstitutions =
-      pcre2_substitute(code_,                                         /* regex object */
-                       reinterpret_cast<PCRE2_SPTR8>(subject.data()), /* subject */
-                       subject.size(),                                /* length of subject */
-                       0,                         /* start at offset 0 in the subject */
-                       PCRE2_SUBSTITUTE_GLOBAL,   /* substitute all matches */
-                       Match{code_}.data().get(), /* block for storing the result */
-                       nullptr,                   /* use default match context */
-                       reinterpret_cast<PCRE2_SPTR8>(replacement.data()), /* replacement */
-                       replacement.size(),                                /* replacement length */
-                       reinterpret_cast<PCRE2_UCHAR8*>(result.data()),    /* output buffer */
-                       &resultSize                                        /* output buffer size */
-      );
+  int numSubstitutions = pcre2_substitute(
+      code_,                                             /* regex object */
+      reinterpret_cast<PCRE2_SPTR8>(subject.data()),     /* subject */
+      subject.size(),                                    /* length of subject */
+      0,                                                 /* start at offset 0 in the subject */
+      PCRE2_SUBSTITUTE_GLOBAL,                           /* substitute all matches */
+      threadLocalMatchData(numMatchPairs_),              /* block for storing the result */
+      nullptr,                                           /* use default match context */
+      reinterpret_cast<PCRE2_SPTR8>(replacement.data()), /* replacement */
+      replacement.size(),                                /* replacement length */
+      reinterpret_cast<PCRE2_UCHAR8*>(result.data()),    /* output buffer */
+      &resultSize                                        /* output buffer size */
+  );
 
   if (numSubstitutions < 0) {
     throw errors::InputValidationException{
@@ -109,7 +163,6 @@ Str Regex::substituteToReduceSize(const std::string_view& subject,
   }
 
   result.resize(resultSize);
-  return result;
 }
 
 Regex::Match::Match(const pcre2_code_8* code)
@@ -120,6 +173,8 @@ Regex::Match::Match(const pcre2_code_8* code)
   }
 }
 
+Regex::Match::Match(const Regex& regex) : Match{regex.code_} {}
+
 std::string_view Regex::Match::group(const std::string_view subject,
                                      const std::size_t groupNum) const {
   // Precondition.
@@ -2,9 +2,11 @@
 // Copyright 2023 The Foundry Visionmongers Ltd
 #pragma once
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
@@ -26,6 +28,12 @@ namespace utils {
  *
  * As well as the regex object itself, matches are cached for subsequent
  * querying.
+ *
+ * Where match groups are not required, prefer @ref matches (or
+ * @ref matchMany), which re-use a per-thread match data buffer rather
+ * than allocating a new one per call. Similarly, callers that match
+ * repeatedly and require match groups can re-use a @ref Match via the
+ * corresponding @ref match overload.
  */
 class Regex {
  public:
@@ -41,6 +49,14 @@ class Regex {
    public:
     explicit Match(const pcre2_code* code);
 
+    /**
+     * Construct a match data buffer suitable for re-use across
+     * multiple calls to @ref Regex::match with the given regex.
+     *
+     * @param regex Regex that the match will be used with.
+     */
+    explicit Match(const Regex& regex);
+
     /**
      * Get the string from a group in the match.
      *
@@ -95,6 +111,41 @@ class Regex {
    */
   [[nodiscard]] std::optional<Match> match(std::string_view subject) const;
 
+  /**
+   * Check if the regex matches a given subject string, storing the
+   * match results in a caller-provided buffer.
+   *
+   * @param subject Subject string to match the regex against.
+   *
+   * @param[out] matchObj Match to store the results in. Must have been
+   * constructed from this regex. Unspecified if there is no match.
+   *
+   * @return `true` if there is a match, `false` otherwise.
+   */
+  [[nodiscard]] bool match(std::string_view subject, Match& matchObj) const;
+
+  /**
+   * Check if the regex matches a given subject string.
+   *
+   * Match results are not retained, allowing a per-thread match data
+   * buffer to be re-used, avoiding any allocation.
+   *
+   * @param subject Subject string to match the regex against.
+   *
+   * @return `true` if there is a match, `false` otherwise.
+   */
+  [[nodiscard]] bool matches(std::string_view subject) const;
+
+  /**
+   * Check if the regex matches each of a batch of subject strings.
+   *
+   * @param subjects Subject strings to match the regex against.
+   *
+   * @return Whether each subject matched, in the same order as the
+   * subjects.
+   */
+  [[nodiscard]] std::vector<bool> matchMany(const std::vector<std::string_view>& subjects) const;
+
   /**
    * Get a new string with all matches of the regex substituted with the
    * given replacement string.
@@ -112,8 +163,35 @@ class Regex {
   [[nodiscard]] Str substituteToReduceSize(const std::string_view& subject,
                                            const std::string_view& replacement) const;
 
+  /**
+   * Substitute all matches of the regex in a subject string with the
+   * given replacement string, writing to a caller-provided string.
+   *
+   * As above, but re-uses the existing capacity of @p result, avoiding
+   * allocation if it is already large enough.
+   *
+   * @param subject String to copy, with substitutions.
+   * @param replacement Replacement to substitute matches with.
+   * @param[out] result String to assign the result to.
+   * @throws InputValidationException On substitution error (e.g. if the
+   * resulting string would be longer than the subject string).
+   */
+  void substituteToReduceSize(const std::string_view& subject,
+                              const std::string_view& replacement, Str& result) const;
+
  private:
+  /**
+   * Match the regex against a subject string, storing the results in
+   * the given match data.
+   *
+   * @return Number of matched pairs, or `PCRE2_ERROR_NOMATCH`.
+   * @throws InputValidationException On matching error.
+   */
+  int matchInto(std::string_view subject, pcre2_match_data* matchData) const;
+
   pcre2_code* code_{nullptr};
+  /// Number of match data pairs required, i.e. capture groups + 1.
+  std::uint32_t numMatchPairs_{0};
 };
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
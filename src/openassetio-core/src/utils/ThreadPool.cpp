@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+
+ThreadPool::ThreadPool(std::size_t numWorkers) {
+  numWorkers = std::max<std::size_t>(numWorkers, 1);
+  workers_.reserve(numWorkers);
+  for (std::size_t idx = 0; idx < numWorkers; ++idx) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(numWorkers);
+  for (std::size_t idx = 0; idx < numWorkers; ++idx) {
+    threads_.emplace_back([this, idx] { run(idx); });
+  }
+}
+
+ThreadPool::~ThreadPool() { shutdown(); }
+
+void ThreadPool::shutdown() {
+  // Serialise concurrent calls, so that each thread is joined once.
+  const std::lock_guard shutdownLock{shutdownMutex_};
+  {
+    const std::lock_guard lock{wakeMutex_};
+    stopping_ = true;
+  }
+  wakeCondition_.notify_all();
+  for (std::thread& thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+ThreadPool& ThreadPool::shared() {
+  static ThreadPool pool{std::max(std::thread::hardware_concurrency(), 2U) - 1};
+  return pool;
+}
+
+std::size_t ThreadPool::size() const { return workers_.size(); }
+
+bool ThreadPool::submit(Task task) {
+  const std::size_t workerIdx = nextWorker_.fetch_add(1) % workers_.size();
+  {
+    // Held whilst queueing, so that a task cannot be queued after the
+    // workers have stopped.
+    const std::lock_guard lock{wakeMutex_};
+    if (stopping_) {
+      return false;
+    }
+    {
+      Worker& worker = *workers_[workerIdx];
+      const std::lock_guard workerLock{worker.mutex};
+      worker.tasks.push_back(std::move(task));
+    }
+    ++numPending_;
+  }
+  wakeCondition_.notify_one();
+  return true;
+}
+
+bool ThreadPool::tryTake(const std::size_t workerIdx, Task& task) {
+  // Own queue first, most recently queued task first.
+  {
+    Worker& worker = *workers_[workerIdx];
+    const std::lock_guard lock{worker.mutex};
+    if (!worker.tasks.empty()) {
+      task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      return true;
+    }
+  }
+  // Then steal the oldest task from another worker's queue.
+  for (std::size_t offset = 1; offset < workers_.size(); ++offset) {
+    Worker& victim = *workers_[(workerIdx + offset) % workers_.size()];
+    const std::lock_guard lock{victim.mutex};
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::run(const std::size_t workerIdx) {
+  Task task;
+  while (true) {
+    {
+      std::unique_lock lock{wakeMutex_};
+      wakeCondition_.wait(lock, [this] { return numPending_ > 0 || stopping_; });
+      if (numPending_ == 0) {
+        // Stopping, and nothing left to run.
+        return;
+      }
+      // Claim one task. It is guaranteed to be in some queue, since
+      // tasks are queued before being counted.
+      --numPending_;
+    }
+    while (!tryTake(workerIdx, task)) {
+      // Queues are scanned one at a time, so a concurrent steal can
+      // race us past the remaining tasks. There are always at least as
+      // many queued tasks as claims, so a retry will find one.
+      std::this_thread::yield();
+    }
+    task();
+    task = nullptr;
+  }
+}
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils {
+
+/**
+ * Fixed-size pool of worker threads with per-worker task queues.
+ *
+ * Submitted tasks are distributed round-robin across the workers'
+ * queues. A worker takes tasks from the back of its own queue and,
+ * when that is empty, steals from the front of other workers' queues,
+ * so that a worker blocked on a long-running task does not hold up
+ * the tasks queued behind it.
+ *
+ * Tasks must not throw. Tasks must not block waiting on other tasks
+ * submitted to the same pool, since there is no guarantee that a
+ * worker is available to run them.
+ *
+ * Instances of this class are thread-safe.
+ */
+class ThreadPool {
+ public:
+  using Task = std::function<void()>;
+
+  /**
+   * Construct a pool with the given number of workers.
+   *
+   * @param numWorkers Number of worker threads, clamped to at least
+   * one.
+   */
+  explicit ThreadPool(std::size_t numWorkers);
+
+  /// Shuts down the pool, if not already, see @ref shutdown.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) noexcept = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+  /**
+   * Process-wide pool, created on first use, with one fewer worker
+   * than the available hardware concurrency, on the assumption that
+   * the submitting thread participates in the work.
+   */
+  static ThreadPool& shared();
+
+  /// Number of worker threads.
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * Queue a task to be run on a worker thread.
+   *
+   * @return `false` if the pool has been shut down, in which case the
+   * task is discarded.
+   */
+  bool submit(Task task);
+
+  /**
+   * Stop accepting tasks, then join all workers, after they have run
+   * all queued tasks.
+   *
+   * Has no effect if the pool is already shut down. Must not be called
+   * from a task.
+   */
+  void shutdown();
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void run(std::size_t workerIdx);
+  bool tryTake(std::size_t workerIdx, Task& task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  std::mutex wakeMutex_;
+  std::condition_variable wakeCondition_;
+  std::size_t numPending_{0};
+  bool stopping_{false};
+
+  std::atomic<std::size_t> nextWorker_{0};
+
+  std::mutex shutdownMutex_;
+};
+}  // namespace utils
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
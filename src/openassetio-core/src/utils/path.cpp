@@ -2,6 +2,9 @@
 // Copyright 2023 The Foundry Visionmongers Ltd
 #include <openassetio/utils/path.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 #include <openassetio/errors/exceptions.hpp>
 
 #include "./path/common.hpp"
@@ -104,6 +107,25 @@ struct FileUrlPathConverterImpl {
     return pathType == PathType::kWindows ? windowsFileUrlPathConverter.pathFromUrl(fileUrl)
                                           : posixFileUrlPathConverter.pathFromUrl(fileUrl);
   }
+
+  /**
+   * Apply a conversion function to each of a batch of inputs.
+   *
+   * The system path type is resolved once up front, rather than per
+   * element.
+   */
+  template <class Convert>
+  std::vector<Str> convertEach(const std::vector<std::string_view>& inputs, PathType pathType,
+                               const Convert& convert) const {
+    pathType = path::GenericPath::resolveSystemPathType(pathType);
+    std::vector<Str> outputs;
+    outputs.reserve(inputs.size());
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(outputs),
+                   [&](const std::string_view input) {
+                     return (this->*convert)(input, pathType);
+                   });
+    return outputs;
+  }
 };
 
 FileUrlPathConverter::FileUrlPathConverter()
@@ -118,6 +140,16 @@ Str FileUrlPathConverter::pathToUrl(std::string_view absolutePath, PathType path
 Str FileUrlPathConverter::pathFromUrl(std::string_view fileUrl, PathType pathType) const {
   return impl_->pathFromUrl(fileUrl, pathType);
 }
+
+std::vector<Str> FileUrlPathConverter::pathsToUrls(
+    const std::vector<std::string_view>& absolutePaths, PathType pathType) const {
+  return impl_->convertEach(absolutePaths, pathType, &FileUrlPathConverterImpl::pathToUrl);
+}
+
+std::vector<Str> FileUrlPathConverter::pathsFromUrls(const std::vector<std::string_view>& fileUrls,
+                                                     PathType pathType) const {
+  return impl_->convertEach(fileUrls, pathType, &FileUrlPathConverterImpl::pathFromUrl);
+}
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
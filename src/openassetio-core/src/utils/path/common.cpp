@@ -26,7 +26,11 @@ Str ForwardSlashSeparatedString::removeTrailingForwardSlashesInPathSegments(
 // GenericUrl
 
 bool GenericUrl::isFileUrl(const std::string_view& url) const {
-  return fileUrlRegex.match(url).has_value();
+  // Avoid a regex match in the common case.
+  if (url.substr(0, kFileUrlPrefix.size()) == kFileUrlPrefix) {
+    return true;
+  }
+  return fileUrlRegex.matches(url);
 }
 
 void GenericUrl::setUrlPath(const Str& urlPath, ada::url& url) {
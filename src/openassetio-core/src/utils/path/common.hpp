@@ -56,6 +56,7 @@ constexpr char kForwardSlash = '/';
 constexpr char kBackSlash = '\\';
 constexpr std::string_view kBackSlashStr = "\\";
 constexpr std::string_view kDoubleBackSlash = R"(\\)";
+constexpr std::string_view kFileUrlPrefix = "file://";
 
 /**
  * Throw an exception formatted to contain the problematic string.
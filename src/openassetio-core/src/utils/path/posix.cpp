@@ -12,6 +12,10 @@ Str FileUrlPathConverter::pathToUrl(const std::string_view& posixPath) const {
   // Precondition.
   assert(!posixPath.empty());
 
+  if (Str url; detail::SimplePathScanner::tryPathToUrl(posixPath, url)) {
+    return url;
+  }
+
   if (posixPathHandler.containsUpwardsTraversal(posixPath)) {
     throwError(kErrorUpwardsTraversal, posixPath);
   }
@@ -40,6 +44,10 @@ Str FileUrlPathConverter::pathToUrl(const std::string_view& posixPath) const {
 }
 
 Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+  if (Str path; detail::SimplePathScanner::tryPathFromUrl(url, path)) {
+    return path;
+  }
+
   ada::result<ada::url_aggregator> adaUrl = ada::parse(url);
   if (!adaUrl) {
     throwError(kErrorUrlParseFailure, url);
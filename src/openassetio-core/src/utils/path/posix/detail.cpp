@@ -2,7 +2,9 @@
 // Copyright 2023 The Foundry Visionmongers Ltd
 #include "detail.hpp"
 
+#include <array>
 #include <cassert>
+#include <cstdint>
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -12,7 +14,7 @@ namespace utils::path::posix::detail {
 // PosixPath
 
 bool PosixPath::containsUpwardsTraversal(const std::string_view& str) const {
-  return upwardsTraversalRegex.match(str).has_value();
+  return upwardsTraversalRegex.matches(str);
 }
 
 bool PosixPath::startsWithForwardSlash(const std::string_view& path) {
@@ -48,7 +50,7 @@ Str PosixPath::removeTrailingForwardSlashesInPathSegments(const std::string_view
 
 bool PosixUrl::containsPercentEncodedForwardSlash(const std::string_view& url) const {
   // Using regex for case-insensitivity.
-  return percentEncodedForwardSlashRegex.match(url).has_value();
+  return percentEncodedForwardSlashRegex.matches(url);
 }
 
 std::optional<Str> PosixUrl::maybePercentEncode(const std::string_view& path) {
@@ -60,6 +62,180 @@ std::optional<Str> PosixUrl::maybePercentEncode(const std::string_view& path) {
   }
   return std::nullopt;
 }
+
+// ---------------------------------------------------------------------
+// SimplePathScanner
+
+namespace {
+constexpr std::string_view kUpperHexDigits = "0123456789ABCDEF";
+constexpr std::size_t kNumByteValues = 256;
+constexpr std::uint8_t kNibbleBits = 4;
+constexpr std::uint8_t kNibbleMask = 0xF;
+constexpr std::uint8_t kByteSize = 8;
+
+/// Characters that need special handling when converting a path to a
+/// URL, i.e. separators and characters to percent-encode.
+constexpr std::array kPathSpecialCharacters = [] {
+  std::array<bool, kNumByteValues> charSet{};
+  for (std::size_t charCode = 0; charCode < charSet.size(); ++charCode) {
+    charSet[charCode] = (PosixUrl::kPercentEncodeCharacterSet[charCode / kByteSize] &
+                         (1U << (charCode % kByteSize))) != 0;
+  }
+  charSet[static_cast<std::uint8_t>(kForwardSlash)] = true;
+  return charSet;
+}();
+
+/// Characters that are accepted verbatim in a URL path, i.e. the
+/// unreserved and sub-delimiter characters of RFC 3986, plus `:`, `@`
+/// and `/`.
+constexpr std::array kUrlSafeCharacters = [] {
+  std::array<bool, kNumByteValues> charSet{};
+  for (char chr = 'a'; chr <= 'z'; ++chr) {
+    charSet[static_cast<std::uint8_t>(chr)] = true;
+  }
+  for (char chr = 'A'; chr <= 'Z'; ++chr) {
+    charSet[static_cast<std::uint8_t>(chr)] = true;
+  }
+  for (char chr = '0'; chr <= '9'; ++chr) {
+    charSet[static_cast<std::uint8_t>(chr)] = true;
+  }
+  for (const char chr : std::string_view{"-._~!$&'()*+,;=:@/"}) {
+    charSet[static_cast<std::uint8_t>(chr)] = true;
+  }
+  return charSet;
+}();
+
+/// Check if a path segment is `.` or `..`.
+constexpr bool isDotSegment(const std::string_view segment) {
+  return segment == "." || segment == "..";
+}
+
+/// Check if a path or URL path begins with two `/`s, which are treated
+/// specially.
+constexpr bool startsWithDoubleForwardSlash(const std::string_view path) {
+  return path.size() > 1 && path[0] == kForwardSlash && path[1] == kForwardSlash;
+}
+
+/// Value of a hex digit, or -1 if not a hex digit.
+constexpr int hexValue(const char chr) {
+  if (chr >= '0' && chr <= '9') {
+    return chr - '0';
+  }
+  if (chr >= 'A' && chr <= 'F') {
+    return chr - 'A' + 10;  // NOLINT(*-magic-numbers)
+  }
+  if (chr >= 'a' && chr <= 'f') {
+    return chr - 'a' + 10;  // NOLINT(*-magic-numbers)
+  }
+  return -1;
+}
+}  // namespace
+
+bool SimplePathScanner::tryPathToUrl(const std::string_view path, Str& url) {
+  // Precondition.
+  assert(!path.empty());
+
+  if (path.front() != kForwardSlash || startsWithDoubleForwardSlash(path)) {
+    return false;
+  }
+
+  url.clear();
+  url.reserve(kFileUrlPrefix.size() + path.size());
+  url += kFileUrlPrefix;
+
+  std::size_t segmentStart = 0;
+  std::size_t idx = 0;
+  while (idx < path.size()) {
+    // Copy the run of characters up to the next special character.
+    std::size_t runEnd = idx;
+    while (runEnd < path.size() &&
+           !kPathSpecialCharacters[static_cast<std::uint8_t>(path[runEnd])]) {
+      ++runEnd;
+    }
+    url.append(path, idx, runEnd - idx);
+    idx = runEnd;
+    if (idx == path.size()) {
+      break;
+    }
+
+    const char chr = path[idx];
+    if (chr == kForwardSlash) {
+      if (isDotSegment(path.substr(segmentStart, idx - segmentStart))) {
+        return false;
+      }
+      segmentStart = idx + 1;
+      // Collapse repeated separators.
+      if (idx == 0 || path[idx - 1] != kForwardSlash) {
+        url += kForwardSlash;
+      }
+    } else {
+      // Leave NULL bytes to the general route.
+      if (chr == '\0') {
+        return false;
+      }
+      const auto charCode = static_cast<std::uint8_t>(chr);
+      url += kPercent;
+      url += kUpperHexDigits[charCode >> kNibbleBits];
+      url += kUpperHexDigits[charCode & kNibbleMask];
+    }
+    ++idx;
+  }
+
+  return !isDotSegment(path.substr(segmentStart));
+}
+
+bool SimplePathScanner::tryPathFromUrl(const std::string_view url, Str& path) {
+  if (url.substr(0, kFileUrlPrefix.size()) != kFileUrlPrefix) {
+    return false;
+  }
+  const std::string_view urlPath = url.substr(kFileUrlPrefix.size());
+  if (urlPath.empty() || urlPath.front() != kForwardSlash ||
+      startsWithDoubleForwardSlash(urlPath)) {
+    return false;
+  }
+
+  path.clear();
+  path.reserve(urlPath.size());
+
+  std::size_t segmentStart = 0;
+  for (std::size_t idx = 0; idx < urlPath.size(); ++idx) {
+    const char chr = urlPath[idx];
+
+    if (chr == kForwardSlash) {
+      if (isDotSegment(urlPath.substr(segmentStart, idx - segmentStart))) {
+        return false;
+      }
+      segmentStart = idx + 1;
+      // Collapse repeated separators.
+      if (idx == 0 || urlPath[idx - 1] != kForwardSlash) {
+        path += kForwardSlash;
+      }
+    } else if (chr == kPercent) {
+      if (idx + 2 >= urlPath.size()) {
+        return false;
+      }
+      const int high = hexValue(urlPath[idx + 1]);
+      const int low = hexValue(urlPath[idx + 2]);
+      if (high < 0 || low < 0) {
+        return false;
+      }
+      const auto decoded = static_cast<char>((high << kNibbleBits) | low);
+      // Leave encoded separators, dot segments and NULL bytes to the
+      // general route.
+      if (decoded == kForwardSlash || decoded == '.' || decoded == '\0') {
+        return false;
+      }
+      path += decoded;
+      idx += 2;
+    } else if (kUrlSafeCharacters[static_cast<std::uint8_t>(chr)]) {
+      path += chr;
+    } else {
+      return false;
+    }
+  }
+
+  return !isDotSegment(urlPath.substr(segmentStart));
+}
 }  // namespace utils::path::posix::detail
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -119,6 +119,49 @@ struct PosixUrl {
    */
   static std::optional<Str> maybePercentEncode(const std::string_view& path);
 };
+
+/**
+ * Single-pass conversion of simple POSIX paths and URLs.
+ *
+ * This is a fast path for the common case, avoiding regex matching
+ * and full URL parsing. Each character is inspected exactly once,
+ * with the output written directly to the result string.
+ *
+ * Only inputs that are known to convert identically to the general
+ * route via @ref PosixPath / @ref PosixUrl and Ada are accepted. Any
+ * other input, including all invalid input, is rejected, and should
+ * be converted (or have its error reported) by the general route.
+ */
+struct SimplePathScanner {
+  /**
+   * Attempt to convert a POSIX path into a file URL.
+   *
+   * Rejects relative paths, paths beginning with `//`, and paths
+   * containing `.` or `..` segments.
+   *
+   * @param path Non-empty path to convert.
+   * @param[out] url String to assign the URL to. Unspecified if the
+   * path is rejected.
+   * @return true if the path was converted, false if rejected.
+   */
+  static bool tryPathToUrl(std::string_view path, Str& url);
+
+  /**
+   * Attempt to convert a file URL to a POSIX path.
+   *
+   * Only accepts URLs beginning with `file:///` (i.e. with an empty
+   * host) whose path contains only URL-safe ASCII characters and
+   * percent-encoded bytes. Rejects paths beginning with `//`,
+   * containing `.` or `..` segments, or containing percent-encoded
+   * `/`, `.` or NULL bytes.
+   *
+   * @param url URL to convert.
+   * @param[out] path String to assign the path to. Unspecified if the
+   * URL is rejected.
+   * @return true if the URL was converted, false if rejected.
+   */
+  static bool tryPathFromUrl(std::string_view url, Str& path);
+};
 }  // namespace utils::path::posix::detail
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -16,7 +16,7 @@ namespace utils::path::windows::detail {
 
 bool WindowsUrl::containsPercentEncodedSlash(const std::string_view& url) const {
   // Using regex for case-insensitivity.
-  return percentEncodedSlashRegex.match(url).has_value();
+  return percentEncodedSlashRegex.matches(url);
 }
 
 std::optional<Str> WindowsUrl::ip6ToValidHostname(const std::string_view& host) const {
@@ -47,7 +47,7 @@ bool WindowsUrl::maybePercentEncodeAndAppendTo(const std::string_view& path, Str
 }
 
 bool WindowsUrl::setUrlHost(const std::string_view& host, ada::url& url) const {
-  if (localHostRegex.match(host).has_value()) {
+  if (localHostRegex.matches(host)) {
     return url.set_host(kLocalHostIP);
   }
   return url.set_host(host);
@@ -89,7 +89,7 @@ std::string_view NormalisedPath::withoutTrailingSpacesAndDots(const std::string_
 }
 
 bool NormalisedPath::containsUpwardsTraversal(const std::string_view& path) const {
-  return upwardsTraversalRegex.match(path).has_value();
+  return upwardsTraversalRegex.matches(path);
 }
 
 Str NormalisedPath::removeTrailingDotsInPathSegments(const std::string_view& path) const {
@@ -110,18 +110,18 @@ bool NormalisedPath::startsWithSlash(const std::string_view& path) {
 // DriveLetter
 
 bool DriveLetter::isDrive(const std::string_view& str) const {
-  return driveRegex.match(str).has_value();
+  return driveRegex.matches(str);
 }
 
 bool DriveLetter::isAbsoluteDrivePath(const std::string_view& str) const {
-  return absoluteDrivePathRegex.match(str).has_value();
+  return absoluteDrivePathRegex.matches(str);
 }
 
 // ---------------------------------------------------------------------
 // UncHost
 
 bool UncHost::isInvalidHostname(const std::string_view& host) const {
-  return invalidHostnameRegex.match(host).has_value();
+  return invalidHostnameRegex.matches(host);
 }
 
 // ---------------------------------------------------------------------
@@ -157,7 +157,7 @@ bool UncUnnormalisedDevicePath::containsForwardSlash(const std::string_view& pat
 }
 
 bool UncUnnormalisedDevicePath::containsUpwardsTraversal(const std::string_view& str) const {
-  return upwardsTraversalRegex.match(str).has_value();
+  return upwardsTraversalRegex.matches(str);
 }
 
 Str UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(
@@ -1,5 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
 #include <fmt/args.h>
 #include <fmt/format.h>
 
@@ -40,6 +46,178 @@ openassetio::Str substitute(const std::string_view input,
   }
 }
 
+namespace {
+[[noreturn]] void throwTemplateError(const std::string_view input, const std::string_view reason) {
+  throw openassetio::errors::InputValidationException{fmt::format(
+      "SubstitutionTemplate: failed to process the input string '{}': {}", input, reason)};
+}
+
+constexpr bool isKeyStartChar(const char chr) {
+  return (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') || chr == '_';
+}
+
+constexpr bool isKeyChar(const char chr) {
+  return isKeyStartChar(chr) || (chr >= '0' && chr <= '9');
+}
+
+/**
+ * Append a value using the default format, consistent with
+ * `fmt::format("{}", value)`.
+ */
+void appendValue(openassetio::Str& output, const openassetio::InfoDictionaryValue& value) {
+  std::visit(
+      [&output](const auto& typedValue) {
+        using T = std::decay_t<decltype(typedValue)>;
+        if constexpr (std::is_same_v<T, openassetio::Str>) {
+          output += typedValue;
+        } else if constexpr (std::is_same_v<T, openassetio::Bool>) {
+          output += typedValue ? "true" : "false";
+        } else if constexpr (std::is_same_v<T, openassetio::Int>) {
+          const fmt::format_int formatted{typedValue};
+          output.append(formatted.data(), formatted.size());
+        } else {
+          fmt::format_to(std::back_inserter(output), "{}", typedValue);
+        }
+      },
+      value);
+}
+
+/// Append a value using a format string containing a single field.
+void appendValue(openassetio::Str& output, const openassetio::InfoDictionaryValue& value,
+                 const std::string_view valueFormat) {
+  std::visit(
+      [&output, valueFormat](const auto& typedValue) {
+        using T = std::decay_t<decltype(typedValue)>;
+        if constexpr (std::is_same_v<T, openassetio::Str>) {
+          fmt::format_to(std::back_inserter(output), fmt::runtime(valueFormat),
+                         std::string_view{typedValue});
+        } else {
+          fmt::format_to(std::back_inserter(output), fmt::runtime(valueFormat), typedValue);
+        }
+      },
+      value);
+}
+}  // namespace
+
+SubstitutionTemplate::SubstitutionTemplate(const std::string_view input) : input_{input} {
+  Segment segment;
+  std::size_t idx = 0;
+
+  while (idx < input.size()) {
+    const char chr = input[idx];
+
+    if (chr == '}') {
+      if (idx + 1 == input.size() || input[idx + 1] != '}') {
+        throwTemplateError(input, "unmatched '}' in format string");
+      }
+      segment.literal += '}';
+      idx += 2;
+      continue;
+    }
+
+    if (chr != '{') {
+      // Copy the run of literal characters up to the next brace.
+      const std::size_t runEnd = std::min(input.find_first_of("{}", idx), input.size());
+      segment.literal.append(input, idx, runEnd - idx);
+      idx = runEnd;
+      continue;
+    }
+
+    if (idx + 1 < input.size() && input[idx + 1] == '{') {
+      segment.literal += '{';
+      idx += 2;
+      continue;
+    }
+
+    // Placeholder key.
+    const std::size_t keyBegin = ++idx;
+    if (idx == input.size() || !isKeyStartChar(input[idx])) {
+      if (idx < input.size() && (input[idx] == '}' || input[idx] == ':' ||
+                                 (input[idx] >= '0' && input[idx] <= '9'))) {
+        throwTemplateError(input, "positional placeholders are not supported");
+      }
+      throwTemplateError(input, "invalid format string");
+    }
+    while (idx < input.size() && isKeyChar(input[idx])) {
+      ++idx;
+    }
+    segment.key = input.substr(keyBegin, idx - keyBegin);
+
+    // Optional format specifier.
+    if (idx < input.size() && input[idx] == ':') {
+      const std::size_t specEnd = input.find_first_of("{}", idx);
+      if (specEnd == std::string_view::npos) {
+        throwTemplateError(input, "missing '}' in format string");
+      }
+      if (input[specEnd] == '{') {
+        throwTemplateError(input, "nested placeholders are not supported");
+      }
+      segment.valueFormat = fmt::format("{{{}}}", input.substr(idx, specEnd - idx));
+      idx = specEnd;
+    }
+
+    if (idx == input.size()) {
+      throwTemplateError(input, "missing '}' in format string");
+    }
+    if (input[idx] != '}') {
+      throwTemplateError(input, "invalid format string");
+    }
+    ++idx;
+
+    literalSize_ += segment.literal.size();
+    segments_.push_back(std::move(segment));
+    segment = {};
+  }
+
+  if (!segment.literal.empty() || segments_.empty()) {
+    literalSize_ += segment.literal.size();
+    segments_.push_back(std::move(segment));
+  }
+}
+
+openassetio::Str SubstitutionTemplate::render(
+    const openassetio::InfoDictionary& substitutions) const {
+  openassetio::Str output;
+  render(substitutions, output);
+  return output;
+}
+
+void SubstitutionTemplate::render(const openassetio::InfoDictionary& substitutions,
+                                  openassetio::Str& output) const {
+  output.clear();
+  output.reserve(literalSize_);
+
+  for (const Segment& segment : segments_) {
+    output += segment.literal;
+    if (segment.key.empty()) {
+      continue;
+    }
+
+    const auto valueIter = substitutions.find(segment.key);
+    if (valueIter == substitutions.end()) {
+      throwTemplateError(input_, "argument not found");
+    }
+
+    if (segment.valueFormat.empty()) {
+      appendValue(output, valueIter->second);
+      continue;
+    }
+    try {
+      appendValue(output, valueIter->second, segment.valueFormat);
+    } catch (const fmt::format_error& exc) {
+      throwTemplateError(input_, exc.what());
+    }
+  }
+}
+
+std::vector<openassetio::Str> SubstitutionTemplate::renderMany(
+    const std::vector<openassetio::InfoDictionary>& substitutionsList) const {
+  std::vector<openassetio::Str> outputs(substitutionsList.size());
+  for (std::size_t idx = 0; idx < substitutionsList.size(); ++idx) {
+    render(substitutionsList[idx], outputs[idx]);
+  }
+  return outputs;
+}
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/EntityReferenceInterner.hpp>
+#include <openassetio/errors/exceptions.hpp>
+
+using openassetio::EntityReference;
+using openassetio::EntityReferenceInterner;
+using openassetio::Str;
+
+SCENARIO("EntityReference hashing") {
+  GIVEN("two references constructed from the same string") {
+    const EntityReference reference{"some://ref"};
+    const EntityReference otherReference{"some://ref"};
+
+    THEN("they are equal") { CHECK(reference == otherReference); }
+
+    THEN("their hashes are equal to the hash of the string") {
+      CHECK(reference.hash() == otherReference.hash());
+      CHECK(reference.hash() == std::hash<std::string_view>{}("some://ref"));
+    }
+
+    THEN("std::hash uses the precomputed hash") {
+      CHECK(std::hash<EntityReference>{}(reference) == reference.hash());
+    }
+  }
+
+  GIVEN("references constructed from different strings") {
+    const EntityReference reference{"some://ref"};
+    const EntityReference otherReference{"some://other"};
+
+    THEN("they are not equal") { CHECK_FALSE(reference == otherReference); }
+  }
+
+  GIVEN("an unordered set of references") {
+    std::unordered_set<EntityReference> references{EntityReference{"a"}, EntityReference{"b"}};
+
+    THEN("references can be found by value") {
+      CHECK(references.count(EntityReference{"a"}) == 1);
+      CHECK(references.count(EntityReference{"c"}) == 0);
+    }
+  }
+}
+
+SCENARIO("EntityReference moves") {
+  GIVEN("a reference") {
+    EntityReference reference{"some://ref/that/is/too/long/for/small/string/optimisation"};
+
+    WHEN("the reference is moved from") {
+      const EntityReference movedTo{std::move(reference)};
+
+      THEN("the moved-to reference has the original string") {
+        CHECK(movedTo.toString() == "some://ref/that/is/too/long/for/small/string/optimisation");
+      }
+
+      THEN("the moved-from reference is empty, with a consistent hash") {
+        // NOLINTNEXTLINE(bugprone-use-after-move)
+        CHECK(reference == EntityReference{""});
+      }
+    }
+
+    WHEN("the reference is move-assigned from") {
+      EntityReference movedTo{"other"};
+      movedTo = std::move(reference);
+
+      THEN("the moved-to reference has the original string and hash") {
+        CHECK(movedTo == EntityReference{
+                             "some://ref/that/is/too/long/for/small/string/optimisation"});
+      }
+
+      THEN("the moved-from reference is empty, with a consistent hash") {
+        // NOLINTNEXTLINE(bugprone-use-after-move)
+        CHECK(reference == EntityReference{""});
+      }
+    }
+  }
+}
+
+SCENARIO("EntityReference with shared storage") {
+  GIVEN("a reference constructed from a shared string") {
+    const auto sharedString = std::make_shared<const Str>("some://ref");
+    const EntityReference reference{sharedString};
+
+    THEN("it is equal to a reference owning the same string") {
+      CHECK(reference == EntityReference{"some://ref"});
+      CHECK(reference.hash() == EntityReference{"some://ref"}.hash());
+    }
+
+    THEN("its string is the shared string") { CHECK(&reference.toString() == sharedString.get()); }
+
+    WHEN("the reference is copied") {
+      const EntityReference copy = reference;  // NOLINT(performance-unnecessary-copy-initialization)
+
+      THEN("the copy shares the same string") {
+        CHECK(&copy.toString() == sharedString.get());
+      }
+    }
+  }
+
+  GIVEN("a null shared string") {
+    const std::shared_ptr<const Str> sharedString;
+
+    THEN("constructing a reference throws") {
+      CHECK_THROWS_AS(EntityReference{sharedString},
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("EntityReferenceInterner") {
+  GIVEN("an interner") {
+    const EntityReferenceInterner::Ptr interner = EntityReferenceInterner::make();
+
+    THEN("it is empty") { CHECK(interner->size() == 0); }
+
+    WHEN("the same string is interned twice") {
+      const EntityReference reference = interner->intern("some://ref");
+      const EntityReference otherReference = interner->intern("some://ref");
+
+      THEN("the references share the same string") {
+        CHECK(reference == otherReference);
+        CHECK(&reference.toString() == &otherReference.toString());
+      }
+
+      THEN("the pool holds a single string") { CHECK(interner->size() == 1); }
+
+      AND_WHEN("a different string is interned") {
+        const EntityReference thirdReference = interner->intern("some://other");
+
+        THEN("the reference has its own string") {
+          CHECK(thirdReference.toString() == "some://other");
+          CHECK_FALSE(thirdReference == reference);
+          CHECK(interner->size() == 2);
+        }
+      }
+
+      AND_WHEN("the interner is cleared") {
+        interner->clear();
+
+        THEN("the pool is empty") { CHECK(interner->size() == 0); }
+
+        THEN("existing references remain valid") { CHECK(reference.toString() == "some://ref"); }
+
+        THEN("interning the string again does not share with existing references") {
+          const EntityReference newReference = interner->intern("some://ref");
+          CHECK(newReference == reference);
+          CHECK(&newReference.toString() != &reference.toString());
+        }
+      }
+    }
+  }
+}
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2024 The Foundry Visionmongers Ltd
+#include <string>
 #include <type_traits>
 
 #include <catch2/catch.hpp>
@@ -64,3 +65,165 @@ SCENARIO("TraitsData make from other creates a deep copy") {
     }
   }
 }
+
+SCENARIO("TraitsData property access") {
+  GIVEN("an instance with properties set on multiple traits") {
+    const TraitsDataPtr data = TraitsData::make({"emptyTrait"});
+    data->setTraitProperty("b", "y", Int{2});
+    data->setTraitProperty("a", "x", openassetio::Str{"one"});
+    data->setTraitProperty("a", "z", openassetio::Float{3.0});
+    data->setTraitProperty("b", "x", openassetio::Bool{true});
+
+    THEN("all traits are reported, including those without properties") {
+      CHECK(data->traitSet() == openassetio::trait::TraitSet{"emptyTrait", "a", "b"});
+      CHECK(data->hasTrait("emptyTrait"));
+      CHECK(data->hasTrait("a"));
+      CHECK_FALSE(data->hasTrait("x"));
+    }
+
+    THEN("property keys are reported per trait") {
+      CHECK(data->traitPropertyKeys("a") == openassetio::trait::property::KeySet{"x", "z"});
+      CHECK(data->traitPropertyKeys("b") == openassetio::trait::property::KeySet{"x", "y"});
+      CHECK(data->traitPropertyKeys("emptyTrait").empty());
+      CHECK(data->traitPropertyKeys("unknownTrait").empty());
+    }
+
+    THEN("property values are retrieved from the correct trait") {
+      Value value;
+      REQUIRE(data->getTraitProperty(&value, "a", "x"));
+      CHECK(value == Value{openassetio::Str{"one"}});
+      REQUIRE(data->getTraitProperty(&value, "b", "x"));
+      CHECK(value == Value{openassetio::Bool{true}});
+    }
+
+    THEN("querying an unset property does not modify the output value") {
+      Value value{Int{42}};
+      CHECK_FALSE(data->getTraitProperty(&value, "a", "y"));
+      CHECK_FALSE(data->getTraitProperty(&value, "emptyTrait", "x"));
+      CHECK_FALSE(data->getTraitProperty(&value, "neverUsedTrait", "neverUsedKey"));
+      CHECK(value == Value{Int{42}});
+    }
+
+    WHEN("an existing property is overwritten") {
+      data->setTraitProperty("a", "x", Int{4});
+
+      THEN("the new value is retrieved") {
+        Value value;
+        REQUIRE(data->getTraitProperty(&value, "a", "x"));
+        CHECK(value == Value{Int{4}});
+        CHECK(data->traitPropertyKeys("a") == openassetio::trait::property::KeySet{"x", "z"});
+      }
+    }
+  }
+}
+
+SCENARIO("TraitsData property access with many properties") {
+  // Enough entries to exceed the threshold at which lookups switch
+  // from a linear scan to a binary search.
+  static constexpr Int kNumTraits = 4;
+  static constexpr Int kNumPropertiesPerTrait = 8;
+
+  const auto traitIdFor = [](const Int traitIdx) {
+    return "openassetio-test:trait." + std::to_string(traitIdx);
+  };
+  const auto keyFor = [](const Int propertyIdx) { return "key" + std::to_string(propertyIdx); };
+
+  GIVEN("an instance with many properties set on traits sharing a prefix") {
+    const TraitsDataPtr data = TraitsData::make({"openassetio-test:trait.empty"});
+    // Populate in reverse order, exercising insertion before existing
+    // entries.
+    for (Int traitIdx = kNumTraits - 1; traitIdx >= 0; --traitIdx) {
+      for (Int propertyIdx = kNumPropertiesPerTrait - 1; propertyIdx >= 0; --propertyIdx) {
+        data->setTraitProperty(traitIdFor(traitIdx), keyFor(propertyIdx),
+                               Int{traitIdx * kNumPropertiesPerTrait + propertyIdx});
+      }
+    }
+
+    THEN("all traits are reported") {
+      CHECK(data->traitSet().size() == kNumTraits + 1);
+      CHECK(data->hasTrait("openassetio-test:trait.empty"));
+      for (Int traitIdx = 0; traitIdx < kNumTraits; ++traitIdx) {
+        CHECK(data->hasTrait(traitIdFor(traitIdx)));
+      }
+      CHECK_FALSE(data->hasTrait(traitIdFor(kNumTraits)));
+    }
+
+    THEN("all property keys are reported per trait") {
+      for (Int traitIdx = 0; traitIdx < kNumTraits; ++traitIdx) {
+        CHECK(data->traitPropertyKeys(traitIdFor(traitIdx)).size() == kNumPropertiesPerTrait);
+      }
+      CHECK(data->traitPropertyKeys("openassetio-test:trait.empty").empty());
+    }
+
+    THEN("all property values are retrieved from the correct trait") {
+      for (Int traitIdx = 0; traitIdx < kNumTraits; ++traitIdx) {
+        for (Int propertyIdx = 0; propertyIdx < kNumPropertiesPerTrait; ++propertyIdx) {
+          Value value;
+          REQUIRE(data->getTraitProperty(&value, traitIdFor(traitIdx), keyFor(propertyIdx)));
+          CHECK(value == Value{Int{traitIdx * kNumPropertiesPerTrait + propertyIdx}});
+        }
+      }
+    }
+
+    THEN("querying an unset property does not modify the output value") {
+      Value value{Int{-1}};
+      CHECK_FALSE(
+          data->getTraitProperty(&value, traitIdFor(0), keyFor(kNumPropertiesPerTrait)));
+      CHECK_FALSE(data->getTraitProperty(&value, "openassetio-test:trait.empty", keyFor(0)));
+      CHECK_FALSE(data->getTraitProperty(&value, traitIdFor(kNumTraits), keyFor(0)));
+      CHECK(value == Value{Int{-1}});
+    }
+
+    WHEN("an existing property is overwritten") {
+      data->setTraitProperty(traitIdFor(2), keyFor(3), openassetio::Str{"overwritten"});
+
+      THEN("the new value is retrieved and no property is added") {
+        Value value;
+        REQUIRE(data->getTraitProperty(&value, traitIdFor(2), keyFor(3)));
+        CHECK(value == Value{openassetio::Str{"overwritten"}});
+        CHECK(data->traitPropertyKeys(traitIdFor(2)).size() == kNumPropertiesPerTrait);
+      }
+    }
+
+    AND_GIVEN("another instance populated with the same data in a different order") {
+      const TraitsDataPtr other = TraitsData::make();
+      for (Int traitIdx = 0; traitIdx < kNumTraits; ++traitIdx) {
+        for (Int propertyIdx = 0; propertyIdx < kNumPropertiesPerTrait; ++propertyIdx) {
+          other->setTraitProperty(traitIdFor(traitIdx), keyFor(propertyIdx),
+                                  Int{traitIdx * kNumPropertiesPerTrait + propertyIdx});
+        }
+      }
+      other->addTrait("openassetio-test:trait.empty");
+
+      THEN("they compare equal") { CHECK(*data == *other); }
+    }
+  }
+}
+
+SCENARIO("TraitsData equality") {
+  GIVEN("two instances populated with the same data in a different order") {
+    const TraitsDataPtr first = TraitsData::make();
+    first->addTrait("c");
+    first->setTraitProperty("a", "x", Int{1});
+    first->setTraitProperty("b", "y", Int{2});
+
+    const TraitsDataPtr second = TraitsData::make();
+    second->setTraitProperty("b", "y", Int{2});
+    second->setTraitProperty("a", "x", Int{1});
+    second->addTrait("c");
+
+    THEN("they compare equal") { CHECK(*first == *second); }
+
+    AND_GIVEN("a property value is changed on one of them") {
+      second->setTraitProperty("a", "x", Int{3});
+
+      THEN("they compare unequal") { CHECK_FALSE(*first == *second); }
+    }
+
+    AND_GIVEN("an additional trait is added to one of them") {
+      second->addTrait("d");
+
+      THEN("they compare unequal") { CHECK_FALSE(*first == *second); }
+    }
+  }
+}
@@ -0,0 +1,335 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openassetio/export.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+
+struct StubHostInterface : hostApi::HostInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.host"; }
+  [[nodiscard]] Str displayName() const override { return "Test Host"; }
+};
+
+struct StubLoggerInterface : log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+
+/**
+ * Pager over a fixed number of pages, each holding references
+ * "<page>/<index>", recording the calls made to it.
+ *
+ * If `throwOnPage` is set, fetching that page throws.
+ */
+struct CountingPagerInterface : managerApi::EntityReferencePagerInterface {
+  CountingPagerInterface(const std::size_t numPages_, const std::size_t pageSize_)
+      : numPages{numPages_}, pageSize{pageSize_} {}
+
+  bool hasNext([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return currentPage + 1 < numPages;
+  }
+
+  Page get([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    ++numGetCalls;
+    if (currentPage == throwOnPage) {
+      throw std::runtime_error{"Page fetch failed"};
+    }
+    Page page;
+    if (currentPage < numPages) {
+      for (std::size_t idx = 0; idx < pageSize; ++idx) {
+        page.emplace_back(std::to_string(currentPage) + "/" + std::to_string(idx));
+      }
+    }
+    return page;
+  }
+
+  void next([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    ++currentPage;
+  }
+
+  void close([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    ++numCloseCalls;
+  }
+
+  const std::size_t numPages;
+  const std::size_t pageSize;
+  std::size_t throwOnPage{static_cast<std::size_t>(-1)};
+  std::atomic<std::size_t> currentPage{0};
+  std::atomic<std::size_t> numGetCalls{0};
+  std::atomic<std::size_t> numCloseCalls{0};
+};
+
+/// Wait until the predicate is true, or a generous timeout expires.
+template <class Predicate>
+bool waitUntil(const Predicate& predicate) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  return true;
+}
+
+/// Expected references for all pages from `firstPage` onward.
+EntityReferences expectedReferences(const std::size_t firstPage, const std::size_t numPages,
+                                    const std::size_t pageSize) {
+  EntityReferences references;
+  for (std::size_t page = firstPage; page < numPages; ++page) {
+    for (std::size_t idx = 0; idx < pageSize; ++idx) {
+      references.emplace_back(std::to_string(page) + "/" + std::to_string(idx));
+    }
+  }
+  return references;
+}
+
+managerApi::HostSessionPtr makeHostSession() {
+  return managerApi::HostSession::make(
+      managerApi::Host::make(std::make_shared<StubHostInterface>()),
+      std::make_shared<StubLoggerInterface>());
+}
+}  // namespace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+using openassetio::EntityReferences;
+using openassetio::hostApi::EntityReferencePager;
+
+SCENARIO("Draining all pages") {
+  GIVEN("a pager over several pages") {
+    constexpr std::size_t kNumPages = 4;
+    constexpr std::size_t kPageSize = 3;
+    auto pagerInterface =
+        std::make_shared<openassetio::CountingPagerInterface>(kNumPages, kPageSize);
+    auto pager = EntityReferencePager::make(pagerInterface, openassetio::makeHostSession());
+
+    AND_GIVEN("the pager has been advanced") {
+      pager->next();
+
+      WHEN("all pages are drained") {
+        const EntityReferences references = pager->drainAll(kNumPages * kPageSize);
+
+        THEN("the current and subsequent pages are returned in order") {
+          CHECK(references == openassetio::expectedReferences(1, kNumPages, kPageSize));
+        }
+
+        THEN("the pager is advanced beyond the last page") {
+          CHECK_FALSE(pager->hasNext());
+          CHECK(pager->get().empty());
+        }
+      }
+    }
+
+    AND_GIVEN("prefetch is enabled") {
+      pager->enablePrefetch();
+
+      WHEN("all pages are drained") {
+        const EntityReferences references = pager->drainAll();
+
+        THEN("all pages are returned in order") {
+          CHECK(references == openassetio::expectedReferences(0, kNumPages, kPageSize));
+        }
+
+        THEN("the pager is advanced beyond the last page") {
+          CHECK_FALSE(pager->hasNext());
+          CHECK(pager->get().empty());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Prefetching pages") {
+  GIVEN("a pager over several pages") {
+    constexpr std::size_t kNumPages = 10;
+    constexpr std::size_t kPageSize = 2;
+    auto pagerInterface =
+        std::make_shared<openassetio::CountingPagerInterface>(kNumPages, kPageSize);
+    auto pager = EntityReferencePager::make(pagerInterface, openassetio::makeHostSession());
+
+    THEN("prefetch is disabled by default") { CHECK_FALSE(pager->isPrefetchEnabled()); }
+
+    WHEN("prefetch is enabled with a depth of zero") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_MATCHES(
+            pager->enablePrefetch(0), openassetio::errors::InputValidationException,
+            Catch::Message("Prefetch depth must be greater than zero."));
+        CHECK_FALSE(pager->isPrefetchEnabled());
+      }
+    }
+
+    WHEN("prefetch is enabled with a depth of two") {
+      pager->enablePrefetch(2);
+
+      THEN("prefetch is enabled") { CHECK(pager->isPrefetchEnabled()); }
+
+      THEN("the current page and two subsequent pages are fetched, and no more") {
+        CHECK(openassetio::waitUntil([&] { return pagerInterface->numGetCalls == 3; }));
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        CHECK(pagerInterface->numGetCalls == 3);
+      }
+
+      THEN("enabling prefetch again throws") {
+        CHECK_THROWS_MATCHES(pager->enablePrefetch(),
+                             openassetio::errors::InputValidationException,
+                             Catch::Message("Prefetch is already enabled."));
+      }
+
+      AND_WHEN("the host advances a page") {
+        pager->next();
+
+        THEN("another page is fetched") {
+          CHECK(openassetio::waitUntil([&] { return pagerInterface->numGetCalls == 4; }));
+        }
+      }
+
+      AND_WHEN("the host walks all pages") {
+        EntityReferences references;
+        std::size_t numPages = 0;
+        while (true) {
+          const EntityReferencePager::Page page = pager->get();
+          references.insert(references.end(), page.begin(), page.end());
+          ++numPages;
+          if (!pager->hasNext()) {
+            break;
+          }
+          pager->next();
+        }
+
+        THEN("pages are returned in order, as without prefetch") {
+          CHECK(numPages == kNumPages);
+          CHECK(references == openassetio::expectedReferences(0, kNumPages, kPageSize));
+        }
+
+        AND_WHEN("the host advances beyond the last page") {
+          pager->next();
+
+          THEN("an empty page is returned") {
+            CHECK(pager->get().empty());
+            CHECK_FALSE(pager->hasNext());
+          }
+        }
+      }
+
+      AND_WHEN("the pager is destroyed") {
+        pager.reset();
+
+        THEN("the background thread is joined and the query is closed exactly once") {
+          CHECK(pagerInterface.use_count() == 1);
+          CHECK(pagerInterface->numCloseCalls == 1);
+          std::this_thread::sleep_for(std::chrono::milliseconds{50});
+          CHECK(pagerInterface->numCloseCalls == 1);
+        }
+      }
+
+      AND_WHEN("the pager is destroyed with a join hook set") {
+        std::size_t numHookCalls = 0;
+        bool wasJoinedInHook = false;
+        EntityReferencePager::setJoinHook([&](const std::function<void()>& join) {
+          ++numHookCalls;
+          join();
+          // The background thread's reference is released on exit,
+          // leaving this test's and the pager's.
+          wasJoinedInHook = pagerInterface.use_count() == 2;
+        });
+        pager.reset();
+        EntityReferencePager::setJoinHook({});
+
+        THEN("the background thread is joined via the hook") {
+          CHECK(numHookCalls == 1);
+          CHECK(wasJoinedInHook);
+          CHECK(pagerInterface->numCloseCalls == 1);
+        }
+      }
+    }
+
+    WHEN("prefetch is disabled and the pager is destroyed with a join hook set") {
+      std::size_t numHookCalls = 0;
+      EntityReferencePager::setJoinHook([&](const std::function<void()>& join) {
+        ++numHookCalls;
+        join();
+      });
+      pager.reset();
+      EntityReferencePager::setJoinHook({});
+
+      THEN("the hook is not called") {
+        CHECK(numHookCalls == 0);
+        CHECK(pagerInterface->numCloseCalls == 1);
+      }
+    }
+
+    WHEN("prefetch is enabled and the whole query fits within the prefetch depth") {
+      pager->enablePrefetch(kNumPages);
+      REQUIRE(openassetio::waitUntil([&] { return pagerInterface->numGetCalls == kNumPages; }));
+
+      AND_WHEN("the pager is destroyed") {
+        pager.reset();
+
+        THEN("the background thread is joined and the query is closed exactly once") {
+          CHECK(pagerInterface.use_count() == 1);
+          CHECK(pagerInterface->numCloseCalls == 1);
+          std::this_thread::sleep_for(std::chrono::milliseconds{50});
+          CHECK(pagerInterface->numCloseCalls == 1);
+        }
+      }
+    }
+  }
+
+  GIVEN("a pager that fails to fetch a page") {
+    auto pagerInterface = std::make_shared<openassetio::CountingPagerInterface>(4, 1);
+    pagerInterface->throwOnPage = 2;
+    auto pager = EntityReferencePager::make(pagerInterface, openassetio::makeHostSession());
+
+    WHEN("prefetch is enabled") {
+      pager->enablePrefetch();
+
+      THEN("pages before the failure are available") {
+        CHECK(pager->get() == EntityReferences{openassetio::EntityReference{"0/0"}});
+        pager->next();
+        CHECK(pager->get() == EntityReferences{openassetio::EntityReference{"1/0"}});
+        CHECK(pager->hasNext());
+
+        AND_WHEN("the host advances to the failed page") {
+          pager->next();
+
+          THEN("the manager's exception is rethrown") {
+            CHECK_THROWS_MATCHES(pager->get(), std::runtime_error,
+                                 Catch::Message("Page fetch failed"));
+            CHECK_THROWS_MATCHES(pager->hasNext(), std::runtime_error,
+                                 Catch::Message("Page fetch failed"));
+          }
+        }
+      }
+
+      AND_WHEN("all pages are drained") {
+        THEN("the manager's exception is rethrown") {
+          CHECK_THROWS_MATCHES(pager->drainAll(), std::runtime_error,
+                               Catch::Message("Page fetch failed"));
+        }
+      }
+    }
+  }
+}
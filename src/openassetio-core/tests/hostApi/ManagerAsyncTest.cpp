@@ -0,0 +1,584 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/export.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/BatchFuture.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveStream.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+
+struct StubHostInterface : hostApi::HostInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.host"; }
+  [[nodiscard]] Str displayName() const override { return "Test Host"; }
+};
+
+struct StubLoggerInterface : log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+
+struct StubPagerInterface : managerApi::EntityReferencePagerInterface {
+  explicit StubPagerInterface(EntityReference entityReference)
+      : page{std::move(entityReference)} {}
+  bool hasNext([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return false;
+  }
+  Page get([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return page;
+  }
+  void next([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {}
+  Page page;
+};
+
+/**
+ * ManagerInterface that responds to each reference in turn, echoing
+ * the reference back.
+ *
+ * References beginning "error" result in an error, "throw" in an
+ * exception, "skip" in no response, and "block" in waiting until the
+ * gate is opened.
+ */
+struct EchoManagerInterface : managerApi::ManagerInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.echo"; }
+  [[nodiscard]] Str displayName() const override { return "Echo"; }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return true;
+  }
+
+  void entityExists(const EntityReferences& entityReferences,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback,
+               [&](std::size_t idx, const EntityReference&) { successCallback(idx, true); });
+  }
+
+  void resolve(const EntityReferences& entityReferences,
+               [[maybe_unused]] const trait::TraitSet& traitSet,
+               [[maybe_unused]] access::ResolveAccess resolveAccess,
+               [[maybe_unused]] const ContextConstPtr& context,
+               [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback,
+               [&](std::size_t idx, const EntityReference& ref) {
+                 auto traitsData = trait::TraitsData::make();
+                 traitsData->setTraitProperty("aTrait", "ref", ref.toString());
+                 successCallback(idx, std::move(traitsData));
+               });
+  }
+
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           [[maybe_unused]] const trait::TraitsDataPtr& relationshipTraitsData,
+                           [[maybe_unused]] const trait::TraitSet& resultTraitSet,
+                           [[maybe_unused]] size_t pageSize,
+                           [[maybe_unused]] access::RelationsAccess relationsAccess,
+                           [[maybe_unused]] const ContextConstPtr& context,
+                           [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback,
+               [&](std::size_t idx, const EntityReference& ref) {
+                 successCallback(idx, std::make_shared<StubPagerInterface>(ref));
+               });
+  }
+
+  void preflight(const EntityReferences& entityReferences,
+                 [[maybe_unused]] const trait::TraitsDatas& traitsHints,
+                 [[maybe_unused]] access::PublishingAccess publishingAccess,
+                 [[maybe_unused]] const ContextConstPtr& context,
+                 [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback, successCallback);
+  }
+
+  void register_(const EntityReferences& entityReferences,
+                 [[maybe_unused]] const trait::TraitsDatas& entityTraitsDatas,
+                 [[maybe_unused]] access::PublishingAccess publishingAccess,
+                 [[maybe_unused]] const ContextConstPtr& context,
+                 [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback, successCallback);
+  }
+
+  template <class OnSuccess>
+  void forEachRef(const EntityReferences& entityReferences,
+                  const BatchElementErrorCallback& errorCallback, const OnSuccess& onSuccess) {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref.rfind("block", 0) == 0) {
+        ++numBlocked;
+        gate.wait();
+      }
+      if (ref.rfind("throw", 0) == 0) {
+        throw std::runtime_error{ref};
+      }
+      if (ref.rfind("skip", 0) == 0) {
+        continue;
+      }
+      if (ref.rfind("outofrange", 0) == 0) {
+        onSuccess(entityReferences.size() + idx, entityReferences[idx]);
+      } else if (ref.rfind("error", 0) == 0) {
+        errorCallback(idx, errors::BatchElementError{
+                               errors::BatchElementError::ErrorCode::kEntityResolutionError,
+                               ref});
+      } else {
+        onSuccess(idx, entityReferences[idx]);
+      }
+      ++numProcessed;
+    }
+  }
+
+  std::promise<void> gateOpener;
+  std::shared_future<void> gate = gateOpener.get_future().share();
+  std::atomic<std::size_t> numBlocked{0};
+  std::atomic<std::size_t> numProcessed{0};
+};
+
+struct ManagerAsyncFixture {
+  ManagerAsyncFixture()
+      : managerInterface{std::make_shared<EchoManagerInterface>()},
+        manager{hostApi::Manager::make(
+            managerInterface,
+            managerApi::HostSession::make(
+                managerApi::Host::make(std::make_shared<StubHostInterface>()),
+                std::make_shared<StubLoggerInterface>()))} {}
+
+  ~ManagerAsyncFixture() {
+    // Ensure no request is left blocked.
+    openGate();
+  }
+
+  ManagerAsyncFixture(const ManagerAsyncFixture&) = delete;
+  ManagerAsyncFixture(ManagerAsyncFixture&&) noexcept = delete;
+  ManagerAsyncFixture& operator=(const ManagerAsyncFixture&) = delete;
+  ManagerAsyncFixture& operator=(ManagerAsyncFixture&&) noexcept = delete;
+
+  void openGate() {
+    if (!isGateOpen) {
+      managerInterface->gateOpener.set_value();
+      isGateOpen = true;
+    }
+  }
+
+  void waitForBlocked(const std::size_t count) const {
+    while (managerInterface->numBlocked < count) {
+      std::this_thread::yield();
+    }
+  }
+
+  void waitForProcessed(const std::size_t count) const {
+    while (managerInterface->numProcessed < count) {
+      std::this_thread::yield();
+    }
+  }
+
+  /// Wait for any background task to release the manager.
+  void waitForRelease() const {
+    while (manager.use_count() > 1) {
+      std::this_thread::yield();
+    }
+  }
+
+  std::shared_ptr<EchoManagerInterface> managerInterface;
+  hostApi::ManagerPtr manager;
+  ContextConstPtr context = Context::make();
+  bool isGateOpen = false;
+};
+
+Str resolvedRef(const hostApi::ResolveStream::ElementResult& result) {
+  trait::property::Value value;
+  std::get<trait::TraitsDataPtr>(result)->getTraitProperty(&value, "aTrait", "ref");
+  return std::get<Str>(value);
+}
+}  // namespace
+
+SCENARIO("Asynchronous resolution") {
+  GIVEN("a Manager") {
+    ManagerAsyncFixture fixture;
+
+    WHEN("a batch is resolved asynchronously") {
+      auto future = fixture.manager->resolveAsync(
+          {EntityReference{"ref0"}, EntityReference{"error1"}, EntityReference{"ref2"}},
+          {"aTrait"}, access::ResolveAccess::kRead, fixture.context);
+
+      THEN("results are available for each element") {
+        CHECK(future.size() == 3);
+        CHECK(resolvedRef(future.element(0)) == "ref0");
+        CHECK(std::get<errors::BatchElementError>(future.element(1)).message == "error1");
+        CHECK(resolvedRef(future.element(2)) == "ref2");
+      }
+
+      THEN("results are available for the whole batch") {
+        const auto& results = future.get();
+        REQUIRE(results.size() == 3);
+        CHECK(resolvedRef(results[0]) == "ref0");
+        CHECK(std::get<errors::BatchElementError>(results[1]).message == "error1");
+        CHECK(resolvedRef(results[2]) == "ref2");
+        CHECK(future.isReady());
+        CHECK(future.numCompleted() == 3);
+        CHECK(future.isElementReady(2));
+        CHECK_FALSE(future.isCancelled());
+        CHECK(future.completion().wait_for(std::chrono::seconds{0}) ==
+              std::future_status::ready);
+      }
+
+      THEN("an out of range element index is an error") {
+        CHECK_FALSE(future.isElementReady(3));
+        CHECK_THROWS_AS(future.element(3), errors::InputValidationException);
+      }
+    }
+
+    WHEN("the manager throws part way through a batch") {
+      auto future = fixture.manager->resolveAsync(
+          {EntityReference{"ref0"}, EntityReference{"throw1"}, EntityReference{"ref2"}},
+          {"aTrait"}, access::ResolveAccess::kRead, fixture.context);
+
+      THEN("the exception is rethrown for the batch and incomplete elements") {
+        CHECK_THROWS_WITH(future.get(), "throw1");
+        CHECK(resolvedRef(future.element(0)) == "ref0");
+        CHECK_THROWS_WITH(future.element(2), "throw1");
+        CHECK(future.numCompleted() == 1);
+      }
+    }
+
+    WHEN("a request is blocked in the manager") {
+      auto future = fixture.manager->resolveAsync(
+          {EntityReference{"ref0"}, EntityReference{"block1"}, EntityReference{"ref2"}},
+          {"aTrait"}, access::ResolveAccess::kRead, fixture.context);
+      fixture.waitForBlocked(1);
+
+      THEN("completed elements are available") {
+        CHECK(resolvedRef(future.element(0)) == "ref0");
+        CHECK(future.numCompleted() == 1);
+        CHECK_FALSE(future.isElementReady(1));
+        CHECK_FALSE(future.isReady());
+        CHECK_FALSE(future.waitFor(std::chrono::milliseconds{1}));
+      }
+
+      AND_WHEN("the request is cancelled") {
+        future.cancel();
+
+        THEN("incomplete elements complete with a cancellation error") {
+          CHECK(future.isReady());
+          CHECK(future.isCancelled());
+          const auto& results = future.get();
+          CHECK(resolvedRef(results[0]) == "ref0");
+          for (const std::size_t idx : {1, 2}) {
+            const auto& error = std::get<errors::BatchElementError>(results[idx]);
+            CHECK(error.code == errors::BatchElementError::ErrorCode::kUnknown);
+            CHECK(error.message == hostApi::Manager::ResolveFuture::kCancelledMessage);
+          }
+        }
+
+        AND_WHEN("the manager resumes") {
+          fixture.openGate();
+
+          THEN("the manager is interrupted at the next result") {
+            fixture.waitForRelease();
+            CHECK(fixture.managerInterface->numProcessed == 1);
+            CHECK(std::holds_alternative<errors::BatchElementError>(future.get()[1]));
+          }
+        }
+      }
+    }
+
+    WHEN("several requests are made concurrently") {
+      auto first = fixture.manager->resolveAsync({EntityReference{"block0"}}, {"aTrait"},
+                                                 access::ResolveAccess::kRead, fixture.context);
+      auto second = fixture.manager->resolveAsync({EntityReference{"block1"}}, {"aTrait"},
+                                                  access::ResolveAccess::kRead, fixture.context);
+
+      THEN("the requests are in flight at the same time") {
+        fixture.waitForBlocked(2);
+        fixture.openGate();
+        CHECK(resolvedRef(first.get()[0]) == "block0");
+        CHECK(resolvedRef(second.get()[0]) == "block1");
+      }
+    }
+  }
+}
+
+SCENARIO("Asynchronous batch queries") {
+  GIVEN("a Manager") {
+    ManagerAsyncFixture fixture;
+    const EntityReferences refs{EntityReference{"ref0"}, EntityReference{"error1"}};
+
+    WHEN("existence is queried asynchronously") {
+      // Results of a temporary handle are returned by value.
+      const auto results = fixture.manager->entityExistsAsync(refs, fixture.context).get();
+
+      THEN("results are available for each element") {
+        CHECK(std::get<bool>(results[0]));
+        CHECK(std::holds_alternative<errors::BatchElementError>(results[1]));
+      }
+    }
+
+    WHEN("relationships are queried asynchronously") {
+      const auto future = fixture.manager->getWithRelationshipAsync(
+          refs, trait::TraitsData::make(), 1, access::RelationsAccess::kRead, fixture.context);
+      const auto& results = future.get();
+
+      THEN("results are available for each element") {
+        const auto& pager = std::get<hostApi::EntityReferencePagerPtr>(results[0]);
+        CHECK(pager->get() == EntityReferences{refs[0]});
+        CHECK(std::holds_alternative<errors::BatchElementError>(results[1]));
+      }
+    }
+
+    WHEN("the manager reports a result for an index outside the batch") {
+      const auto future = fixture.manager->entityExistsAsync(
+          {EntityReference{"ref0"}, EntityReference{"outofrange1"}}, fixture.context);
+
+      THEN("a validation error is rethrown from the handle") {
+        CHECK_THROWS_MATCHES(
+            future.get(), errors::InputValidationException,
+            Catch::Message("Manager provided index 3 out of range for batch of size 2."));
+      }
+    }
+
+    WHEN("relationships are queried asynchronously with an invalid page size") {
+      const auto future = fixture.manager->getWithRelationshipAsync(
+          refs, trait::TraitsData::make(), 0, access::RelationsAccess::kRead, fixture.context);
+
+      THEN("the validation error is rethrown from the handle") {
+        CHECK_THROWS_AS(future.get(), errors::InputValidationException);
+      }
+    }
+
+    WHEN("entities are preflighted and registered asynchronously") {
+      const trait::TraitsDatas traitsDatas{trait::TraitsData::make(), trait::TraitsData::make()};
+      const auto preflightFuture = fixture.manager->preflightAsync(
+          refs, traitsDatas, access::PublishingAccess::kWrite, fixture.context);
+      const auto registerFuture = fixture.manager->registerAsync(
+          refs, traitsDatas, access::PublishingAccess::kWrite, fixture.context);
+
+      THEN("results are available for each element") {
+        CHECK(std::get<EntityReference>(preflightFuture.get()[0]) == refs[0]);
+        CHECK(std::holds_alternative<errors::BatchElementError>(preflightFuture.get()[1]));
+        CHECK(std::get<EntityReference>(registerFuture.get()[0]) == refs[0]);
+        CHECK(std::holds_alternative<errors::BatchElementError>(registerFuture.get()[1]));
+      }
+    }
+
+    WHEN("entities are registered asynchronously with mismatched arguments") {
+      const auto future = fixture.manager->registerAsync(
+          refs, {trait::TraitsData::make()}, access::PublishingAccess::kWrite, fixture.context);
+
+      THEN("the validation error is rethrown from the handle") {
+        CHECK_THROWS_AS(future.get(), errors::InputValidationException);
+      }
+    }
+  }
+}
+
+SCENARIO("Streaming resolution") {
+  GIVEN("a Manager") {
+    ManagerAsyncFixture fixture;
+
+    WHEN("a batch is resolved as a stream") {
+      hostApi::ResolveStreamPtr stream = fixture.manager->resolveStream(
+          {EntityReference{"ref0"}, EntityReference{"skip1"}, EntityReference{"error2"},
+           EntityReference{"ref3"}},
+          {"aTrait"}, access::ResolveAccess::kRead, fixture.context);
+
+      THEN("each element is yielded once, with its index") {
+        CHECK(stream->size() == 4);
+        CHECK(stream->maxQueueSize() == hostApi::ResolveStream::kDefaultMaxQueueSize);
+
+        std::map<std::size_t, hostApi::ResolveStream::ElementResult> results;
+        for (const auto& [index, result] : *stream) {
+          CHECK(results.count(index) == 0);
+          results.emplace(index, result);
+        }
+
+        REQUIRE(results.size() == 4);
+        CHECK(resolvedRef(results[0]) == "ref0");
+        CHECK(std::get<errors::BatchElementError>(results[2]).message == "error2");
+        CHECK(resolvedRef(results[3]) == "ref3");
+
+        AND_THEN("elements the manager did not respond to have a default error") {
+          CHECK(std::get<errors::BatchElementError>(results[1]) == errors::BatchElementError{});
+        }
+
+        AND_THEN("the exhausted stream yields nothing further") {
+          CHECK_FALSE(stream->next().has_value());
+        }
+      }
+    }
+
+    WHEN("results are produced faster than they are consumed") {
+      constexpr std::size_t kMaxQueueSize = 2;
+      constexpr std::size_t kNumRefs = 10;
+      EntityReferences refs;
+      for (std::size_t idx = 0; idx < kNumRefs; ++idx) {
+        refs.emplace_back("ref" + std::to_string(idx));
+      }
+      hostApi::ResolveStreamPtr stream = fixture.manager->resolveStream(
+          refs, {"aTrait"}, access::ResolveAccess::kRead, fixture.context, kMaxQueueSize);
+
+      THEN("the manager is blocked once the queue is full") {
+        fixture.waitForProcessed(kMaxQueueSize);
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        CHECK(fixture.managerInterface->numProcessed == kMaxQueueSize);
+
+        AND_THEN("the manager resumes as results are consumed") {
+          std::size_t numResults = 0;
+          while (const auto element = stream->next()) {
+            CHECK(resolvedRef(element->result) == "ref" + std::to_string(element->index));
+            ++numResults;
+          }
+          CHECK(numResults == kNumRefs);
+          CHECK(fixture.managerInterface->numProcessed == kNumRefs);
+        }
+      }
+
+      AND_WHEN("the stream is destroyed before it is exhausted") {
+        fixture.waitForProcessed(kMaxQueueSize);
+        stream.reset();
+
+        THEN("the manager is interrupted and its call has returned") {
+          CHECK(fixture.manager.use_count() == 1);
+          CHECK(fixture.managerInterface->numProcessed == kMaxQueueSize);
+        }
+      }
+    }
+
+    WHEN("the manager throws part way through a batch") {
+      hostApi::ResolveStreamPtr stream = fixture.manager->resolveStream(
+          {EntityReference{"ref0"}, EntityReference{"throw1"}, EntityReference{"ref2"}},
+          {"aTrait"}, access::ResolveAccess::kRead, fixture.context);
+
+      THEN("results before the exception are yielded, then the exception is thrown once") {
+        const auto element = stream->next();
+        REQUIRE(element.has_value());
+        CHECK(element->index == 0);
+        CHECK_THROWS_WITH(stream->next(), "throw1");
+        CHECK_FALSE(stream->next().has_value());
+      }
+    }
+
+    WHEN("the stream is cancelled whilst the manager is blocked") {
+      hostApi::ResolveStreamPtr stream = fixture.manager->resolveStream(
+          {EntityReference{"ref0"}, EntityReference{"block1"}}, {"aTrait"},
+          access::ResolveAccess::kRead, fixture.context);
+      fixture.waitForBlocked(1);
+      stream->cancel();
+
+      THEN("the stream yields nothing further") { CHECK_FALSE(stream->next().has_value()); }
+
+      // Allow the manager's call to return, so the stream can be
+      // destroyed.
+      fixture.openGate();
+    }
+
+    WHEN("there are more stalled streams than asynchronous request workers") {
+      // Each stream's queue is full, with the host yet to consume
+      // from any of them.
+      const std::size_t numStreams = std::thread::hardware_concurrency() + 4;
+      std::vector<hostApi::ResolveStreamPtr> streams;
+      for (std::size_t idx = 0; idx < numStreams; ++idx) {
+        streams.push_back(fixture.manager->resolveStream(
+            {EntityReference{"ref0"}, EntityReference{"ref1"}}, {"aTrait"},
+            access::ResolveAccess::kRead, fixture.context, 1));
+      }
+      fixture.waitForProcessed(numStreams);
+
+      THEN("asynchronous requests are not starved") {
+        auto future = fixture.manager->resolveAsync({EntityReference{"ref0"}}, {"aTrait"},
+                                                    access::ResolveAccess::kRead,
+                                                    fixture.context);
+        REQUIRE(future.completion().wait_for(std::chrono::seconds{10}) ==
+                std::future_status::ready);
+        CHECK(resolvedRef(future.element(0)) == "ref0");
+
+        AND_THEN("the streams complete as they are consumed") {
+          for (const auto& stream : streams) {
+            std::size_t numResults = 0;
+            while (stream->next()) {
+              ++numResults;
+            }
+            CHECK(numResults == 2);
+          }
+        }
+      }
+    }
+
+    WHEN("the stream is destroyed whilst the manager is blocked") {
+      hostApi::ResolveStreamPtr stream = fixture.manager->resolveStream(
+          {EntityReference{"block0"}}, {"aTrait"}, access::ResolveAccess::kRead,
+          fixture.context);
+      fixture.waitForBlocked(1);
+
+      std::thread opener{[&fixture] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        fixture.openGate();
+      }};
+      stream.reset();
+      opener.join();
+
+      THEN("destruction waits for the manager's call to return") {
+        CHECK(fixture.manager.use_count() == 1);
+      }
+    }
+
+    WHEN("the manager reports a result for an index outside the batch") {
+      hostApi::ResolveStreamPtr stream = fixture.manager->resolveStream(
+          {EntityReference{"ref0"}, EntityReference{"outofrange1"}}, {"aTrait"},
+          access::ResolveAccess::kRead, fixture.context);
+
+      THEN("results before the invalid index are yielded, then an exception is thrown") {
+        const auto element = stream->next();
+        REQUIRE(element.has_value());
+        CHECK(element->index == 0);
+        CHECK_THROWS_MATCHES(
+            stream->next(), errors::InputValidationException,
+            Catch::Message("Manager provided index 3 out of range for batch of size 2."));
+        CHECK_FALSE(stream->next().has_value());
+      }
+    }
+
+    WHEN("a zero queue size is requested") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(fixture.manager->resolveStream({EntityReference{"ref0"}}, {"aTrait"},
+                                                       access::ResolveAccess::kRead,
+                                                       fixture.context, 0),
+                        errors::InputValidationException);
+      }
+    }
+  }
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
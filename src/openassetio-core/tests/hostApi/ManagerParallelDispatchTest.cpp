@@ -0,0 +1,314 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <openassetio/export.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+
+struct StubHostInterface : hostApi::HostInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.host"; }
+  [[nodiscard]] Str displayName() const override { return "Test Host"; }
+};
+
+struct StubLoggerInterface : log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+
+/**
+ * ManagerInterface that records the size of each batch it is given,
+ * and can be made to declare itself thread-safe.
+ *
+ * Resolves each reference to a TraitsData holding the reference string,
+ * except references beginning "error", which result in an error, and
+ * references beginning "throw", which cause an exception.
+ */
+struct ShardRecordingManagerInterface : managerApi::ManagerInterface {
+  explicit ShardRecordingManagerInterface(const bool isThreadSafe_) : isThreadSafe{isThreadSafe_} {}
+
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.shards"; }
+  [[nodiscard]] Str displayName() const override { return "Shards"; }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return true;
+  }
+
+  [[nodiscard]] InfoDictionary info() override {
+    return {{Str{constants::kInfoKey_IsThreadSafe}, isThreadSafe}};
+  }
+
+  void entityExists(const EntityReferences& entityReferences,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback,
+               [&](std::size_t idx, const Str&) { successCallback(idx, true); });
+  }
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    [[maybe_unused]] access::EntityTraitsAccess entityTraitsAccess,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback,
+               [&](std::size_t idx, const Str& ref) { successCallback(idx, {ref}); });
+  }
+
+  void resolve(const EntityReferences& entityReferences,
+               [[maybe_unused]] const trait::TraitSet& traitSet,
+               [[maybe_unused]] access::ResolveAccess resolveAccess,
+               [[maybe_unused]] const ContextConstPtr& context,
+               [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback, [&](std::size_t idx, const Str& ref) {
+      auto traitsData = trait::TraitsData::make();
+      traitsData->setTraitProperty("aTrait", "ref", ref);
+      successCallback(idx, std::move(traitsData));
+    });
+  }
+
+  template <class OnSuccess>
+  void forEachRef(const EntityReferences& entityReferences,
+                  const BatchElementErrorCallback& errorCallback, const OnSuccess& onSuccess) {
+    {
+      const std::lock_guard lock{mutex};
+      batchSizes.push_back(entityReferences.size());
+    }
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref.rfind("throw", 0) == 0) {
+        throw std::runtime_error{ref};
+      }
+      if (ref.rfind("error", 0) == 0) {
+        errorCallback(idx, errors::BatchElementError{
+                               errors::BatchElementError::ErrorCode::kEntityResolutionError,
+                               ref});
+      } else {
+        onSuccess(idx, ref);
+      }
+    }
+  }
+
+  const bool isThreadSafe;
+  std::mutex mutex;
+  std::vector<std::size_t> batchSizes;
+};
+
+/**
+ * Fixture providing an initialized Manager wrapping a
+ * ShardRecordingManagerInterface.
+ */
+struct ParallelDispatchFixture {
+  explicit ParallelDispatchFixture(const bool isThreadSafe = true)
+      : managerInterface{std::make_shared<ShardRecordingManagerInterface>(isThreadSafe)},
+        manager{hostApi::Manager::make(
+            managerInterface,
+            managerApi::HostSession::make(
+                managerApi::Host::make(std::make_shared<StubHostInterface>()),
+                std::make_shared<StubLoggerInterface>()))} {
+    manager->initialize({});
+  }
+
+  /// References "ref0", "ref1", ..., with every tenth an error.
+  static EntityReferences makeRefs(const std::size_t count) {
+    EntityReferences refs;
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      refs.emplace_back((idx % 10 == 3 ? "error" : "ref") + std::to_string(idx));
+    }
+    return refs;
+  }
+
+  std::shared_ptr<ShardRecordingManagerInterface> managerInterface;
+  hostApi::ManagerPtr manager;
+  ContextConstPtr context = Context::make();
+};
+}  // namespace
+
+SCENARIO("Parallel dispatch of Manager batch methods") {
+  GIVEN("a Manager wrapping a thread-safe manager interface") {
+    ParallelDispatchFixture fixture;
+    const EntityReferences refs = ParallelDispatchFixture::makeRefs(100);
+
+    THEN("parallel dispatch is disabled by default") {
+      CHECK_FALSE(fixture.manager->isParallelDispatchEnabled());
+
+      fixture.manager->resolve(
+          refs, {"aTrait"}, access::ResolveAccess::kRead, fixture.context,
+          [](std::size_t, const trait::TraitsDataPtr&) {},
+          [](std::size_t, const errors::BatchElementError&) {});
+
+      CHECK(fixture.managerInterface->batchSizes == std::vector<std::size_t>{100});
+    }
+
+    AND_GIVEN("parallel dispatch is enabled") {
+      fixture.manager->enableParallelDispatch(4, 10);
+      REQUIRE(fixture.manager->isParallelDispatchEnabled());
+
+      WHEN("a batch is resolved") {
+        const std::thread::id callingThreadId = std::this_thread::get_id();
+        std::vector<Str> resolvedRefs(refs.size());
+        std::vector<std::size_t> timesReported(refs.size(), 0);
+        bool allOnCallingThread = true;
+
+        fixture.manager->resolve(
+            refs, {"aTrait"}, access::ResolveAccess::kRead, fixture.context,
+            [&](std::size_t idx, const trait::TraitsDataPtr& traitsData) {
+              allOnCallingThread &= std::this_thread::get_id() == callingThreadId;
+              ++timesReported[idx];
+              trait::property::Value value;
+              traitsData->getTraitProperty(&value, "aTrait", "ref");
+              resolvedRefs[idx] = std::get<Str>(value);
+            },
+            [&](std::size_t idx, const errors::BatchElementError& error) {
+              allOnCallingThread &= std::this_thread::get_id() == callingThreadId;
+              ++timesReported[idx];
+              resolvedRefs[idx] = error.message;
+            });
+
+        THEN("the batch is split into shards") {
+          CHECK(fixture.managerInterface->batchSizes ==
+                std::vector<std::size_t>{25, 25, 25, 25});
+        }
+
+        THEN("each element is reported once, with its original index") {
+          for (std::size_t idx = 0; idx < refs.size(); ++idx) {
+            CHECK(timesReported[idx] == 1);
+            CHECK(resolvedRefs[idx] == refs[idx].toString());
+          }
+        }
+
+        THEN("callbacks are called on the calling thread") { CHECK(allOnCallingThread); }
+      }
+
+      WHEN("entity existence and traits are queried") {
+        std::size_t numExists = 0;
+        std::size_t numTraits = 0;
+        std::size_t numErrors = 0;
+        bool allTraitsMatch = true;
+
+        fixture.manager->entityExists(
+            refs, fixture.context, [&](std::size_t, bool) { ++numExists; },
+            [&](std::size_t, const errors::BatchElementError&) { ++numErrors; });
+        fixture.manager->entityTraits(
+            refs, access::EntityTraitsAccess::kRead, fixture.context,
+            [&](std::size_t idx, const trait::TraitSet& traitSet) {
+              allTraitsMatch &= traitSet == trait::TraitSet{refs[idx].toString()};
+              ++numTraits;
+            },
+            [&](std::size_t, const errors::BatchElementError&) { ++numErrors; });
+
+        THEN("all elements are reported with their original index") {
+          CHECK(fixture.managerInterface->batchSizes.size() == 8);
+          CHECK(numExists == 90);
+          CHECK(numTraits == 90);
+          CHECK(numErrors == 20);
+          CHECK(allTraitsMatch);
+        }
+      }
+
+      WHEN("a batch too small to split is resolved") {
+        fixture.manager->resolve(
+            ParallelDispatchFixture::makeRefs(19), {"aTrait"}, access::ResolveAccess::kRead,
+            fixture.context, [](std::size_t, const trait::TraitsDataPtr&) {},
+            [](std::size_t, const errors::BatchElementError&) {});
+
+        THEN("the batch is dispatched whole") {
+          CHECK(fixture.managerInterface->batchSizes == std::vector<std::size_t>{19});
+        }
+      }
+
+      WHEN("a callback throws") {
+        THEN("the exception is propagated") {
+          CHECK_THROWS_AS(fixture.manager->resolve(
+                              refs, {"aTrait"}, access::ResolveAccess::kRead, fixture.context,
+                              [](std::size_t, const trait::TraitsDataPtr&) {},
+                              [](std::size_t, const errors::BatchElementError& error) {
+                                throw errors::BatchElementException{0, error, error.message};
+                              }),
+                          errors::BatchElementException);
+        }
+      }
+
+      WHEN("the manager throws whilst processing a shard") {
+        EntityReferences refsWithThrow = refs;
+        refsWithThrow[80] = EntityReference{"throw80"};
+
+        THEN("the exception is propagated") {
+          CHECK_THROWS_WITH(fixture.manager->resolve(
+                                refsWithThrow, {"aTrait"}, access::ResolveAccess::kRead,
+                                fixture.context, [](std::size_t, const trait::TraitsDataPtr&) {},
+                                [](std::size_t, const errors::BatchElementError&) {}),
+                            "throw80");
+        }
+      }
+
+      AND_WHEN("parallel dispatch is disabled") {
+        fixture.manager->disableParallelDispatch();
+
+        THEN("batches are dispatched whole") {
+          CHECK_FALSE(fixture.manager->isParallelDispatchEnabled());
+
+          fixture.manager->resolve(
+              refs, {"aTrait"}, access::ResolveAccess::kRead, fixture.context,
+              [](std::size_t, const trait::TraitsDataPtr&) {},
+              [](std::size_t, const errors::BatchElementError&) {});
+
+          CHECK(fixture.managerInterface->batchSizes == std::vector<std::size_t>{100});
+        }
+      }
+    }
+
+    WHEN("parallel dispatch is enabled with a zero minimum shard size") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(fixture.manager->enableParallelDispatch(4, 0),
+                        errors::InputValidationException);
+      }
+    }
+  }
+
+  GIVEN("a Manager wrapping a manager interface that is not thread-safe") {
+    ParallelDispatchFixture fixture{false};
+
+    AND_GIVEN("parallel dispatch is enabled") {
+      fixture.manager->enableParallelDispatch(4, 10);
+
+      WHEN("a batch is resolved") {
+        fixture.manager->resolve(
+            ParallelDispatchFixture::makeRefs(100), {"aTrait"}, access::ResolveAccess::kRead,
+            fixture.context, [](std::size_t, const trait::TraitsDataPtr&) {},
+            [](std::size_t, const errors::BatchElementError&) {});
+
+        THEN("the batch is dispatched whole") {
+          CHECK(fixture.managerInterface->batchSizes == std::vector<std::size_t>{100});
+        }
+      }
+    }
+  }
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
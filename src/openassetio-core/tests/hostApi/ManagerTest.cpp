@@ -346,6 +346,67 @@ SCENARIO("Resolving entities") {
   }
 }
 
+SCENARIO("Resolving entities into columns") {
+  namespace hostApi = openassetio::hostApi;
+  using trompeloeil::_;
+
+  GIVEN("a configured Manager instance") {
+    const openassetio::ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& context = fixture.context;
+    const auto& hostSession = fixture.hostSession;
+    const auto resolveAccess = openassetio::access::ResolveAccess::kRead;
+
+    const hostApi::ResolvedBatch::ColumnSpecs columnSpecs{
+        {"aTrait", "aStr", hostApi::ResolvedBatch::ColumnType::kStr},
+        {"anotherTrait", "anInt", hostApi::ResolvedBatch::ColumnType::kInt}};
+    const openassetio::trait::TraitSet expectedTraits{"aTrait", "anotherTrait"};
+
+    GIVEN("manager plugin resolves some entities and errors for others, out of order") {
+      const openassetio::EntityReferences refs = {openassetio::EntityReference{"testReference1"},
+                                                  openassetio::EntityReference{"testReference2"},
+                                                  openassetio::EntityReference{"testReference3"}};
+
+      const openassetio::trait::TraitsDataPtr value0 = openassetio::trait::TraitsData::make();
+      value0->setTraitProperty("aTrait", "aStr", openassetio::Str{"first"});
+      value0->setTraitProperty("anotherTrait", "anInt", openassetio::Int{1});
+      const openassetio::trait::TraitsDataPtr value2 = openassetio::trait::TraitsData::make();
+      value2->setTraitProperty("aTrait", "aStr", openassetio::Str{"third"});
+      const openassetio::errors::BatchElementError expectedError1{
+          openassetio::errors::BatchElementError::ErrorCode::kEntityAccessError,
+          "Entity Access Error Message"};
+
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(refs, expectedTraits, resolveAccess, context, hostSession, _, _))
+          .LR_SIDE_EFFECT(_6(2, value2))
+          .LR_SIDE_EFFECT(_7(1, expectedError1))
+          .LR_SIDE_EFFECT(_6(0, value0));
+
+      WHEN("resolveColumns is called") {
+        const hostApi::ResolvedBatch actual =
+            manager->resolveColumns(refs, columnSpecs, resolveAccess, context);
+
+        THEN("values are available in the expected rows") {
+          CHECK(actual.size() == 3);
+          CHECK(actual.strValue(0, 0) == "first");
+          CHECK(actual.intColumn(1)[0] == 1);
+          CHECK(actual.strValue(0, 2) == "third");
+          CHECK_FALSE(actual.isValid(1, 2));
+        }
+
+        THEN("errors are available in the expected rows") {
+          CHECK_FALSE(actual.isError(0));
+          CHECK(actual.isError(1));
+          CHECK(actual.error(1) == expectedError1);
+          CHECK_FALSE(actual.isValid(0, 1));
+          CHECK_FALSE(actual.isError(2));
+        }
+      }
+    }
+  }
+}
+
 using ErrorCode = openassetio::errors::BatchElementError::ErrorCode;
 
 SCENARIO("Preflighting entities") {
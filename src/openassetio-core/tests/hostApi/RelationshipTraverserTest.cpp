@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/RelationshipTraverser.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+
+struct StubHostInterface : hostApi::HostInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.host"; }
+  [[nodiscard]] Str displayName() const override { return "Test Host"; }
+};
+
+struct StubLoggerInterface : log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+
+/// Pager over a fixed list of references, in pages of a given size.
+struct ListPagerInterface : managerApi::EntityReferencePagerInterface {
+  ListPagerInterface(EntityReferences refs_, const std::size_t pageSize_)
+      : refs{std::move(refs_)}, pageSize{pageSize_} {}
+
+  bool hasNext([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    return offset + pageSize < refs.size();
+  }
+
+  Page get([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    const std::size_t begin = std::min(offset, refs.size());
+    const std::size_t end = std::min(offset + pageSize, refs.size());
+    return {refs.begin() + static_cast<std::ptrdiff_t>(begin),
+            refs.begin() + static_cast<std::ptrdiff_t>(end)};
+  }
+
+  void next([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    offset += pageSize;
+  }
+
+  EntityReferences refs;
+  std::size_t pageSize;
+  std::size_t offset{0};
+};
+
+/**
+ * ManagerInterface serving relationships from a fixed adjacency list,
+ * recording the batch of references given to each query.
+ *
+ * References without an entry in the adjacency list result in an
+ * error.
+ */
+struct GraphManagerInterface : managerApi::ManagerInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.graph"; }
+  [[nodiscard]] Str displayName() const override { return "Graph"; }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return true;
+  }
+
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           [[maybe_unused]] const trait::TraitsDataPtr& relationshipTraitsData,
+                           [[maybe_unused]] const trait::TraitSet& resultTraitSet,
+                           const std::size_t pageSize,
+                           [[maybe_unused]] access::RelationsAccess relationsAccess,
+                           [[maybe_unused]] const ContextConstPtr& context,
+                           [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override {
+    queries.push_back(entityReferences);
+    // Respond in reverse order, to check results do not depend on it.
+    for (std::size_t idx = entityReferences.size(); idx-- > 0;) {
+      const auto related = graph.find(entityReferences[idx].toString());
+      if (related == graph.end()) {
+        errorCallback(idx, errors::BatchElementError{
+                               errors::BatchElementError::ErrorCode::kEntityResolutionError,
+                               entityReferences[idx].toString()});
+        continue;
+      }
+      EntityReferences relatedRefs;
+      for (const auto& ref : related->second) {
+        relatedRefs.emplace_back(ref);
+      }
+      successCallback(idx, std::make_shared<ListPagerInterface>(std::move(relatedRefs), pageSize));
+    }
+  }
+
+  std::map<Str, std::vector<Str>> graph;
+  std::vector<EntityReferences> queries;
+};
+
+struct TraverserFixture {
+  TraverserFixture()
+      : managerInterface{std::make_shared<GraphManagerInterface>()},
+        manager{hostApi::Manager::make(
+            managerInterface,
+            managerApi::HostSession::make(
+                managerApi::Host::make(std::make_shared<StubHostInterface>()),
+                std::make_shared<StubLoggerInterface>()))} {
+    manager->initialize({});
+  }
+
+  [[nodiscard]] hostApi::RelationshipTraverserPtr makeTraverser() const {
+    return hostApi::RelationshipTraverser::make(manager, trait::TraitsData::make({"dependsOn"}),
+                                                access::RelationsAccess::kRead, Context::make(),
+                                                {}, 2);
+  }
+
+  std::shared_ptr<GraphManagerInterface> managerInterface;
+  hostApi::ManagerPtr manager;
+};
+
+std::vector<std::pair<Str, std::size_t>> nodesOf(
+    const hostApi::RelationshipTraverser::Traversal& traversal) {
+  std::vector<std::pair<Str, std::size_t>> nodes;
+  for (const auto& node : traversal.nodes) {
+    nodes.emplace_back(node.entityReference.toString(), node.depth);
+  }
+  return nodes;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> edgesOf(
+    const hostApi::RelationshipTraverser::Traversal& traversal) {
+  std::vector<std::pair<std::size_t, std::size_t>> edges;
+  for (const auto& edge : traversal.edges) {
+    edges.emplace_back(edge.source, edge.target);
+  }
+  return edges;
+}
+
+using Nodes = std::vector<std::pair<Str, std::size_t>>;
+using Edges = std::vector<std::pair<std::size_t, std::size_t>>;
+}  // namespace
+
+SCENARIO("RelationshipTraverser construction") {
+  GIVEN("a Manager") {
+    const TraverserFixture fixture;
+
+    WHEN("a traverser is constructed with a zero page size") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(
+            hostApi::RelationshipTraverser::make(fixture.manager, trait::TraitsData::make(),
+                                                 access::RelationsAccess::kRead,
+                                                 Context::make(), {}, 0),
+            errors::InputValidationException);
+      }
+    }
+  }
+}
+
+SCENARIO("RelationshipTraverser traversal") {
+  GIVEN("a Manager serving an acyclic graph with shared dependencies") {
+    TraverserFixture fixture;
+    // a -> b, c; b -> d, e, f; c -> d; d, e, f -> (none)
+    fixture.managerInterface->graph = {{"a", {"b", "c"}}, {"b", {"d", "e", "f"}}, {"c", {"d"}},
+                                       {"d", {}},         {"e", {}},              {"f", {}}};
+    const auto traverser = fixture.makeTraverser();
+
+    WHEN("the graph is traversed from its root") {
+      const auto traversal = traverser->traverse({EntityReference{"a"}});
+
+      THEN("all entities are visited once, in breadth-first order") {
+        CHECK(nodesOf(traversal) ==
+              Nodes{{"a", 0}, {"b", 1}, {"c", 1}, {"d", 2}, {"e", 2}, {"f", 2}});
+        CHECK(edgesOf(traversal) == Edges{{0, 1}, {0, 2}, {1, 3}, {1, 4}, {1, 5}, {2, 3}});
+        CHECK(traversal.errors.empty());
+        CHECK_FALSE(traversal.hasCycle);
+      }
+
+      THEN("one query is made per level, batching the whole frontier") {
+        CHECK(traverser->queryCount() == 3);
+        REQUIRE(fixture.managerInterface->queries.size() == 3);
+        CHECK(fixture.managerInterface->queries[0] == EntityReferences{EntityReference{"a"}});
+        CHECK(fixture.managerInterface->queries[1] ==
+              EntityReferences{EntityReference{"b"}, EntityReference{"c"}});
+        CHECK(fixture.managerInterface->queries[2] ==
+              EntityReferences{EntityReference{"d"}, EntityReference{"e"},
+                               EntityReference{"f"}});
+      }
+
+      AND_WHEN("an overlapping traversal is made") {
+        const auto subTraversal = traverser->traverse({EntityReference{"c"}});
+
+        THEN("memoised relationships are used without querying the manager") {
+          CHECK(nodesOf(subTraversal) == Nodes{{"c", 0}, {"d", 1}});
+          CHECK(traverser->queryCount() == 3);
+        }
+
+        AND_WHEN("the cache is cleared and the traversal repeated") {
+          traverser->clearCache();
+          traverser->traverse({EntityReference{"c"}});
+
+          THEN("the manager is queried again") { CHECK(traverser->queryCount() == 5); }
+        }
+      }
+    }
+
+    WHEN("the graph is traversed with a depth limit") {
+      const auto traversal = traverser->traverse({EntityReference{"a"}}, 1);
+
+      THEN("entities at the depth limit are visited but not expanded") {
+        CHECK(nodesOf(traversal) == Nodes{{"a", 0}, {"b", 1}, {"c", 1}});
+        CHECK(traverser->queryCount() == 1);
+      }
+    }
+
+    WHEN("the graph is traversed with a zero depth limit") {
+      const auto traversal =
+          traverser->traverse({EntityReference{"b"}, EntityReference{"a"}, EntityReference{"b"}}, 0);
+
+      THEN("only the de-duplicated roots are visited") {
+        CHECK(nodesOf(traversal) == Nodes{{"b", 0}, {"a", 0}});
+        CHECK(traverser->queryCount() == 0);
+      }
+    }
+  }
+
+  GIVEN("a Manager serving a graph with a cycle") {
+    TraverserFixture fixture;
+    fixture.managerInterface->graph = {{"a", {"b"}}, {"b", {"c"}}, {"c", {"a"}}};
+    const auto traverser = fixture.makeTraverser();
+
+    WHEN("the graph is traversed") {
+      const auto traversal = traverser->traverse({EntityReference{"a"}});
+
+      THEN("traversal terminates and the cycle is reported") {
+        CHECK(nodesOf(traversal) == Nodes{{"a", 0}, {"b", 1}, {"c", 2}});
+        CHECK(edgesOf(traversal) == Edges{{0, 1}, {1, 2}, {2, 0}});
+        CHECK(traversal.hasCycle);
+        CHECK(traverser->queryCount() == 3);
+      }
+    }
+  }
+
+  GIVEN("a Manager that fails to query some entities") {
+    TraverserFixture fixture;
+    // "missing" has no entry, so results in an error.
+    fixture.managerInterface->graph = {{"a", {"missing", "b"}}, {"b", {}}};
+    const auto traverser = fixture.makeTraverser();
+
+    WHEN("the graph is traversed") {
+      const auto traversal = traverser->traverse({EntityReference{"a"}});
+
+      THEN("errors are reported against the entity and it is not expanded") {
+        CHECK(nodesOf(traversal) == Nodes{{"a", 0}, {"missing", 1}, {"b", 1}});
+        REQUIRE(traversal.errors.size() == 1);
+        CHECK(traversal.errors[0].first == 1);
+        CHECK(traversal.errors[0].second.message == "missing");
+        CHECK_FALSE(traversal.hasCycle);
+      }
+    }
+  }
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ResolvedBatch.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+using openassetio::errors::BatchElementError;
+using openassetio::hostApi::ResolvedBatch;
+
+SCENARIO("ResolvedBatch population and access") {
+  GIVEN("a ResolvedBatch with a column of each type") {
+    ResolvedBatch batch{{{"aTrait", "aBool", ResolvedBatch::ColumnType::kBool},
+                         {"aTrait", "anInt", ResolvedBatch::ColumnType::kInt},
+                         {"anotherTrait", "aFloat", ResolvedBatch::ColumnType::kFloat},
+                         {"anotherTrait", "aStr", ResolvedBatch::ColumnType::kStr}},
+                        3};
+
+    THEN("all rows are initially invalid and not in error") {
+      CHECK(batch.size() == 3);
+      CHECK(batch.columnSpecs().size() == 4);
+      for (std::size_t index = 0; index < batch.size(); ++index) {
+        CHECK_FALSE(batch.isError(index));
+        for (std::size_t column = 0; column < batch.columnSpecs().size(); ++column) {
+          CHECK_FALSE(batch.isValid(column, index));
+        }
+      }
+      CHECK(batch.errors().empty());
+    }
+
+    WHEN("rows are populated out of order") {
+      const auto data0 = openassetio::trait::TraitsData::make();
+      data0->setTraitProperty("aTrait", "aBool", true);
+      data0->setTraitProperty("aTrait", "anInt", openassetio::Int{3});
+      data0->setTraitProperty("anotherTrait", "aFloat", 1.5);
+      data0->setTraitProperty("anotherTrait", "aStr", openassetio::Str{"first"});
+
+      const auto data2 = openassetio::trait::TraitsData::make();
+      data2->setTraitProperty("anotherTrait", "aStr", openassetio::Str{"third value"});
+
+      batch.setValues(2, *data2);
+      batch.setValues(0, *data0);
+
+      THEN("values are available by column") {
+        CHECK(batch.boolColumn(0)[0] == 1);
+        CHECK(batch.intColumn(1)[0] == 3);
+        CHECK(batch.floatColumn(2)[0] == 1.5);
+        CHECK(batch.strValue(3, 0) == "first");
+        CHECK(batch.strValue(3, 2) == "third value");
+      }
+
+      THEN("validity reflects the properties set") {
+        for (std::size_t column = 0; column < 4; ++column) {
+          CHECK(batch.isValid(column, 0));
+          CHECK_FALSE(batch.isValid(column, 1));
+        }
+        CHECK_FALSE(batch.isValid(0, 2));
+        CHECK_FALSE(batch.isValid(1, 2));
+        CHECK_FALSE(batch.isValid(2, 2));
+        CHECK(batch.isValid(3, 2));
+      }
+
+      THEN("string values share a contiguous buffer") {
+        const auto& buffer = batch.strBuffer(3);
+        CHECK(buffer == "third valuefirst");
+        CHECK(buffer.substr(batch.strOffsets(3)[0], batch.strLengths(3)[0]) == "first");
+        CHECK(batch.strLengths(3)[1] == 0);
+      }
+    }
+
+    WHEN("a row holds a property of an unexpected type") {
+      const auto data = openassetio::trait::TraitsData::make();
+      data->setTraitProperty("aTrait", "anInt", openassetio::Str{"not an int"});
+      batch.setValues(1, *data);
+
+      THEN("the value is invalid") { CHECK_FALSE(batch.isValid(1, 1)); }
+    }
+
+    WHEN("a row is marked as an error") {
+      const BatchElementError expectedError{
+          BatchElementError::ErrorCode::kEntityResolutionError, "some error"};
+      batch.setError(1, expectedError);
+
+      THEN("the error is available for that row only") {
+        CHECK_FALSE(batch.isError(0));
+        CHECK(batch.isError(1));
+        CHECK(batch.error(1) == expectedError);
+        CHECK(batch.errors().size() == 1);
+        CHECK_THROWS_AS(batch.error(0), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a column is accessed as the wrong type") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(batch.intColumn(0), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.strValue(1, 0), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a column index is out of range") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(batch.boolColumn(4), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a row index is out of range") {
+      THEN("an exception is thrown") {
+        const auto data = openassetio::trait::TraitsData::make();
+        const BatchElementError error{BatchElementError::ErrorCode::kEntityResolutionError,
+                                      "some error"};
+        CHECK_THROWS_AS(batch.setValues(3, *data),
+                        openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.setError(3, error), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.isError(3), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.isValid(0, 3), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.isValid(4, 0), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.strValue(3, 3), openassetio::errors::InputValidationException);
+      }
+    }
+
+    WHEN("a row is set more than once") {
+      const auto data = openassetio::trait::TraitsData::make();
+      data->setTraitProperty("aTrait", "anInt", openassetio::Int{3});
+      data->setTraitProperty("anotherTrait", "aStr", openassetio::Str{"first"});
+      batch.setValues(0, *data);
+      const BatchElementError error{BatchElementError::ErrorCode::kEntityResolutionError,
+                                    "some error"};
+      batch.setError(1, error);
+
+      const auto otherData = openassetio::trait::TraitsData::make();
+      otherData->setTraitProperty("anotherTrait", "aStr", openassetio::Str{"second"});
+
+      THEN("an exception is thrown and the row is unchanged") {
+        CHECK_THROWS_MATCHES(
+            batch.setValues(0, *otherData), openassetio::errors::InputValidationException,
+            Catch::Message("Row index 0 of ResolvedBatch has already been set."));
+        CHECK_THROWS_AS(batch.setError(0, error), openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.setValues(1, *otherData),
+                        openassetio::errors::InputValidationException);
+        CHECK_THROWS_AS(batch.setError(1, error), openassetio::errors::InputValidationException);
+
+        CHECK(batch.isValid(1, 0));
+        CHECK(batch.strValue(3, 0) == "first");
+        CHECK(batch.strBuffer(3) == "first");
+        CHECK_FALSE(batch.isError(0));
+        CHECK_FALSE(batch.isValid(3, 1));
+      }
+    }
+  }
+}
@@ -0,0 +1,504 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+
+#include <openassetio/export.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/CachingManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+/**
+ * ManagerInterface that records the arguments of cacheable queries.
+ *
+ * Resolves each reference to a TraitsData holding the reference string
+ * and the number of times it has been registered, except references
+ * beginning "error", which result in an error. References beginning
+ * "new" do not exist until registered. Preflight returns the reference
+ * with a "#working" suffix.
+ */
+struct RecordingManagerInterface : managerApi::ManagerInterface {
+  [[nodiscard]] Identifier identifier() const override { return "org.openassetio.test.recording"; }
+  [[nodiscard]] Str displayName() const override { return "Recording"; }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return true;
+  }
+
+  void flushCaches([[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    ++flushCount;
+  }
+
+  trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, [[maybe_unused]] access::PolicyAccess policyAccess,
+      [[maybe_unused]] const ContextConstPtr& context,
+      [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) override {
+    policyQueries.push_back(traitSets);
+    trait::TraitsDatas policies;
+    for (const auto& traitSet : traitSets) {
+      policies.push_back(trait::TraitsData::make(traitSet));
+    }
+    return policies;
+  }
+
+  void entityExists(const EntityReferences& entityReferences,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    existsQueries.push_back(entityReferences);
+    forEachRef(entityReferences, errorCallback, [&](std::size_t idx, const Str& ref) {
+      successCallback(idx, ref.rfind("new", 0) != 0 || versions.count(ref) != 0);
+    });
+  }
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    [[maybe_unused]] access::EntityTraitsAccess entityTraitsAccess,
+                    [[maybe_unused]] const ContextConstPtr& context,
+                    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    traitsQueries.push_back(entityReferences);
+    forEachRef(entityReferences, errorCallback,
+               [&](std::size_t idx, const Str& ref) { successCallback(idx, {ref}); });
+  }
+
+  void resolve(const EntityReferences& entityReferences,
+               [[maybe_unused]] const trait::TraitSet& traitSet,
+               [[maybe_unused]] access::ResolveAccess resolveAccess,
+               [[maybe_unused]] const ContextConstPtr& context,
+               [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    resolveQueries.push_back(entityReferences);
+    forEachRef(entityReferences, errorCallback, [&](std::size_t idx, const Str& ref) {
+      auto traitsData = trait::TraitsData::make();
+      traitsData->setTraitProperty("aTrait", "ref", ref);
+      traitsData->setTraitProperty("aTrait", "version", versions[ref]);
+      successCallback(idx, std::move(traitsData));
+    });
+  }
+
+  void preflight(const EntityReferences& entityReferences,
+                 [[maybe_unused]] const trait::TraitsDatas& traitsHints,
+                 [[maybe_unused]] access::PublishingAccess publishingAccess,
+                 [[maybe_unused]] const ContextConstPtr& context,
+                 [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback, [&](std::size_t idx, const Str& ref) {
+      successCallback(idx, EntityReference{ref + "#working"});
+    });
+  }
+
+  void register_(const EntityReferences& entityReferences,
+                 [[maybe_unused]] const trait::TraitsDatas& entityTraitsDatas,
+                 [[maybe_unused]] access::PublishingAccess publishingAccess,
+                 [[maybe_unused]] const ContextConstPtr& context,
+                 [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    forEachRef(entityReferences, errorCallback, [&](std::size_t idx, const Str& ref) {
+      ++versions[ref];
+      successCallback(idx, EntityReference{ref});
+    });
+  }
+
+  template <class OnSuccess>
+  void forEachRef(const EntityReferences& entityReferences,
+                  const BatchElementErrorCallback& errorCallback,
+                  const OnSuccess& onSuccess) const {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref.rfind("error", 0) == 0) {
+        errorCallback(idx + callbackIndexOffset,
+                      errors::BatchElementError{
+                          errors::BatchElementError::ErrorCode::kEntityResolutionError, ref});
+      } else {
+        onSuccess(idx + callbackIndexOffset, ref);
+      }
+    }
+  }
+
+  std::vector<trait::TraitSets> policyQueries;
+  std::vector<EntityReferences> existsQueries;
+  std::vector<EntityReferences> traitsQueries;
+  std::vector<EntityReferences> resolveQueries;
+  std::size_t flushCount = 0;
+  /// Number of times each reference has been registered.
+  std::unordered_map<Str, Int> versions;
+  /// Added to indices passed to callbacks, to simulate a buggy manager.
+  std::size_t callbackIndexOffset = 0;
+};
+
+/**
+ * Fixture providing a CachingManagerInterface wrapping a
+ * RecordingManagerInterface.
+ */
+struct CachingManagerInterfaceFixture {
+  explicit CachingManagerInterfaceFixture(
+      const std::size_t capacity = managerApi::CachingManagerInterface::kDefaultCapacity,
+      const managerApi::CachingManagerInterface::Clock::duration timeToLive = {})
+      : cachingInterface{
+            managerApi::CachingManagerInterface::make(recordingInterface, capacity, timeToLive)} {}
+
+  Str resolveRef(const Str& ref) const {
+    Str result;
+    cachingInterface->resolve(
+        {EntityReference{ref}}, {"aTrait"}, access::ResolveAccess::kRead, context, nullptr,
+        [&](std::size_t, const trait::TraitsDataPtr& traitsData) {
+          trait::property::Value value;
+          traitsData->getTraitProperty(&value, "aTrait", "ref");
+          result = std::get<Str>(value);
+        },
+        [&](std::size_t, const errors::BatchElementError& error) { result = error.message; });
+    return result;
+  }
+
+  std::shared_ptr<RecordingManagerInterface> recordingInterface =
+      std::make_shared<RecordingManagerInterface>();
+  managerApi::CachingManagerInterfacePtr cachingInterface;
+  ContextPtr context = Context::make();
+};
+}  // namespace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+using openassetio::CachingManagerInterfaceFixture;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::access::ResolveAccess;
+using openassetio::errors::BatchElementError;
+using openassetio::managerApi::CachingManagerInterface;
+using openassetio::trait::TraitsDataPtr;
+
+SCENARIO("CachingManagerInterface construction") {
+  STATIC_REQUIRE_FALSE(std::is_constructible_v<CachingManagerInterface,
+                                               openassetio::managerApi::ManagerInterfacePtr>);
+
+  GIVEN("a null upstream interface") {
+    THEN("make throws") {
+      CHECK_THROWS_AS(CachingManagerInterface::make(nullptr),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("a zero capacity") {
+    THEN("make throws") {
+      CHECK_THROWS_AS(CachingManagerInterface::make(
+                          std::make_shared<openassetio::RecordingManagerInterface>(), 0),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("a caching interface") {
+    const CachingManagerInterfaceFixture fixture;
+
+    THEN("upstream interface is available and methods are forwarded") {
+      CHECK(fixture.cachingInterface->upstreamInterface() == fixture.recordingInterface);
+      CHECK(fixture.cachingInterface->identifier() == "org.openassetio.test.recording");
+      CHECK(fixture.cachingInterface->displayName() == "Recording");
+    }
+  }
+}
+
+SCENARIO("CachingManagerInterface resolve") {
+  GIVEN("a caching interface") {
+    const CachingManagerInterfaceFixture fixture;
+    const auto& cachingInterface = fixture.cachingInterface;
+    const auto& recordingInterface = fixture.recordingInterface;
+    const auto& context = fixture.context;
+
+    WHEN("a batch is resolved twice") {
+      const EntityReferences refs{EntityReference{"a"}, EntityReference{"error1"},
+                                  EntityReference{"b"}};
+
+      std::vector<TraitsDataPtr> firstResults(3);
+      std::vector<TraitsDataPtr> secondResults(3);
+      std::vector<BatchElementError> errors;
+      const auto resolveInto = [&](std::vector<TraitsDataPtr>& results) {
+        cachingInterface->resolve(
+            refs, {"aTrait"}, ResolveAccess::kRead, context, nullptr,
+            [&](std::size_t idx, TraitsDataPtr traitsData) {
+              results[idx] = std::move(traitsData);
+            },
+            [&](std::size_t, BatchElementError error) { errors.push_back(std::move(error)); });
+      };
+      resolveInto(firstResults);
+      resolveInto(secondResults);
+
+      THEN("only errored elements are queried upstream the second time") {
+        REQUIRE(recordingInterface->resolveQueries.size() == 2);
+        CHECK(recordingInterface->resolveQueries[0] == refs);
+        CHECK(recordingInterface->resolveQueries[1] == EntityReferences{EntityReference{"error1"}});
+        CHECK(errors.size() == 2);
+      }
+
+      THEN("cached results are equal to, but distinct from, upstream results") {
+        CHECK(*firstResults[0] == *secondResults[0]);
+        CHECK(*firstResults[2] == *secondResults[2]);
+        CHECK(firstResults[0] != secondResults[0]);
+      }
+
+      AND_WHEN("a returned result is modified") {
+        secondResults[0]->setTraitProperty("aTrait", "ref", Str{"modified"});
+
+        THEN("the cached result is unaffected") { CHECK(fixture.resolveRef("a") == "a"); }
+      }
+    }
+
+    WHEN("the same reference is resolved with a different trait set, access or locale") {
+      const EntityReferences refs{EntityReference{"a"}};
+      const auto noop = [](std::size_t, const auto&) {};
+
+      cachingInterface->resolve(refs, {"aTrait"}, ResolveAccess::kRead, context, nullptr, noop,
+                                noop);
+      cachingInterface->resolve(refs, {"aTrait", "anotherTrait"}, ResolveAccess::kRead, context,
+                                nullptr, noop, noop);
+      cachingInterface->resolve(refs, {"aTrait"}, ResolveAccess::kManagerDriven, context, nullptr,
+                                noop, noop);
+      const auto otherContext = openassetio::Context::make();
+      otherContext->locale->setTraitProperty("aLocaleTrait", "aKey", Str{"aValue"});
+      cachingInterface->resolve(refs, {"aTrait"}, ResolveAccess::kRead, otherContext, nullptr,
+                                noop, noop);
+
+      THEN("each is queried upstream") {
+        CHECK(recordingInterface->resolveQueries.size() == 4);
+      }
+
+      AND_WHEN("queries are repeated with equivalent arguments") {
+        const auto equivalentContext = openassetio::Context::make();
+        equivalentContext->locale->setTraitProperty("aLocaleTrait", "aKey", Str{"aValue"});
+        cachingInterface->resolve(refs, {"aTrait"}, ResolveAccess::kRead, equivalentContext,
+                                  nullptr, noop, noop);
+        cachingInterface->resolve(refs, {"anotherTrait", "aTrait"}, ResolveAccess::kRead,
+                                  context, nullptr, noop, noop);
+
+        THEN("results are served from the cache") {
+          CHECK(recordingInterface->resolveQueries.size() == 4);
+        }
+      }
+    }
+
+    WHEN("caches are flushed") {
+      CHECK(fixture.resolveRef("a") == "a");
+      cachingInterface->flushCaches(nullptr);
+      CHECK(fixture.resolveRef("a") == "a");
+
+      THEN("the flush is forwarded and results are queried upstream again") {
+        CHECK(recordingInterface->flushCount == 1);
+        CHECK(recordingInterface->resolveQueries.size() == 2);
+      }
+    }
+  }
+
+  GIVEN("a caching interface with a capacity of two") {
+    const CachingManagerInterfaceFixture fixture{2};
+
+    WHEN("three references are resolved, then the first again") {
+      fixture.resolveRef("a");
+      fixture.resolveRef("b");
+      fixture.resolveRef("a");
+      fixture.resolveRef("c");
+      fixture.resolveRef("a");
+      fixture.resolveRef("b");
+
+      THEN("the least recently used entry is evicted") {
+        // a, b, (a cached), c evicts b, (a cached), b re-queried.
+        CHECK(fixture.recordingInterface->resolveQueries.size() == 4);
+      }
+    }
+  }
+
+  GIVEN("a caching interface with a short time-to-live") {
+    const CachingManagerInterfaceFixture fixture{CachingManagerInterface::kDefaultCapacity,
+                                                 std::chrono::milliseconds{1}};
+
+    WHEN("a reference is resolved again after the time-to-live") {
+      fixture.resolveRef("a");
+      std::this_thread::sleep_for(std::chrono::milliseconds{5});
+      fixture.resolveRef("a");
+
+      THEN("the expired entry is queried upstream again") {
+        CHECK(fixture.recordingInterface->resolveQueries.size() == 2);
+      }
+    }
+  }
+}
+
+SCENARIO("CachingManagerInterface entityExists, entityTraits and managementPolicy") {
+  GIVEN("a caching interface") {
+    const CachingManagerInterfaceFixture fixture;
+    const auto& cachingInterface = fixture.cachingInterface;
+    const auto& recordingInterface = fixture.recordingInterface;
+    const auto& context = fixture.context;
+    const auto noop = [](std::size_t, const auto&) {};
+
+    WHEN("existence is queried for overlapping batches") {
+      std::vector<bool> results(2);
+      const auto exists = [&](const EntityReferences& refs) {
+        cachingInterface->entityExists(
+            refs, context, nullptr, [&](std::size_t idx, bool value) { results[idx] = value; },
+            noop);
+      };
+      exists({EntityReference{"a"}});
+      exists({EntityReference{"a"}, EntityReference{"b"}});
+
+      THEN("only uncached references are queried upstream") {
+        REQUIRE(recordingInterface->existsQueries.size() == 2);
+        CHECK(recordingInterface->existsQueries[1] == EntityReferences{EntityReference{"b"}});
+        CHECK(results[0]);
+        CHECK(results[1]);
+      }
+    }
+
+    WHEN("entity traits are queried twice") {
+      openassetio::trait::TraitSet result;
+      for (int repeat = 0; repeat < 2; ++repeat) {
+        cachingInterface->entityTraits(
+            {EntityReference{"a"}}, openassetio::access::EntityTraitsAccess::kRead, context,
+            nullptr,
+            [&](std::size_t, openassetio::trait::TraitSet traitSet) {
+              result = std::move(traitSet);
+            },
+            noop);
+      }
+
+      THEN("upstream is queried once") {
+        CHECK(recordingInterface->traitsQueries.size() == 1);
+        CHECK(result == openassetio::trait::TraitSet{"a"});
+      }
+    }
+
+    WHEN("management policy is queried for overlapping trait sets") {
+      [[maybe_unused]] const auto firstPolicies = cachingInterface->managementPolicy(
+          {{"a"}}, openassetio::access::PolicyAccess::kRead, context, nullptr);
+      const auto policies = cachingInterface->managementPolicy(
+          {{"b"}, {"a"}}, openassetio::access::PolicyAccess::kRead, context, nullptr);
+
+      THEN("only uncached trait sets are queried upstream, and results are in order") {
+        REQUIRE(recordingInterface->policyQueries.size() == 2);
+        CHECK(recordingInterface->policyQueries[1] == openassetio::trait::TraitSets{{"b"}});
+        REQUIRE(policies.size() == 2);
+        CHECK(policies[0]->hasTrait("b"));
+        CHECK(policies[1]->hasTrait("a"));
+      }
+    }
+  }
+}
+
+SCENARIO("CachingManagerInterface publishing") {
+  GIVEN("a caching interface with cached results for an unpublished entity") {
+    const CachingManagerInterfaceFixture fixture;
+    const auto& cachingInterface = fixture.cachingInterface;
+    const auto& recordingInterface = fixture.recordingInterface;
+    const auto& context = fixture.context;
+    const auto noop = [](std::size_t, const auto&) {};
+    const EntityReference ref{"new"};
+    const EntityReference workingRef{"new#working"};
+
+    const auto exists = [&](const EntityReference& entityReference) {
+      bool result = false;
+      cachingInterface->entityExists(
+          {entityReference}, context, nullptr,
+          [&](std::size_t, bool value) { result = value; }, noop);
+      return result;
+    };
+    const auto version = [&](const EntityReference& entityReference) {
+      openassetio::trait::property::Value value;
+      cachingInterface->resolve(
+          {entityReference}, {"aTrait"}, ResolveAccess::kRead, context, nullptr,
+          [&](std::size_t, const TraitsDataPtr& traitsData) {
+            traitsData->getTraitProperty(&value, "aTrait", "version");
+          },
+          noop);
+      return std::get<openassetio::Int>(value);
+    };
+
+    REQUIRE_FALSE(exists(ref));
+    REQUIRE(version(ref) == 0);
+    REQUIRE(version(workingRef) == 0);
+    REQUIRE(recordingInterface->resolveQueries.size() == 2);
+
+    WHEN("the entity is preflighted") {
+      EntityReferences preflightRefs;
+      cachingInterface->preflight(
+          {ref}, {openassetio::trait::TraitsData::make()},
+          openassetio::access::PublishingAccess::kWrite, context, nullptr,
+          [&](std::size_t, EntityReference entityReference) {
+            preflightRefs.push_back(std::move(entityReference));
+          },
+          noop);
+
+      THEN("results for the given and returned references are queried upstream again") {
+        CHECK(preflightRefs == EntityReferences{workingRef});
+        CHECK(version(workingRef) == 0);
+        CHECK(version(ref) == 0);
+        CHECK(recordingInterface->resolveQueries.size() == 4);
+      }
+    }
+
+    WHEN("the entity is registered") {
+      cachingInterface->register_({ref}, {openassetio::trait::TraitsData::make()},
+                                  openassetio::access::PublishingAccess::kWrite, context,
+                                  nullptr, noop, noop);
+
+      THEN("subsequent queries reflect the published entity") {
+        CHECK(exists(ref));
+        CHECK(version(ref) == 1);
+        CHECK(recordingInterface->existsQueries.size() == 2);
+        CHECK(recordingInterface->resolveQueries.size() == 3);
+      }
+
+      AND_THEN("results for other references remain cached") {
+        CHECK(version(workingRef) == 0);
+        CHECK(recordingInterface->resolveQueries.size() == 2);
+      }
+    }
+  }
+}
+
+SCENARIO("CachingManagerInterface with a manager providing invalid callback indices") {
+  GIVEN("a caching interface wrapping a manager that provides out of range indices") {
+    const CachingManagerInterfaceFixture fixture;
+    const auto& cachingInterface = fixture.cachingInterface;
+    const auto& context = fixture.context;
+    const auto noop = [](std::size_t, const auto&) {};
+    fixture.recordingInterface->callbackIndexOffset = 1;
+
+    THEN("queries throw rather than accessing out of bounds") {
+      const EntityReferences refs{EntityReference{"a"}, EntityReference{"error"}};
+      CHECK_THROWS_MATCHES(
+          cachingInterface->resolve(refs, {"aTrait"}, ResolveAccess::kRead, context, nullptr,
+                                    noop, noop),
+          openassetio::errors::InputValidationException,
+          Catch::Message("Upstream manager provided index 2 out of range for batch of size 2."));
+      CHECK_THROWS_AS(
+          cachingInterface->entityExists({EntityReference{"error"}}, context, nullptr, noop, noop),
+          openassetio::errors::InputValidationException);
+      CHECK_THROWS_AS(
+          cachingInterface->entityTraits({EntityReference{"a"}},
+                                         openassetio::access::EntityTraitsAccess::kRead, context,
+                                         nullptr, noop, noop),
+          openassetio::errors::InputValidationException);
+      CHECK_THROWS_AS(cachingInterface->register_({EntityReference{"a"}},
+                                                  {openassetio::trait::TraitsData::make()},
+                                                  openassetio::access::PublishingAccess::kWrite,
+                                                  context, nullptr, noop, noop),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <utils/PrefixMatcher.hpp>
+
+using openassetio::Str;
+using openassetio::utils::PrefixMatcher;
+
+TEST_CASE("Strings are matched against any of the prefixes") {
+  const PrefixMatcher matcher{{"asset://", "bal:///", "file:///proj/"}};
+
+  CHECK(matcher.matches("asset://my_asset"));
+  CHECK(matcher.matches("bal:///a/b"));
+  CHECK(matcher.matches("file:///proj/shot"));
+  CHECK(matcher.matches("asset://"));
+  CHECK_FALSE(matcher.matches("asset:/my_asset"));
+  CHECK_FALSE(matcher.matches("file:///other/shot"));
+  CHECK_FALSE(matcher.matches("/home/user/my_asset"));
+  CHECK_FALSE(matcher.matches("ass"));
+  CHECK_FALSE(matcher.matches(""));
+  CHECK_FALSE(matcher.matches("zzz"));
+}
+
+TEST_CASE("Prefixes extending another prefix are redundant") {
+  const PrefixMatcher matcher{{"ab", "abc", "a", "abd", "b", "ba"}};
+
+  CHECK(matcher.prefixes() == std::vector<Str>{"a", "b"});
+  CHECK(matcher.matches("abz"));
+  CHECK(matcher.matches("bz"));
+  CHECK_FALSE(matcher.matches("cab"));
+}
+
+TEST_CASE("Prefixes sharing a first byte are disambiguated") {
+  const PrefixMatcher matcher{{"ab", "ac", "ae"}};
+
+  CHECK(matcher.matches("ab1"));
+  CHECK(matcher.matches("ac1"));
+  CHECK(matcher.matches("ae1"));
+  CHECK_FALSE(matcher.matches("aa1"));
+  CHECK_FALSE(matcher.matches("ad1"));
+  CHECK_FALSE(matcher.matches("af1"));
+  CHECK_FALSE(matcher.matches("a"));
+}
+
+TEST_CASE("Prefixes are matched bytewise, including multi-byte characters") {
+  const PrefixMatcher matcher{{"my📹manager⚡", "\xff"}};
+
+  CHECK(matcher.matches("my📹manager⚡my_asset⚡"));
+  CHECK_FALSE(matcher.matches("my📹manager☁️my_asset⚡"));
+  CHECK(matcher.matches("\xff\x01"));
+}
+
+TEST_CASE("An empty prefix matches everything") {
+  const PrefixMatcher matcher{{"asset://", ""}};
+
+  CHECK(matcher.prefixes() == std::vector<Str>{""});
+  CHECK(matcher.matches(""));
+  CHECK(matcher.matches("anything"));
+}
+
+TEST_CASE("No prefixes matches nothing") {
+  const PrefixMatcher matcher{{}};
+
+  CHECK(matcher.prefixes().empty());
+  CHECK_FALSE(matcher.matches(""));
+  CHECK_FALSE(matcher.matches("anything"));
+}
@@ -1,5 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
+#include <string_view>
+#include <thread>
+#include <vector>
+
 #include <fmt/format.h>
 #include <catch2/catch.hpp>
 
@@ -25,6 +29,75 @@ TEST_CASE("Happy path") {
   CHECK(regex.substituteToReduceSize(text, "f") == "fde");
 }
 
+TEST_CASE("Matching without retaining match groups") {
+  Regex regex{"^a(.)c"};
+
+  CHECK(regex.matches("abcde"));
+  CHECK_FALSE(regex.matches("xabcde"));
+  CHECK(regex.matchMany({"abc", "xyz", "", "aXc"}) == std::vector<bool>{true, false, false, true});
+  CHECK(regex.matchMany({}).empty());
+}
+
+TEST_CASE("Matching with a re-used match") {
+  Regex regex{"a(.)c"};
+  Regex::Match match{regex};
+  openassetio::Str text1{"abcde"};
+  openassetio::Str text2{"xaXc"};
+
+  REQUIRE(regex.match(text1, match));
+  CHECK(match.group(text1, 1) == "b");
+  REQUIRE(regex.match(text2, match));
+  CHECK(match.group(text2, 1) == "X");
+  CHECK_FALSE(regex.match("xyz", match));
+}
+
+TEST_CASE("Matching with regexes with differing capture group counts on the same thread") {
+  // Per-thread match data is shared between instances, so must grow
+  // to accommodate the largest.
+  Regex fewGroups{"a"};
+  Regex manyGroups{"(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)(k)(l)(m)(n)(o)(p)(q)"};
+
+  CHECK(fewGroups.matches("a"));
+  CHECK(manyGroups.matches("abcdefghijklmnopq"));
+  CHECK(manyGroups.substituteToReduceSize("xabcdefghijklmnopqx", "$17") == "xqx");
+  CHECK(fewGroups.matches("a"));
+}
+
+TEST_CASE("Matching concurrently from multiple threads") {
+  constexpr std::size_t kNumThreads = 8;
+  constexpr std::size_t kNumIterations = 1000;
+  const Regex regex{"^a(.)c$"};
+  std::vector<bool> results(kNumThreads);
+  std::vector<std::thread> threads;
+
+  for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+    threads.emplace_back([&regex, &results, threadIdx] {
+      bool allExpected = true;
+      for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+        allExpected &= regex.matches("abc") && !regex.matches("abcd") &&
+                       regex.substituteToReduceSize("abc", "z") == "z";
+      }
+      results[threadIdx] = allExpected;
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(results == std::vector<bool>(kNumThreads, true));
+}
+
+TEST_CASE("Substituting into a re-used string") {
+  Regex regex{"//+"};
+  openassetio::Str result{"previous contents that are long"};
+
+  regex.substituteToReduceSize("a//b///c", "/", result);
+  CHECK(result == "a/b/c");
+
+  regex.substituteToReduceSize("", "/", result);
+  CHECK(result.empty());
+}
+
 TEST_CASE("Invalid pattern exception") {
   CHECK_THROWS_MATCHES(
       Regex{"("}, InputValidationException,
@@ -55,6 +128,12 @@ TEST_CASE("Invalid match exception") {
   CHECK_THROWS_MATCHES(
       regex.match("abab"), InputValidationException,
       ExceptionMessageMatcher{"Error -47 matching regex to 'abab': match limit exceeded"});
+  CHECK_THROWS_MATCHES(
+      regex.matches("abab"), InputValidationException,
+      ExceptionMessageMatcher{"Error -47 matching regex to 'abab': match limit exceeded"});
+  CHECK_THROWS_MATCHES(
+      regex.matchMany({"b", "abab"}), InputValidationException,
+      ExceptionMessageMatcher{"Error -47 matching regex to 'abab': match limit exceeded"});
 }
 
 TEST_CASE("Invalid substitution exception") {
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include <utils/ThreadPool.hpp>
+
+using openassetio::utils::ThreadPool;
+
+TEST_CASE("Pool is constructed with at least one worker") {
+  CHECK(ThreadPool{0}.size() == 1);
+  CHECK(ThreadPool{3}.size() == 3);
+  CHECK(ThreadPool::shared().size() >= 1);
+}
+
+TEST_CASE("All submitted tasks are run before the pool is destroyed") {
+  constexpr std::size_t kNumTasks = 1000;
+  std::atomic<std::size_t> numRun{0};
+  std::mutex mutex;
+  std::set<std::thread::id> threadIds;
+
+  {
+    ThreadPool pool{4};
+    for (std::size_t idx = 0; idx < kNumTasks; ++idx) {
+      pool.submit([&] {
+        ++numRun;
+        const std::lock_guard lock{mutex};
+        threadIds.insert(std::this_thread::get_id());
+      });
+    }
+  }
+
+  CHECK(numRun == kNumTasks);
+  CHECK(threadIds.count(std::this_thread::get_id()) == 0);
+  CHECK(threadIds.size() <= 4);
+}
+
+TEST_CASE("A blocked worker does not prevent other tasks from running") {
+  ThreadPool pool{2};
+  std::atomic<bool> release{false};
+  std::atomic<std::size_t> numRun{0};
+
+  // Occupy one worker until all other tasks have run.
+  pool.submit([&] {
+    while (!release) {
+      std::this_thread::yield();
+    }
+  });
+  constexpr std::size_t kNumTasks = 10;
+  for (std::size_t idx = 0; idx < kNumTasks; ++idx) {
+    pool.submit([&] { ++numRun; });
+  }
+
+  while (numRun < kNumTasks) {
+    std::this_thread::yield();
+  }
+  release = true;
+
+  CHECK(numRun == kNumTasks);
+}
+
+TEST_CASE("Shutting down a pool runs queued tasks then rejects further tasks") {
+  constexpr std::size_t kNumTasks = 100;
+  std::atomic<std::size_t> numRun{0};
+
+  ThreadPool pool{2};
+  for (std::size_t idx = 0; idx < kNumTasks; ++idx) {
+    CHECK(pool.submit([&] { ++numRun; }));
+  }
+  pool.shutdown();
+
+  CHECK(numRun == kNumTasks);
+  CHECK_FALSE(pool.submit([&] { ++numRun; }));
+  // Subsequent shutdowns have no effect.
+  pool.shutdown();
+  CHECK(numRun == kNumTasks);
+}
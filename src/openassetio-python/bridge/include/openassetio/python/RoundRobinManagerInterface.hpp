@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/python/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi {
+OPENASSETIO_DECLARE_PTR(RoundRobinManagerInterface)
+
+/**
+ * A ManagerInterface facade that distributes calls across several
+ * independent instances of the same manager.
+ *
+ * Each query is forwarded in its entirety to the next instance in
+ * turn. Concurrent calls from multiple host threads therefore land on
+ * different instances, so do not contend on per-instance state, such
+ * as locks or connections held by the manager. For Python managers,
+ * this allows any work done with the GIL released (e.g. I/O) to
+ * overlap.
+ *
+ * Instances must be interchangeable, other than in their @ref
+ * managerApi.ManagerStateBase "ManagerStateBase" objects. States
+ * created via this facade are pinned to the instance that created
+ * them, such that all calls using a @ref Context holding such a state
+ * are forwarded to that instance. Hence stateful workflows (e.g.
+ * publishing via @ref preflight then @ref register_) see a consistent
+ * instance, whilst stateless queries are distributed.
+ *
+ * @ref initialize and @ref flushCaches are forwarded to all instances.
+ * Introspection methods (@ref identifier, @ref displayName, @ref
+ * hasCapability, @ref info, @ref settings and @ref updateTerminology)
+ * are forwarded to the first instance.
+ *
+ * This class is safe to call from multiple threads concurrently,
+ * assuming the wrapped instances are.
+ *
+ * @see PooledManagerImplementationFactory
+ */
+class OPENASSETIO_PYTHON_BRIDGE_EXPORT RoundRobinManagerInterface final
+    : public managerApi::ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RoundRobinManagerInterface)
+
+  /// List of manager instances.
+  using ManagerInterfaces = std::vector<managerApi::ManagerInterfacePtr>;
+
+  /**
+   * Construct a facade distributing calls across the given instances.
+   *
+   * @param instances Manager instances to distribute calls across.
+   *
+   * @throws errors.InputValidationException If `instances` is empty,
+   * contains null pointers, or contains instances with differing
+   * identifiers.
+   */
+  [[nodiscard]] static RoundRobinManagerInterfacePtr make(ManagerInterfaces instances);
+
+  /// Returns the instances wrapped by this facade.
+  [[nodiscard]] const ManagerInterfaces& instances() const;
+
+  /**
+   * @name Forwarded to the first instance
+   *
+   * @{
+   */
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] StrMap updateTerminology(StrMap terms,
+                                         const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+  /**
+   * @}
+   */
+
+  /**
+   * @name Forwarded to all instances
+   *
+   * @{
+   */
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  /**
+   * @}
+   */
+
+  /**
+   * @name Forwarded to each instance in turn
+   *
+   * Unless the context (or parent state) holds a state created by a
+   * specific instance, in which case that instance is used.
+   *
+   * @{
+   */
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      const managerApi::ManagerStateBasePtr& parentState,
+      const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] Str persistenceTokenForState(
+      const managerApi::ManagerStateBasePtr& state,
+      const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<std::string_view>& someStrings,
+      const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, size_t pageSize,
+                           access::RelationsAccess relationsAccess,
+                           const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, size_t pageSize,
+                            access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override;
+  void getWithRelationshipsMatrix(const EntityReferences& entityReferences,
+                                  const trait::TraitsDatas& relationshipTraitsDatas,
+                                  const trait::TraitSet& resultTraitSet, size_t pageSize,
+                                  access::RelationsAccess relationsAccess,
+                                  const ContextConstPtr& context,
+                                  const managerApi::HostSessionPtr& hostSession,
+                                  const RelationshipQuerySuccessCallback& successCallback,
+                                  const BatchElementErrorCallback& errorCallback) override;
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+  /**
+   * @}
+   */
+
+ private:
+  explicit RoundRobinManagerInterface(ManagerInterfaces instances);
+
+  /// Index of the instance to forward the next unpinned call to.
+  std::size_t nextIndex();
+
+  /// Instance to forward the next unpinned call to.
+  managerApi::ManagerInterface& next();
+
+  /// Instance and arguments to forward a call to.
+  template <class StatePtr>
+  struct Route {
+    managerApi::ManagerInterface& instance;
+    StatePtr argument;
+  };
+
+  /**
+   * Route a call using the given context.
+   *
+   * If the context holds a state created via this facade, the call is
+   * routed to the instance that created it, with a copy of the context
+   * holding that instance's own state. Otherwise, the call is routed to
+   * the next instance, with the context unchanged.
+   */
+  Route<ContextConstPtr> route(const ContextConstPtr& context);
+
+  /// Route a call using the given state, as for @ref route(const ContextConstPtr&).
+  Route<managerApi::ManagerStateBasePtr> route(const managerApi::ManagerStateBasePtr& state);
+
+  /// Wrap a state created by the given instance, pinning it to that instance.
+  static managerApi::ManagerStateBasePtr pin(managerApi::ManagerStateBasePtr state,
+                                             std::size_t instanceIdx);
+
+  ManagerInterfaces instances_;
+  std::atomic<std::size_t> next_{0};
+};
+}  // namespace python::hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,12 +1,19 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2024 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
 #include <openassetio/export.h>
+#include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/python/export.h>
 #include <openassetio/typedefs.hpp>
 
-OPENASSETIO_FWD_DECLARE(hostApi, ManagerImplementationFactoryInterface)
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
+OPENASSETIO_FWD_DECLARE(managerApi, ManagerInterface)
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -23,6 +30,118 @@ namespace hostApi {
  */
 OPENASSETIO_PYTHON_BRIDGE_EXPORT openassetio::hostApi::ManagerImplementationFactoryInterfacePtr
 createPythonPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger);
+
+OPENASSETIO_DECLARE_PTR(PooledManagerImplementationFactory)
+
+/**
+ * Manager factory decorator that pre-instantiates a pool of
+ * @fqref{managerApi.ManagerInterface} "ManagerInterface" instances
+ * per identifier, and hands them out from @ref instantiate.
+ *
+ * For Python plugins, instantiation must hold the GIL, so hosts that
+ * create a manager per worker thread would otherwise serialise on it.
+ * By paying the instantiation cost up front, checking out a pooled
+ * instance is lock-free and never touches the GIL.
+ *
+ * Once the pool for an identifier is exhausted, instantiation falls
+ * back to the wrapped factory.
+ *
+ * The pools are created on construction and are not replenished, so
+ * @ref instantiate is safe to call concurrently from multiple threads,
+ * provided the wrapped factory is too.
+ */
+class OPENASSETIO_PYTHON_BRIDGE_EXPORT PooledManagerImplementationFactory final
+    : public openassetio::hostApi::ManagerImplementationFactoryInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(PooledManagerImplementationFactory)
+
+  /// Number of instances to pre-instantiate, keyed by identifier.
+  using PoolSizes = std::unordered_map<Identifier, std::size_t>;
+
+  /**
+   * Construct a pooled factory, pre-instantiating the requested
+   * number of instances for each identifier.
+   *
+   * @param factory Factory to instantiate managers.
+   *
+   * @param poolSizes Number of instances to pre-instantiate, keyed by
+   * identifier.
+   *
+   * @param logger Logger to use for all logging.
+   *
+   * @throws Any exception thrown by the wrapped factory whilst
+   * pre-instantiating.
+   */
+  static PooledManagerImplementationFactoryPtr make(
+      openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory,
+      const PoolSizes& poolSizes, log::LoggerInterfacePtr logger);
+
+  ~PooledManagerImplementationFactory() override;
+
+  /**
+   * Identifiers known to the wrapped factory.
+   */
+  [[nodiscard]] Identifiers identifiers() override;
+
+  /**
+   * Check out a pre-instantiated manager with the given identifier, if
+   * any remain, otherwise instantiate a new one using the wrapped
+   * factory.
+   *
+   * @param identifier The identifier of the ManagerInterface to
+   * instantiate.
+   *
+   * @return Pre-instantiated or newly created `ManagerInterface`.
+   */
+  [[nodiscard]] managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
+
+  /**
+   * Manager details known to the wrapped factory.
+   */
+  [[nodiscard]] std::optional<openassetio::hostApi::ManagerFactory::ManagerDetail> managerDetail(
+      const Identifier& identifier) override;
+
+  /**
+   * Number of pre-instantiated managers remaining for an identifier.
+   *
+   * @param identifier Identifier of the manager.
+   *
+   * @return Number of managers remaining in the pool.
+   */
+  [[nodiscard]] std::size_t available(const Identifier& identifier) const;
+
+ private:
+  struct Pool;
+
+  PooledManagerImplementationFactory(
+      openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory,
+      log::LoggerInterfacePtr logger);
+
+  openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory_;
+  /// Populated on construction and not modified afterwards.
+  std::unordered_map<Identifier, std::unique_ptr<Pool>> pools_;
+};
+
+/**
+ * Retrieve a pooled instance of the Python plugin system
+ * implementation.
+ *
+ * The GIL is acquired once whilst pre-instantiating all pooled
+ * managers.
+ *
+ * @param logger Logger to use for all logging.
+ *
+ * @param poolSizes Number of instances to pre-instantiate, keyed by
+ * identifier.
+ *
+ * @return Pooled Python plugin system.
+ *
+ * @see PooledManagerImplementationFactory
+ */
+OPENASSETIO_PYTHON_BRIDGE_EXPORT PooledManagerImplementationFactoryPtr
+createPooledPythonPluginSystemManagerImplementationFactory(
+    log::LoggerInterfacePtr logger,
+    const PooledManagerImplementationFactory::PoolSizes& poolSizes);
 }  // namespace hostApi
 }  // namespace python
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/python/RoundRobinManagerInterface.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi {
+
+using managerApi::HostSessionPtr;
+using managerApi::ManagerStateBasePtr;
+
+namespace {
+/**
+ * State created by a particular instance, wrapped such that calls
+ * using it can be forwarded to that same instance.
+ */
+struct PinnedState final : managerApi::ManagerStateBase {
+  PinnedState(ManagerStateBasePtr state_, const std::size_t instanceIdx_)
+      : state{std::move(state_)}, instanceIdx{instanceIdx_} {}
+
+  const ManagerStateBasePtr state;
+  const std::size_t instanceIdx;
+};
+}  // namespace
+
+RoundRobinManagerInterfacePtr RoundRobinManagerInterface::make(ManagerInterfaces instances) {
+  if (instances.empty()) {
+    throw errors::InputValidationException{"At least one manager instance must be provided."};
+  }
+  if (std::any_of(instances.begin(), instances.end(), [](const auto& instance) {
+        return instance == nullptr;
+      })) {
+    throw errors::InputValidationException{"Manager instances cannot be null."};
+  }
+  const Identifier identifier = instances.front()->identifier();
+  if (std::any_of(instances.begin() + 1, instances.end(), [&identifier](const auto& instance) {
+        return instance->identifier() != identifier;
+      })) {
+    throw errors::InputValidationException{
+        "Manager instances must all have the same identifier."};
+  }
+  return RoundRobinManagerInterfacePtr{new RoundRobinManagerInterface{std::move(instances)}};
+}
+
+RoundRobinManagerInterface::RoundRobinManagerInterface(ManagerInterfaces instances)
+    : instances_{std::move(instances)} {}
+
+const RoundRobinManagerInterface::ManagerInterfaces& RoundRobinManagerInterface::instances()
+    const {
+  return instances_;
+}
+
+std::size_t RoundRobinManagerInterface::nextIndex() {
+  return next_.fetch_add(1, std::memory_order_relaxed) % instances_.size();
+}
+
+managerApi::ManagerInterface& RoundRobinManagerInterface::next() {
+  return *instances_[nextIndex()];
+}
+
+RoundRobinManagerInterface::Route<ContextConstPtr> RoundRobinManagerInterface::route(
+    const ContextConstPtr& context) {
+  if (context) {
+    if (const auto* pinned = dynamic_cast<const PinnedState*>(context->managerState.get())) {
+      return {*instances_[pinned->instanceIdx], Context::make(context->locale, pinned->state)};
+    }
+  }
+  return {next(), context};
+}
+
+RoundRobinManagerInterface::Route<ManagerStateBasePtr> RoundRobinManagerInterface::route(
+    const ManagerStateBasePtr& state) {
+  if (const auto* pinned = dynamic_cast<const PinnedState*>(state.get())) {
+    return {*instances_[pinned->instanceIdx], pinned->state};
+  }
+  return {next(), state};
+}
+
+ManagerStateBasePtr RoundRobinManagerInterface::pin(ManagerStateBasePtr state,
+                                                    const std::size_t instanceIdx) {
+  if (!state) {
+    return state;
+  }
+  return std::make_shared<PinnedState>(std::move(state), instanceIdx);
+}
+
+Identifier RoundRobinManagerInterface::identifier() const {
+  return instances_.front()->identifier();
+}
+
+Str RoundRobinManagerInterface::displayName() const { return instances_.front()->displayName(); }
+
+bool RoundRobinManagerInterface::hasCapability(const Capability capability) {
+  return instances_.front()->hasCapability(capability);
+}
+
+InfoDictionary RoundRobinManagerInterface::info() { return instances_.front()->info(); }
+
+StrMap RoundRobinManagerInterface::updateTerminology(StrMap terms,
+                                                     const HostSessionPtr& hostSession) {
+  return instances_.front()->updateTerminology(std::move(terms), hostSession);
+}
+
+InfoDictionary RoundRobinManagerInterface::settings(const HostSessionPtr& hostSession) {
+  return instances_.front()->settings(hostSession);
+}
+
+void RoundRobinManagerInterface::initialize(InfoDictionary managerSettings,
+                                            const HostSessionPtr& hostSession) {
+  for (const auto& instance : instances_) {
+    instance->initialize(managerSettings, hostSession);
+  }
+}
+
+void RoundRobinManagerInterface::flushCaches(const HostSessionPtr& hostSession) {
+  for (const auto& instance : instances_) {
+    instance->flushCaches(hostSession);
+  }
+}
+
+trait::TraitsDatas RoundRobinManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession) {
+  auto [instance, instanceContext] = route(context);
+  return instance.managementPolicy(traitSets, policyAccess, instanceContext, hostSession);
+}
+
+ManagerStateBasePtr RoundRobinManagerInterface::createState(const HostSessionPtr& hostSession) {
+  const std::size_t instanceIdx = nextIndex();
+  return pin(instances_[instanceIdx]->createState(hostSession), instanceIdx);
+}
+
+ManagerStateBasePtr RoundRobinManagerInterface::createChildState(
+    const ManagerStateBasePtr& parentState, const HostSessionPtr& hostSession) {
+  // Children must live on the same instance as their parent.
+  const auto* pinned = dynamic_cast<const PinnedState*>(parentState.get());
+  const std::size_t instanceIdx = pinned ? pinned->instanceIdx : nextIndex();
+  return pin(instances_[instanceIdx]->createChildState(pinned ? pinned->state : parentState,
+                                                       hostSession),
+             instanceIdx);
+}
+
+Str RoundRobinManagerInterface::persistenceTokenForState(const ManagerStateBasePtr& state,
+                                                         const HostSessionPtr& hostSession) {
+  auto [instance, instanceState] = route(state);
+  return instance.persistenceTokenForState(instanceState, hostSession);
+}
+
+ManagerStateBasePtr RoundRobinManagerInterface::stateFromPersistenceToken(
+    const Str& token, const HostSessionPtr& hostSession) {
+  const std::size_t instanceIdx = nextIndex();
+  return pin(instances_[instanceIdx]->stateFromPersistenceToken(token, hostSession), instanceIdx);
+}
+
+bool RoundRobinManagerInterface::isEntityReferenceString(const Str& someString,
+                                                         const HostSessionPtr& hostSession) {
+  return next().isEntityReferenceString(someString, hostSession);
+}
+
+std::vector<bool> RoundRobinManagerInterface::areEntityReferenceStrings(
+    const std::vector<std::string_view>& someStrings, const HostSessionPtr& hostSession) {
+  return next().areEntityReferenceStrings(someStrings, hostSession);
+}
+
+void RoundRobinManagerInterface::entityExists(const EntityReferences& entityReferences,
+                                              const ContextConstPtr& context,
+                                              const HostSessionPtr& hostSession,
+                                              const ExistsSuccessCallback& successCallback,
+                                              const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.entityExists(entityReferences, instanceContext, hostSession, successCallback,
+                        errorCallback);
+}
+
+void RoundRobinManagerInterface::entityTraits(const EntityReferences& entityReferences,
+                                              const access::EntityTraitsAccess entityTraitsAccess,
+                                              const ContextConstPtr& context,
+                                              const HostSessionPtr& hostSession,
+                                              const EntityTraitsSuccessCallback& successCallback,
+                                              const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.entityTraits(entityReferences, entityTraitsAccess, instanceContext, hostSession,
+                        successCallback, errorCallback);
+}
+
+void RoundRobinManagerInterface::resolve(const EntityReferences& entityReferences,
+                                         const trait::TraitSet& traitSet,
+                                         const access::ResolveAccess resolveAccess,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         const ResolveSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.resolve(entityReferences, traitSet, resolveAccess, instanceContext, hostSession,
+                   successCallback, errorCallback);
+}
+
+void RoundRobinManagerInterface::defaultEntityReference(
+    const trait::TraitSets& traitSets, const access::DefaultEntityAccess defaultEntityAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession,
+    const DefaultEntityReferenceSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.defaultEntityReference(traitSets, defaultEntityAccess, instanceContext, hostSession,
+                                  successCallback, errorCallback);
+}
+
+void RoundRobinManagerInterface::getWithRelationship(
+    const EntityReferences& entityReferences, const trait::TraitsDataPtr& relationshipTraitsData,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.getWithRelationship(entityReferences, relationshipTraitsData, resultTraitSet, pageSize,
+                               relationsAccess, instanceContext, hostSession, successCallback,
+                               errorCallback);
+}
+
+void RoundRobinManagerInterface::getWithRelationships(
+    const EntityReference& entityReference, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.getWithRelationships(entityReference, relationshipTraitsDatas, resultTraitSet, pageSize,
+                                relationsAccess, instanceContext, hostSession, successCallback,
+                                errorCallback);
+}
+
+void RoundRobinManagerInterface::getWithRelationshipsMatrix(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+    const trait::TraitSet& resultTraitSet, const size_t pageSize,
+    const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+    const HostSessionPtr& hostSession, const RelationshipQuerySuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas, resultTraitSet,
+                                      pageSize, relationsAccess, instanceContext, hostSession,
+                                      successCallback, errorCallback);
+}
+
+void RoundRobinManagerInterface::preflight(const EntityReferences& entityReferences,
+                                           const trait::TraitsDatas& traitsHints,
+                                           const access::PublishingAccess publishingAccess,
+                                           const ContextConstPtr& context,
+                                           const HostSessionPtr& hostSession,
+                                           const PreflightSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.preflight(entityReferences, traitsHints, publishingAccess, instanceContext, hostSession,
+                     successCallback, errorCallback);
+}
+
+void RoundRobinManagerInterface::register_(const EntityReferences& entityReferences,
+                                           const trait::TraitsDatas& entityTraitsDatas,
+                                           const access::PublishingAccess publishingAccess,
+                                           const ContextConstPtr& context,
+                                           const HostSessionPtr& hostSession,
+                                           const RegisterSuccessCallback& successCallback,
+                                           const BatchElementErrorCallback& errorCallback) {
+  auto [instance, instanceContext] = route(context);
+  instance.register_(entityReferences, entityTraitsDatas, publishingAccess, instanceContext,
+                     hostSession, successCallback, errorCallback);
+}
+}  // namespace python::hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,13 +1,19 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2024 The Foundry Visionmongers Ltd
 #include <openassetio/python/hostApi.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <pybind11/embed.h>
 
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
 // Private headers
 #include <openassetio/private/python/pointers.hpp>
 
@@ -42,6 +48,80 @@ ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplemen
   return pointers::createPyRetainingPtr<ManagerImplementationFactoryInterfacePtr>(pyInstance,
                                                                                   cppInstancePtr);
 }
+
+/**
+ * Pre-instantiated managers for a single identifier.
+ *
+ * Each call to `instantiate` claims a unique slot by atomically
+ * incrementing `next`, so no two threads ever access the same
+ * instance.
+ */
+struct PooledManagerImplementationFactory::Pool {
+  std::vector<managerApi::ManagerInterfacePtr> instances;
+  std::atomic<std::size_t> next{0};
+};
+
+PooledManagerImplementationFactoryPtr PooledManagerImplementationFactory::make(
+    ManagerImplementationFactoryInterfacePtr factory, const PoolSizes& poolSizes,
+    log::LoggerInterfacePtr logger) {
+  PooledManagerImplementationFactoryPtr pooled{
+      new PooledManagerImplementationFactory{std::move(factory), std::move(logger)}};
+
+  for (const auto& [identifier, poolSize] : poolSizes) {
+    auto pool = std::make_unique<Pool>();
+    pool->instances.reserve(poolSize);
+    for (std::size_t idx = 0; idx < poolSize; ++idx) {
+      pool->instances.push_back(pooled->factory_->instantiate(identifier));
+    }
+    pooled->pools_.emplace(identifier, std::move(pool));
+  }
+  return pooled;
+}
+
+PooledManagerImplementationFactory::PooledManagerImplementationFactory(
+    ManagerImplementationFactoryInterfacePtr factory, log::LoggerInterfacePtr logger)
+    : ManagerImplementationFactoryInterface{std::move(logger)}, factory_{std::move(factory)} {}
+
+PooledManagerImplementationFactory::~PooledManagerImplementationFactory() = default;
+
+Identifiers PooledManagerImplementationFactory::identifiers() { return factory_->identifiers(); }
+
+managerApi::ManagerInterfacePtr PooledManagerImplementationFactory::instantiate(
+    const Identifier& identifier) {
+  if (const auto iter = pools_.find(identifier); iter != pools_.end()) {
+    Pool& pool = *iter->second;
+    if (const std::size_t slot = pool.next.fetch_add(1, std::memory_order_relaxed);
+        slot < pool.instances.size()) {
+      return std::move(pool.instances[slot]);
+    }
+  }
+  return factory_->instantiate(identifier);
+}
+
+std::optional<openassetio::hostApi::ManagerFactory::ManagerDetail>
+PooledManagerImplementationFactory::managerDetail(const Identifier& identifier) {
+  return factory_->managerDetail(identifier);
+}
+
+std::size_t PooledManagerImplementationFactory::available(const Identifier& identifier) const {
+  const auto iter = pools_.find(identifier);
+  if (iter == pools_.end()) {
+    return 0;
+  }
+  const Pool& pool = *iter->second;
+  return pool.instances.size() -
+         std::min(pool.next.load(std::memory_order_relaxed), pool.instances.size());
+}
+
+PooledManagerImplementationFactoryPtr createPooledPythonPluginSystemManagerImplementationFactory(
+    log::LoggerInterfacePtr logger,  // NOLINT(performance-unnecessary-value-param)
+    const PooledManagerImplementationFactory::PoolSizes& poolSizes) {
+  // Acquire the GIL once for all instantiations, rather than once
+  // per instance.
+  const py::gil_scoped_acquire gil{};
+  return PooledManagerImplementationFactory::make(
+      createPythonPluginSystemManagerImplementationFactory(logger), poolSizes, logger);
+}
 }  // namespace python::hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
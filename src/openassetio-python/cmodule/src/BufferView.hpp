@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines BufferView, exposing contiguous C++ arrays to Python via the
+ * buffer protocol, without creating a Python object per element.
+ */
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Read-only, one-dimensional view of a contiguous array.
+ *
+ * Instances are not exposed directly, rather wrapped in a Python
+ * `memoryview`, which holds a reference to the BufferView, which in
+ * turn holds a reference to the owner of the data.
+ *
+ * @see makeBufferView
+ */
+struct BufferView {
+  /// Start of the array.
+  const void* data;
+  /// Number of elements in the array.
+  pybind11::ssize_t size;
+  /// Size of each element, in bytes.
+  pybind11::ssize_t itemSize;
+  /// Struct-module-style format string of each element.
+  std::string format;
+  /// Object that must be kept alive for `data` to remain valid.
+  pybind11::object owner;
+};
+
+/**
+ * Create a read-only `memoryview` of an array owned by another Python
+ * object.
+ *
+ * @param data Start of the array. Must remain valid whilst `owner` is
+ * alive.
+ *
+ * @param size Number of elements in the array.
+ *
+ * @param owner Python object owning `data`.
+ *
+ * @param format Struct-module-style format of each element. Defaults
+ * to that of `T`.
+ */
+template <class T>
+pybind11::memoryview makeBufferView(
+    const T* data, const std::size_t size, pybind11::object owner,
+    std::string format = pybind11::format_descriptor<T>::format()) {
+  return pybind11::memoryview(pybind11::cast(
+      BufferView{data, static_cast<pybind11::ssize_t>(size),
+                 static_cast<pybind11::ssize_t>(sizeof(T)), std::move(format), std::move(owner)}));
+}
+
+/**
+ * Create a read-only `memoryview` of a vector owned by another Python
+ * object.
+ *
+ * @param data Vector to view. Must remain valid, and not be resized,
+ * whilst `owner` is alive.
+ *
+ * @param owner Python object owning `data`.
+ */
+template <class T>
+pybind11::memoryview makeBufferView(const std::vector<T>& data, pybind11::object owner) {
+  return makeBufferView(data.data(), data.size(), std::move(owner));
+}
+
+/**
+ * Create a read-only `memoryview` of a vector, taking ownership of
+ * the vector.
+ *
+ * The vector is moved to the heap and destroyed once the `memoryview`
+ * (and any views derived from it) are destroyed.
+ *
+ * @param data Vector to view.
+ */
+template <class T>
+pybind11::memoryview makeBufferView(std::vector<T> data) {
+  auto* heapData = new std::vector<T>{std::move(data)};  // NOLINT(cppcoreguidelines-owning-memory)
+  pybind11::capsule owner{heapData, [](void* ptr) {
+                            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                            delete static_cast<std::vector<T>*>(ptr);
+                          }};
+  return makeBufferView(*heapData, std::move(owner));
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
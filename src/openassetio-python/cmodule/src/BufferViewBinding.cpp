@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <pybind11/pybind11.h>
+
+#include "BufferView.hpp"
+#include "_openassetio.hpp"
+
+void registerBufferView(const py::module& mod) {
+  using openassetio::BufferView;
+
+  // Not intended to be used directly, only via `memoryview`. See
+  // makeBufferView.
+  py::class_<BufferView>{mod, "_BufferView", py::buffer_protocol()}.def_buffer(
+      [](const BufferView& self) {
+        return py::buffer_info{
+            // Safe since the buffer is flagged read-only.
+            const_cast<void*>(self.data),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            self.itemSize,
+            self.format,
+            1,
+            {self.size},
+            {self.itemSize},
+            true};
+      });
+}
@@ -19,5 +19,6 @@ void registerEntityReference(const py::module& mod) {
            [](const EntityReference& self) {
              return fmt::format("<openassetio.EntityReference {}>", self.toString());
            })
-      .def(py::self == py::self);  // NOLINT(misc-redundant-expression)
+      .def(py::self == py::self)  // NOLINT(misc-redundant-expression)
+      .def("__hash__", &EntityReference::hash);
 }
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <pybind11/pybind11.h>
+
+#include <openassetio/EntityReferenceInterner.hpp>
+
+#include "_openassetio.hpp"
+
+void registerEntityReferenceInterner(const py::module& mod) {
+  using openassetio::EntityReferenceInterner;
+
+  py::class_<EntityReferenceInterner, EntityReferenceInterner::Ptr>{mod, "EntityReferenceInterner",
+                                                                    py::is_final()}
+      .def(py::init(&EntityReferenceInterner::make))
+      .def("intern", &EntityReferenceInterner::intern, py::arg("entityReferenceString"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("size", &EntityReferenceInterner::size, py::call_guard<py::gil_scoped_release>{})
+      .def("clear", &EntityReferenceInterner::clear, py::call_guard<py::gil_scoped_release>{});
+}
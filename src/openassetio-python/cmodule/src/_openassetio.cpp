@@ -32,6 +32,7 @@ PYBIND11_MODULE(_openassetio, mod) {
 
   registerVersion(mod);
   registerAccess(access);
+  registerBufferView(mod);
   registerConstants(constants);
   registerLoggerInterface(log);
   registerConsoleLogger(log);
@@ -42,14 +43,20 @@ PYBIND11_MODULE(_openassetio, mod) {
   registerBatchElementError(errors);
   registerExceptions(errors);
   registerEntityReference(mod);
+  registerEntityReferenceInterner(mod);
   registerHostInterface(hostApi);
   registerHost(managerApi);
   registerHostSession(managerApi);
   registerEntityReferencePagerInterface(managerApi);
   registerEntityReferencePager(hostApi);
   registerManagerInterface(managerApi);
+  registerCachingManagerInterface(managerApi);
   registerManagerImplementationFactoryInterface(hostApi);
+  registerResolvedBatch(hostApi);
+  registerBatchFuture(hostApi);
+  registerResolveStream(hostApi);
   registerManager(hostApi);
+  registerRelationshipTraverser(hostApi);
   registerManagerFactory(hostApi);
   registerUtils(utils);
   registerCppPluginSystemPlugin(pluginSystem);
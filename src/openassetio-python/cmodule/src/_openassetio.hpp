@@ -49,6 +49,9 @@ void registerVersion(py::module& mod);
 /// Register access enums and strings.
 void registerAccess(const py::module& mod);
 
+/// Register the private BufferView class with Python.
+void registerBufferView(const py::module& mod);
+
 /// Register constants for use as dict keys.
 void registerConstants(const py::module& mod);
 
@@ -76,12 +79,27 @@ void registerHostSession(const py::module& mod);
 /// Register the ManagerInterface class with Python.
 void registerManagerInterface(const py::module& mod);
 
+/// Register the CachingManagerInterface class with Python.
+void registerCachingManagerInterface(const py::module& mod);
+
 /// Register the ManagerImplementationFactoryInterface class with Python.
 void registerManagerImplementationFactoryInterface(const py::module& mod);
 
+/// Register the ResolvedBatch class with Python.
+void registerResolvedBatch(const py::module& mod);
+
+/// Register the BatchFuture class template instantiations with Python.
+void registerBatchFuture(const py::module& mod);
+
+/// Register the ResolveStream class with Python.
+void registerResolveStream(const py::module& mod);
+
 /// Register the Manager class with Python.
 void registerManager(const py::module& mod);
 
+/// Register the RelationshipTraverser class with Python.
+void registerRelationshipTraverser(const py::module& mod);
+
 /// Register the ManagerFactory class with Python.
 void registerManagerFactory(const py::module& mod);
 
@@ -94,6 +112,9 @@ void registerManagerStateBase(const py::module& mod);
 /// Register the EntityReference type with Python.
 void registerEntityReference(const py::module& mod);
 
+/// Register the EntityReferenceInterner class with Python.
+void registerEntityReferenceInterner(const py::module& mod);
+
 /// Register the BatchElementError type with Python.
 void registerBatchElementError(const py::module& mod);
 
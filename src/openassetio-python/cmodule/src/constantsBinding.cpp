@@ -12,6 +12,9 @@ void registerConstants(const py::module_ &mod) {
   mod.attr("kInfoKey_SmallIcon") = openassetio::constants::kInfoKey_SmallIcon;
   mod.attr("kInfoKey_EntityReferencesMatchPrefix") =
       openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
+  mod.attr("kInfoKey_EntityReferencesMatchPrefixes") =
+      openassetio::constants::kInfoKey_EntityReferencesMatchPrefixes;
+  mod.attr("kInfoKey_IsThreadSafe") = openassetio::constants::kInfoKey_IsThreadSafe;
   // TODO(DF): @deprecated
   mod.attr("kField_Icon") = openassetio::constants::kInfoKey_Icon;
   mod.attr("kField_SmallIcon") = openassetio::constants::kInfoKey_SmallIcon;
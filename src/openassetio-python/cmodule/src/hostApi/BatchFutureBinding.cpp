@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/BatchFuture.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../_openassetio.hpp"
+
+namespace {
+template <class Value>
+void registerBatchFutureOf(const py::module& mod, const char* name) {
+  using openassetio::hostApi::BatchFuture;
+  using Future = BatchFuture<Value>;
+
+  py::class_<Future>{mod, name, py::is_final()}
+      .def_property_readonly_static(
+          "kCancelledMessage",
+          [](const py::object&) { return openassetio::Str{Future::kCancelledMessage}; })
+      .def("size", &Future::size)
+      .def("numCompleted", &Future::numCompleted)
+      .def("isElementReady", &Future::isElementReady, py::arg("index"))
+      .def("isReady", &Future::isReady)
+      .def("wait", &Future::wait, py::call_guard<py::gil_scoped_release>{})
+      .def("waitFor", &Future::waitFor, py::arg("timeout"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("element", &Future::element, py::arg("index"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "get", [](const Future& self) -> const typename Future::Results& { return self.get(); },
+          py::call_guard<py::gil_scoped_release>{})
+      .def("cancel", &Future::cancel)
+      .def("isCancelled", &Future::isCancelled);
+}
+}  // namespace
+
+void registerBatchFuture(const py::module& mod) {
+  using openassetio::EntityReference;
+  using openassetio::hostApi::EntityReferencePagerPtr;
+  using openassetio::trait::TraitsDataPtr;
+
+  registerBatchFutureOf<TraitsDataPtr>(mod, "ResolveFuture");
+  registerBatchFutureOf<bool>(mod, "EntityExistsFuture");
+  registerBatchFutureOf<EntityReference>(mod, "PublishFuture");
+  registerBatchFutureOf<EntityReferencePagerPtr>(mod, "RelationshipQueryFuture");
+}
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2022 The Foundry Visionmongers Ltd
 #include <algorithm>
+#include <functional>
 
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
@@ -14,9 +15,32 @@
 
 #include "../_openassetio.hpp"
 
+namespace {
+using openassetio::hostApi::EntityReferencePager;
+using openassetio::hostApi::EntityReferencePagerPtr;
+
+/**
+ * Wait for a pager's prefetch thread to exit, releasing the GIL if
+ * held.
+ *
+ * The prefetch thread may be waiting for the GIL in order to call a
+ * Python EntityReferencePagerInterface. A pager may be destroyed with
+ * the GIL held by whichever Python object holds its last reference,
+ * e.g. a BatchFuture, so this cannot be handled by the pager's own
+ * binding.
+ */
+void joinReleasingGil(const std::function<void()>& join) {
+  if (Py_IsInitialized() == 0 || PyGILState_Check() == 0) {
+    join();
+    return;
+  }
+  const py::gil_scoped_release gil{};
+  join();
+}
+}  // namespace
+
 void registerEntityReferencePager(const py::module& mod) {
-  using openassetio::hostApi::EntityReferencePager;
-  using openassetio::hostApi::EntityReferencePagerPtr;
+  EntityReferencePager::setJoinHook(&joinReleasingGil);
 
   py::class_<EntityReferencePager, EntityReferencePagerPtr>{mod, "EntityReferencePager"}
       .def(py::init(RetainCommonPyArgs::forFn<&EntityReferencePager::make>()),
@@ -24,5 +48,13 @@ void registerEntityReferencePager(const py::module& mod) {
            py::arg("hostSession").none(false))
       .def("hasNext", &EntityReferencePager::hasNext, py::call_guard<py::gil_scoped_release>{})
       .def("get", &EntityReferencePager::get, py::call_guard<py::gil_scoped_release>{})
-      .def("next", &EntityReferencePager::next, py::call_guard<py::gil_scoped_release>{});
+      .def("next", &EntityReferencePager::next, py::call_guard<py::gil_scoped_release>{})
+      .def("drainAll", &EntityReferencePager::drainAll, py::arg("sizeHint") = 0,
+           py::call_guard<py::gil_scoped_release>{})
+      .def("enablePrefetch", &EntityReferencePager::enablePrefetch,
+           py::arg("depth") = EntityReferencePager::kDefaultPrefetchDepth,
+           py::call_guard<py::gil_scoped_release>{})
+      .def("isPrefetchEnabled", &EntityReferencePager::isPrefetchEnabled,
+           py::call_guard<py::gil_scoped_release>{})
+      .def_readonly_static("kDefaultPrefetchDepth", &EntityReferencePager::kDefaultPrefetchDepth);
 }
@@ -1,19 +1,30 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2023 The Foundry Visionmongers Ltd
+// Copyright 2013-2024 The Foundry Visionmongers Ltd
 #include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/Context.hpp>
+#include <openassetio/EntityReferenceInterner.hpp>
 #include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/BatchFuture.hpp>
 #include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ResolveStream.hpp>
+#include <openassetio/hostApi/ResolvedBatch.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/trait/collection.hpp>
 
+#include "../BufferView.hpp"
 #include "../_openassetio.hpp"
 
 namespace {
@@ -31,6 +42,68 @@ void validateTraitsDatas(const TraitsDatas& traitsDatas) {
   }
 }
 
+/**
+ * Call a callback-based batch method, optionally buffering the results
+ * natively and passing them to the host's callbacks only once the
+ * batch is complete.
+ *
+ * Callbacks from Python are wrapped such that the GIL is acquired for
+ * every call. When buffered, the GIL is instead acquired once for the
+ * whole batch.
+ *
+ * Results are passed on in the order they were received. If the
+ * manager throws, the results received so far are passed on before
+ * the exception is propagated, as they would have been if unbuffered.
+ *
+ * @param bufferCallbacks Whether to buffer results.
+ *
+ * @param successCallback Host's success callback.
+ *
+ * @param errorCallback Host's error callback.
+ *
+ * @param fn Callable accepting a success and error callback, which
+ * calls the batch method.
+ */
+template <class Value, class Fn>
+void callWithBufferedCallbacks(const bool bufferCallbacks,
+                               const std::function<void(std::size_t, Value)>& successCallback,
+                               const Manager::BatchElementErrorCallback& errorCallback,
+                               const Fn& fn) {
+  using openassetio::errors::BatchElementError;
+
+  if (!bufferCallbacks) {
+    fn(successCallback, errorCallback);
+    return;
+  }
+
+  std::vector<std::pair<std::size_t, std::variant<BatchElementError, Value>>> results;
+
+  const auto flush = [&] {
+    const py::gil_scoped_acquire gil{};
+    for (auto& [idx, result] : results) {
+      if (auto* value = std::get_if<Value>(&result)) {
+        successCallback(idx, std::move(*value));
+      } else {
+        errorCallback(idx, std::get<BatchElementError>(std::move(result)));
+      }
+    }
+  };
+
+  try {
+    fn(
+        [&results](const std::size_t idx, Value value) {
+          results.emplace_back(idx, std::move(value));
+        },
+        [&results](const std::size_t idx, BatchElementError error) {
+          results.emplace_back(idx, std::move(error));
+        });
+  } catch (...) {
+    flush();
+    throw;
+  }
+  flush();
+}
+
 py::list pyBoolListFromUintVector(const std::vector<Manager::BoolAsUint>& boolAsUints) {
   py::gil_scoped_acquire gil{};
   py::list pyResult;
@@ -90,6 +163,11 @@ void registerManager(const py::module& mod) {
       .def("initialize", &Manager::initialize, py::arg("managerSettings"),
            py::call_guard<py::gil_scoped_release>{})
       .def("flushCaches", &Manager::flushCaches, py::call_guard<py::gil_scoped_release>{})
+      .def_readonly_static("kDefaultMinShardSize", &Manager::kDefaultMinShardSize)
+      .def("enableParallelDispatch", &Manager::enableParallelDispatch, py::arg("maxShards") = 0,
+           py::arg("minShardSize") = Manager::kDefaultMinShardSize)
+      .def("disableParallelDispatch", &Manager::disableParallelDispatch)
+      .def("isParallelDispatchEnabled", &Manager::isParallelDispatchEnabled)
       .def("managementPolicy", &Manager::managementPolicy, py::arg("traitSets"),
            py::arg("policyAccess"), py::arg("context").none(false),
            py::call_guard<py::gil_scoped_release>{})
@@ -102,10 +180,22 @@ void registerManager(const py::module& mod) {
            py::call_guard<py::gil_scoped_release>{})
       .def("isEntityReferenceString", &Manager::isEntityReferenceString, py::arg("someString"),
            py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "areEntityReferenceStrings",
+          [](Manager& self, const std::vector<std::string_view>& someStrings) {
+            return pyBoolListFromUintVector(self.areEntityReferenceStrings(someStrings));
+          },
+          py::arg("someStrings"), py::call_guard<py::gil_scoped_release>{})
       .def("createEntityReference", &Manager::createEntityReference,
            py::arg("entityReferenceString"), py::call_guard<py::gil_scoped_release>{})
       .def("createEntityReferenceIfValid", &Manager::createEntityReferenceIfValid,
            py::arg("entityReferenceString"), py::call_guard<py::gil_scoped_release>{})
+      .def("createEntityReferences",
+           py::overload_cast<std::vector<openassetio::Str>, const Manager::BatchElementErrorCallback&,
+                             const openassetio::EntityReferenceInternerPtr&>(
+               &Manager::createEntityReferences),
+           py::arg("entityReferenceStrings"), py::arg("errorCallback"),
+           py::arg("interner").none(true) = nullptr, py::call_guard<py::gil_scoped_release>{})
       .def(
           "entityExists",
           [](Manager& self, const EntityReference& entityReference,
@@ -144,25 +234,54 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReferences"), py::arg("context").none(false), py::arg("errorPolicyTag"),
           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityExistsView",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const ContextConstPtr& context) {
+            std::vector<Manager::BoolAsUint> result;
+            {
+              py::gil_scoped_release gil{};
+              result = self.entityExists(entityReferences, context);
+            }
+            // Avoid a Python bool per element, see makeBufferView.
+            return openassetio::makeBufferView(std::move(result));
+          },
+          py::arg("entityReferences"), py::arg("context").none(false))
       .def("entityExists",
            py::overload_cast<const EntityReferences&, const ContextConstPtr&,
                              const Manager::BatchElementErrorPolicyTag::Variant&>(
                &Manager::entityExists),
            py::arg("entityReferences"), py::arg("context").none(false), py::arg("errorPolicyTag"),
            py::call_guard<py::gil_scoped_release>{})
-      .def("entityExists",
-           py::overload_cast<const EntityReferences&, const ContextConstPtr&,
-                             const Manager::ExistsSuccessCallback&,
-                             const Manager::BatchElementErrorCallback&>(&Manager::entityExists),
-           py::arg("entityReferences"), py::arg("context").none(false), py::arg("successCallback"),
-           py::arg("errorCallback"), py::call_guard<py::gil_scoped_release>{})
-      .def("entityTraits",
-           py::overload_cast<const EntityReferences&, access::EntityTraitsAccess,
-                             const ContextConstPtr&, const Manager::EntityTraitsSuccessCallback&,
-                             const Manager::BatchElementErrorCallback&>(&Manager::entityTraits),
-           py::arg("entityReferences"), py::arg("entityTraitsAccess"),
-           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
-           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityExists",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const ContextConstPtr& context, const Manager::ExistsSuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback, const bool bufferCallbacks) {
+            callWithBufferedCallbacks(bufferCallbacks, successCallback, errorCallback,
+                                      [&](const auto& onSuccess, const auto& onError) {
+                                        self.entityExists(entityReferences, context, onSuccess,
+                                                          onError);
+                                      });
+          },
+          py::arg("entityReferences"), py::arg("context").none(false), py::arg("successCallback"),
+          py::arg("errorCallback"), py::arg("bufferCallbacks") = false,
+          py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityTraits",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+             const Manager::EntityTraitsSuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback, const bool bufferCallbacks) {
+            callWithBufferedCallbacks(bufferCallbacks, successCallback, errorCallback,
+                                      [&](const auto& onSuccess, const auto& onError) {
+                                        self.entityTraits(entityReferences, entityTraitsAccess,
+                                                          context, onSuccess, onError);
+                                      });
+          },
+          py::arg("entityReferences"), py::arg("entityTraitsAccess"),
+          py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
       .def("entityTraits",
            py::overload_cast<const EntityReference&, access::EntityTraitsAccess,
                              const ContextConstPtr&,
@@ -221,12 +340,20 @@ void registerManager(const py::module& mod) {
            py::call_guard<py::gil_scoped_release>{})
       .def(
           "resolve",
-          py::overload_cast<const EntityReferences&, const trait::TraitSet&, access::ResolveAccess,
-                            const ContextConstPtr&, const Manager::ResolveSuccessCallback&,
-                            const Manager::BatchElementErrorCallback&>(&Manager::resolve),
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitSet& traitSet, const access::ResolveAccess resolveAccess,
+             const ContextConstPtr& context,
+             const Manager::ResolveSuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback, const bool bufferCallbacks) {
+            callWithBufferedCallbacks(bufferCallbacks, successCallback, errorCallback,
+                                      [&](const auto& onSuccess, const auto& onError) {
+                                        self.resolve(entityReferences, traitSet, resolveAccess,
+                                                     context, onSuccess, onError);
+                                      });
+          },
           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
-          py::call_guard<py::gil_scoped_release>{})
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
       .def("resolve",
            py::overload_cast<const EntityReference&, const trait::TraitSet&, access::ResolveAccess,
                              const ContextConstPtr&,
@@ -287,20 +414,46 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
-      .def("defaultEntityReference", &Manager::defaultEntityReference, py::arg("traitSets"),
-           py::arg("defaultEntityAccess"), py::arg("context").none(false),
-           py::arg("successCallback"), py::arg("errorCallback"),
+      .def("resolveColumns", &Manager::resolveColumns, py::arg("entityReferences"),
+           py::arg("columnSpecs"), py::arg("resolveAccess"), py::arg("context").none(false),
            py::call_guard<py::gil_scoped_release>{})
-      .def("getWithRelationship",
-           py::overload_cast<const EntityReferences&, const trait::TraitsDataPtr&, size_t,
-                             access::RelationsAccess, const ContextConstPtr&,
-                             const Manager::RelationshipQuerySuccessCallback&,
-                             const Manager::BatchElementErrorCallback&, const trait::TraitSet&>(
-               &Manager::getWithRelationship),
-           py::arg("entityReferences"), py::arg("relationshipTraitsData").none(false),
-           py::arg("pageSize"), py::arg("relationsAccess"), py::arg("context").none(false),
-           py::arg("successCallback"), py::arg("errorCallback"),
-           py::arg("resultTraitSet") = trait::TraitSet{}, py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "defaultEntityReference",
+          [](Manager& self, const trait::TraitSets& traitSets,
+             const access::DefaultEntityAccess defaultEntityAccess,
+             const ContextConstPtr& context,
+             const Manager::DefaultEntityReferenceSuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback, const bool bufferCallbacks) {
+            callWithBufferedCallbacks(bufferCallbacks, successCallback, errorCallback,
+                                      [&](const auto& onSuccess, const auto& onError) {
+                                        self.defaultEntityReference(traitSets, defaultEntityAccess,
+                                                                    context, onSuccess, onError);
+                                      });
+          },
+          py::arg("traitSets"), py::arg("defaultEntityAccess"), py::arg("context").none(false),
+          py::arg("successCallback"), py::arg("errorCallback"),
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "getWithRelationship",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDataPtr& relationshipTraitsData, size_t pageSize,
+             const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const Manager::RelationshipQuerySuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback,
+             const trait::TraitSet& resultTraitSet, const bool bufferCallbacks) {
+            callWithBufferedCallbacks(
+                bufferCallbacks, successCallback, errorCallback,
+                [&](const auto& onSuccess, const auto& onError) {
+                  self.getWithRelationship(entityReferences, relationshipTraitsData, pageSize,
+                                           relationsAccess, context, onSuccess, onError,
+                                           resultTraitSet);
+                });
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsData").none(false),
+          py::arg("pageSize"), py::arg("relationsAccess"), py::arg("context").none(false),
+          py::arg("successCallback"), py::arg("errorCallback"),
+          py::arg("resultTraitSet") = trait::TraitSet{}, py::arg("bufferCallbacks") = false,
+          py::call_guard<py::gil_scoped_release>{})
       // TODO(DF): Technically we shouldn't need this overload,
       // since we can use a similar trick to C++ to default the
       // appropriate overload's tag parameter, e.g.
@@ -377,16 +530,20 @@ void registerManager(const py::module& mod) {
              const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
              const Manager::RelationshipQuerySuccessCallback& successCallback,
              const Manager::BatchElementErrorCallback& errorCallback,
-             const trait::TraitSet& resultTraitSet) {
+             const trait::TraitSet& resultTraitSet, const bool bufferCallbacks) {
             validateTraitsDatas(relationshipTraitsDatas);
-            return self.getWithRelationships(entityReference, relationshipTraitsDatas, pageSize,
-                                             relationsAccess, context, successCallback,
-                                             errorCallback, resultTraitSet);
+            callWithBufferedCallbacks(
+                bufferCallbacks, successCallback, errorCallback,
+                [&](const auto& onSuccess, const auto& onError) {
+                  self.getWithRelationships(entityReference, relationshipTraitsDatas, pageSize,
+                                            relationsAccess, context, onSuccess, onError,
+                                            resultTraitSet);
+                });
           },
           py::arg("entityReference"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
           py::arg("relationsAccess"), py::arg("context").none(false), py::arg("successCallback"),
           py::arg("errorCallback"), py::arg("resultTraitSet") = trait::TraitSet{},
-          py::call_guard<py::gil_scoped_release>{})
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
       // TODO(DF): Technically we shouldn't need this overload,
       // since we can use a similar trick to C++ to default the
       // appropriate overload's tag parameter, e.g.
@@ -435,20 +592,89 @@ void registerManager(const py::module& mod) {
           py::arg("entityReference"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
           py::arg("relationsAccess"), py::arg("context").none(false), py::arg("resultTraitSet"),
           py::arg("errorPolicyTag"), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "getWithRelationshipsMatrix",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& relationshipTraitsDatas, size_t pageSize,
+             const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const Manager::RelationshipQuerySuccessCallback& successCallback,
+             const Manager::BatchElementErrorCallback& errorCallback,
+             const trait::TraitSet& resultTraitSet, const bool bufferCallbacks) {
+            validateTraitsDatas(relationshipTraitsDatas);
+            callWithBufferedCallbacks(
+                bufferCallbacks, successCallback, errorCallback,
+                [&](const auto& onSuccess, const auto& onError) {
+                  self.getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                  pageSize, relationsAccess, context, onSuccess,
+                                                  onError, resultTraitSet);
+                });
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
+          py::arg("relationsAccess"), py::arg("context").none(false), py::arg("successCallback"),
+          py::arg("errorCallback"), py::arg("resultTraitSet") = trait::TraitSet{},
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "getWithRelationshipsMatrix",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& relationshipTraitsDatas, size_t pageSize,
+             const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const trait::TraitSet& resultTraitSet) {
+            validateTraitsDatas(relationshipTraitsDatas);
+            return self.getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                   pageSize, relationsAccess, context,
+                                                   resultTraitSet);
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
+          py::arg("relationsAccess"), py::arg("context").none(false), py::arg("resultTraitSet"),
+          py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "getWithRelationshipsMatrix",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& relationshipTraitsDatas, size_t pageSize,
+             access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const trait::TraitSet& resultTraitSet,
+             const Manager::BatchElementErrorPolicyTag::Exception& errorPolicyTag) {
+            validateTraitsDatas(relationshipTraitsDatas);
+            return self.getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                   pageSize, relationsAccess, context,
+                                                   resultTraitSet, errorPolicyTag);
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
+          py::arg("relationsAccess"), py::arg("context").none(false), py::arg("resultTraitSet"),
+          py::arg("errorPolicyTag"), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "getWithRelationshipsMatrix",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitsDatas& relationshipTraitsDatas, size_t pageSize,
+             access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+             const trait::TraitSet& resultTraitSet,
+             const Manager::BatchElementErrorPolicyTag::Variant& errorPolicyTag) {
+            validateTraitsDatas(relationshipTraitsDatas);
+            return self.getWithRelationshipsMatrix(entityReferences, relationshipTraitsDatas,
+                                                   pageSize, relationsAccess, context,
+                                                   resultTraitSet, errorPolicyTag);
+          },
+          py::arg("entityReferences"), py::arg("relationshipTraitsDatas"), py::arg("pageSize"),
+          py::arg("relationsAccess"), py::arg("context").none(false), py::arg("resultTraitSet"),
+          py::arg("errorPolicyTag"), py::call_guard<py::gil_scoped_release>{})
       .def(
           "preflight",
           [](Manager& self, const EntityReferences& entityReferences,
              const trait::TraitsDatas& traitsHints,
              const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
              const Manager::PreflightSuccessCallback& successCallback,
-             const Manager::BatchElementErrorCallback& errorCallback) {
+             const Manager::BatchElementErrorCallback& errorCallback, const bool bufferCallbacks) {
             validateTraitsDatas(traitsHints);
-            self.preflight(entityReferences, traitsHints, publishingAccess, context,
-                           successCallback, errorCallback);
+            callWithBufferedCallbacks(bufferCallbacks, successCallback, errorCallback,
+                                      [&](const auto& onSuccess, const auto& onError) {
+                                        self.preflight(entityReferences, traitsHints,
+                                                       publishingAccess, context, onSuccess,
+                                                       onError);
+                                      });
           },
           py::arg("entityReferences"), py::arg("traitsHints"), py::arg("publishAccess"),
           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
-          py::call_guard<py::gil_scoped_release>{})
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
       .def("preflight",
            py::overload_cast<const EntityReference&, const TraitsDataPtr&,
                              access::PublishingAccess, const ContextConstPtr&,
@@ -514,14 +740,18 @@ void registerManager(const py::module& mod) {
              const trait::TraitsDatas& entityTraitsDatas,
              const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
              const Manager::RegisterSuccessCallback& successCallback,
-             const Manager::BatchElementErrorCallback& errorCallback) {
+             const Manager::BatchElementErrorCallback& errorCallback, const bool bufferCallbacks) {
             validateTraitsDatas(entityTraitsDatas);
-            self.register_(entityReferences, entityTraitsDatas, publishingAccess, context,
-                           successCallback, errorCallback);
+            callWithBufferedCallbacks(bufferCallbacks, successCallback, errorCallback,
+                                      [&](const auto& onSuccess, const auto& onError) {
+                                        self.register_(entityReferences, entityTraitsDatas,
+                                                       publishingAccess, context, onSuccess,
+                                                       onError);
+                                      });
           },
           py::arg("entityReferences"), py::arg("entityTraitsDatas"), py::arg("publishAccess"),
           py::arg("context").none(false), py::arg("successCallback"), py::arg("errorCallback"),
-          py::call_guard<py::gil_scoped_release>{})
+          py::arg("bufferCallbacks") = false, py::call_guard<py::gil_scoped_release>{})
 
       .def("register",
            py::overload_cast<const EntityReference&, const TraitsDataPtr&,
@@ -585,5 +815,46 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReference"), py::arg("entityTraitsData").none(false),
           py::arg("publishAccess"), py::arg("context").none(false),
-          py::call_guard<py::gil_scoped_release>{});
+          py::call_guard<py::gil_scoped_release>{})
+      .def("resolveAsync", &Manager::resolveAsync, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("context").none(false),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("resolveStream", &Manager::resolveStream, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("context").none(false),
+           py::arg("maxQueueSize") = openassetio::hostApi::ResolveStream::kDefaultMaxQueueSize,
+           py::call_guard<py::gil_scoped_release>{})
+      .def("entityExistsAsync", &Manager::entityExistsAsync, py::arg("entityReferences"),
+           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def("getWithRelationshipAsync", &Manager::getWithRelationshipAsync,
+           py::arg("entityReferences"), py::arg("relationshipTraitsData").none(false),
+           py::arg("pageSize"), py::arg("relationsAccess"), py::arg("context").none(false),
+           py::arg("resultTraitSet") = openassetio::trait::TraitSet{},
+           py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "preflightAsync",
+          [](Manager& self, EntityReferences entityReferences, TraitsDatas traitsHints,
+             const access::PublishingAccess publishingAccess, ContextConstPtr context) {
+            validateTraitsDatas(traitsHints);
+            return self.preflightAsync(std::move(entityReferences), std::move(traitsHints),
+                                       publishingAccess, std::move(context));
+          },
+          py::arg("entityReferences"), py::arg("traitsHints"), py::arg("publishAccess"),
+          py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "registerAsync",
+          [](Manager& self, EntityReferences entityReferences, TraitsDatas entityTraitsDatas,
+             const access::PublishingAccess publishingAccess, ContextConstPtr context) {
+            validateTraitsDatas(entityTraitsDatas);
+            return self.registerAsync(std::move(entityReferences), std::move(entityTraitsDatas),
+                                      publishingAccess, std::move(context));
+          },
+          py::arg("entityReferences"), py::arg("entityTraitsDatas"), py::arg("publishAccess"),
+          py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def_static("shutdownAsyncRequests", &Manager::shutdownAsyncRequests,
+                  py::call_guard<py::gil_scoped_release>{});
+
+  // Asynchronous requests may call into Python, so must finish before
+  // the interpreter is finalised, rather than during static
+  // destruction.
+  py::module_::import("atexit").attr("register")(pyManager.attr("shutdownAsyncRequests"));
 }  // NOLINT(readability/fn_size)
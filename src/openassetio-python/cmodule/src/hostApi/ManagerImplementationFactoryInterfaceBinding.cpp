@@ -2,6 +2,9 @@
 // Copyright 2013-2024 The Foundry Visionmongers Ltd
 #include <pybind11/stl.h>
 
+#include <optional>
+
+#include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
@@ -35,6 +38,13 @@ struct PyManagerImplementationFactoryInterface : ManagerImplementationFactoryInt
                                        identifier);
   }
 
+  [[nodiscard]] std::optional<ManagerFactory::ManagerDetail> managerDetail(
+      const Identifier& identifier) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(std::optional<ManagerFactory::ManagerDetail>,
+                                  ManagerImplementationFactoryInterface, managerDetail,
+                                  identifier);
+  }
+
   using ManagerImplementationFactoryInterface::logger;
 };
 
@@ -57,5 +67,7 @@ void registerManagerImplementationFactoryInterface(const py::module& mod) {
            py::call_guard<py::gil_scoped_release>{})
       .def("instantiate", &ManagerImplementationFactoryInterface::instantiate,
            py::arg("identifier"), py::call_guard<py::gil_scoped_release>{})
+      .def("managerDetail", &ManagerImplementationFactoryInterface::managerDetail,
+           py::arg("identifier"), py::call_guard<py::gil_scoped_release>{})
       .def_property_readonly("_logger", &PyManagerImplementationFactoryInterface::logger);
 }
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/RelationshipTraverser.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerRelationshipTraverser(const py::module& mod) {
+  using openassetio::hostApi::RelationshipTraverser;
+  using openassetio::hostApi::RelationshipTraverserPtr;
+
+  py::class_<RelationshipTraverser, RelationshipTraverserPtr> pyRelationshipTraverser{
+      mod, "RelationshipTraverser", py::is_final()};
+
+  py::class_<RelationshipTraverser::Node>{pyRelationshipTraverser, "Node"}
+      .def_readonly("entityReference", &RelationshipTraverser::Node::entityReference)
+      .def_readonly("depth", &RelationshipTraverser::Node::depth);
+
+  py::class_<RelationshipTraverser::Edge>{pyRelationshipTraverser, "Edge"}
+      .def_readonly("source", &RelationshipTraverser::Edge::source)
+      .def_readonly("target", &RelationshipTraverser::Edge::target);
+
+  py::class_<RelationshipTraverser::Traversal>{pyRelationshipTraverser, "Traversal"}
+      .def_readonly("nodes", &RelationshipTraverser::Traversal::nodes)
+      .def_readonly("edges", &RelationshipTraverser::Traversal::edges)
+      .def_readonly("errors", &RelationshipTraverser::Traversal::errors)
+      .def_readonly("hasCycle", &RelationshipTraverser::Traversal::hasCycle);
+
+  pyRelationshipTraverser
+      .def(py::init(&RelationshipTraverser::make), py::arg("manager").none(false),
+           py::arg("relationshipTraitsData").none(false), py::arg("relationsAccess"),
+           py::arg("context").none(false),
+           py::arg("resultTraitSet") = openassetio::trait::TraitSet{},
+           py::arg("pageSize") = RelationshipTraverser::kDefaultPageSize)
+      .def_readonly_static("kUnlimitedDepth", &RelationshipTraverser::kUnlimitedDepth)
+      .def_readonly_static("kDefaultPageSize", &RelationshipTraverser::kDefaultPageSize)
+      .def("traverse", &RelationshipTraverser::traverse, py::arg("entityReferences"),
+           py::arg("maxDepth") = RelationshipTraverser::kUnlimitedDepth,
+           py::call_guard<py::gil_scoped_release>{})
+      .def("queryCount", &RelationshipTraverser::queryCount)
+      .def("clearCache", &RelationshipTraverser::clearCache);
+}
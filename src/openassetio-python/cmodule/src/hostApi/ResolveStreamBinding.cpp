@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <optional>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/ResolveStream.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../_openassetio.hpp"
+
+namespace {
+using openassetio::hostApi::ResolveStream;
+using openassetio::hostApi::ResolveStreamPtr;
+
+/**
+ * Deallocate a Python ResolveStream, releasing the GIL before the C++
+ * instance is destroyed.
+ *
+ * Destroying a stream joins its background thread, which may be
+ * waiting for the GIL in order to call a Python ManagerInterface.
+ */
+void deallocReleasingGil(PyObject* self) {
+  // Keep the C++ instance alive beyond the Python instance's holder.
+  ResolveStreamPtr stream;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto valueAndHolder = reinterpret_cast<py::detail::instance*>(self)->get_value_and_holder();
+  if (valueAndHolder.holder_constructed()) {
+    stream = valueAndHolder.holder<ResolveStreamPtr>();
+  }
+  py::detail::pybind11_object_dealloc(self);
+
+  const py::gil_scoped_release gil{};
+  stream.reset();
+}
+}  // namespace
+
+void registerResolveStream(const py::module& mod) {
+  py::class_<ResolveStream, ResolveStreamPtr>{
+      mod, "ResolveStream", py::is_final(), py::custom_type_setup([](PyHeapTypeObject* heapType) {
+        heapType->ht_type.tp_dealloc = &deallocReleasingGil;
+      })}
+      .def_readonly_static("kDefaultMaxQueueSize", &ResolveStream::kDefaultMaxQueueSize)
+      .def("size", &ResolveStream::size)
+      .def("maxQueueSize", &ResolveStream::maxQueueSize)
+      .def("cancel", &ResolveStream::cancel)
+      .def("__iter__", [](const ResolveStreamPtr& self) { return self; })
+      .def("__next__", [](ResolveStream& self) {
+        std::optional<ResolveStream::Element> element;
+        {
+          py::gil_scoped_release gil{};
+          element = self.next();
+        }
+        if (!element) {
+          throw py::stop_iteration{};
+        }
+        return py::make_tuple(element->index, std::move(element->result));
+      });
+}
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/ResolvedBatch.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../BufferView.hpp"
+#include "../_openassetio.hpp"
+
+namespace {
+using openassetio::hostApi::ResolvedBatch;
+
+/**
+ * Number of live column views of each ResolvedBatch.
+ *
+ * Views point directly into the batch's storage, which may be
+ * reallocated by mutation, so mutation is disallowed whilst any view
+ * is alive. Only accessed whilst holding the GIL.
+ */
+std::unordered_map<const ResolvedBatch*, std::size_t>& viewCounts() {
+  static std::unordered_map<const ResolvedBatch*, std::size_t> counts;
+  return counts;
+}
+
+/**
+ * Owner of the data of a column view, keeping the ResolvedBatch both
+ * alive and marked as viewed.
+ */
+class ViewPin {
+ public:
+  explicit ViewPin(py::object batch)
+      : batch_{std::move(batch)}, batchPtr_{&batch_.cast<const ResolvedBatch&>()} {
+    ++viewCounts()[batchPtr_];
+  }
+
+  ~ViewPin() {
+    if (const auto iter = viewCounts().find(batchPtr_); --iter->second == 0) {
+      viewCounts().erase(iter);
+    }
+  }
+
+  ViewPin(const ViewPin&) = delete;
+  ViewPin(ViewPin&&) noexcept = delete;
+  ViewPin& operator=(const ViewPin&) = delete;
+  ViewPin& operator=(ViewPin&&) noexcept = delete;
+
+ private:
+  py::object batch_;
+  const ResolvedBatch* batchPtr_;
+};
+
+/**
+ * Create an owner for the data of a column view of a ResolvedBatch,
+ * pinning the batch until the view is destroyed.
+ */
+py::capsule pinForView(py::object batch) {
+  return py::capsule{new ViewPin{std::move(batch)},  // NOLINT(cppcoreguidelines-owning-memory)
+                     [](void* ptr) {
+                       // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                       delete static_cast<ViewPin*>(ptr);
+                     }};
+}
+
+/// Throw if any column views of the given ResolvedBatch are alive.
+void checkNotViewed(const ResolvedBatch& batch) {
+  if (viewCounts().count(&batch) != 0) {
+    throw py::buffer_error{
+        "ResolvedBatch cannot be modified whilst views of its columns exist."};
+  }
+}
+}  // namespace
+
+void registerResolvedBatch(const py::module& mod) {
+  using openassetio::makeBufferView;
+
+  py::class_<ResolvedBatch> pyResolvedBatch{mod, "ResolvedBatch", py::is_final()};
+
+  py::enum_<ResolvedBatch::ColumnType>{pyResolvedBatch, "ColumnType"}
+      .value("kBool", ResolvedBatch::ColumnType::kBool)
+      .value("kInt", ResolvedBatch::ColumnType::kInt)
+      .value("kFloat", ResolvedBatch::ColumnType::kFloat)
+      .value("kStr", ResolvedBatch::ColumnType::kStr);
+
+  py::class_<ResolvedBatch::ColumnSpec>{pyResolvedBatch, "ColumnSpec"}
+      .def(py::init<openassetio::trait::TraitId, openassetio::trait::property::Key,
+                    ResolvedBatch::ColumnType>(),
+           py::arg("traitId"), py::arg("propertyKey"), py::arg("type"))
+      .def_readonly("traitId", &ResolvedBatch::ColumnSpec::traitId)
+      .def_readonly("propertyKey", &ResolvedBatch::ColumnSpec::propertyKey)
+      .def_readonly("type", &ResolvedBatch::ColumnSpec::type);
+
+  pyResolvedBatch
+      .def(py::init<ResolvedBatch::ColumnSpecs, std::size_t>(), py::arg("columnSpecs"),
+           py::arg("size"))
+      .def("size", &ResolvedBatch::size)
+      .def("columnSpecs", &ResolvedBatch::columnSpecs)
+      .def(
+          "setValues",
+          [](ResolvedBatch& self, const std::size_t index,
+             const openassetio::trait::TraitsData& traitsData) {
+            checkNotViewed(self);
+            self.setValues(index, traitsData);
+          },
+          py::arg("index"), py::arg("traitsData").none(false))
+      .def(
+          "setError",
+          [](ResolvedBatch& self, const std::size_t index,
+             openassetio::errors::BatchElementError error) {
+            checkNotViewed(self);
+            self.setError(index, std::move(error));
+          },
+          py::arg("index"), py::arg("error"))
+      .def("isValid", &ResolvedBatch::isValid, py::arg("column"), py::arg("index"))
+      .def("isError", &ResolvedBatch::isError, py::arg("index"))
+      .def("error", &ResolvedBatch::error, py::arg("index"))
+      .def("errors", &ResolvedBatch::errors)
+      .def("boolColumn", &ResolvedBatch::boolColumn, py::arg("column"))
+      .def("intColumn", &ResolvedBatch::intColumn, py::arg("column"))
+      .def("floatColumn", &ResolvedBatch::floatColumn, py::arg("column"))
+      .def("strOffsets", &ResolvedBatch::strOffsets, py::arg("column"))
+      .def("strLengths", &ResolvedBatch::strLengths, py::arg("column"))
+      .def("strValue", &ResolvedBatch::strValue, py::arg("column"), py::arg("index"))
+      // Zero-copy views of columns, via the buffer protocol. Each view
+      // keeps the ResolvedBatch alive, and prevents its modification.
+      .def(
+          "boolColumnView",
+          [](const py::object& self, const std::size_t column) {
+            const auto& batch = self.cast<const ResolvedBatch&>();
+            return makeBufferView(batch.boolColumn(column), pinForView(self));
+          },
+          py::arg("column"))
+      .def(
+          "intColumnView",
+          [](const py::object& self, const std::size_t column) {
+            const auto& batch = self.cast<const ResolvedBatch&>();
+            return makeBufferView(batch.intColumn(column), pinForView(self));
+          },
+          py::arg("column"))
+      .def(
+          "floatColumnView",
+          [](const py::object& self, const std::size_t column) {
+            const auto& batch = self.cast<const ResolvedBatch&>();
+            return makeBufferView(batch.floatColumn(column), pinForView(self));
+          },
+          py::arg("column"))
+      .def(
+          "strBufferView",
+          [](const py::object& self, const std::size_t column) {
+            const openassetio::Str& buffer = self.cast<const ResolvedBatch&>().strBuffer(column);
+            // Raw UTF-8 bytes.
+            return makeBufferView(reinterpret_cast<const std::uint8_t*>(  // NOLINT
+                                      buffer.data()),
+                                  buffer.size(), pinForView(self));
+          },
+          py::arg("column"))
+      .def(
+          "strOffsetsView",
+          [](const py::object& self, const std::size_t column) {
+            const auto& batch = self.cast<const ResolvedBatch&>();
+            return makeBufferView(batch.strOffsets(column), pinForView(self));
+          },
+          py::arg("column"))
+      .def(
+          "strLengthsView",
+          [](const py::object& self, const std::size_t column) {
+            const auto& batch = self.cast<const ResolvedBatch&>();
+            return makeBufferView(batch.strLengths(column), pinForView(self));
+          },
+          py::arg("column"));
+}
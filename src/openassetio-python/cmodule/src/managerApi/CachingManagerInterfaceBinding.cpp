@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+
+#include <openassetio/managerApi/CachingManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+
+#include "../PyRetainingSharedPtr.hpp"
+#include "../_openassetio.hpp"
+
+void registerCachingManagerInterface(const py::module& mod) {
+  using openassetio::managerApi::CachingManagerInterface;
+  using openassetio::managerApi::CachingManagerInterfacePtr;
+  using openassetio::managerApi::ManagerInterface;
+
+  py::class_<CachingManagerInterface, ManagerInterface, CachingManagerInterfacePtr>(
+      mod, "CachingManagerInterface", py::is_final())
+      .def(py::init(RetainCommonPyArgs::forFn<&CachingManagerInterface::make>()),
+           py::arg("upstreamInterface").none(false),
+           py::arg("capacity") = CachingManagerInterface::kDefaultCapacity,
+           py::arg("timeToLive") = CachingManagerInterface::Clock::duration::zero())
+      .def_readonly_static("kDefaultCapacity", &CachingManagerInterface::kDefaultCapacity)
+      .def("upstreamInterface", &CachingManagerInterface::upstreamInterface);
+}
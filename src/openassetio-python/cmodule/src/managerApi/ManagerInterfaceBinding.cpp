@@ -1,10 +1,22 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2023 The Foundry Visionmongers Ltd
+// Copyright 2013-2024 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/Context.hpp>
 #include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
@@ -20,10 +32,29 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
+namespace {
+template <class T>
+struct IsOptional : std::false_type {};
+
+template <class T>
+struct IsOptional<std::optional<T>> : std::true_type {};
+}  // namespace
 
 /**
  * Trampoline class required for pybind to bind pure virtual methods
  * and allow C++ -> Python calls via a C++ instance.
+ *
+ * As an alternative to the callback-based batch methods, Python
+ * managers may implement a corresponding `<method>Batch` method (e.g.
+ * `resolveBatch`), taking the same arguments minus the callbacks. This
+ * must return a `(results, errors)` tuple, where `results` is a list
+ * with one result per element of the batch, and `errors` is a dict
+ * mapping the index of each element in error to its
+ * BatchElementError. Results for elements in error are ignored, and
+ * so may be `None`.
+ *
+ * The returned batch is converted to C++ in a single pass, avoiding
+ * the cost of a Python <-> C++ transition for each element.
  */
 struct PyManagerInterface : ManagerInterface {
   using ManagerInterface::ManagerInterface;
@@ -92,10 +123,21 @@ struct PyManagerInterface : ManagerInterface {
                                   hostSession);
   }
 
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<std::string_view>& someStrings,
+      const HostSessionPtr& hostSession) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(std::vector<bool>, ManagerInterface, areEntityReferenceStrings,
+                                  someStrings, hostSession);
+  }
+
   void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
                     const HostSessionPtr& hostSession,
                     const ExistsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
+    if (callBatchOverride("entityExistsBatch", entityReferences.size(), successCallback,
+                          errorCallback, entityReferences, context, hostSession)) {
+      return;
+    }
     OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityExists, entityReferences, context,
                                   hostSession, successCallback, errorCallback);
   }
@@ -114,6 +156,11 @@ struct PyManagerInterface : ManagerInterface {
                const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
                const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
                const BatchElementErrorCallback& errorCallback) override {
+    if (callBatchOverride("resolveBatch", entityReferences.size(), successCallback,
+                          errorCallback, entityReferences, traitSet, resolveAccess, context,
+                          hostSession)) {
+      return;
+    }
     OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, resolve, entityReferences, traitSet,
                                   resolveAccess, context, hostSession, successCallback,
                                   errorCallback);
@@ -124,6 +171,11 @@ struct PyManagerInterface : ManagerInterface {
                     const ContextConstPtr& context, const HostSessionPtr& hostSession,
                     const EntityTraitsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
+    if (callBatchOverride("entityTraitsBatch", entityReferences.size(), successCallback,
+                          errorCallback, entityReferences, entityTraitsAccess, context,
+                          hostSession)) {
+      return;
+    }
     OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityTraits, entityReferences,
                                   entityTraitsAccess, context, hostSession, successCallback,
                                   errorCallback);
@@ -134,6 +186,10 @@ struct PyManagerInterface : ManagerInterface {
                               const ContextConstPtr& context, const HostSessionPtr& hostSession,
                               const DefaultEntityReferenceSuccessCallback& successCallback,
                               const BatchElementErrorCallback& errorCallback) override {
+    if (callBatchOverride("defaultEntityReferenceBatch", traitSets.size(), successCallback,
+                          errorCallback, traitSets, defaultEntityAccess, context, hostSession)) {
+      return;
+    }
     OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, defaultEntityReference, traitSets,
                                   defaultEntityAccess, context, hostSession, successCallback,
                                   errorCallback);
@@ -169,11 +225,31 @@ struct PyManagerInterface : ManagerInterface {
         context, hostSession, RetainCommonPyArgs::forFn(successCallback), errorCallback);
   }
 
+  void getWithRelationshipsMatrix(
+      const EntityReferences& entityReferences, const trait::TraitsDatas& relationshipTraitsDatas,
+      const trait::TraitSet& resultTraitSet, size_t pageSize,
+      const access::RelationsAccess relationsAccess, const ContextConstPtr& context,
+      const HostSessionPtr& hostSession,
+      const ManagerInterface::RelationshipQuerySuccessCallback& successCallback,
+      const ManagerInterface::BatchElementErrorCallback& errorCallback) override {
+    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
+        void, ManagerInterface, getWithRelationshipsMatrix,
+        (entityReferences, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+         context, hostSession, successCallback, errorCallback),
+        entityReferences, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
+        context, hostSession, RetainCommonPyArgs::forFn(successCallback), errorCallback);
+  }
+
   void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
                  const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
                  const HostSessionPtr& hostSession,
                  const PreflightSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
+    if (callBatchOverride("preflightBatch", entityReferences.size(), successCallback,
+                          errorCallback, entityReferences, traitsHints, publishingAccess, context,
+                          hostSession)) {
+      return;
+    }
     OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, preflight, entityReferences, traitsHints,
                                   publishingAccess, context, hostSession, successCallback,
                                   errorCallback);
@@ -183,6 +259,11 @@ struct PyManagerInterface : ManagerInterface {
                  const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
                  const HostSessionPtr& hostSession, const RegisterSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
+    if (callBatchOverride("registerBatch", entityReferences.size(), successCallback,
+                          errorCallback, entityReferences, traitsDatas, publishingAccess, context,
+                          hostSession)) {
+      return;
+    }
     OPENASSETIO_PYBIND11_OVERRIDE_NAME(void, ManagerInterface, "register", register_,
                                        entityReferences, traitsDatas, publishingAccess, context,
                                        hostSession, successCallback, errorCallback);
@@ -190,6 +271,77 @@ struct PyManagerInterface : ManagerInterface {
 
   // Hoist protected members
   using ManagerInterface::createEntityReference;
+
+ private:
+  /**
+   * Call the Python `<method>Batch` override, if one exists, passing
+   * its results on to the given callbacks.
+   *
+   * The GIL is held only whilst calling the override and converting
+   * its results. Callbacks are called in index order, with the GIL
+   * released.
+   *
+   * @param name Name of the Python batch method.
+   *
+   * @param batchSize Number of elements in the batch.
+   *
+   * @param successCallback Callback for successful elements.
+   *
+   * @param errorCallback Callback for elements in error.
+   *
+   * @param args Arguments to pass to the Python method.
+   *
+   * @return Whether a Python batch method was found and called.
+   */
+  template <class Value, class... Args>
+  bool callBatchOverride(const char* name, const std::size_t batchSize,
+                         const std::function<void(std::size_t, Value)>& successCallback,
+                         const BatchElementErrorCallback& errorCallback, const Args&... args) {
+    using Results = std::vector<std::optional<Value>>;
+    using Errors = std::unordered_map<std::size_t, errors::BatchElementError>;
+
+    std::optional<std::pair<Results, Errors>> batch;
+    decorateWithExceptionConverter([&] {
+      const py::gil_scoped_acquire gil{};
+      const py::function override =
+          py::get_override(static_cast<const ManagerInterface*>(this), name);
+      if (override) {
+        batch = override(args...).template cast<std::pair<Results, Errors>>();
+      }
+    });
+    if (!batch) {
+      return false;
+    }
+
+    auto& [results, elementErrors] = *batch;
+    if (results.size() != batchSize) {
+      throw errors::InputValidationException{
+          Str{name} + " returned " + std::to_string(results.size()) + " results for a batch of " +
+          std::to_string(batchSize) + "."};
+    }
+    for (const auto& entry : elementErrors) {
+      if (entry.first >= batchSize) {
+        throw errors::InputValidationException{Str{name} + " returned an error for index " +
+                                               std::to_string(entry.first) +
+                                               ", which is out of range."};
+      }
+    }
+
+    for (std::size_t idx = 0; idx < batchSize; ++idx) {
+      if (const auto error = elementErrors.find(idx); error != elementErrors.end()) {
+        errorCallback(idx, std::move(error->second));
+      } else if (results[idx]) {
+        successCallback(idx, std::move(*results[idx]));
+      } else if constexpr (IsOptional<Value>::value) {
+        // `None` is a valid result, e.g. no default entity.
+        successCallback(idx, Value{});
+      } else {
+        throw errors::InputValidationException{Str{name} + " returned None for index " +
+                                               std::to_string(idx) + ", which is not in error."};
+      }
+    }
+    return true;
+  }
 };
 
 }  // namespace managerApi
@@ -253,6 +405,9 @@ void registerManagerInterface(const py::module& mod) {
       .def("isEntityReferenceString", &ManagerInterface::isEntityReferenceString,
            py::arg("someString"), py::arg("hostSession").none(false),
            py::call_guard<py::gil_scoped_release>{})
+      .def("areEntityReferenceStrings", &ManagerInterface::areEntityReferenceStrings,
+           py::arg("someStrings"), py::arg("hostSession").none(false),
+           py::call_guard<py::gil_scoped_release>{})
       .def("entityExists", &ManagerInterface::entityExists, py::arg("entityReferences"),
            py::arg("context").none(false), py::arg("hostSession").none(false),
            py::arg("successCallback"), py::arg("errorCallback"),
@@ -285,6 +440,12 @@ void registerManagerInterface(const py::module& mod) {
            py::arg("context").none(false), py::arg("hostSession").none(false),
            py::arg("successCallback"), py::arg("errorCallback"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("getWithRelationshipsMatrix", &ManagerInterface::getWithRelationshipsMatrix,
+           py::arg("entityReferences"), py::arg("relationshipTraitsDatas"),
+           py::arg("resultTraitSet"), py::arg("pageSize"), py::arg("relationsAccess"),
+           py::arg("context").none(false), py::arg("hostSession").none(false),
+           py::arg("successCallback"), py::arg("errorCallback"),
+           py::call_guard<py::gil_scoped_release>{})
       .def("preflight", &ManagerInterface::preflight, py::arg("entityReferences"),
            py::arg("traitsHints"), py::arg("publishingAccess"), py::arg("context").none(false),
            py::arg("hostSession").none(false), py::arg("successCallback"),
@@ -13,17 +13,34 @@
 void registerCppPluginSystem(const py::module_ &mod) {
   using openassetio::pluginSystem::CppPluginSystem;
 
-  // Only bother releasing the GIL for `scan`, since that's the only
-  // method that potentially calls out to virtual method(s). Tests will
-  // catch if this changes (e.g. if we add logger calls in the other
-  // methods).
+  // Only bother releasing the GIL for `scan` and `plugin`, since
+  // they're the only methods that potentially call out to virtual
+  // method(s) (`plugin` may lazily load a plugin registered from a
+  // manifest or the scan cache). Tests will catch if this changes
+  // (e.g. if we add logger calls in the other methods).
 
-  py::class_<CppPluginSystem, CppPluginSystem::Ptr>(mod, "CppPluginSystem")
+  py::class_<CppPluginSystem, CppPluginSystem::Ptr> cppPluginSystem(mod, "CppPluginSystem");
+
+  py::class_<CppPluginSystem::PluginManifest>(cppPluginSystem, "PluginManifest")
+      .def_readonly("identifier", &CppPluginSystem::PluginManifest::identifier)
+      .def_readonly("kind", &CppPluginSystem::PluginManifest::kind)
+      .def_readonly("displayName", &CppPluginSystem::PluginManifest::displayName)
+      .def_readonly("info", &CppPluginSystem::PluginManifest::info);
+
+  cppPluginSystem
+      .def_readonly_static("kManifestExtension", &CppPluginSystem::kManifestExtension)
       .def(py::init(RetainCommonPyArgs::forFn<&CppPluginSystem::make>()),
            py::arg("logger").none(false))
       .def("reset", &CppPluginSystem::reset)
       .def("scan", &CppPluginSystem::scan, py::arg("paths"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("enableParallelLoading", &CppPluginSystem::enableParallelLoading)
+      .def("disableParallelLoading", &CppPluginSystem::disableParallelLoading)
+      .def("isParallelLoadingEnabled", &CppPluginSystem::isParallelLoadingEnabled)
+      .def("setScanCachePath", &CppPluginSystem::setScanCachePath, py::arg("cachePath"))
+      .def("scanCachePath", &CppPluginSystem::scanCachePath)
       .def("identifiers", &CppPluginSystem::identifiers)
-      .def("plugin", &CppPluginSystem::plugin, py::arg("identifier"));
+      .def("plugin", &CppPluginSystem::plugin, py::arg("identifier"),
+           py::call_guard<py::gil_scoped_release>{})
+      .def("manifest", &CppPluginSystem::manifest, py::arg("identifier"));
 }
@@ -3,6 +3,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <optional>
+
+#include <openassetio/hostApi/ManagerFactory.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
@@ -31,6 +34,13 @@ struct PyCppPluginSystemManagerImplementationFactory
                                        CppPluginSystemManagerImplementationFactory, instantiate,
                                        identifier);
   }
+
+  [[nodiscard]] std::optional<hostApi::ManagerFactory::ManagerDetail> managerDetail(
+      const openassetio::Identifier& identifier) override {
+    OPENASSETIO_PYBIND11_OVERRIDE(std::optional<hostApi::ManagerFactory::ManagerDetail>,
+                                  CppPluginSystemManagerImplementationFactory, managerDetail,
+                                  identifier);
+  }
 };
 }  // namespace
 }  // namespace pluginSystem
@@ -59,5 +69,7 @@ void registerCppPluginSystemManagerImplementationFactory(const py::module_& mod)
       .def("identifiers", &CppPluginSystemManagerImplementationFactory::identifiers,
            py::call_guard<py::gil_scoped_release>{})
       .def("instantiate", &CppPluginSystemManagerImplementationFactory::instantiate,
+           py::arg("identifier"), py::call_guard<py::gil_scoped_release>{})
+      .def("managerDetail", &CppPluginSystemManagerImplementationFactory::managerDetail,
            py::arg("identifier"), py::call_guard<py::gil_scoped_release>{});
 }
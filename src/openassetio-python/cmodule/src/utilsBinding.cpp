@@ -21,7 +21,21 @@ void registerUtils(py::module_ &mod) {
       .def("pathToUrl", &utils::FileUrlPathConverter::pathToUrl, py::arg("absolutePath"),
            py::arg("pathType") = utils::PathType::kSystem)
       .def("pathFromUrl", &utils::FileUrlPathConverter::pathFromUrl, py::arg("fileUrl"),
+           py::arg("pathType") = utils::PathType::kSystem)
+      .def("pathsToUrls", &utils::FileUrlPathConverter::pathsToUrls, py::arg("absolutePaths"),
+           py::arg("pathType") = utils::PathType::kSystem)
+      .def("pathsFromUrls", &utils::FileUrlPathConverter::pathsFromUrls, py::arg("fileUrls"),
            py::arg("pathType") = utils::PathType::kSystem);
 
   mod.def("substitute", &utils::substitute, py::arg("input"), py::arg("substitutions"));
+
+  py::class_<utils::SubstitutionTemplate>(mod, "SubstitutionTemplate")
+      .def(py::init<std::string_view>(), py::arg("input"))
+      .def("input", &utils::SubstitutionTemplate::input)
+      .def("render",
+           py::overload_cast<const openassetio::InfoDictionary&>(
+               &utils::SubstitutionTemplate::render, py::const_),
+           py::arg("substitutions"))
+      .def("renderMany", &utils::SubstitutionTemplate::renderMany,
+           py::arg("substitutionsList"));
 }
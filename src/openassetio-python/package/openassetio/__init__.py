@@ -73,6 +73,7 @@ from ._openassetio import (
     constants,
     Context,
     EntityReference,
+    EntityReferenceInterner,
     majorVersion,
     minorVersion,
     patchVersion,
@@ -30,3 +30,10 @@ ManagerFactory = _openassetio.hostApi.ManagerFactory
 HostInterface = _openassetio.hostApi.HostInterface
 ManagerImplementationFactoryInterface = _openassetio.hostApi.ManagerImplementationFactoryInterface
 EntityReferencePager = _openassetio.hostApi.EntityReferencePager
+ResolvedBatch = _openassetio.hostApi.ResolvedBatch
+ResolveStream = _openassetio.hostApi.ResolveStream
+RelationshipTraverser = _openassetio.hostApi.RelationshipTraverser
+ResolveFuture = _openassetio.hostApi.ResolveFuture
+EntityExistsFuture = _openassetio.hostApi.EntityExistsFuture
+PublishFuture = _openassetio.hostApi.PublishFuture
+RelationshipQueryFuture = _openassetio.hostApi.RelationshipQueryFuture
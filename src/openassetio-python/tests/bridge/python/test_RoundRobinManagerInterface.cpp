@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+#include <openassetio/python/RoundRobinManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace {
+using openassetio::python::hostApi::RoundRobinManagerInterface;
+
+struct StubHostInterface : openassetio::hostApi::HostInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.test.host";
+  }
+  [[nodiscard]] openassetio::Str displayName() const override { return "Test Host"; }
+};
+
+struct StubLoggerInterface : openassetio::log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity,
+           [[maybe_unused]] const openassetio::Str& message) override {}
+};
+
+/// Manager counting calls made to it, and recording states it creates.
+struct CountingManagerInterface : openassetio::managerApi::ManagerInterface {
+  explicit CountingManagerInterface(openassetio::Identifier identifier_ =
+                                        "org.openassetio.test.manager")
+      : identifier_{std::move(identifier_)} {}
+
+  [[nodiscard]] openassetio::Identifier identifier() const override { return identifier_; }
+  [[nodiscard]] openassetio::Str displayName() const override { return "Counting"; }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return true;
+  }
+
+  void initialize([[maybe_unused]] openassetio::InfoDictionary managerSettings,
+                  [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession)
+      override {
+    ++initializeCount;
+  }
+
+  openassetio::managerApi::ManagerStateBasePtr createState(
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    return createdStates.emplace_back(
+        std::make_shared<openassetio::managerApi::ManagerStateBase>());
+  }
+
+  openassetio::managerApi::ManagerStateBasePtr createChildState(
+      const openassetio::managerApi::ManagerStateBasePtr& parentState,
+      const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    receivedStates.push_back(parentState);
+    return createState(hostSession);
+  }
+
+  openassetio::Str persistenceTokenForState(
+      const openassetio::managerApi::ManagerStateBasePtr& state,
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    receivedStates.push_back(state);
+    return "token";
+  }
+
+  [[nodiscard]] bool owns(const openassetio::managerApi::ManagerStateBasePtr& state) const {
+    return std::find(createdStates.begin(), createdStates.end(), state) != createdStates.end();
+  }
+
+  void entityExists(const openassetio::EntityReferences& entityReferences,
+                    const openassetio::ContextConstPtr& context,
+                    [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) override {
+    ++queryCount;
+    if (context->managerState && owns(context->managerState)) {
+      ++ownStateQueryCount;
+    }
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      successCallback(idx, true);
+    }
+  }
+
+  openassetio::Identifier identifier_;
+  std::atomic<std::size_t> initializeCount{0};
+  std::atomic<std::size_t> queryCount{0};
+  std::atomic<std::size_t> ownStateQueryCount{0};
+  std::vector<openassetio::managerApi::ManagerStateBasePtr> createdStates;
+  std::vector<openassetio::managerApi::ManagerStateBasePtr> receivedStates;
+};
+
+openassetio::managerApi::HostSessionPtr makeHostSession() {
+  return openassetio::managerApi::HostSession::make(
+      openassetio::managerApi::Host::make(std::make_shared<StubHostInterface>()),
+      std::make_shared<StubLoggerInterface>());
+}
+}  // namespace
+
+SCENARIO("RoundRobinManagerInterface construction") {
+  WHEN("constructed with no instances") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(RoundRobinManagerInterface::make({}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  WHEN("constructed with a null instance") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(RoundRobinManagerInterface::make(
+                          {std::make_shared<CountingManagerInterface>(), nullptr}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  WHEN("constructed with instances of different managers") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(RoundRobinManagerInterface::make(
+                          {std::make_shared<CountingManagerInterface>(),
+                           std::make_shared<CountingManagerInterface>("org.openassetio.other")}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("RoundRobinManagerInterface dispatch") {
+  GIVEN("a facade over three manager instances") {
+    constexpr std::size_t kNumInstances = 3;
+    std::vector<std::shared_ptr<CountingManagerInterface>> instances;
+    RoundRobinManagerInterface::ManagerInterfaces managerInterfaces;
+    for (std::size_t idx = 0; idx < kNumInstances; ++idx) {
+      instances.push_back(std::make_shared<CountingManagerInterface>());
+      managerInterfaces.push_back(instances.back());
+    }
+    const auto facade = RoundRobinManagerInterface::make(managerInterfaces);
+    const auto hostSession = makeHostSession();
+    const auto context = openassetio::Context::make();
+
+    THEN("introspection is forwarded to the first instance") {
+      CHECK(facade->identifier() == "org.openassetio.test.manager");
+      CHECK(facade->displayName() == "Counting");
+      CHECK(facade->instances() == managerInterfaces);
+    }
+
+    WHEN("the facade is initialized") {
+      facade->initialize({}, hostSession);
+
+      THEN("all instances are initialized") {
+        for (const auto& instance : instances) {
+          CHECK(instance->initializeCount == 1);
+        }
+      }
+    }
+
+    WHEN("queries are made") {
+      std::size_t successCount = 0;
+      for (std::size_t call = 0; call < 2 * kNumInstances; ++call) {
+        facade->entityExists(
+            {openassetio::EntityReference{"a"}, openassetio::EntityReference{"b"}}, context,
+            hostSession, [&](std::size_t, bool) { ++successCount; },
+            [](std::size_t, const openassetio::errors::BatchElementError&) { FAIL(); });
+      }
+
+      THEN("each whole batch is forwarded to each instance in turn") {
+        CHECK(successCount == 4 * kNumInstances);
+        for (const auto& instance : instances) {
+          CHECK(instance->queryCount == 2);
+        }
+      }
+    }
+
+    WHEN("queries are made concurrently") {
+      constexpr std::size_t kNumThreads = 2 * kNumInstances;
+      std::atomic<std::size_t> successCount{0};
+      {
+        std::vector<std::thread> threads;
+        for (std::size_t idx = 0; idx < kNumThreads; ++idx) {
+          threads.emplace_back([&] {
+            facade->entityExists(
+                {openassetio::EntityReference{"a"}}, context, hostSession,
+                [&](std::size_t, bool) { ++successCount; },
+                [](std::size_t, const openassetio::errors::BatchElementError&) {});
+          });
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      }
+
+      THEN("calls are distributed evenly across instances") {
+        CHECK(successCount == kNumThreads);
+        for (const auto& instance : instances) {
+          CHECK(instance->queryCount == 2);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("RoundRobinManagerInterface manager state") {
+  GIVEN("a facade over three manager instances") {
+    constexpr std::size_t kNumInstances = 3;
+    std::vector<std::shared_ptr<CountingManagerInterface>> instances;
+    RoundRobinManagerInterface::ManagerInterfaces managerInterfaces;
+    for (std::size_t idx = 0; idx < kNumInstances; ++idx) {
+      instances.push_back(std::make_shared<CountingManagerInterface>());
+      managerInterfaces.push_back(instances.back());
+    }
+    const auto facade = RoundRobinManagerInterface::make(managerInterfaces);
+    const auto hostSession = makeHostSession();
+
+    AND_GIVEN("a context holding a state created via the facade") {
+      // Advance the round-robin so the state isn't created by the
+      // first instance.
+      facade->entityExists({}, openassetio::Context::make(), hostSession,
+                           [](std::size_t, bool) {},
+                           [](std::size_t, const openassetio::errors::BatchElementError&) {});
+      const auto context = openassetio::Context::make(openassetio::trait::TraitsData::make(),
+                                                      facade->createState(hostSession));
+      const auto& creator = instances[1];
+      REQUIRE(creator->createdStates.size() == 1);
+
+      WHEN("queries are made using the context") {
+        for (std::size_t call = 0; call < 2 * kNumInstances; ++call) {
+          facade->entityExists({openassetio::EntityReference{"a"}}, context, hostSession,
+                               [](std::size_t, bool) {},
+                               [](std::size_t, const openassetio::errors::BatchElementError&) {
+                                 FAIL();
+                               });
+        }
+
+        THEN("all are forwarded to the creating instance with its own state") {
+          CHECK(creator->ownStateQueryCount == 2 * kNumInstances);
+          CHECK(instances[0]->queryCount == 1);
+          CHECK(instances[2]->queryCount == 0);
+        }
+      }
+
+      WHEN("a child state is created and used") {
+        const auto childState = facade->createChildState(context->managerState, hostSession);
+        const auto childContext =
+            openassetio::Context::make(openassetio::trait::TraitsData::make(), childState);
+        facade->entityExists({openassetio::EntityReference{"a"}}, childContext, hostSession,
+                             [](std::size_t, bool) {},
+                             [](std::size_t, const openassetio::errors::BatchElementError&) {});
+
+        THEN("the creating instance creates and receives the child state") {
+          REQUIRE(creator->receivedStates.size() == 1);
+          CHECK(creator->receivedStates[0] == creator->createdStates[0]);
+          CHECK(creator->createdStates.size() == 2);
+          CHECK(creator->ownStateQueryCount == 1);
+        }
+      }
+
+      WHEN("a persistence token is requested for the state") {
+        CHECK(facade->persistenceTokenForState(context->managerState, hostSession) == "token");
+
+        THEN("the creating instance receives its own state") {
+          REQUIRE(creator->receivedStates.size() == 1);
+          CHECK(creator->receivedStates[0] == creator->createdStates[0]);
+        }
+      }
+    }
+  }
+}
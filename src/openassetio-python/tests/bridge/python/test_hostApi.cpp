@@ -1,5 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2024 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
 
 #include <pybind11/gil.h>
 #include <catch2/catch.hpp>
@@ -7,6 +13,7 @@
 
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/python/hostApi.hpp>
 
 namespace {
@@ -14,6 +21,32 @@ struct MockLogger : trompeloeil::mock_interface<openassetio::log::LoggerInterfac
   IMPLEMENT_MOCK2(log);
 };
 using trompeloeil::_;
+
+struct StubManagerInterface : openassetio::managerApi::ManagerInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.test.manager";
+  }
+  [[nodiscard]] openassetio::Str displayName() const override { return "Stub"; }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return false;
+  }
+};
+
+/// Factory counting the number of instances it has created.
+struct CountingManagerImplementationFactory
+    : openassetio::hostApi::ManagerImplementationFactoryInterface {
+  using ManagerImplementationFactoryInterface::ManagerImplementationFactoryInterface;
+
+  openassetio::Identifiers identifiers() override { return {"org.openassetio.test.manager"}; }
+
+  openassetio::managerApi::ManagerInterfacePtr instantiate(
+      [[maybe_unused]] const openassetio::Identifier& identifier) override {
+    ++instantiateCount;
+    return std::make_shared<StubManagerInterface>();
+  }
+
+  std::atomic<std::size_t> instantiateCount{0};
+};
 }  // namespace
 
 SCENARIO("Accessing the Python plugin system from C++") {
@@ -43,3 +76,80 @@ SCENARIO("Accessing the Python plugin system from C++") {
     }
   }
 }
+
+SCENARIO("Pooling manager instantiation") {
+  using openassetio::python::hostApi::PooledManagerImplementationFactory;
+
+  GIVEN("a pooled factory with a pool of two managers") {
+    const openassetio::log::LoggerInterfacePtr logger = std::make_shared<MockLogger>();
+    const auto factory = std::make_shared<CountingManagerImplementationFactory>(logger);
+    const openassetio::Identifier identifier = "org.openassetio.test.manager";
+
+    const auto pooled =
+        PooledManagerImplementationFactory::make(factory, {{identifier, 2}}, logger);
+
+    THEN("managers are instantiated up front") {
+      CHECK(factory->instantiateCount == 2);
+      CHECK(pooled->available(identifier) == 2);
+      CHECK(pooled->available("org.openassetio.test.unknown") == 0);
+    }
+
+    THEN("identifiers are those of the wrapped factory") {
+      CHECK(pooled->identifiers() == factory->identifiers());
+    }
+
+    WHEN("more managers are instantiated than are in the pool") {
+      const auto first = pooled->instantiate(identifier);
+      const auto second = pooled->instantiate(identifier);
+
+      THEN("pooled managers are handed out first") {
+        CHECK(first);
+        CHECK(second);
+        CHECK(first != second);
+        CHECK(factory->instantiateCount == 2);
+        CHECK(pooled->available(identifier) == 0);
+      }
+
+      AND_WHEN("the pool is exhausted") {
+        const auto third = pooled->instantiate(identifier);
+
+        THEN("the wrapped factory is used") {
+          CHECK(third);
+          CHECK(factory->instantiateCount == 3);
+          CHECK(pooled->available(identifier) == 0);
+        }
+      }
+    }
+  }
+
+  GIVEN("a pooled factory with a pool of managers for each of several threads") {
+    constexpr std::size_t kNumThreads = 8;
+    const openassetio::log::LoggerInterfacePtr logger = std::make_shared<MockLogger>();
+    const auto factory = std::make_shared<CountingManagerImplementationFactory>(logger);
+    const openassetio::Identifier identifier = "org.openassetio.test.manager";
+
+    const auto pooled =
+        PooledManagerImplementationFactory::make(factory, {{identifier, kNumThreads}}, logger);
+
+    WHEN("each thread instantiates a manager concurrently") {
+      std::vector<openassetio::managerApi::ManagerInterfacePtr> managers(kNumThreads);
+      {
+        std::vector<std::thread> threads;
+        for (std::size_t idx = 0; idx < kNumThreads; ++idx) {
+          threads.emplace_back([&, idx] { managers[idx] = pooled->instantiate(identifier); });
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      }
+
+      THEN("each thread receives a distinct pooled manager") {
+        const std::set<openassetio::managerApi::ManagerInterfacePtr> unique{managers.begin(),
+                                                                            managers.end()};
+        CHECK(unique.size() == kNumThreads);
+        CHECK(unique.count(nullptr) == 0);
+        CHECK(factory->instantiateCount == kNumThreads);
+      }
+    }
+  }
+}
@@ -18,6 +18,7 @@ Testing that ManagerFactory/CppPluginSystemPlugin
 methods release the GIL.
 """
 import os
+import pathlib
 import sysconfig
 
 # pylint: disable=redefined-outer-name,protected-access
@@ -128,11 +129,50 @@ class Test_CppPluginSystem_gil:
         the_cpp_gil_check_plugin_identifier,
         the_cpp_gil_check_plugin_path,
         a_cpp_plugin_system,
+        a_threaded_logger_interface,
+        tmp_path,
     ):
         a_cpp_plugin_system.scan(the_cpp_gil_check_plugin_path)
 
         _path, _plugin = a_cpp_plugin_system.plugin(the_cpp_gil_check_plugin_identifier)
 
+        # Plugin registered from the scan cache, so lazily loaded.
+        cache_path = tmp_path / "scan.cache"
+        a_cpp_plugin_system.reset()
+        a_cpp_plugin_system.setScanCachePath(cache_path)
+        a_cpp_plugin_system.scan(the_cpp_gil_check_plugin_path)
+        cached_plugin_system = CppPluginSystem(a_threaded_logger_interface)
+        cached_plugin_system.setScanCachePath(cache_path)
+        cached_plugin_system.scan(the_cpp_gil_check_plugin_path)
+
+        _path, _plugin = cached_plugin_system.plugin(the_cpp_gil_check_plugin_identifier)
+
+    def test_enableParallelLoading(self, the_cpp_gil_check_plugin_path, a_cpp_plugin_system):
+        a_cpp_plugin_system.enableParallelLoading()
+        a_cpp_plugin_system.scan(the_cpp_gil_check_plugin_path)
+
+    def test_disableParallelLoading(self, a_cpp_plugin_system):
+        a_cpp_plugin_system.disableParallelLoading()
+
+    def test_isParallelLoadingEnabled(self, a_cpp_plugin_system):
+        assert a_cpp_plugin_system.isParallelLoadingEnabled() is False
+
+    def test_setScanCachePath(self, a_cpp_plugin_system, tmp_path):
+        a_cpp_plugin_system.setScanCachePath(tmp_path / "scan.cache")
+
+    def test_scanCachePath(self, a_cpp_plugin_system):
+        assert a_cpp_plugin_system.scanCachePath() == pathlib.Path()
+
+    def test_manifest(
+        self,
+        the_cpp_gil_check_plugin_identifier,
+        the_cpp_gil_check_plugin_path,
+        a_cpp_plugin_system,
+    ):
+        a_cpp_plugin_system.scan(the_cpp_gil_check_plugin_path)
+
+        assert a_cpp_plugin_system.manifest(the_cpp_gil_check_plugin_identifier) is None
+
 
 class Test_CppPluginSystemManagerImplementationFactory_gil:
     """
@@ -183,6 +223,13 @@ class Test_CppPluginSystemManagerImplementationFactory_gil:
         # Confidence check.
         assert isinstance(manager_interface, ManagerInterface)
 
+    def test_managerDetail(
+        self,
+        the_cpp_gil_check_plugin_identifier,
+        a_cpp_plugin_impl_factory,
+    ):
+        assert a_cpp_plugin_impl_factory.managerDetail(the_cpp_gil_check_plugin_identifier) is None
+
 
 @pytest.fixture
 def a_cpp_plugin_system(a_threaded_logger_interface):
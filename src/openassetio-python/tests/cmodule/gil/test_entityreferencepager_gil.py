@@ -118,6 +118,22 @@ class Test_EntityReferencePager_gil:
     def test_next(self, a_threaded_entity_ref_pager):
         a_threaded_entity_ref_pager.next()
 
+    def test_drainAll(self, a_threaded_entity_ref_pager, mock_entity_reference_pager_interface):
+        mock_entity_reference_pager_interface.mock.get.return_value = []
+        mock_entity_reference_pager_interface.mock.hasNext.return_value = False
+        a_threaded_entity_ref_pager.drainAll()
+
+    def test_enablePrefetch(
+        self, a_threaded_entity_ref_pager, mock_entity_reference_pager_interface
+    ):
+        mock_entity_reference_pager_interface.mock.get.return_value = []
+        mock_entity_reference_pager_interface.mock.hasNext.return_value = False
+        a_threaded_entity_ref_pager.enablePrefetch()
+        a_threaded_entity_ref_pager.get()
+
+    def test_isPrefetchEnabled(self, a_threaded_entity_ref_pager):
+        a_threaded_entity_ref_pager.isPrefetchEnabled()
+
 
 @pytest.fixture
 def a_threaded_entity_ref_pager(a_threaded_entity_ref_pager_interface, a_host_session):
@@ -63,6 +63,9 @@ class Test_Manager_gil:
 
         assert unimplemented == []
 
+    def test_areEntityReferenceStrings(self, a_threaded_manager):
+        a_threaded_manager.areEntityReferenceStrings([""])
+
     def test_contextFromPersistenceToken(
         self, mock_manager_interface, a_context, a_threaded_manager
     ):
@@ -84,6 +87,9 @@ class Test_Manager_gil:
     def test_createEntityReferenceIfValid(self, a_threaded_manager):
         a_threaded_manager.createEntityReferenceIfValid("")
 
+    def test_createEntityReferences(self, a_threaded_manager):
+        a_threaded_manager.createEntityReferences([""], fail)
+
     def test_persistenceTokenForContext(self, a_threaded_manager, a_context):
         a_threaded_manager.persistenceTokenForContext(a_context)
 
@@ -100,15 +106,22 @@ class Test_Manager_gil:
             fail,
         )
 
+    def test_disableParallelDispatch(self, a_threaded_manager):
+        a_threaded_manager.disableParallelDispatch()
+
     def test_displayName(self, mock_manager_interface, a_threaded_manager):
         mock_manager_interface.mock.displayName.return_value = "My Name"
         assert a_threaded_manager.displayName() == "My Name"
 
+    def test_enableParallelDispatch(self, a_threaded_manager):
+        a_threaded_manager.enableParallelDispatch()
+
     def test_entityExists(self, a_threaded_manager, a_context, an_entity_reference):
         ref = an_entity_reference
         tag = Manager.BatchElementErrorPolicyTag
 
         a_threaded_manager.entityExists([], a_context, fail, fail)
+        a_threaded_manager.entityExists([], a_context, fail, fail, bufferCallbacks=True)
         a_threaded_manager.entityExists(ref, a_context)
         a_threaded_manager.entityExists(ref, a_context, tag.kException)
         a_threaded_manager.entityExists(ref, a_context, tag.kVariant)
@@ -116,6 +129,12 @@ class Test_Manager_gil:
         a_threaded_manager.entityExists([], a_context, tag.kException)
         a_threaded_manager.entityExists([], a_context, tag.kVariant)
 
+    def test_entityExistsAsync(self, a_threaded_manager, a_context, an_entity_reference):
+        a_threaded_manager.entityExistsAsync([an_entity_reference], a_context).get()
+
+    def test_entityExistsView(self, a_threaded_manager, a_context):
+        a_threaded_manager.entityExistsView([], a_context)
+
     def test_entityTraits(self, a_threaded_manager, a_context, an_entity_reference):
         ref = an_entity_reference
         an_access = access.EntityTraitsAccess.kRead
@@ -175,6 +194,13 @@ class Test_Manager_gil:
             [], a_traits_data, 1, access.RelationsAccess.kRead, a_context, set(), tag.kException
         )
 
+    def test_getWithRelationshipAsync(
+        self, a_threaded_manager, an_entity_reference, a_traits_data, a_context
+    ):
+        a_threaded_manager.getWithRelationshipAsync(
+            [an_entity_reference], a_traits_data, 1, access.RelationsAccess.kRead, a_context
+        ).get()
+
     def test_getWithRelationships(self, a_threaded_manager, an_entity_reference, a_context):
         a_threaded_manager.getWithRelationships(
             an_entity_reference,
@@ -210,6 +236,48 @@ class Test_Manager_gil:
             tag.kException,
         )
 
+    def test_getWithRelationshipsMatrix(self, a_threaded_manager, an_entity_reference, a_context):
+        a_threaded_manager.getWithRelationshipsMatrix(
+            [an_entity_reference],
+            [],
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            fail,
+            fail,
+        )
+
+        tag = Manager.BatchElementErrorPolicyTag
+
+        a_threaded_manager.getWithRelationshipsMatrix(
+            [an_entity_reference],
+            [],
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            set(),
+        )
+
+        a_threaded_manager.getWithRelationshipsMatrix(
+            [an_entity_reference],
+            [],
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            set(),
+            tag.kVariant,
+        )
+
+        a_threaded_manager.getWithRelationshipsMatrix(
+            [an_entity_reference],
+            [],
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            set(),
+            tag.kException,
+        )
+
     def test_hasCapability(self, a_threaded_manager):
         a_threaded_manager.hasCapability(Manager.Capability.kExistenceQueries)
 
@@ -226,6 +294,9 @@ class Test_Manager_gil:
     def test_isEntityReferenceString(self, a_threaded_manager):
         a_threaded_manager.isEntityReferenceString("")
 
+    def test_isParallelDispatchEnabled(self, a_threaded_manager):
+        a_threaded_manager.isParallelDispatchEnabled()
+
     def test_managementPolicy(self, a_threaded_manager, a_context):
         a_threaded_manager.managementPolicy([], access.PolicyAccess.kRead, a_context)
 
@@ -242,6 +313,13 @@ class Test_Manager_gil:
         a_threaded_manager.preflight([], [], an_access, a_context, tag.kException)
         a_threaded_manager.preflight([], [], an_access, a_context, tag.kVariant)
 
+    def test_preflightAsync(
+        self, a_threaded_manager, an_entity_reference, a_traits_data, a_context
+    ):
+        a_threaded_manager.preflightAsync(
+            [an_entity_reference], [a_traits_data], access.PublishingAccess.kWrite, a_context
+        ).get()
+
     def test_register(self, a_threaded_manager, an_entity_reference, a_traits_data, a_context):
         an_access = access.PublishingAccess.kWrite
         tag = Manager.BatchElementErrorPolicyTag
@@ -255,6 +333,13 @@ class Test_Manager_gil:
         a_threaded_manager.register([], [], an_access, a_context, tag.kException)
         a_threaded_manager.register([], [], an_access, a_context, tag.kVariant)
 
+    def test_registerAsync(
+        self, a_threaded_manager, an_entity_reference, a_traits_data, a_context
+    ):
+        a_threaded_manager.registerAsync(
+            [an_entity_reference], [a_traits_data], access.PublishingAccess.kWrite, a_context
+        ).get()
+
     def test_resolve(self, a_threaded_manager, an_entity_reference, a_context):
         an_access = access.ResolveAccess.kRead
         tag = Manager.BatchElementErrorPolicyTag
@@ -265,6 +350,9 @@ class Test_Manager_gil:
         assert "Overloaded" in a_threaded_manager.resolve.__doc__
 
         a_threaded_manager.resolve([], set(), an_access, a_context, fail, fail)
+        a_threaded_manager.resolve(
+            [], set(), an_access, a_context, fail, fail, bufferCallbacks=True
+        )
         a_threaded_manager.resolve(ref, set(), an_access, a_context)
         a_threaded_manager.resolve(ref, set(), an_access, a_context, tag.kException)
         a_threaded_manager.resolve(ref, set(), an_access, a_context, tag.kVariant)
@@ -272,6 +360,23 @@ class Test_Manager_gil:
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kException)
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kVariant)
 
+    def test_resolveAsync(self, a_threaded_manager, an_entity_reference, a_context):
+        a_threaded_manager.resolveAsync(
+            [an_entity_reference], set(), access.ResolveAccess.kRead, a_context
+        ).get()
+
+    def test_resolveColumns(self, a_threaded_manager, an_entity_reference, a_context):
+        a_threaded_manager.resolveColumns(
+            [an_entity_reference], [], access.ResolveAccess.kRead, a_context
+        )
+
+    def test_resolveStream(self, a_threaded_manager, an_entity_reference, a_context):
+        list(
+            a_threaded_manager.resolveStream(
+                [an_entity_reference], set(), access.ResolveAccess.kRead, a_context
+            )
+        )
+
     def test_settings(self, mock_manager_interface, a_threaded_manager):
         mock_manager_interface.mock.settings.return_value = {}
         a_threaded_manager.settings()
@@ -69,6 +69,10 @@ class Test_ManagerImplementationFactoryInterface_gil:
         mock_manager_impl_factory.mock.instantiate.return_value = mock_manager_interface
         a_threaded_manager_impl_factory.instantiate("")
 
+    def test_managerDetail(self, a_threaded_manager_impl_factory, mock_manager_impl_factory):
+        mock_manager_impl_factory.mock.managerDetail.return_value = None
+        a_threaded_manager_impl_factory.managerDetail("")
+
 
 class Test_ManagerFactory_gil:
     """
@@ -235,3 +239,6 @@ class MockManagerImplFactoryInterface(ManagerImplementationFactoryInterface):
 
     def instantiate(self, identifier):
         return self.mock.instantiate(identifier)
+
+    def managerDetail(self, identifier):
+        return self.mock.managerDetail(identifier)
@@ -82,6 +82,9 @@ class Test_ManagerInterface_gil:
 
         assert unimplemented == []
 
+    def test_areEntityReferenceStrings(self, a_threaded_mock_manager_interface, a_host_session):
+        a_threaded_mock_manager_interface.areEntityReferenceStrings([""], a_host_session)
+
     def test_createChildState(
         self, mock_manager_interface, a_threaded_mock_manager_interface, a_host_session
     ):
@@ -152,6 +155,21 @@ class Test_ManagerInterface_gil:
             fail,
         )
 
+    def test_getWithRelationshipsMatrix(
+        self, a_threaded_mock_manager_interface, an_entity_reference, a_context, a_host_session
+    ):
+        a_threaded_mock_manager_interface.getWithRelationshipsMatrix(
+            [an_entity_reference],
+            [],
+            set(),
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            a_host_session,
+            fail,
+            fail,
+        )
+
     def test_hasCapability(self, a_threaded_mock_manager_interface):
         a_threaded_mock_manager_interface.hasCapability(
             ManagerInterface.Capability.kManagementPolicyQueries
@@ -104,12 +104,14 @@ struct ThreadedManagerInterface : managerApi::ManagerInterface {
   IMPLEMENT_MOCK2(persistenceTokenForState);
   IMPLEMENT_MOCK2(stateFromPersistenceToken);
   IMPLEMENT_MOCK2(isEntityReferenceString);
+  IMPLEMENT_MOCK2(areEntityReferenceStrings);
   IMPLEMENT_MOCK5(entityExists);
   IMPLEMENT_MOCK6(entityTraits);
   IMPLEMENT_MOCK7(resolve);
   IMPLEMENT_MOCK6(defaultEntityReference);
   IMPLEMENT_MOCK9(getWithRelationship);
   IMPLEMENT_MOCK9(getWithRelationships);
+  IMPLEMENT_MOCK9(getWithRelationshipsMatrix);
   IMPLEMENT_MOCK7(preflight);
   IMPLEMENT_MOCK7(register_);
 };
@@ -167,6 +169,7 @@ struct ThreadedManagerImplFactory : hostApi::ManagerImplementationFactoryInterfa
 
   IMPLEMENT_MOCK0(identifiers);
   IMPLEMENT_MOCK1(instantiate);
+  IMPLEMENT_MOCK1(managerDetail);
 };
 
 namespace pluginSystem = openassetio::pluginSystem;
@@ -19,14 +19,18 @@ Tests that cover the openassetio.hostApi.EntityReferencePager wrapper class.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import threading
 import weakref
 
 import pytest
 
-from openassetio import EntityReference
-from openassetio.hostApi import EntityReferencePager
+from openassetio import Context, EntityReference
+from openassetio.access import RelationsAccess
+from openassetio.errors import InputValidationException
+from openassetio.hostApi import EntityReferencePager, Manager
 from openassetio.log import LoggerInterface
 from openassetio.managerApi import EntityReferencePagerInterface
+from openassetio.trait import TraitsData
 
 
 class Test_EntityReferencePager_init:
@@ -94,6 +98,93 @@ class Test_EntityReferencePager_get:
         method.assert_called_once_with(a_host_session)
 
 
+class Test_EntityReferencePager_drainAll:
+    def test_returns_all_remaining_pages_and_advances_beyond_last_page(self, a_host_session):
+        pager = EntityReferencePager(
+            FakeMultiPageEntityReferencePagerInterface(num_pages=3), a_host_session
+        )
+
+        assert pager.drainAll() == [
+            EntityReference("page 0"),
+            EntityReference("page 1"),
+            EntityReference("page 2"),
+        ]
+        assert pager.hasNext() is False
+        assert pager.get() == []
+
+    def test_when_size_hint_given_then_same_result(self, a_host_session):
+        pager = EntityReferencePager(
+            FakeMultiPageEntityReferencePagerInterface(num_pages=2), a_host_session
+        )
+
+        assert pager.drainAll(sizeHint=10) == [
+            EntityReference("page 0"),
+            EntityReference("page 1"),
+        ]
+
+
+class Test_EntityReferencePager_enablePrefetch:
+    def test_default_depth(self):
+        assert EntityReferencePager.kDefaultPrefetchDepth == 2
+
+    def test_when_not_enabled_then_isPrefetchEnabled_is_false(self, an_entity_reference_pager):
+        assert an_entity_reference_pager.isPrefetchEnabled() is False
+
+    def test_when_enabled_then_pages_are_returned_in_order(self, a_host_session):
+        pager = EntityReferencePager(
+            FakeMultiPageEntityReferencePagerInterface(num_pages=5), a_host_session
+        )
+        pager.enablePrefetch(depth=1)
+
+        assert pager.isPrefetchEnabled() is True
+
+        pages = [pager.get()]
+        while pager.hasNext():
+            pager.next()
+            pages.append(pager.get())
+
+        assert pages == [[EntityReference(f"page {idx}")] for idx in range(5)]
+
+    def test_when_depth_is_zero_then_raises_InputValidationException(
+        self, an_entity_reference_pager
+    ):
+        with pytest.raises(
+            InputValidationException, match="Prefetch depth must be greater than zero."
+        ):
+            an_entity_reference_pager.enablePrefetch(0)
+
+    def test_when_already_enabled_then_raises_InputValidationException(self, a_host_session):
+        pager = EntityReferencePager(
+            FakeMultiPageEntityReferencePagerInterface(num_pages=1), a_host_session
+        )
+        pager.enablePrefetch()
+
+        with pytest.raises(InputValidationException, match="Prefetch is already enabled."):
+            pager.enablePrefetch()
+
+
+class FakeMultiPageEntityReferencePagerInterface(EntityReferencePagerInterface):
+    """
+    Pager interface over a number of single-element pages.
+    """
+
+    def __init__(self, num_pages):
+        EntityReferencePagerInterface.__init__(self)
+        self.__num_pages = num_pages
+        self.__current_page = 0
+
+    def hasNext(self, _hostSession):
+        return self.__current_page + 1 < self.__num_pages
+
+    def get(self, _hostSession):
+        if self.__current_page >= self.__num_pages:
+            return []
+        return [EntityReference(f"page {self.__current_page}")]
+
+    def next(self, _hostSession):
+        self.__current_page += 1
+
+
 class FakeEntityReferencePagerInterface(EntityReferencePagerInterface):
     """
     Throwaway pager interface def, so we can create a temporary
@@ -115,6 +206,34 @@ class FakeEntityReferencePagerInterface(EntityReferencePagerInterface):
         pass
 
 
+class SlowEntityReferencePagerInterface(EntityReferencePagerInterface):
+    """
+    Pager interface with an infinite number of pages, each of which
+    takes a while to fetch.
+    """
+
+    def __init__(self):
+        EntityReferencePagerInterface.__init__(self)
+        self.get_entered = threading.Event()
+        self.get_exited = threading.Event()
+        self.close_count = 0
+
+    def hasNext(self, _hostSession):
+        return True
+
+    def get(self, _hostSession):
+        self.get_entered.set()
+        threading.Event().wait(timeout=0.1)
+        self.get_exited.set()
+        return [EntityReference("page")]
+
+    def next(self, _hostSession):
+        pass
+
+    def close(self, _hostSession):
+        self.close_count += 1
+
+
 class Test_EntityReferencePager_destruction:
     def test_when_EntityReferencePager_holding_interface_loses_scope_then_scope_is_destructed(
         self, a_host_session
@@ -165,6 +284,49 @@ class Test_EntityReferencePager_destruction:
         assert LoggerInterface.Severity.kError == args[0]
         assert exception_what in args[1]
 
+    def test_when_prefetching_EntityReferencePager_destructed_mid_fetch_then_waits_and_closes(
+        self, a_host_session
+    ):
+        pager_interface = SlowEntityReferencePagerInterface()
+        pager = EntityReferencePager(pager_interface, a_host_session)
+        pager.enablePrefetch()
+        assert pager_interface.get_entered.wait(timeout=10)
+
+        # Must not deadlock, despite the background thread requiring
+        # the GIL to complete its call to `get`.
+        del pager
+
+        assert pager_interface.get_exited.is_set()
+        assert pager_interface.close_count == 1
+
+    def test_when_prefetching_EntityReferencePager_last_held_by_future_then_waits_and_closes(
+        self, a_host_session, mock_manager_interface
+    ):
+        pager_interface = SlowEntityReferencePagerInterface()
+
+        def get_with_relationship(*args):
+            success_callback = args[-2]
+            success_callback(0, pager_interface)
+
+        mock_manager_interface.mock.getWithRelationship.side_effect = get_with_relationship
+        manager = Manager(mock_manager_interface, a_host_session)
+
+        future = manager.getWithRelationshipAsync(
+            [EntityReference("a")], TraitsData(), 1, RelationsAccess.kRead, Context()
+        )
+        pager = future.element(0)
+        pager.enablePrefetch()
+        assert pager_interface.get_entered.wait(timeout=10)
+
+        # The last reference to the pager is released by the future,
+        # whose deallocation must not deadlock, despite the background
+        # thread requiring the GIL to complete its call to `get`.
+        del pager
+        del future
+
+        assert pager_interface.get_exited.is_set()
+        assert pager_interface.close_count == 1
+
 
 @pytest.fixture
 def an_entity_reference_pager(mock_entity_reference_pager_interface, a_host_session):
@@ -17,6 +17,9 @@
 Tests that cover the openassetio.hostApi.Manager wrapper class.
 """
 import itertools
+import subprocess
+import sys
+import textwrap
 from typing import Callable, Any
 
 # pylint: disable=invalid-name,redefined-outer-name,unused-argument
@@ -31,6 +34,7 @@ import pytest
 from openassetio import (
     Context,
     EntityReference,
+    EntityReferenceInterner,
     managerApi,
     constants,
     access,
@@ -42,7 +46,7 @@ from openassetio.errors import (
     InputValidationException,
     ConfigurationException,
 )
-from openassetio.hostApi import Manager, EntityReferencePager
+from openassetio.hostApi import Manager, EntityReferencePager, ResolvedBatch
 from openassetio.managerApi import EntityReferencePagerInterface, ManagerInterface
 from openassetio.trait import TraitsData
 
@@ -735,6 +739,20 @@ class Test_Manager_initialize:
             " than call the manager's implementation.",
         )
 
+    def test_when_entity_ref_prefixes_type_invalid_then_warning_printed(
+        self, manager, mock_manager_interface, mock_logger
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefixes: 123
+        }
+
+        manager.initialize({})
+
+        mock_logger.mock.log.assert_called_once_with(
+            mock_logger.Severity.kWarning,
+            "Entity reference prefixes given but is an invalid type: should be a string.",
+        )
+
     def test_when_entity_ref_prefix_type_invalid_then_debug_log_printed(
         self, manager, mock_manager_interface, mock_logger
     ):
@@ -807,6 +825,251 @@ class Test_Manager_initialize_capablility_check:
             manager.initialize({})
 
 
+class Test_Manager_parallelDispatch:
+    def test_when_not_enabled_then_reports_disabled(self, manager):
+        assert manager.isParallelDispatchEnabled() is False
+
+    def test_when_enabled_then_reports_enabled(self, manager):
+        manager.enableParallelDispatch()
+        assert manager.isParallelDispatchEnabled() is True
+
+    def test_when_disabled_after_enabling_then_reports_disabled(self, manager):
+        manager.enableParallelDispatch()
+        manager.disableParallelDispatch()
+        assert manager.isParallelDispatchEnabled() is False
+
+    def test_when_min_shard_size_zero_then_raises(self, manager):
+        with pytest.raises(InputValidationException):
+            manager.enableParallelDispatch(4, 0)
+
+    @pytest.mark.parametrize("is_thread_safe", (True, False))
+    def test_batch_split_only_when_manager_declares_thread_safety(
+        self, manager, mock_manager_interface, a_context, is_thread_safe
+    ):
+        mock_manager_interface.mock.hasCapability.return_value = True
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_IsThreadSafe: is_thread_safe
+        }
+        manager.initialize({})
+        manager.enableParallelDispatch(maxShards=2, minShardSize=5)
+        refs = [EntityReference(f"asset://{idx}") for idx in range(10)]
+
+        def resolve_each_to_its_ref(
+            entity_refs, _trait_set, _access, _context, _host_session, success_cb, _error_cb
+        ):
+            for idx, ref in enumerate(entity_refs):
+                traits_data = TraitsData()
+                traits_data.setTraitProperty("aTrait", "ref", ref.toString())
+                success_cb(idx, traits_data)
+
+        mock_manager_interface.mock.resolve.side_effect = resolve_each_to_its_ref
+
+        results = {}
+        manager.resolve(
+            refs,
+            {"aTrait"},
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda idx, traits_data: results.update(
+                {idx: traits_data.getTraitProperty("aTrait", "ref")}
+            ),
+            lambda _idx, _error: pytest.fail("Unexpected error"),
+        )
+
+        batch_sizes = sorted(
+            len(call.args[0]) for call in mock_manager_interface.mock.resolve.call_args_list
+        )
+        assert batch_sizes == ([5, 5] if is_thread_safe else [10])
+        assert results == {idx: ref.toString() for idx, ref in enumerate(refs)}
+
+
+class Test_Manager_async:
+    def test_resolveAsync_returns_future_holding_per_element_results(
+        self, manager, mock_manager_interface, a_context, a_batch_element_error
+    ):
+        refs = [EntityReference("asset://a"), EntityReference("asset://b")]
+        a_traits_data = TraitsData({"aTrait"})
+
+        def resolve(
+            _entity_refs, _trait_set, _access, _context, _host_session, success_cb, error_cb
+        ):
+            success_cb(0, a_traits_data)
+            error_cb(1, a_batch_element_error)
+
+        mock_manager_interface.mock.resolve.side_effect = resolve
+
+        future = manager.resolveAsync(refs, {"aTrait"}, access.ResolveAccess.kRead, a_context)
+        results = future.get()
+
+        assert future.isReady() is True
+        assert future.size() == 2
+        assert future.numCompleted() == 2
+        assert results[0] == a_traits_data
+        assert results[1] == a_batch_element_error
+        assert future.element(1) == a_batch_element_error
+        mock_manager_interface.mock.resolve.assert_called_once()
+
+    def test_entityExistsAsync_when_manager_raises_then_get_raises(
+        self, manager, mock_manager_interface, a_context
+    ):
+        mock_manager_interface.mock.entityExists.side_effect = RuntimeError("Oops")
+
+        future = manager.entityExistsAsync([EntityReference("asset://a")], a_context)
+
+        with pytest.raises(RuntimeError, match="Oops"):
+            future.get()
+
+    def test_registerAsync_when_traits_data_is_None_then_raises(self, manager, a_context):
+        with pytest.raises(InputValidationException):
+            manager.registerAsync(
+                [EntityReference("asset://a")], [None], access.PublishingAccess.kWrite, a_context
+            )
+
+    def test_resolveStream_yields_index_and_result_for_each_element(
+        self, manager, mock_manager_interface, a_context, a_batch_element_error
+    ):
+        refs = [EntityReference("asset://a"), EntityReference("asset://b")]
+        a_traits_data = TraitsData({"aTrait"})
+
+        def resolve(
+            _entity_refs, _trait_set, _access, _context, _host_session, success_cb, error_cb
+        ):
+            error_cb(1, a_batch_element_error)
+            success_cb(0, a_traits_data)
+
+        mock_manager_interface.mock.resolve.side_effect = resolve
+
+        stream = manager.resolveStream(
+            refs, {"aTrait"}, access.ResolveAccess.kRead, a_context, maxQueueSize=1
+        )
+
+        assert stream.size() == 2
+        assert stream.maxQueueSize() == 1
+        assert list(stream) == [(1, a_batch_element_error), (0, a_traits_data)]
+
+    def test_resolveStream_when_destroyed_before_exhausted_then_waits_for_manager(
+        self, manager, mock_manager_interface, a_context
+    ):
+        refs = [EntityReference(f"asset://{idx}") for idx in range(10)]
+        call_returned = False
+
+        def resolve(
+            _entity_refs, _trait_set, _access, _context, _host_session, success_cb, _error_cb
+        ):
+            nonlocal call_returned
+            try:
+                for idx in range(len(refs)):
+                    success_cb(idx, TraitsData())
+            finally:
+                call_returned = True
+
+        mock_manager_interface.mock.resolve.side_effect = resolve
+
+        stream = manager.resolveStream(
+            refs, {"aTrait"}, access.ResolveAccess.kRead, a_context, maxQueueSize=1
+        )
+        next(stream)
+        # Must not deadlock on the background thread, which requires
+        # the GIL to call the Python manager.
+        del stream
+
+        assert call_returned is True
+
+    def test_resolveStream_when_manager_provides_invalid_index_then_raises(
+        self, manager, mock_manager_interface, a_context
+    ):
+        def resolve(
+            _entity_refs, _trait_set, _access, _context, _host_session, success_cb, _error_cb
+        ):
+            success_cb(1, TraitsData())
+
+        mock_manager_interface.mock.resolve.side_effect = resolve
+
+        stream = manager.resolveStream(
+            [EntityReference("asset://a")], {"aTrait"}, access.ResolveAccess.kRead, a_context
+        )
+
+        with pytest.raises(
+            InputValidationException,
+            match="Manager provided index 1 out of range for batch of size 1.",
+        ):
+            list(stream)
+
+    def test_resolveStream_when_queue_size_zero_then_raises(self, manager, a_context):
+        with pytest.raises(InputValidationException):
+            manager.resolveStream(
+                [EntityReference("asset://a")],
+                {"aTrait"},
+                access.ResolveAccess.kRead,
+                a_context,
+                maxQueueSize=0,
+            )
+
+    def test_when_interpreter_exits_with_request_in_progress_then_exits_cleanly(self):
+        script = textwrap.dedent(
+            """
+            import time
+
+            from openassetio import Context, EntityReference
+            from openassetio.hostApi import HostInterface, Manager
+            from openassetio.log import ConsoleLogger
+            from openassetio.managerApi import Host, HostSession, ManagerInterface
+
+            class SlowManagerInterface(ManagerInterface):
+                def identifier(self):
+                    return "org.openassetio.test.slow"
+
+                def displayName(self):
+                    return "Slow"
+
+                def hasCapability(self, capability):
+                    return False
+
+                def entityExists(self, refs, context, hostSession, successCb, errorCb):
+                    for idx in range(len(refs)):
+                        time.sleep(0.01)
+                        successCb(idx, True)
+
+            class StubHostInterface(HostInterface):
+                def identifier(self):
+                    return "org.openassetio.test.host"
+
+                def displayName(self):
+                    return "Host"
+
+            manager = Manager(
+                SlowManagerInterface(),
+                HostSession(Host(StubHostInterface()), ConsoleLogger()),
+            )
+            future = manager.entityExistsAsync([EntityReference("ref")] * 1000, Context())
+            while future.numCompleted() == 0:
+                time.sleep(0.01)
+            """
+        )
+
+        # The request must be shut down before the interpreter is
+        # finalised, otherwise the process crashes or hangs.
+        # pylint: disable=subprocess-run-check
+        proc = subprocess.run([sys.executable, "-c", script], capture_output=True, timeout=60)
+
+        assert proc.returncode == 0, proc.stderr.decode()
+
+    def test_when_cancelled_after_completion_then_results_unchanged(
+        self, manager, mock_manager_interface, a_context
+    ):
+        def entity_exists(_entity_refs, _context, _host_session, success_cb, _error_cb):
+            success_cb(0, True)
+
+        mock_manager_interface.mock.entityExists.side_effect = entity_exists
+
+        future = manager.entityExistsAsync([EntityReference("asset://a")], a_context)
+        future.wait()
+        future.cancel()
+
+        assert future.isCancelled() is False
+        assert future.get() == [True]
+
+
 manager_capabilities = [
     (Manager.Capability.kStatefulContexts, ManagerInterface.Capability.kStatefulContexts),
     (Manager.Capability.kCustomTerminology, ManagerInterface.Capability.kCustomTerminology),
@@ -908,6 +1171,125 @@ class Test_Manager_isEntityReferenceString:
         assert actual is expected
 
 
+class Test_Manager_createEntityReferences:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.createEntityReferences)
+        assert method_introspector.is_implemented_once(Manager, "createEntityReferences")
+
+    def test_when_no_prefix_given_then_interface_called_once_for_batch(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        mock_manager_interface.mock.isEntityReferenceString.side_effect = (
+            lambda some_string, _host_session: some_string.startswith("asset://")
+        )
+        errors = []
+
+        actual = manager.createEntityReferences(
+            ["asset://a", "/home/b", "asset://c", "d"],
+            lambda idx, error: errors.append((idx, error)),
+        )
+
+        assert actual == [EntityReference("asset://a"), EntityReference("asset://c")]
+        assert errors == [
+            (
+                1,
+                BatchElementError(
+                    BatchElementError.ErrorCode.kInvalidEntityReference,
+                    "Invalid entity reference: /home/b",
+                ),
+            ),
+            (
+                3,
+                BatchElementError(
+                    BatchElementError.ErrorCode.kInvalidEntityReference,
+                    "Invalid entity reference: d",
+                ),
+            ),
+        ]
+
+    def test_when_prefix_given_in_info_then_interface_not_called(
+        self, manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefix: "asset://"
+        }
+        manager.initialize({})
+
+        actual = manager.createEntityReferences(
+            ["asset://a", "asset://b"], lambda _idx, _error: pytest.fail("Unexpected error")
+        )
+
+        assert actual == [EntityReference("asset://a"), EntityReference("asset://b")]
+        assert not mock_manager_interface.mock.isEntityReferenceString.called
+
+    def test_when_interner_given_then_strings_interned(self, manager, mock_manager_interface):
+        mock_manager_interface.mock.isEntityReferenceString.side_effect = (
+            lambda some_string, _host_session: some_string.startswith("asset://")
+        )
+        interner = EntityReferenceInterner()
+
+        actual = manager.createEntityReferences(
+            ["asset://a", "d", "asset://a"], lambda _idx, _error: None, interner
+        )
+
+        assert actual == [EntityReference("asset://a"), EntityReference("asset://a")]
+        assert interner.size() == 1
+
+
+class Test_Manager_areEntityReferenceStrings:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.areEntityReferenceStrings)
+        assert method_introspector.is_implemented_once(Manager, "areEntityReferenceStrings")
+
+    def test_when_no_prefix_given_then_interface_called_for_each_string(
+        self, manager, mock_manager_interface, a_host_session
+    ):
+        method = mock_manager_interface.mock.isEntityReferenceString
+        method.side_effect = lambda some_string, _host_session: some_string.startswith("x")
+
+        actual = manager.areEntityReferenceStrings(["xa", "ya", "xb"])
+
+        assert actual == [True, False, True]
+        method.assert_has_calls(
+            [mock.call(s, a_host_session) for s in ("xa", "ya", "xb")], any_order=False
+        )
+
+    def test_when_prefixes_given_in_info_then_prefixes_used_and_interface_not_called(
+        self, manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefix: "asset://",
+            constants.kInfoKey_EntityReferencesMatchPrefixes: "bal:///  my📹manager⚡",
+        }
+        manager.initialize({})
+
+        actual = manager.areEntityReferenceStrings(
+            [
+                "asset://my_asset",
+                "bal:///my_asset",
+                "my📹manager⚡my_asset⚡",
+                "/home/user/my_asset",
+                "bal://my_asset",
+                "",
+            ]
+        )
+
+        assert actual == [True, True, True, False, False, False]
+        assert not mock_manager_interface.mock.isEntityReferenceString.called
+
+    def test_when_prefixes_given_then_isEntityReferenceString_uses_them(
+        self, manager, mock_manager_interface
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefixes: "asset:// bal:///"
+        }
+        manager.initialize({})
+
+        assert manager.isEntityReferenceString("bal:///my_asset") is True
+        assert manager.isEntityReferenceString("file:///my_asset") is False
+        assert not mock_manager_interface.mock.isEntityReferenceString.called
+
+
 class Test_Manager_createEntityReference:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(Manager.createEntityReference)
@@ -1096,6 +1478,47 @@ class Test_Manager_entityExists(BatchFirstMethodTest):
         )
 
 
+class Test_Manager_entityExistsView:
+    def test_when_entities_queried_then_uint8_memoryview_returned(
+        self,
+        manager,
+        mock_manager_interface,
+        invoke_entityExists_success_cb,
+        two_refs,
+        a_context,
+    ):
+        def call_callbacks(*_args):
+            invoke_entityExists_success_cb(1, True)
+            invoke_entityExists_success_cb(0, False)
+
+        mock_manager_interface.mock.entityExists.side_effect = call_callbacks
+
+        actual = manager.entityExistsView(two_refs, a_context)
+
+        assert isinstance(actual, memoryview)
+        assert actual.readonly
+        assert actual.format == "B"
+        assert actual.tolist() == [0, 1]
+
+    def test_when_entity_errors_then_exception_raised(
+        self,
+        manager,
+        mock_manager_interface,
+        invoke_entityExists_error_cb,
+        two_refs,
+        a_context,
+        a_batch_element_error,
+    ):
+        mock_manager_interface.mock.entityExists.side_effect = (
+            lambda *_args: invoke_entityExists_error_cb(1, a_batch_element_error)
+        )
+
+        with pytest.raises(BatchElementException) as exc_info:
+            manager.entityExistsView(two_refs, a_context)
+
+        assert exc_info.value.index == 1
+
+
 class Test_Manager_defaultEntityReference:
     def test_method_defined_in_cpp(self, method_introspector):
         assert not method_introspector.is_defined_in_python(Manager.defaultEntityReference)
@@ -2026,6 +2449,189 @@ class Test_Manager_getWithRelationships_with_batch_convenience:
             assert variant_error == [a_batch_element_error, a_batch_element_error_2]
 
 
+class Test_Manager_getWithRelationshipsMatrix_with_callback_signature:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(Manager.getWithRelationshipsMatrix)
+        assert method_introspector.is_implemented_once(Manager, "getWithRelationshipsMatrix")
+
+    def test_wraps_the_corresponding_method_of_the_held_interface(
+        self,
+        manager,
+        mock_manager_interface,
+        a_host_session,
+        some_refs,
+        a_batch_element_error,
+        an_empty_traitsdata,
+        an_entity_trait_set,
+        mock_entity_reference_pager_interface,
+        a_context,
+        invoke_getWithRelationship_success_cb,
+        invoke_getWithRelationship_error_cb,
+    ):
+        page_size = 3
+
+        success_callback = mock.Mock()
+        error_callback = mock.Mock()
+
+        # Default ManagerInterface implementation delegates to
+        # getWithRelationship, since there are fewer relationships than
+        # entities.
+        method = mock_manager_interface.mock.getWithRelationship
+
+        def call_callbacks(*_args):
+            invoke_getWithRelationship_success_cb(0, mock_entity_reference_pager_interface)
+            invoke_getWithRelationship_error_cb(1, a_batch_element_error)
+
+        method.side_effect = call_callbacks
+
+        manager.getWithRelationshipsMatrix(
+            some_refs,
+            [an_empty_traitsdata],
+            page_size,
+            access.RelationsAccess.kWrite,
+            a_context,
+            success_callback,
+            error_callback,
+            resultTraitSet=an_entity_trait_set,
+        )
+
+        method.assert_called_once_with(
+            some_refs,
+            an_empty_traitsdata,
+            an_entity_trait_set,
+            page_size,
+            access.RelationsAccess.kWrite,
+            a_context,
+            a_host_session,
+            mock.ANY,  # success
+            mock.ANY,  # error
+        )
+
+        success_callback.assert_called_once_with(0, mock.ANY)
+        pager = success_callback.call_args[0][1]
+        assert isinstance(pager, EntityReferencePager)
+        pager.next()
+        mock_entity_reference_pager_interface.mock.next.assert_called_once_with(a_host_session)
+        error_callback.assert_called_once_with(1, a_batch_element_error)
+
+    def test_when_zero_pageSize_then_InputValidationException_is_raised(
+        self, manager, some_refs, an_empty_traitsdata, a_context
+    ):
+        with pytest.raises(InputValidationException):
+            manager.getWithRelationshipsMatrix(
+                some_refs,
+                [an_empty_traitsdata],
+                0,
+                access.RelationsAccess.kRead,
+                a_context,
+                mock.Mock(),
+                mock.Mock(),
+            )
+
+
+class Test_Manager_getWithRelationshipsMatrix_with_batch_convenience:
+    @pytest.mark.parametrize(
+        "error_mode",
+        [
+            None,
+            Manager.BatchElementErrorPolicyTag.kException,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        ],
+    )
+    def test_when_success_then_row_major_grid_of_pagers_returned(
+        self,
+        manager,
+        a_ref,
+        mock_manager_interface,
+        an_empty_traitsdata,
+        a_context,
+        mock_entity_reference_pager_interface,
+        mock_entity_reference_pager_interface_2,
+        invoke_getWithRelationships_success_cb,
+        error_mode,
+    ):
+        # Single entity, so default implementation delegates to
+        # getWithRelationships.
+        method = mock_manager_interface.mock.getWithRelationships
+
+        def call_callbacks(*_args):
+            mock_entity_reference_pager_interface.mock.hasNext.return_value = True
+            invoke_getWithRelationships_success_cb(0, mock_entity_reference_pager_interface)
+            mock_entity_reference_pager_interface_2.mock.hasNext.return_value = False
+            invoke_getWithRelationships_success_cb(1, mock_entity_reference_pager_interface_2)
+
+        method.side_effect = call_callbacks
+
+        args = {
+            "entityReferences": [a_ref],
+            "relationshipTraitsDatas": [an_empty_traitsdata, an_empty_traitsdata],
+            "pageSize": 3,
+            "relationsAccess": access.RelationsAccess.kRead,
+            "context": a_context,
+            "resultTraitSet": set(),
+        }
+
+        if error_mode is not None:
+            args["errorPolicyTag"] = error_mode
+
+        actual_pagers = manager.getWithRelationshipsMatrix(**args)
+
+        method.assert_called_once()
+        assert len(actual_pagers) == 2
+        assert actual_pagers[0].hasNext() is True
+        assert actual_pagers[1].hasNext() is False
+
+    @pytest.mark.parametrize(
+        "error_mode",
+        [
+            None,
+            Manager.BatchElementErrorPolicyTag.kException,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        ],
+    )
+    def test_when_fail_then_error_emitted_with_flattened_index(
+        self,
+        manager,
+        some_refs,
+        mock_manager_interface,
+        an_empty_traitsdata,
+        a_context,
+        a_batch_element_error,
+        a_batch_element_error_2,
+        invoke_getWithRelationship_error_cb,
+        error_mode,
+    ):
+        method = mock_manager_interface.mock.getWithRelationship
+
+        def call_callbacks(*_args):
+            invoke_getWithRelationship_error_cb(1, a_batch_element_error)
+            invoke_getWithRelationship_error_cb(0, a_batch_element_error_2)
+
+        method.side_effect = call_callbacks
+
+        args = {
+            "entityReferences": some_refs,
+            "relationshipTraitsDatas": [an_empty_traitsdata],
+            "pageSize": 3,
+            "relationsAccess": access.RelationsAccess.kRead,
+            "context": a_context,
+            "resultTraitSet": set(),
+        }
+
+        if error_mode is not None:
+            args["errorPolicyTag"] = error_mode
+
+        if error_mode is None or error_mode is Manager.BatchElementErrorPolicyTag.kException:
+            with pytest.raises(BatchElementException) as exc_info:
+                manager.getWithRelationshipsMatrix(**args)
+
+            assert exc_info.value.index == 1
+            assert exc_info.value.error == a_batch_element_error
+        else:
+            variant_error = manager.getWithRelationshipsMatrix(**args)
+            assert variant_error == [a_batch_element_error_2, a_batch_element_error]
+
+
 class Test_Manager_BatchElementErrorPolicyTag:
     def test_unique(self):
         assert (
@@ -2225,6 +2831,188 @@ class Test_Manager_resolve(BatchFirstMethodTest):
         )
 
 
+class Test_Manager_resolveColumns:
+    def test_wraps_resolve_of_the_held_interface_with_traits_of_columns(
+        self, manager, mock_manager_interface, two_refs, a_context, a_host_session
+    ):
+        column_specs = [
+            ResolvedBatch.ColumnSpec("aTrait", "aStr", ResolvedBatch.ColumnType.kStr),
+            ResolvedBatch.ColumnSpec("anotherTrait", "anInt", ResolvedBatch.ColumnType.kInt),
+        ]
+
+        manager.resolveColumns(two_refs, column_specs, access.ResolveAccess.kRead, a_context)
+
+        mock_manager_interface.mock.resolve.assert_called_once_with(
+            two_refs,
+            {"aTrait", "anotherTrait"},
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            mock.ANY,
+            mock.ANY,
+        )
+
+    def test_when_interface_returns_mixed_output_out_of_order_then_columns_populated(
+        self,
+        manager,
+        invoke_resolve_success_cb,
+        invoke_resolve_error_cb,
+        mock_manager_interface,
+        two_refs,
+        a_context,
+        a_batch_element_error,
+    ):
+        column_specs = [ResolvedBatch.ColumnSpec("aTrait", "aStr", ResolvedBatch.ColumnType.kStr)]
+        traits_data = TraitsData()
+        traits_data.setTraitProperty("aTrait", "aStr", "a value")
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(1, traits_data)
+            invoke_resolve_error_cb(0, a_batch_element_error)
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        actual = manager.resolveColumns(
+            two_refs, column_specs, access.ResolveAccess.kRead, a_context
+        )
+
+        assert actual.size() == 2
+        assert actual.isError(0)
+        assert actual.error(0) == a_batch_element_error
+        assert not actual.isValid(0, 0)
+        assert not actual.isError(1)
+        assert actual.isValid(0, 1)
+        assert actual.strValue(0, 1) == "a value"
+
+
+class Test_Manager_bufferCallbacks:
+    def test_when_not_buffered_then_callbacks_called_during_interface_call(
+        self,
+        manager,
+        mock_manager_interface,
+        invoke_resolve_success_cb,
+        two_refs,
+        an_entity_trait_set,
+        a_context,
+        a_traitsdata,
+    ):
+        calls = []
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(0, a_traitsdata)
+            calls.append("interface returned")
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        manager.resolve(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda idx, _: calls.append(("success", idx)),
+            lambda idx, _: calls.append(("error", idx)),
+        )
+
+        assert calls == [("success", 0), "interface returned"]
+
+    def test_when_buffered_then_callbacks_called_after_interface_call_in_arrival_order(
+        self,
+        manager,
+        mock_manager_interface,
+        invoke_resolve_success_cb,
+        invoke_resolve_error_cb,
+        two_refs,
+        an_entity_trait_set,
+        a_context,
+        a_traitsdata,
+        a_batch_element_error,
+    ):
+        calls = []
+
+        def call_callbacks(*_args):
+            invoke_resolve_success_cb(1, a_traitsdata)
+            invoke_resolve_error_cb(0, a_batch_element_error)
+            calls.append("interface returned")
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        manager.resolve(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda idx, result: calls.append(("success", idx, result)),
+            lambda idx, error: calls.append(("error", idx, error)),
+            bufferCallbacks=True,
+        )
+
+        assert calls == [
+            "interface returned",
+            ("success", 1, a_traitsdata),
+            ("error", 0, a_batch_element_error),
+        ]
+
+    def test_when_buffered_and_interface_raises_then_results_so_far_passed_on_before_raise(
+        self,
+        manager,
+        mock_manager_interface,
+        invoke_entityExists_success_cb,
+        two_refs,
+        a_context,
+    ):
+        calls = []
+
+        def call_callbacks(*_args):
+            invoke_entityExists_success_cb(0, True)
+            raise RuntimeError("Oops")
+
+        mock_manager_interface.mock.entityExists.side_effect = call_callbacks
+
+        with pytest.raises(RuntimeError, match="Oops"):
+            manager.entityExists(
+                two_refs,
+                a_context,
+                lambda idx, result: calls.append(("success", idx, result)),
+                lambda idx, _: calls.append(("error", idx)),
+                bufferCallbacks=True,
+            )
+
+        assert calls == [("success", 0, True)]
+
+    def test_when_buffered_then_relationship_queries_pass_on_pagers(
+        self,
+        manager,
+        mock_manager_interface,
+        invoke_getWithRelationship_success_cb,
+        two_refs,
+        a_context,
+    ):
+        pager_interface = FakeEntityReferencePagerInterface()
+        calls = []
+
+        def call_callbacks(*_args):
+            invoke_getWithRelationship_success_cb(0, pager_interface)
+            calls.append("interface returned")
+
+        mock_manager_interface.mock.getWithRelationship.side_effect = call_callbacks
+
+        manager.getWithRelationship(
+            two_refs,
+            TraitsData(),
+            1,
+            access.RelationsAccess.kRead,
+            a_context,
+            lambda idx, pager: calls.append(("success", idx, pager)),
+            lambda idx, _: calls.append(("error", idx)),
+            bufferCallbacks=True,
+        )
+
+        assert calls[0] == "interface returned"
+        assert calls[1][:2] == ("success", 0)
+        assert isinstance(calls[1][2], EntityReferencePager)
+        assert len(calls) == 2
+
+
 class Test_Manager_entityTraits(BatchFirstMethodTest):
     @pytest.fixture(autouse=True)
     def constructor(
@@ -128,6 +128,45 @@ class Test_ManagerFactory_availableManagers:
 
         assert actual == expected
 
+    def test_when_implementation_factory_provides_details_then_not_instantiated(
+        self, create_mock_manager_interface, mock_manager_implementation_factory, a_manager_factory
+    ):
+        # setup
+
+        identifiers = ["first.identifier", "second.identifier"]
+        mock_manager_implementation_factory.mock.identifiers.return_value = identifiers
+
+        first_detail = ManagerFactory.ManagerDetail(
+            identifier="first.identifier", displayName="First", info={"first": "info"}
+        )
+        mock_manager_implementation_factory.mock.managerDetail.side_effect = [first_detail, None]
+
+        second_manager_interface = create_mock_manager_interface()
+        second_manager_interface.mock.identifier.return_value = "second.identifier"
+        second_manager_interface.mock.displayName.return_value = "Second"
+        second_manager_interface.mock.info.return_value = {"second": "info"}
+        mock_manager_implementation_factory.mock.instantiate.side_effect = [
+            second_manager_interface
+        ]
+
+        expected = {
+            "first.identifier": first_detail,
+            "second.identifier": ManagerFactory.ManagerDetail(
+                identifier="second.identifier", displayName="Second", info={"second": "info"}
+            ),
+        }
+
+        # action
+
+        actual = a_manager_factory.availableManagers()
+
+        # confirm
+
+        assert actual == expected
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with(
+            "second.identifier"
+        )
+
 
 class Test_ManagerFactory_kDefaultManagerConfigEnvVarName:
     def test_has_expected_value(self):
@@ -525,6 +564,7 @@ def a_cpp_manager_factory(mock_host_interface, mock_manager_implementation_facto
 def mock_manager_implementation_factory(mock_logger, mock_manager_interface):
     factory = MockManagerImplementationFactory(mock_logger)
     factory.mock.instantiate.return_value = mock_manager_interface
+    factory.mock.managerDetail.return_value = None
     return factory
 
 
@@ -617,3 +657,6 @@ class MockManagerImplementationFactory(ManagerImplementationFactoryInterface):
 
     def instantiate(self, identifier):
         return self.mock.instantiate(identifier)
+
+    def managerDetail(self, identifier):
+        return self.mock.managerDetail(identifier)
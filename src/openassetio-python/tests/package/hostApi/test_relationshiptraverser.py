@@ -0,0 +1,157 @@
+#
+#   Copyright 2024 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.hostApi.RelationshipTraverser class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import pytest
+
+from openassetio import Context, EntityReference, access
+from openassetio.errors import BatchElementError, InputValidationException
+from openassetio.hostApi import Manager, RelationshipTraverser
+from openassetio.managerApi import EntityReferencePagerInterface
+from openassetio.trait import TraitsData
+
+
+class Test_RelationshipTraverser_init:
+    def test_when_pageSize_is_zero_then_raises_InputValidationException(self, manager):
+        with pytest.raises(InputValidationException):
+            RelationshipTraverser(
+                manager, TraitsData(), access.RelationsAccess.kRead, Context(), set(), 0
+            )
+
+    def test_defaults(self):
+        assert RelationshipTraverser.kDefaultPageSize == 256
+        assert RelationshipTraverser.kUnlimitedDepth == 2**64 - 1
+
+
+class Test_RelationshipTraverser_traverse:
+    def test_when_graph_traversed_then_one_query_per_level(
+        self, manager, mock_manager_interface, a_traverser
+    ):
+        graph = {"a": ["b", "c"], "b": ["d"], "c": ["d", "a"], "d": []}
+        serve_graph(mock_manager_interface, graph)
+
+        traversal = a_traverser.traverse([EntityReference("a")])
+
+        assert [(n.entityReference.toString(), n.depth) for n in traversal.nodes] == [
+            ("a", 0),
+            ("b", 1),
+            ("c", 1),
+            ("d", 2),
+        ]
+        assert [(e.source, e.target) for e in traversal.edges] == [
+            (0, 1),
+            (0, 2),
+            (1, 3),
+            (2, 3),
+            (2, 0),
+        ]
+        assert traversal.hasCycle is True
+        assert traversal.errors == []
+        assert a_traverser.queryCount() == 3
+        queried = [
+            [ref.toString() for ref in call.args[0]]
+            for call in mock_manager_interface.mock.getWithRelationship.call_args_list
+        ]
+        assert queried == [["a"], ["b", "c"], ["d"]]
+
+    def test_when_maxDepth_given_then_traversal_limited(
+        self, manager, mock_manager_interface, a_traverser
+    ):
+        serve_graph(mock_manager_interface, {"a": ["b"], "b": ["c"], "c": []})
+
+        traversal = a_traverser.traverse([EntityReference("a")], maxDepth=1)
+
+        assert [n.entityReference.toString() for n in traversal.nodes] == ["a", "b"]
+        assert traversal.hasCycle is False
+
+    def test_when_entity_in_error_then_error_reported(
+        self, manager, mock_manager_interface, a_traverser
+    ):
+        serve_graph(mock_manager_interface, {"a": ["missing"]})
+
+        traversal = a_traverser.traverse([EntityReference("a")])
+
+        assert len(traversal.errors) == 1
+        index, error = traversal.errors[0]
+        assert index == 1
+        assert error.code == BatchElementError.ErrorCode.kEntityResolutionError
+
+    def test_when_traversed_again_then_memoised_relationships_used(
+        self, manager, mock_manager_interface, a_traverser
+    ):
+        serve_graph(mock_manager_interface, {"a": ["b"], "b": []})
+
+        a_traverser.traverse([EntityReference("a")])
+        a_traverser.traverse([EntityReference("b")])
+        assert a_traverser.queryCount() == 2
+
+        a_traverser.clearCache()
+        a_traverser.traverse([EntityReference("b")])
+        assert a_traverser.queryCount() == 3
+
+
+class ListPagerInterface(EntityReferencePagerInterface):
+    def __init__(self, refs):
+        EntityReferencePagerInterface.__init__(self)
+        self.__refs = refs
+
+    def hasNext(self, hostSession):
+        return False
+
+    def get(self, hostSession):
+        return self.__refs
+
+    def next(self, hostSession):
+        self.__refs = []
+
+
+def serve_graph(mock_manager_interface, graph):
+    """
+    Configure the mock manager to serve relationships from the given
+    adjacency dict, with an error for entities not in the dict.
+    """
+
+    def getWithRelationship(refs, _traits, _result_traits, _page_size, *args):
+        success_cb, error_cb = args[-2:]
+        for idx, ref in enumerate(refs):
+            related = graph.get(ref.toString())
+            if related is None:
+                error_cb(
+                    idx,
+                    BatchElementError(
+                        BatchElementError.ErrorCode.kEntityResolutionError, ref.toString()
+                    ),
+                )
+            else:
+                success_cb(idx, ListPagerInterface([EntityReference(r) for r in related]))
+
+    mock_manager_interface.mock.getWithRelationship.side_effect = getWithRelationship
+
+
+@pytest.fixture
+def manager(mock_manager_interface, a_host_session):
+    return Manager(mock_manager_interface, a_host_session)
+
+
+@pytest.fixture
+def a_traverser(manager):
+    return RelationshipTraverser(
+        manager, TraitsData({"dependsOn"}), access.RelationsAccess.kRead, Context()
+    )
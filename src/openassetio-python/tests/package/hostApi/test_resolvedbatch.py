@@ -0,0 +1,221 @@
+#
+#   Copyright 2024 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.hostApi.ResolvedBatch class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import pytest
+
+from openassetio.errors import BatchElementError, InputValidationException
+from openassetio.hostApi import ResolvedBatch
+from openassetio.trait import TraitsData
+
+
+class Test_ResolvedBatch_init:
+    def test_when_constructed_then_all_rows_invalid_and_not_in_error(self, a_resolved_batch):
+        assert a_resolved_batch.size() == 3
+        assert len(a_resolved_batch.columnSpecs()) == 4
+        for index in range(3):
+            assert not a_resolved_batch.isError(index)
+            for column in range(4):
+                assert not a_resolved_batch.isValid(column, index)
+        assert a_resolved_batch.errors() == {}
+
+
+class Test_ResolvedBatch_setValues:
+    def test_when_values_set_then_available_by_column(self, a_resolved_batch):
+        traits_data = TraitsData()
+        traits_data.setTraitProperty("aTrait", "aBool", True)
+        traits_data.setTraitProperty("aTrait", "anInt", 3)
+        traits_data.setTraitProperty("anotherTrait", "aFloat", 1.5)
+        traits_data.setTraitProperty("anotherTrait", "aStr", "🦆 value")
+
+        a_resolved_batch.setValues(1, traits_data)
+
+        assert a_resolved_batch.boolColumn(0) == [0, 1, 0]
+        assert a_resolved_batch.intColumn(1) == [0, 3, 0]
+        assert a_resolved_batch.floatColumn(2) == [0.0, 1.5, 0.0]
+        assert a_resolved_batch.strValue(3, 1) == "🦆 value"
+        assert a_resolved_batch.strOffsets(3)[1] == 0
+        assert a_resolved_batch.strLengths(3) == [0, len("🦆 value".encode()), 0]
+        assert all(a_resolved_batch.isValid(column, 1) for column in range(4))
+
+    def test_when_value_has_unexpected_type_then_invalid(self, a_resolved_batch):
+        traits_data = TraitsData()
+        traits_data.setTraitProperty("aTrait", "anInt", "not an int")
+
+        a_resolved_batch.setValues(0, traits_data)
+
+        assert not a_resolved_batch.isValid(1, 0)
+
+    def test_when_row_already_set_then_raises_and_row_unchanged(self, a_resolved_batch):
+        traits_data = TraitsData()
+        traits_data.setTraitProperty("anotherTrait", "aStr", "first")
+        a_resolved_batch.setValues(0, traits_data)
+        other_traits_data = TraitsData()
+        other_traits_data.setTraitProperty("aTrait", "anInt", 3)
+        error = BatchElementError(BatchElementError.ErrorCode.kEntityResolutionError, "oops")
+
+        with pytest.raises(
+            InputValidationException, match="Row index 0 of ResolvedBatch has already been set."
+        ):
+            a_resolved_batch.setValues(0, other_traits_data)
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.setError(0, error)
+
+        assert a_resolved_batch.strValue(3, 0) == "first"
+        assert a_resolved_batch.strLengths(3) == [5, 0, 0]
+        assert not a_resolved_batch.isValid(1, 0)
+        assert not a_resolved_batch.isError(0)
+
+
+class Test_ResolvedBatch_setError:
+    def test_when_error_set_then_available_for_that_row_only(self, a_resolved_batch):
+        error = BatchElementError(BatchElementError.ErrorCode.kEntityResolutionError, "oops")
+
+        a_resolved_batch.setError(2, error)
+
+        assert a_resolved_batch.isError(2)
+        assert a_resolved_batch.error(2) == error
+        assert a_resolved_batch.errors() == {2: error}
+        assert not a_resolved_batch.isError(0)
+
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.error(0)
+
+
+class Test_ResolvedBatch_column_access:
+    def test_when_column_accessed_as_wrong_type_then_raises(self, a_resolved_batch):
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.intColumn(0)
+
+    def test_when_column_index_out_of_range_then_raises(self, a_resolved_batch):
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.boolColumn(4)
+
+
+class Test_ResolvedBatch_row_access:
+    def test_when_row_index_out_of_range_then_raises(self, a_resolved_batch):
+        error = BatchElementError(BatchElementError.ErrorCode.kEntityResolutionError, "oops")
+
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.setValues(3, TraitsData())
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.setError(3, error)
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.isError(3)
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.isValid(0, 3)
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.strValue(3, 3)
+
+
+class Test_ResolvedBatch_column_views:
+    def test_when_viewed_then_memoryviews_match_columns(self, a_resolved_batch):
+        traits_data = TraitsData()
+        traits_data.setTraitProperty("aTrait", "aBool", True)
+        traits_data.setTraitProperty("aTrait", "anInt", -3)
+        traits_data.setTraitProperty("anotherTrait", "aFloat", 1.5)
+        traits_data.setTraitProperty("anotherTrait", "aStr", "🦆 value")
+        a_resolved_batch.setValues(1, traits_data)
+
+        views = [
+            a_resolved_batch.boolColumnView(0),
+            a_resolved_batch.intColumnView(1),
+            a_resolved_batch.floatColumnView(2),
+            a_resolved_batch.strOffsetsView(3),
+            a_resolved_batch.strLengthsView(3),
+        ]
+
+        for view in views:
+            assert isinstance(view, memoryview)
+            assert view.readonly
+            assert len(view) == 3
+        assert views[0].tolist() == [0, 1, 0]
+        assert views[1].tolist() == [0, -3, 0]
+        assert views[2].tolist() == [0.0, 1.5, 0.0]
+        assert views[3].tolist() == a_resolved_batch.strOffsets(3)
+        assert views[4].tolist() == a_resolved_batch.strLengths(3)
+
+        str_buffer = a_resolved_batch.strBufferView(3)
+        offset = views[3][1]
+        assert bytes(str_buffer[offset : offset + views[4][1]]).decode() == "🦆 value"
+
+    def test_when_batch_released_then_view_keeps_it_alive(self):
+        batch = ResolvedBatch(
+            [ResolvedBatch.ColumnSpec("aTrait", "anInt", ResolvedBatch.ColumnType.kInt)], 2
+        )
+        traits_data = TraitsData()
+        traits_data.setTraitProperty("aTrait", "anInt", 7)
+        batch.setValues(0, traits_data)
+
+        view = batch.intColumnView(0)
+        del batch
+
+        assert view.tolist() == [7, 0]
+
+    def test_when_column_viewed_as_wrong_type_then_raises(self, a_resolved_batch):
+        with pytest.raises(InputValidationException):
+            a_resolved_batch.intColumnView(0)
+
+    @pytest.mark.parametrize(
+        "view_method",
+        [
+            ("boolColumnView", 0),
+            ("intColumnView", 1),
+            ("floatColumnView", 2),
+            ("strBufferView", 3),
+            ("strOffsetsView", 3),
+            ("strLengthsView", 3),
+        ],
+    )
+    def test_when_view_alive_then_modification_raises_BufferError(
+        self, a_resolved_batch, view_method
+    ):
+        method_name, column = view_method
+        view = getattr(a_resolved_batch, method_name)(column)
+        a_slice = view[1:]
+        error = BatchElementError(BatchElementError.ErrorCode.kEntityResolutionError, "oops")
+
+        with pytest.raises(BufferError):
+            a_resolved_batch.setValues(0, TraitsData())
+        with pytest.raises(BufferError):
+            a_resolved_batch.setError(0, error)
+
+        del view
+        # Views derived from a view also pin the batch.
+        with pytest.raises(BufferError):
+            a_resolved_batch.setValues(0, TraitsData())
+
+        del a_slice
+        a_resolved_batch.setValues(0, TraitsData())
+        a_resolved_batch.setError(1, error)
+        assert a_resolved_batch.isError(1)
+
+
+@pytest.fixture
+def a_resolved_batch():
+    return ResolvedBatch(
+        [
+            ResolvedBatch.ColumnSpec("aTrait", "aBool", ResolvedBatch.ColumnType.kBool),
+            ResolvedBatch.ColumnSpec("aTrait", "anInt", ResolvedBatch.ColumnType.kInt),
+            ResolvedBatch.ColumnSpec("anotherTrait", "aFloat", ResolvedBatch.ColumnType.kFloat),
+            ResolvedBatch.ColumnSpec("anotherTrait", "aStr", ResolvedBatch.ColumnType.kStr),
+        ],
+        3,
+    )
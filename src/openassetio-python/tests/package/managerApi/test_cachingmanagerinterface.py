@@ -0,0 +1,106 @@
+#
+#   Copyright 2024 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.managerApi.CachingManagerInterface
+class.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
+from unittest import mock
+
+import pytest
+
+from openassetio import Context, EntityReference
+from openassetio.access import ResolveAccess
+from openassetio.errors import InputValidationException
+from openassetio.managerApi import CachingManagerInterface, ManagerInterface
+from openassetio.trait import TraitsData
+
+
+class Test_CachingManagerInterface_init:
+    def test_is_a_ManagerInterface(self, mock_manager_interface):
+        caching_interface = CachingManagerInterface(mock_manager_interface)
+
+        assert isinstance(caching_interface, ManagerInterface)
+        assert caching_interface.upstreamInterface() is mock_manager_interface
+
+    def test_when_upstream_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError):
+            CachingManagerInterface(None)
+
+    def test_when_capacity_is_zero_then_raises(self, mock_manager_interface):
+        with pytest.raises(InputValidationException):
+            CachingManagerInterface(mock_manager_interface, 0)
+
+    def test_accepts_capacity_and_time_to_live(self, mock_manager_interface):
+        CachingManagerInterface(mock_manager_interface, 10, datetime.timedelta(seconds=30))
+
+
+class Test_CachingManagerInterface_resolve:
+    def test_when_resolved_twice_then_upstream_called_once(
+        self, mock_manager_interface, a_host_session
+    ):
+        caching_interface = CachingManagerInterface(mock_manager_interface)
+        ref = EntityReference("some://ref")
+        context = Context()
+        expected = TraitsData()
+        expected.setTraitProperty("aTrait", "aKey", "aValue")
+
+        def call_success_cb(*args):
+            args[5](0, expected)
+
+        mock_manager_interface.mock.resolve.side_effect = call_success_cb
+
+        results = []
+        for _ in range(2):
+            caching_interface.resolve(
+                [ref],
+                {"aTrait"},
+                ResolveAccess.kRead,
+                context,
+                a_host_session,
+                lambda _idx, data: results.append(data),
+                mock.Mock(),
+            )
+
+        mock_manager_interface.mock.resolve.assert_called_once()
+        assert results == [expected, expected]
+
+    def test_when_caches_flushed_then_forwarded_and_upstream_called_again(
+        self, mock_manager_interface, a_host_session
+    ):
+        caching_interface = CachingManagerInterface(mock_manager_interface)
+        mock_manager_interface.mock.resolve.side_effect = lambda *args: args[5](0, TraitsData())
+
+        def resolve():
+            caching_interface.resolve(
+                [EntityReference("some://ref")],
+                {"aTrait"},
+                ResolveAccess.kRead,
+                Context(),
+                a_host_session,
+                mock.Mock(),
+                mock.Mock(),
+            )
+
+        resolve()
+        caching_interface.flushCaches(a_host_session)
+        resolve()
+
+        mock_manager_interface.mock.flushCaches.assert_called_once_with(a_host_session)
+        assert mock_manager_interface.mock.resolve.call_count == 2
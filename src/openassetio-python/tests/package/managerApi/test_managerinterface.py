@@ -1,5 +1,5 @@
 #
-#   Copyright 2013-2023 The Foundry Visionmongers Ltd
+#   Copyright 2013-2024 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -20,6 +20,8 @@ Tests for the default implementations of ManagerInterface methods.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+from unittest import mock
+
 import pytest
 
 from openassetio import EntityReference, Context, errors, access
@@ -178,6 +180,34 @@ class Test_ManagerInterface_isEntityReferenceString:
             manager_interface.isEntityReferenceString("", a_host_session)
 
 
+class Test_ManagerInterface_areEntityReferenceStrings:
+    def test_default_implementation_calls_isEntityReferenceString_for_each_string(
+        self, mock_manager_interface, a_host_session
+    ):
+        method = mock_manager_interface.mock.isEntityReferenceString
+        method.side_effect = lambda some_string, _host_session: some_string == "valid"
+
+        actual = mock_manager_interface.areEntityReferenceStrings(
+            ["valid", "invalid", "valid"], a_host_session
+        )
+
+        assert actual == [True, False, True]
+        assert method.call_args_list == [
+            mock.call(s, a_host_session) for s in ("valid", "invalid", "valid")
+        ]
+
+    def test_when_isEntityReferenceString_not_implemented_then_raises_NotImplementedException(
+        self, manager_interface, a_host_session, unimplemented_method_error_msg
+    ):
+        with pytest.raises(
+            errors.NotImplementedException,
+            match=unimplemented_method_error_msg.format(
+                "isEntityReferenceString", "entityReferenceIdentification"
+            ),
+        ):
+            manager_interface.areEntityReferenceStrings([""], a_host_session)
+
+
 class Test_ManagerInterface_initialize:
     def test_when_settings_not_provided_then_default_implementation_ok(
         self, manager_interface, a_host_session
@@ -433,6 +463,145 @@ class Test_ManagerInterface_getWithRelationships:
             )
 
 
+class Test_ManagerInterface_getWithRelationshipsMatrix:
+    def test_method_defined_in_cpp(self, method_introspector):
+        assert not method_introspector.is_defined_in_python(
+            ManagerInterface.getWithRelationshipsMatrix
+        )
+        assert method_introspector.is_implemented_once(
+            ManagerInterface, "getWithRelationshipsMatrix"
+        )
+
+    def test_when_fewer_relationships_then_getWithRelationship_called_per_relationship(
+        self, mock_manager_interface, a_context, a_host_session
+    ):
+        refs = [EntityReference("a"), EntityReference("b"), EntityReference("c")]
+        relationships = [TraitsData({"r1"}), TraitsData({"r2"})]
+        method = mock_manager_interface.mock.getWithRelationship
+
+        def call_callbacks(entityRefs, relationship, *args):
+            success_cb, error_cb = args[-2:]
+            success_cb(0, EntityReferencePagerInterface())
+            error_cb(
+                len(entityRefs) - 1,
+                errors.BatchElementError(
+                    errors.BatchElementError.ErrorCode.kEntityResolutionError,
+                    next(iter(relationship.traitSet())),
+                ),
+            )
+
+        method.side_effect = call_callbacks
+
+        successes = []
+        failures = []
+        mock_manager_interface.getWithRelationshipsMatrix(
+            refs,
+            relationships,
+            {"t"},
+            2,
+            access.RelationsAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, _pager: successes.append(idx),
+            lambda idx, error: failures.append((idx, error.message)),
+        )
+
+        assert method.call_args_list == [
+            mock.call(
+                refs,
+                relationship,
+                {"t"},
+                2,
+                access.RelationsAccess.kRead,
+                a_context,
+                a_host_session,
+                mock.ANY,
+                mock.ANY,
+            )
+            for relationship in relationships
+        ]
+        assert not mock_manager_interface.mock.getWithRelationships.called
+        # Indices are flattened row-major: entity * numRelationships + relationship.
+        assert successes == [0, 1]
+        assert failures == [(4, "r1"), (5, "r2")]
+
+    def test_when_fewer_entities_then_getWithRelationships_called_per_entity(
+        self, mock_manager_interface, a_context, a_host_session
+    ):
+        refs = [EntityReference("a"), EntityReference("b")]
+        relationships = [TraitsData({"r1"}), TraitsData({"r2"}), TraitsData({"r3"})]
+        method = mock_manager_interface.mock.getWithRelationships
+
+        def call_callbacks(entityRef, relationshipDatas, *args):
+            success_cb, error_cb = args[-2:]
+            success_cb(0, EntityReferencePagerInterface())
+            error_cb(
+                len(relationshipDatas) - 1,
+                errors.BatchElementError(
+                    errors.BatchElementError.ErrorCode.kEntityResolutionError,
+                    entityRef.toString(),
+                ),
+            )
+
+        method.side_effect = call_callbacks
+
+        successes = []
+        failures = []
+        mock_manager_interface.getWithRelationshipsMatrix(
+            refs,
+            relationships,
+            set(),
+            1,
+            access.RelationsAccess.kWrite,
+            a_context,
+            a_host_session,
+            lambda idx, _pager: successes.append(idx),
+            lambda idx, error: failures.append((idx, error.message)),
+        )
+
+        assert method.call_args_list == [
+            mock.call(
+                ref,
+                relationships,
+                set(),
+                1,
+                access.RelationsAccess.kWrite,
+                a_context,
+                a_host_session,
+                mock.ANY,
+                mock.ANY,
+            )
+            for ref in refs
+        ]
+        assert not mock_manager_interface.mock.getWithRelationship.called
+        assert successes == [0, 3]
+        assert failures == [(2, "a"), (5, "b")]
+
+    def test_default_implementation_raises_NotImplementedException(
+        self, manager_interface, a_context, a_host_session, unimplemented_method_error_msg
+    ):
+        def fail(*_):
+            pytest.fail("No callbacks should be called")
+
+        with pytest.raises(
+            errors.NotImplementedException,
+            match=unimplemented_method_error_msg.format(
+                "getWithRelationship", "relationshipQueries"
+            ),
+        ):
+            manager_interface.getWithRelationshipsMatrix(
+                [EntityReference("")],
+                [TraitsData()],
+                set(),
+                1,
+                access.RelationsAccess.kRead,
+                a_context,
+                a_host_session,
+                fail,
+                fail,
+            )
+
+
 def assert_is_default_pager(a_host_session, pager):
     # The default pager behaviour is to return no data and
     # report no new pages.
@@ -504,6 +673,175 @@ class Test_ManagerInterface_register:
             )
 
 
+class Test_ManagerInterface_batch_methods:
+    def test_when_resolveBatch_implemented_then_results_passed_to_callbacks_in_order(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        refs = [EntityReference("a"), EntityReference("b"), EntityReference("c")]
+        a_traits_data = TraitsData({"aTrait"})
+        another_traits_data = TraitsData({"anotherTrait"})
+        an_error = errors.BatchElementError(
+            errors.BatchElementError.ErrorCode.kEntityResolutionError, "b"
+        )
+        a_batch_manager_interface.batch = (
+            [a_traits_data, None, another_traits_data],
+            {1: an_error},
+        )
+
+        calls = []
+        a_batch_manager_interface.resolve(
+            refs,
+            {"aTrait"},
+            access.ResolveAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, traits_data: calls.append((idx, traits_data)),
+            lambda idx, error: calls.append((idx, error)),
+        )
+
+        assert calls == [(0, a_traits_data), (1, an_error), (2, another_traits_data)]
+        assert a_batch_manager_interface.calls == [
+            (
+                "resolveBatch",
+                (refs, {"aTrait"}, access.ResolveAccess.kRead, a_context, a_host_session),
+            )
+        ]
+
+    def test_when_entityExistsBatch_implemented_then_results_passed_to_callbacks(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        refs = [EntityReference("a"), EntityReference("b")]
+        a_batch_manager_interface.batch = ([True, False], {})
+
+        calls = []
+        a_batch_manager_interface.entityExists(
+            refs,
+            a_context,
+            a_host_session,
+            lambda idx, exists: calls.append((idx, exists)),
+            lambda idx, _error: pytest.fail("Unexpected error"),
+        )
+
+        assert calls == [(0, True), (1, False)]
+
+    def test_when_defaultEntityReferenceBatch_returns_None_then_None_passed_to_callback(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        a_batch_manager_interface.batch = ([EntityReference("a"), None], {})
+
+        calls = []
+        a_batch_manager_interface.defaultEntityReference(
+            [{"aTrait"}, {"anotherTrait"}],
+            access.DefaultEntityAccess.kRead,
+            a_context,
+            a_host_session,
+            lambda idx, ref: calls.append((idx, ref)),
+            lambda idx, _error: pytest.fail("Unexpected error"),
+        )
+
+        assert calls == [(0, EntityReference("a")), (1, None)]
+
+    def test_when_batch_has_wrong_number_of_results_then_raises_InputValidationException(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        a_batch_manager_interface.batch = ([True], {})
+
+        with pytest.raises(
+            errors.InputValidationException,
+            match="entityExistsBatch returned 1 results for a batch of 2.",
+        ):
+            a_batch_manager_interface.entityExists(
+                [EntityReference("a"), EntityReference("b")],
+                a_context,
+                a_host_session,
+                lambda *_: None,
+                lambda *_: None,
+            )
+
+    def test_when_batch_has_out_of_range_error_then_raises_InputValidationException(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        an_error = errors.BatchElementError(errors.BatchElementError.ErrorCode.kUnknown, "")
+        a_batch_manager_interface.batch = ([True], {1: an_error})
+
+        with pytest.raises(
+            errors.InputValidationException,
+            match="entityExistsBatch returned an error for index 1, which is out of range.",
+        ):
+            a_batch_manager_interface.entityExists(
+                [EntityReference("a")],
+                a_context,
+                a_host_session,
+                lambda *_: None,
+                lambda *_: None,
+            )
+
+    def test_when_batch_has_None_result_not_in_error_then_raises_InputValidationException(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        a_batch_manager_interface.batch = ([None], {})
+
+        with pytest.raises(
+            errors.InputValidationException,
+            match="resolveBatch returned None for index 0, which is not in error.",
+        ):
+            a_batch_manager_interface.resolve(
+                [EntityReference("a")],
+                set(),
+                access.ResolveAccess.kRead,
+                a_context,
+                a_host_session,
+                lambda *_: None,
+                lambda *_: None,
+            )
+
+    def test_when_batch_method_raises_then_exception_propagated(
+        self, a_batch_manager_interface, a_context, a_host_session
+    ):
+        a_batch_manager_interface.batch = errors.NotImplementedException("Not today")
+
+        with pytest.raises(errors.NotImplementedException, match="Not today"):
+            a_batch_manager_interface.entityExists(
+                [EntityReference("a")],
+                a_context,
+                a_host_session,
+                lambda *_: None,
+                lambda *_: None,
+            )
+
+
+class BatchManagerInterface(ManagerInterface):
+    """
+    ManagerInterface implementing the batch protocol, returning a
+    canned batch and recording each call.
+    """
+
+    def __init__(self):
+        ManagerInterface.__init__(self)
+        self.batch = ([], {})
+        self.calls = []
+
+    def __respond(self, name, args):
+        self.calls.append((name, args))
+        if isinstance(self.batch, Exception):
+            raise self.batch
+        return self.batch
+
+    def entityExistsBatch(self, *args):
+        return self.__respond("entityExistsBatch", args)
+
+    def resolveBatch(self, *args):
+        return self.__respond("resolveBatch", args)
+
+    def defaultEntityReferenceBatch(self, *args):
+        return self.__respond("defaultEntityReferenceBatch", args)
+
+
+@pytest.fixture
+def a_batch_manager_interface():
+    return BatchManagerInterface()
+
+
 @pytest.fixture
 def manager_interface():
     return ManagerInterface()
@@ -23,6 +23,9 @@ These tests check the functionality of the CppPluginSystem class.
 import os
 import pathlib
 import re
+import shutil
+import textwrap
+import threading
 
 import pytest
 
@@ -261,6 +264,365 @@ class Test_CppPluginSystem_scan:
         )
 
 
+class Test_CppPluginSystem_parallelLoading:
+    def test_when_default_constructed_then_disabled(self, a_plugin_system):
+        assert a_plugin_system.isParallelLoadingEnabled() is False
+
+    def test_when_enabled_then_enabled(self, a_plugin_system):
+        a_plugin_system.enableParallelLoading()
+        assert a_plugin_system.isParallelLoadingEnabled() is True
+
+    def test_when_disabled_then_disabled(self, a_plugin_system):
+        a_plugin_system.enableParallelLoading()
+        a_plugin_system.disableParallelLoading()
+        assert a_plugin_system.isParallelLoadingEnabled() is False
+
+    def test_when_enabled_then_leftmost_plugins_are_loaded(
+        self,
+        a_plugin_system,
+        the_cpp_plugins_root_path,
+        plugin_a_identifier,
+        plugin_b_identifier,
+        mock_logger,
+    ):
+        resources_path = pathlib.Path(the_cpp_plugins_root_path)
+        path_a = resources_path / "pathA"
+        path_b = resources_path / "pathB"
+        path_c = resources_path / "pathC"
+        path_a_lib = path_a / f"pathA.{lib_ext}"
+        path_c_lib = path_c / f"pathC.{lib_ext}"
+        a_plugin_system.enableParallelLoading()
+
+        a_plugin_system.scan(paths=os.pathsep.join((str(path_c), str(path_b), str(path_a))))
+
+        assert set(a_plugin_system.identifiers()) == {plugin_a_identifier, plugin_b_identifier}
+        path, plugin = a_plugin_system.plugin(plugin_a_identifier)
+        assert "pathC" in path.parts
+        assert plugin.identifier() == plugin_a_identifier
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            f"CppPluginSystem: Skipping '{plugin_a_identifier}' defined in '{path_a_lib}'."
+            f" Already registered by '{path_c_lib}'",
+        )
+
+    def test_when_enabled_and_plugins_broken_then_skipped(
+        self, broken_cpp_plugins_path, a_plugin_system, mock_logger
+    ):
+        a_plugin_system.enableParallelLoading()
+
+        a_plugin_system.scan(broken_cpp_plugins_path)
+
+        assert not a_plugin_system.identifiers()
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            "CppPluginSystem: Null plugin returned by"
+            f" '{os.path.join(broken_cpp_plugins_path, f'factory-return-null.{lib_ext}')}'",
+        )
+
+
+class Test_CppPluginSystem_scanCache:
+    def test_when_default_constructed_then_path_is_empty(self, a_plugin_system):
+        assert a_plugin_system.scanCachePath() == pathlib.Path()
+
+    def test_when_path_set_then_path_is_retained(self, a_plugin_system, a_scan_cache_path):
+        a_plugin_system.setScanCachePath(a_scan_cache_path)
+        assert a_plugin_system.scanCachePath() == a_scan_cache_path
+
+    def test_when_scanned_then_cache_file_written(
+        self, a_plugin_system, a_cpp_plugin_path, a_scan_cache_path, plugin_a_identifier
+    ):
+        a_plugin_system.setScanCachePath(a_scan_cache_path)
+
+        a_plugin_system.scan(a_cpp_plugin_path)
+
+        cache_lines = a_scan_cache_path.read_text(encoding="utf-8").splitlines()
+        assert cache_lines[0] == "openassetio-cpp-plugin-scan-cache 1"
+        assert len(cache_lines) == 2
+        assert cache_lines[1].endswith(
+            f"\t{plugin_a_identifier}\t{os.path.join(a_cpp_plugin_path, f'pathA.{lib_ext}')}"
+        )
+
+    def test_when_scanned_with_cache_then_plugins_registered_from_cache(
+        self,
+        a_plugin_system,
+        the_cpp_plugins_root_path,
+        a_scan_cache_path,
+        plugin_a_identifier,
+        plugin_b_identifier,
+        mock_logger,
+    ):
+        resources_path = pathlib.Path(the_cpp_plugins_root_path)
+        path_a_lib = resources_path / "pathA" / f"pathA.{lib_ext}"
+        path_c_lib = resources_path / "pathC" / f"pathC.{lib_ext}"
+        paths = os.pathsep.join(
+            str(resources_path / subdir) for subdir in ("pathA", "pathB", "pathC")
+        )
+        a_plugin_system.setScanCachePath(a_scan_cache_path)
+        a_plugin_system.scan(paths)
+        mock_logger.mock.reset_mock()
+
+        cached_plugin_system = CppPluginSystem(mock_logger)
+        cached_plugin_system.setScanCachePath(a_scan_cache_path)
+        cached_plugin_system.scan(paths)
+
+        assert set(cached_plugin_system.identifiers()) == {
+            plugin_a_identifier,
+            plugin_b_identifier,
+        }
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            f"CppPluginSystem: Registered plug-in '{plugin_a_identifier}' from '{path_a_lib}'"
+            " using the scan cache",
+        )
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            f"CppPluginSystem: Skipping '{plugin_a_identifier}' defined in '{path_c_lib}'."
+            f" Already registered by '{path_a_lib}'",
+        )
+        path, plugin = cached_plugin_system.plugin(plugin_a_identifier)
+        assert path == path_a_lib
+        assert plugin.identifier() == plugin_a_identifier
+
+    def test_when_library_modified_then_cache_entry_not_used(
+        self, a_plugin_system, a_copy_of_a_cpp_plugin_path, a_scan_cache_path, mock_logger
+    ):
+        a_plugin_system.setScanCachePath(a_scan_cache_path)
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+        mock_logger.mock.reset_mock()
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        stat = lib_path.stat()
+        os.utime(lib_path, ns=(stat.st_atime_ns, stat.st_mtime_ns + 1_000_000_000))
+
+        a_plugin_system.reset()
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        for call in mock_logger.mock.log.call_args_list:
+            assert "using the scan cache" not in call.args[1]
+
+    def test_when_cached_identifier_is_stale_then_plugin_raises_and_entry_removed(
+        self,
+        a_plugin_system,
+        a_copy_of_a_cpp_plugin_path,
+        a_scan_cache_path,
+        plugin_a_identifier,
+        mock_logger,
+    ):
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        a_plugin_system.setScanCachePath(a_scan_cache_path)
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+        a_scan_cache_path.write_text(
+            a_scan_cache_path.read_text(encoding="utf-8").replace(
+                plugin_a_identifier, "stale.identifier"
+            ),
+            encoding="utf-8",
+        )
+
+        cached_plugin_system = CppPluginSystem(mock_logger)
+        cached_plugin_system.setScanCachePath(a_scan_cache_path)
+        cached_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        assert cached_plugin_system.identifiers() == ["stale.identifier"]
+        with pytest.raises(
+            errors.InputValidationException,
+            match=re.escape(
+                f"CppPluginSystem: Plug-in 'stale.identifier' is no longer provided by"
+                f" '{lib_path}' (provides '{plugin_a_identifier}')"
+            ),
+        ):
+            cached_plugin_system.plugin("stale.identifier")
+        assert "stale.identifier" not in a_scan_cache_path.read_text(encoding="utf-8")
+
+    def test_when_cache_file_unrecognised_then_warning_logged_and_plugins_loaded(
+        self,
+        a_plugin_system,
+        a_cpp_plugin_path,
+        a_scan_cache_path,
+        plugin_a_identifier,
+        mock_logger,
+    ):
+        a_scan_cache_path.write_text("not a cache\n", encoding="utf-8")
+        a_plugin_system.setScanCachePath(a_scan_cache_path)
+
+        a_plugin_system.scan(a_cpp_plugin_path)
+
+        assert a_plugin_system.identifiers() == [plugin_a_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            f"CppPluginSystem: Ignoring unrecognised scan cache '{a_scan_cache_path}'",
+        )
+
+
+class Test_CppPluginSystem_manifest:
+    def test_manifest_extension_has_expected_value(self):
+        assert CppPluginSystem.kManifestExtension == ".openassetio-plugin.toml"
+
+    def test_when_library_has_manifest_then_registered_from_manifest(
+        self, a_plugin_system, a_copy_of_a_cpp_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        write_manifest(
+            lib_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "generic"
+            displayName = "Plugin A"
+
+            [plugin.info]
+            aString = "a value"
+            anInt = 1
+            aFloat = 1.5
+            aBool = true
+            """,
+        )
+
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        assert a_plugin_system.identifiers() == [plugin_a_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kDebug,
+            f"CppPluginSystem: Registered plug-in '{plugin_a_identifier}' from '{lib_path}'"
+            " using its manifest",
+        )
+        manifest = a_plugin_system.manifest(plugin_a_identifier)
+        assert manifest.identifier == plugin_a_identifier
+        assert manifest.kind == "generic"
+        assert manifest.displayName == "Plugin A"
+        assert manifest.info == {"aString": "a value", "anInt": 1, "aFloat": 1.5, "aBool": True}
+
+        path, plugin = a_plugin_system.plugin(plugin_a_identifier)
+        assert path == lib_path
+        assert plugin.identifier() == plugin_a_identifier
+
+    def test_when_plugin_requested_concurrently_then_loaded_once(
+        self, a_plugin_system, a_copy_of_a_cpp_plugin_path, plugin_a_identifier
+    ):
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        write_manifest(
+            lib_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "generic"
+            """,
+        )
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        num_threads = 8
+        barrier = threading.Barrier(num_threads)
+        plugins = [None] * num_threads
+
+        def request_plugin(idx):
+            barrier.wait()
+            _, plugins[idx] = a_plugin_system.plugin(plugin_a_identifier)
+
+        threads = [
+            threading.Thread(target=request_plugin, args=(idx,)) for idx in range(num_threads)
+        ]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        assert all(plugin is plugins[0] for plugin in plugins)
+        assert plugins[0].identifier() == plugin_a_identifier
+
+    def test_when_manifest_identifier_is_incorrect_then_plugin_raises(
+        self, a_plugin_system, a_copy_of_a_cpp_plugin_path, plugin_a_identifier
+    ):
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        write_manifest(
+            lib_path,
+            """
+            [plugin]
+            identifier = "incorrect.identifier"
+            kind = "generic"
+            """,
+        )
+
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        # Library is not loaded during scan.
+        assert a_plugin_system.identifiers() == ["incorrect.identifier"]
+        with pytest.raises(
+            errors.InputValidationException,
+            match=re.escape(
+                f"CppPluginSystem: Plug-in 'incorrect.identifier' is no longer provided by"
+                f" '{lib_path}' (provides '{plugin_a_identifier}')"
+            ),
+        ):
+            a_plugin_system.plugin("incorrect.identifier")
+
+    @pytest.mark.parametrize(
+        "manifest_text,expected_reason",
+        [
+            (
+                '[plugin]\nkind = "generic"',
+                "a plug-in identifier and kind are required",
+            ),
+            (
+                '[plugin]\nidentifier = "some.identifier"',
+                "a plug-in identifier and kind are required",
+            ),
+            (
+                '[plugin]\nidentifier = "some.identifier"\nkind = "generic"\n'
+                "[plugin.info]\nanArray = [1, 2]",
+                "unsupported value type for 'anArray'",
+            ),
+        ],
+    )
+    def test_when_manifest_is_invalid_then_warning_logged_and_library_loaded(
+        self,
+        a_plugin_system,
+        a_copy_of_a_cpp_plugin_path,
+        plugin_a_identifier,
+        mock_logger,
+        manifest_text,
+        expected_reason,
+    ):
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        manifest_path = write_manifest(lib_path, manifest_text)
+
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        assert a_plugin_system.identifiers() == [plugin_a_identifier]
+        assert a_plugin_system.manifest(plugin_a_identifier) is None
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            f"CppPluginSystem: Ignoring invalid manifest '{manifest_path}': {expected_reason}",
+        )
+
+    def test_when_manifest_is_not_toml_then_warning_logged_and_library_loaded(
+        self, a_plugin_system, a_copy_of_a_cpp_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        lib_path = a_copy_of_a_cpp_plugin_path / f"pathA.{lib_ext}"
+        manifest_path = write_manifest(lib_path, "not toml")
+
+        a_plugin_system.scan(str(a_copy_of_a_cpp_plugin_path))
+
+        assert a_plugin_system.identifiers() == [plugin_a_identifier]
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            RegexMatch(
+                f"^CppPluginSystem: Ignoring invalid manifest '{re.escape(str(manifest_path))}':"
+            ),
+        )
+
+    def test_when_library_has_no_manifest_then_manifest_is_none(
+        self, a_plugin_system, a_cpp_plugin_path, plugin_a_identifier
+    ):
+        a_plugin_system.scan(a_cpp_plugin_path)
+
+        assert a_plugin_system.manifest(plugin_a_identifier) is None
+
+    def test_when_plugin_not_found_then_raises_InputValidationException(self, a_plugin_system):
+        with pytest.raises(
+            errors.InputValidationException,
+            match="CppPluginSystem: No plug-in registered with the identifier 'nonexistent'",
+        ):
+            a_plugin_system.manifest("nonexistent")
+
+
 class Test_CppPluginSystem_reset:
     def test_when_reset_then_identifiers_empty(
         self, a_plugin_system, a_cpp_plugin_path, plugin_a_identifier
@@ -321,11 +683,35 @@ class RegexMatch:
         return bool(re.search(self.__pattern, text))
 
 
+def write_manifest(lib_path, manifest_text):
+    """
+    Write a plugin manifest alongside a plugin library.
+    """
+    manifest_path = lib_path.parent / f"{lib_path.stem}{CppPluginSystem.kManifestExtension}"
+    manifest_path.write_text(textwrap.dedent(manifest_text), encoding="utf-8")
+    return manifest_path
+
+
 @pytest.fixture
 def a_plugin_system(mock_logger):
     return CppPluginSystem(mock_logger)
 
 
+@pytest.fixture
+def a_scan_cache_path(tmp_path):
+    return tmp_path / "scan.cache"
+
+
+@pytest.fixture
+def a_copy_of_a_cpp_plugin_path(a_cpp_plugin_path, tmp_path):
+    """
+    Copy of a plugin directory that can be safely modified.
+    """
+    copy_path = tmp_path / "pathACopy"
+    shutil.copytree(a_cpp_plugin_path, copy_path)
+    return copy_path
+
+
 @pytest.fixture(scope="module", autouse=True)
 def skip_if_no_test_plugins_available(the_cpp_plugins_root_path):
     """
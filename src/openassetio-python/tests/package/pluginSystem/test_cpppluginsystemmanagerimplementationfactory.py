@@ -24,12 +24,14 @@ ManagerImplementationFactoryInterface implementation.
 
 import os
 import re
+import shutil
+import textwrap
 
 import pytest
 
 from openassetio import errors
 from openassetio.hostApi import ManagerFactory
-from openassetio.pluginSystem import CppPluginSystemManagerImplementationFactory
+from openassetio.pluginSystem import CppPluginSystem, CppPluginSystemManagerImplementationFactory
 
 
 lib_ext = "so" if os.name == "posix" else "dll"
@@ -113,6 +115,106 @@ class Test_CppPluginSystemManagerImplementationFactory_identifiers:
 
         mock_logger.mock.log.assert_any_call(mock_logger.Severity.kWarning, expected_log_message)
 
+    def test_when_manifest_declares_manager_plugin_then_included(
+        self, a_copy_of_a_cpp_manager_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        write_manifest(
+            a_copy_of_a_cpp_manager_plugin_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "manager"
+            """,
+        )
+        factory = CppPluginSystemManagerImplementationFactory(
+            str(a_copy_of_a_cpp_manager_plugin_path), mock_logger
+        )
+
+        assert factory.identifiers() == [plugin_a_identifier]
+
+    def test_when_manifest_declares_non_manager_plugin_then_excluded_and_logs_warning(
+        self, a_copy_of_a_cpp_manager_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        write_manifest(
+            a_copy_of_a_cpp_manager_plugin_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "generic"
+            """,
+        )
+        factory = CppPluginSystemManagerImplementationFactory(
+            str(a_copy_of_a_cpp_manager_plugin_path), mock_logger
+        )
+
+        assert factory.identifiers() == []
+
+        mock_logger.mock.log.assert_any_call(
+            mock_logger.Severity.kWarning,
+            f"Plugin '{plugin_a_identifier}' is not a manager plugin as its manifest declares it"
+            " to be of kind 'generic'",
+        )
+
+
+class Test_CppPluginSystemManagerImplementationFactory_managerDetail:
+    def test_when_no_manifest_then_returns_none(
+        self, a_cpp_manager_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        factory = CppPluginSystemManagerImplementationFactory(
+            a_cpp_manager_plugin_path, mock_logger
+        )
+
+        assert factory.managerDetail(plugin_a_identifier) is None
+
+    def test_when_manifest_declares_manager_details_then_returns_details(
+        self, a_copy_of_a_cpp_manager_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        write_manifest(
+            a_copy_of_a_cpp_manager_plugin_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "manager"
+            displayName = "Manager A"
+
+            [plugin.info]
+            aKey = "a value"
+            """,
+        )
+        factory = CppPluginSystemManagerImplementationFactory(
+            str(a_copy_of_a_cpp_manager_plugin_path), mock_logger
+        )
+
+        assert factory.managerDetail(plugin_a_identifier) == ManagerFactory.ManagerDetail(
+            identifier=plugin_a_identifier, displayName="Manager A", info={"aKey": "a value"}
+        )
+
+    def test_when_manifest_has_no_display_name_then_returns_none(
+        self, a_copy_of_a_cpp_manager_plugin_path, plugin_a_identifier, mock_logger
+    ):
+        write_manifest(
+            a_copy_of_a_cpp_manager_plugin_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "manager"
+            """,
+        )
+        factory = CppPluginSystemManagerImplementationFactory(
+            str(a_copy_of_a_cpp_manager_plugin_path), mock_logger
+        )
+
+        assert factory.managerDetail(plugin_a_identifier) is None
+
+    def test_when_plugin_not_found_then_raises_InputValidationException(self, mock_logger):
+        factory = CppPluginSystemManagerImplementationFactory("", mock_logger)
+
+        with pytest.raises(
+            errors.InputValidationException,
+            match=re.escape("CppPluginSystem: No plug-in registered with the identifier 'nope'"),
+        ):
+            factory.managerDetail("nope")
+
 
 class Test_CppPluginSystemManagerImplementationFactory_instantiate:
     def test_when_non_manager_plugin_then_raises_InputValidationException(
@@ -196,6 +298,56 @@ class Test_ManagerFactory_CppPluginSystemManagerImplementationFactory:
 
         assert manager.identifier() == plugin_a_identifier
 
+    def test_when_manifest_declares_manager_details_then_available_without_instantiating(
+        self,
+        a_copy_of_a_cpp_manager_plugin_path,
+        plugin_a_identifier,
+        mock_logger,
+        mock_host_interface,
+    ):
+        write_manifest(
+            a_copy_of_a_cpp_manager_plugin_path,
+            f"""
+            [plugin]
+            identifier = "{plugin_a_identifier}"
+            kind = "manager"
+            displayName = "Manager A"
+            """,
+        )
+        manager_factory = ManagerFactory(
+            mock_host_interface,
+            CppPluginSystemManagerImplementationFactory(
+                str(a_copy_of_a_cpp_manager_plugin_path), mock_logger
+            ),
+            mock_logger,
+        )
+
+        # Note that the plugin's `info()` raises, so this would fail if
+        # the manager were instantiated.
+        assert manager_factory.availableManagers() == {
+            plugin_a_identifier: ManagerFactory.ManagerDetail(
+                identifier=plugin_a_identifier, displayName="Manager A", info={}
+            )
+        }
+
+
+def write_manifest(plugin_dir_path, manifest_text):
+    """
+    Write a plugin manifest alongside the managerA plugin library.
+    """
+    manifest_path = plugin_dir_path / f"managerA{CppPluginSystem.kManifestExtension}"
+    manifest_path.write_text(textwrap.dedent(manifest_text), encoding="utf-8")
+
+
+@pytest.fixture
+def a_copy_of_a_cpp_manager_plugin_path(a_cpp_manager_plugin_path, tmp_path):
+    """
+    Copy of a manager plugin directory that manifests can be added to.
+    """
+    copy_path = tmp_path / "managerACopy"
+    shutil.copytree(a_cpp_manager_plugin_path, copy_path)
+    return copy_path
+
 
 @pytest.fixture(scope="module", autouse=True)
 def skip_if_no_test_plugins_available(the_cpp_plugins_root_path):
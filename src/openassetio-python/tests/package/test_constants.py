@@ -26,3 +26,5 @@ def test():
     assert constants.kInfoKey_SmallIcon == "smallIcon"
     assert constants.kInfoKey_Icon == "icon"
     assert constants.kInfoKey_EntityReferencesMatchPrefix == "entityReferencesMatchPrefix"
+    assert constants.kInfoKey_EntityReferencesMatchPrefixes == "entityReferencesMatchPrefixes"
+    assert constants.kInfoKey_IsThreadSafe == "isThreadSafe"
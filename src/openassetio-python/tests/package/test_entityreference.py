@@ -23,7 +23,7 @@ Tests for the EntityReference type.
 
 import pytest
 
-from openassetio import EntityReference
+from openassetio import EntityReference, EntityReferenceInterner
 
 
 class Test_EntityReference_inheritance:
@@ -61,3 +61,44 @@ class Test_EntityReference_string_equivalence:
     def test_when_used_with_format_then_result_contains_toString_value(self):
         a_ref = EntityReference("Some 🍟 with that?")
         assert f"{a_ref}" == a_ref.toString()
+
+
+class Test_EntityReference_hash:
+    def test_when_same_then_hashes_equal(self):
+        assert hash(EntityReference("something")) == hash(EntityReference("something"))
+
+    def test_can_be_used_as_dict_key(self):
+        a_dict = {EntityReference("a"): 1, EntityReference("b"): 2}
+        assert a_dict[EntityReference("b")] == 2
+        assert EntityReference("c") not in a_dict
+
+
+class Test_EntityReferenceInterner:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(EntityReferenceInterner):
+                pass
+
+    def test_when_constructed_then_empty(self):
+        assert EntityReferenceInterner().size() == 0
+
+    def test_when_string_interned_then_reference_returned(self):
+        interner = EntityReferenceInterner()
+        a_ref = interner.intern("a://ref")
+        assert a_ref == EntityReference("a://ref")
+        assert hash(a_ref) == hash(EntityReference("a://ref"))
+
+    def test_when_same_string_interned_twice_then_pooled_once(self):
+        interner = EntityReferenceInterner()
+        interner.intern("a://ref")
+        interner.intern("a://ref")
+        interner.intern("a://other")
+        assert interner.size() == 2
+
+    def test_when_cleared_then_empty_and_references_remain_valid(self):
+        interner = EntityReferenceInterner()
+        a_ref = interner.intern("a://ref")
+        interner.clear()
+        assert interner.size() == 0
+        assert a_ref.toString() == "a://ref"
@@ -55,6 +55,9 @@ class Test_package_imports:
     def test_importing_EntityReference_succeeds(self):
         from openassetio import EntityReference
 
+    def test_importing_EntityReferenceInterner_succeeds(self):
+        from openassetio import EntityReferenceInterner
+
     def test_importing_log_succeeds(self):
         from openassetio import log
 
@@ -83,6 +86,23 @@ class Test_hostApi_imports:
     def test_importing_ManagerImplementationFactoryInterface_succeeds(self):
         from openassetio.hostApi import ManagerImplementationFactoryInterface
 
+    def test_importing_ResolvedBatch_succeeds(self):
+        from openassetio.hostApi import ResolvedBatch
+
+    def test_importing_ResolveStream_succeeds(self):
+        from openassetio.hostApi import ResolveStream
+
+    def test_importing_RelationshipTraverser_succeeds(self):
+        from openassetio.hostApi import RelationshipTraverser
+
+    def test_importing_BatchFuture_types_succeeds(self):
+        from openassetio.hostApi import (
+            ResolveFuture,
+            EntityExistsFuture,
+            PublishFuture,
+            RelationshipQueryFuture,
+        )
+
     def test_importing_terminology_succeeds(self):
         from openassetio.hostApi import terminology
 
@@ -100,6 +120,9 @@ class Test_managerApi_imports:
     def test_importing_ManagerStateBase_succeeds(self):
         from openassetio.managerApi import ManagerStateBase
 
+    def test_importing_CachingManagerInterface_succeeds(self):
+        from openassetio.managerApi import CachingManagerInterface
+
 
 class Test_pluginSystem_imports:
     def test_importing_PythonPluginSystemManagerPlugin_succeeds(self):
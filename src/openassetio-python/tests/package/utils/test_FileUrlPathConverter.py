@@ -166,6 +166,58 @@ class Test_pathFromUrl:
             raise RuntimeError("Unhandled URL mapping")
 
 
+class Test_pathsToUrls:
+    @pytest.mark.parametrize("path_type", (PathType.kPOSIX, PathType.kWindows))
+    def test_when_all_paths_valid_then_matches_pathToUrl(
+        self, file_path_to_url_json, url_path_converter, path_type
+    ):
+        url_key = "URL_windows" if path_type == PathType.kWindows else "URL_posix"
+        paths = [
+            case["file_path"] for case in file_path_to_url_json if isinstance(case[url_key], str)
+        ]
+
+        actual = url_path_converter.pathsToUrls(paths, path_type)
+
+        assert actual == [url_path_converter.pathToUrl(path, path_type) for path in paths]
+
+    def test_when_empty_then_returns_empty(self, url_path_converter):
+        assert url_path_converter.pathsToUrls([]) == []
+
+    def test_when_path_invalid_then_raises_for_first_invalid_path(self, url_path_converter):
+        with pytest.raises(
+            InputValidationException,
+            match=re.escape(error_messages["relative-path"].format("first/relative")),
+        ):
+            url_path_converter.pathsToUrls(
+                ["/valid", "first/relative", "second/relative"], PathType.kPOSIX
+            )
+
+
+class Test_pathsFromUrls:
+    @pytest.mark.parametrize("path_type", (PathType.kPOSIX, PathType.kWindows))
+    def test_when_all_urls_valid_then_matches_pathFromUrl(
+        self, url_to_file_path_json, url_path_converter, path_type
+    ):
+        path_key = "file_path_windows" if path_type == PathType.kWindows else "file_path_posix"
+        urls = [case["URL"] for case in url_to_file_path_json if isinstance(case[path_key], str)]
+
+        actual = url_path_converter.pathsFromUrls(urls, path_type)
+
+        assert actual == [url_path_converter.pathFromUrl(url, path_type) for url in urls]
+
+    def test_when_empty_then_returns_empty(self, url_path_converter):
+        assert url_path_converter.pathsFromUrls([]) == []
+
+    def test_when_url_invalid_then_raises_for_first_invalid_url(self, url_path_converter):
+        with pytest.raises(
+            InputValidationException,
+            match=re.escape(error_messages["not-a-file-url"].format("http://first")),
+        ):
+            url_path_converter.pathsFromUrls(
+                ["file:///valid", "http://first", "http://second"], PathType.kPOSIX
+            )
+
+
 def exc_to_regex(exc):
     return re.escape(str(exc))
 
@@ -71,3 +71,93 @@ class Test_substitute:
         assert utils.substitute("hello {name:04d}", {"name": 1}) == "hello 0001"
         assert utils.substitute("hello {name:04d}", {"name": 123}) == "hello 0123"
         assert utils.substitute("hello {name:04d}", {"name": 12345}) == "hello 12345"
+
+
+class Test_SubstitutionTemplate:
+    def test_input_is_retained(self):
+        assert utils.SubstitutionTemplate("hello {name}").input() == "hello {name}"
+
+    @pytest.mark.parametrize(
+        "input_str",
+        [
+            "hello",
+            "",
+            "hello {name}",
+            "{name}{name}",
+            "{{escaped}} {name} }}",
+            "{frame:04d}.{ext}",
+            "{num:04d}|{fnum}|{yes}|{no}",
+        ],
+    )
+    def test_when_rendered_then_matches_substitute(self, input_str):
+        substitutions = {
+            "name": "world",
+            "frame": 12,
+            "ext": "exr",
+            "num": 123,
+            "fnum": 1.23,
+            "yes": True,
+            "no": False,
+            "extra": "ignored",
+        }
+
+        actual = utils.SubstitutionTemplate(input_str).render(substitutions)
+
+        assert actual == utils.substitute(input_str, substitutions)
+
+    def test_when_rendered_many_then_returns_substituted_string_per_dictionary(self):
+        template = utils.SubstitutionTemplate("/shots/{shot}/img.{frame:04d}.exr")
+
+        actual = template.renderMany(
+            [
+                {"shot": "sh010", "frame": 1},
+                {"shot": "sh010", "frame": 2},
+                {"shot": "sh020", "frame": 1001},
+            ]
+        )
+
+        assert actual == [
+            "/shots/sh010/img.0001.exr",
+            "/shots/sh010/img.0002.exr",
+            "/shots/sh020/img.1001.exr",
+        ]
+
+    def test_when_rendered_many_with_no_dictionaries_then_returns_empty_list(self):
+        assert utils.SubstitutionTemplate("hello {name}").renderMany([]) == []
+
+    def test_when_missing_substitution_variable_then_raises_InputValidationException(self):
+        expected_error = re.escape(
+            "SubstitutionTemplate: failed to process the input string 'hello {name}':"
+            " argument not found"
+        )
+        template = utils.SubstitutionTemplate("hello {name}")
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            template.render({})
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            template.renderMany([{"name": "world"}, {}])
+
+    @pytest.mark.parametrize(
+        "input_str,reason",
+        [
+            ("hello {name", "missing '}' in format string"),
+            ("hello name}", "unmatched '}' in format string"),
+            ("hello {}", "positional placeholders are not supported"),
+            ("hello {0}", "positional placeholders are not supported"),
+            ("hello {name:{width}}", "nested placeholders are not supported"),
+        ],
+    )
+    def test_when_invalid_input_then_raises_InputValidationException(self, input_str, reason):
+        expected_error = re.escape(
+            f"SubstitutionTemplate: failed to process the input string '{input_str}': {reason}"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.SubstitutionTemplate(input_str)
+
+    def test_when_invalid_format_specifier_for_type_then_raises_InputValidationException(self):
+        template = utils.SubstitutionTemplate("hello {name:04d}")
+
+        with pytest.raises(errors.InputValidationException, match="failed to process"):
+            template.render({"name": "world"})
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+/**
+ * @file
+ *
+ * Server exposing a manager to other processes.
+ */
+#pragma once
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/remote/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+class Channel;
+
+OPENASSETIO_DECLARE_PTR(ManagerServer)
+
+/**
+ * Serves a manager to @ref RemoteManagerInterface clients in other
+ * processes, over a Unix domain socket.
+ *
+ * Each client connection is serviced by a dedicated thread. Calls into
+ * the manager are serialized across connections, unless the manager
+ * advertises itself as thread safe using the @ref
+ * constants.kInfoKey_IsThreadSafe "isThreadSafe" info key.
+ *
+ * The manager is shared by all connections, so is initialized only
+ * once, on request of the first client. Subsequent requests to
+ * initialize, e.g. from other clients or clients reconnecting, reuse
+ * that initialization, and a warning is logged if they provide
+ * different settings. This ensures a manager is never re-initialized
+ * whilst other connections are using it.
+ *
+ * The results of batch methods are streamed back to the client as the
+ * manager provides them.
+ *
+ * This is typically run in a dedicated worker process, such as the
+ * `openassetio-remote-worker` executable, so that the host process is
+ * isolated from crashes in the manager.
+ */
+class OPENASSETIO_REMOTE_EXPORT ManagerServer final {
+ public:
+  OPENASSETIO_ALIAS_PTR(ManagerServer)
+
+  /**
+   * Construct a server for the given manager.
+   *
+   * @param managerInterface Manager to serve. This will be initialized
+   * on request of the first client.
+   * @param logger Logger for the manager and for the server itself.
+   */
+  [[nodiscard]] static ManagerServerPtr make(managerApi::ManagerInterfacePtr managerInterface,
+                                             log::LoggerInterfacePtr logger);
+
+  ~ManagerServer();
+
+  ManagerServer(const ManagerServer&) = delete;
+  ManagerServer(ManagerServer&&) noexcept = delete;
+  ManagerServer& operator=(const ManagerServer&) = delete;
+  ManagerServer& operator=(ManagerServer&&) noexcept = delete;
+
+  /**
+   * Bind to the given socket path and start listening for
+   * connections.
+   *
+   * Any existing file at the path is replaced. The socket file is
+   * removed on destruction.
+   *
+   * @throws errors.OpenAssetIOException If the socket cannot be bound.
+   */
+  void listen(const Str& socketPath);
+
+  /**
+   * Accept and service connections until @ref stop is called.
+   *
+   * Blocks the calling thread. On return, all connections have been
+   * closed.
+   *
+   * @throws errors.InputValidationException If @ref listen has not
+   * been called.
+   */
+  void serve();
+
+  /**
+   * Request that @ref serve return.
+   *
+   * This is async-signal-safe, so may be called from a signal
+   * handler.
+   */
+  void stop() const;
+
+ private:
+  struct Session;
+
+  ManagerServer(managerApi::ManagerInterfacePtr managerInterface,
+                log::LoggerInterfacePtr logger);
+
+  /// Service requests from a single client until it disconnects.
+  void serveSession(Channel& channel);
+
+  /// Join and discard sessions whose client has disconnected.
+  void reapSessions();
+
+  managerApi::ManagerInterfacePtr managerInterface_;
+  log::LoggerInterfacePtr logger_;
+  bool isThreadSafe_;
+  /// Held whilst calling the manager, unless it is thread safe.
+  std::mutex managerMutex_;
+  /// Held whilst initializing the manager.
+  std::mutex initializeMutex_;
+  /// Settings the manager was initialized with, if it has been.
+  std::optional<InfoDictionary> initializedSettings_;
+
+  Str socketPath_;
+  int listenFd_{-1};
+  /// Self-pipe used to wake @ref serve from @ref stop.
+  std::array<int, 2> stopFds_{-1, -1};
+
+  std::mutex sessionsMutex_;
+  std::list<Session> sessions_;
+};
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+/**
+ * @file
+ *
+ * Host-side proxy for a manager running in another process.
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/remote/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+namespace codec {
+class Reader;
+}  // namespace codec
+
+OPENASSETIO_DECLARE_PTR(RemoteManagerInterface)
+
+/**
+ * A ManagerInterface that forwards calls to a manager hosted by one or
+ * more @ref ManagerServer worker processes.
+ *
+ * Requests and results are exchanged through shared memory, using a
+ * compact binary encoding, with a Unix domain socket used only for
+ * signalling. Results of batch methods are streamed back to the host
+ * as the remote manager provides them, so callbacks are called
+ * progressively rather than once the whole batch is complete.
+ *
+ * One connection is made to each of the given socket paths. Each call
+ * is forwarded in its entirety over a connection not currently in use
+ * by another thread, blocking until one is available. Calls from
+ * multiple host threads can therefore be serviced concurrently by
+ * separate worker processes, without contending on locks within any
+ * one of them (e.g. the Python GIL). The same path may be given
+ * multiple times to make several connections to a single worker.
+ *
+ * If a worker process dies, the call in flight fails with an
+ * exception rather than affecting the host process. The connection is
+ * re-established on next use, replaying @ref initialize, so that a
+ * restarted worker is picked up transparently. Calls fail only if no
+ * worker can be reached.
+ *
+ * Only the core query methods are supported. In particular,
+ * stateful contexts, publishing and relationship queries are not, and
+ * their capabilities are never advertised. The @ref Context::locale
+ * "locale" of a context is forwarded, but any manager state is not.
+ * Logging by the remote manager goes to the worker's logger.
+ *
+ * This class is safe to call from multiple threads concurrently.
+ *
+ * @see ManagerServer
+ */
+class OPENASSETIO_REMOTE_EXPORT RemoteManagerInterface final
+    : public managerApi::ManagerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(RemoteManagerInterface)
+
+  /// Socket paths of worker processes to connect to.
+  using SocketPaths = std::vector<Str>;
+
+  /// Default size, in bytes, of the shared memory buffer used for
+  /// each direction of each connection.
+  static constexpr std::size_t kDefaultRingCapacity = std::size_t{1} << 20U;
+
+  /**
+   * Connect to the manager served at each of the given socket paths.
+   *
+   * @param socketPaths Paths to listening @ref ManagerServer sockets.
+   * @param ringCapacity Size, in bytes, of the shared memory buffer
+   * used for each direction of each connection. Messages larger than
+   * this are streamed through the buffer in chunks.
+   *
+   * @throws errors.InputValidationException If `socketPaths` is empty
+   * or `ringCapacity` is zero, or if the servers host managers with
+   * differing identifiers.
+   * @throws errors.OpenAssetIOException If a connection cannot be
+   * established.
+   */
+  [[nodiscard]] static RemoteManagerInterfacePtr make(
+      SocketPaths socketPaths, std::size_t ringCapacity = kDefaultRingCapacity);
+
+  ~RemoteManagerInterface() override;
+
+  RemoteManagerInterface(const RemoteManagerInterface&) = delete;
+  RemoteManagerInterface(RemoteManagerInterface&&) noexcept = delete;
+  RemoteManagerInterface& operator=(const RemoteManagerInterface&) = delete;
+  RemoteManagerInterface& operator=(RemoteManagerInterface&&) noexcept = delete;
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+  /// Forwarded to every connection.
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+  /// Forwarded to every connection.
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  /**
+   * Capabilities of the remote manager, limited to those that can be
+   * forwarded.
+   */
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] std::vector<bool> areEntityReferenceStrings(
+      const std::vector<std::string_view>& someStrings,
+      const managerApi::HostSessionPtr& hostSession) override;
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  struct Connection;
+
+  /// Handler for the result of a request.
+  using ResultHandler = std::function<void(codec::Reader& reader)>;
+  /// Handler for each success or error element of a batch response.
+  using ElementHandler =
+      std::function<void(bool isError, std::size_t index, codec::Reader& reader)>;
+
+  RemoteManagerInterface(SocketPaths socketPaths, std::size_t ringCapacity);
+
+  /**
+   * Send a request over an idle connection, calling `elementHandler`
+   * for each streamed batch element, then `resultHandler` with the
+   * final result.
+   *
+   * @throws errors.OpenAssetIOException If no worker can be reached,
+   * or any exception raised by the remote manager.
+   */
+  void call(const std::vector<std::byte>& request, const ResultHandler& resultHandler = {},
+            const ElementHandler& elementHandler = {});
+
+  /// As @ref call, but for every connection in turn.
+  void callAll(const std::vector<std::byte>& request, const ResultHandler& resultHandler = {});
+
+  /// Wait for and take an idle connection from the pool.
+  Connection& acquireConnection();
+  /// Return a connection to the pool.
+  void releaseConnection(Connection& connection);
+
+  /// Perform a request on a specific connection.
+  void callOn(Connection& connection, const std::vector<std::byte>& request,
+              const ResultHandler& resultHandler, const ElementHandler& elementHandler);
+
+  /// (Re)connect if necessary, replaying any initialization.
+  void ensureConnected(Connection& connection);
+
+  std::size_t ringCapacity_;
+  std::vector<std::unique_ptr<Connection>> connections_;
+  Identifier identifier_;
+  Str displayName_;
+  std::atomic<std::uint32_t> capabilities_{0};
+
+  std::mutex poolMutex_;
+  std::condition_variable poolCondition_;
+  std::deque<Connection*> idleConnections_;
+
+  mutable std::mutex initializeMutex_;
+  /// Encoded initialize request, replayed on reconnection.
+  std::optional<std::vector<std::byte>> initializeRequest_;
+};
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
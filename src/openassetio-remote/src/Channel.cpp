@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include "Channel.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+namespace {
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_DONTWAIT | MSG_NOSIGNAL;
+#else
+// E.g. macOS, where SO_NOSIGPIPE is set on the socket instead.
+constexpr int kSendFlags = MSG_DONTWAIT;
+#endif
+
+/// Guard against corrupt length prefixes causing huge allocations.
+constexpr std::uint64_t kMaxMessageSize = std::uint64_t{1} << 32U;
+
+[[noreturn]] void throwSystemError(const std::string& what) {
+  throw errors::OpenAssetIOException{what + ": " + std::strerror(errno)};
+}
+
+[[noreturn]] void throwDisconnected() {
+  throw errors::OpenAssetIOException{"Remote peer disconnected"};
+}
+
+void configureSocket(const int socketFd) {
+  ::fcntl(socketFd, F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+  const int enable = 1;
+  ::setsockopt(socketFd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#endif
+}
+
+/// Unique name for a shared memory segment, unlinked after creation.
+std::string uniqueSegmentName() {
+  static std::atomic<std::uint64_t> counter{0};
+  thread_local std::mt19937_64 random{std::random_device{}()};
+  return "/openassetio-remote-" + std::to_string(::getpid()) + "-" +
+         std::to_string(counter.fetch_add(1)) + "-" + std::to_string(random());
+}
+}  // namespace
+
+std::unique_ptr<Channel> Channel::connect(const Str& socketPath, const std::size_t ringCapacity) {
+  if (ringCapacity == 0) {
+    throw errors::InputValidationException{"Ring capacity must be greater than zero"};
+  }
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socketPath.size() >= sizeof(address.sun_path)) {
+    throw errors::InputValidationException{"Socket path too long: " + socketPath};
+  }
+  std::memcpy(static_cast<char*>(address.sun_path), socketPath.data(), socketPath.size());
+
+  const int socketFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (socketFd < 0) {
+    throwSystemError("Failed to create socket");
+  }
+  configureSocket(socketFd);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (::connect(socketFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+    const int error = errno;
+    ::close(socketFd);
+    errno = error;
+    throwSystemError("Failed to connect to '" + socketPath + "'");
+  }
+
+  const std::size_t mappingSize = sizeof(Segment) + 2 * ringCapacity;
+  const std::string segmentName = uniqueSegmentName();
+  const int segmentFd =
+      ::shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (segmentFd < 0) {
+    const int error = errno;
+    ::close(socketFd);
+    errno = error;
+    throwSystemError("Failed to create shared memory segment");
+  }
+  // The segment lives on only for as long as it is mapped.
+  ::shm_unlink(segmentName.c_str());
+
+  void* mapping = MAP_FAILED;
+  if (::ftruncate(segmentFd, static_cast<off_t>(mappingSize)) == 0) {
+    mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, segmentFd, 0);
+  }
+  if (mapping == MAP_FAILED) {
+    const int error = errno;
+    ::close(segmentFd);
+    ::close(socketFd);
+    errno = error;
+    throwSystemError("Failed to map shared memory segment");
+  }
+  auto* segment = new (mapping) Segment{};
+  segment->capacity = ringCapacity;
+
+  // Hand the segment to the server, along with a single byte of
+  // payload, since ancillary data cannot be sent alone.
+  std::byte payload{0};
+  iovec iov{&payload, 1};
+  alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int))> control{};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.data();
+  msg.msg_controllen = control.size();
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  std::memcpy(CMSG_DATA(cmsg), &segmentFd, sizeof(int));
+
+  const ssize_t sent = ::sendmsg(socketFd, &msg, kSendFlags & ~MSG_DONTWAIT);
+  const int error = errno;
+  ::close(segmentFd);
+  if (sent != 1) {
+    ::munmap(mapping, mappingSize);
+    ::close(socketFd);
+    errno = error;
+    throwSystemError("Failed to send shared memory segment to '" + socketPath + "'");
+  }
+
+  return std::unique_ptr<Channel>{new Channel{socketFd, mapping, mappingSize, true}};
+}
+
+std::unique_ptr<Channel> Channel::accept(const int listenFd) {
+  const int socketFd = ::accept(listenFd, nullptr, nullptr);
+  if (socketFd < 0) {
+    throwSystemError("Failed to accept connection");
+  }
+  configureSocket(socketFd);
+
+  std::byte payload{0};
+  iovec iov{&payload, 1};
+  alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int))> control{};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.data();
+  msg.msg_controllen = control.size();
+
+  const ssize_t received = ::recvmsg(socketFd, &msg, 0);
+  const cmsghdr* cmsg = received == 1 ? CMSG_FIRSTHDR(&msg) : nullptr;
+  if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+    ::close(socketFd);
+    throw errors::OpenAssetIOException{"Client did not provide a shared memory segment"};
+  }
+  int segmentFd = -1;
+  std::memcpy(&segmentFd, CMSG_DATA(cmsg), sizeof(int));
+
+  struct stat segmentStat {};
+  void* mapping = MAP_FAILED;
+  std::size_t mappingSize = 0;
+  if (::fstat(segmentFd, &segmentStat) == 0 &&
+      static_cast<std::size_t>(segmentStat.st_size) > sizeof(Segment)) {
+    mappingSize = static_cast<std::size_t>(segmentStat.st_size);
+    mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, segmentFd, 0);
+  }
+  ::close(segmentFd);
+  if (mapping == MAP_FAILED) {
+    ::close(socketFd);
+    throw errors::OpenAssetIOException{"Failed to map client shared memory segment"};
+  }
+  if (sizeof(Segment) + 2 * static_cast<Segment*>(mapping)->capacity != mappingSize) {
+    ::munmap(mapping, mappingSize);
+    ::close(socketFd);
+    throw errors::OpenAssetIOException{"Client shared memory segment is malformed"};
+  }
+
+  return std::unique_ptr<Channel>{new Channel{socketFd, mapping, mappingSize, false}};
+}
+
+Channel::Channel(const int socketFd, void* mapping, const std::size_t mappingSize,
+                 const bool isClient)
+    : socketFd_{socketFd}, mapping_{mapping}, mappingSize_{mappingSize} {
+  auto* segment = static_cast<Segment*>(mapping);
+  auto* data = static_cast<std::byte*>(mapping) + sizeof(Segment);
+  const std::uint64_t capacity = segment->capacity;
+  const Ring clientToServer{&segment->indices[0], data, capacity};
+  const Ring serverToClient{&segment->indices[1], data + capacity, capacity};
+  outgoing_ = isClient ? clientToServer : serverToClient;
+  incoming_ = isClient ? serverToClient : clientToServer;
+}
+
+Channel::~Channel() {
+  ::munmap(mapping_, mappingSize_);
+  ::close(socketFd_);
+}
+
+void Channel::send(const codec::Message& message) {
+  const std::uint64_t size = message.size();
+  write(reinterpret_cast<const std::byte*>(&size), sizeof(size));
+  write(message.data(), message.size());
+}
+
+codec::Message Channel::receive() {
+  std::uint64_t size = 0;
+  read(reinterpret_cast<std::byte*>(&size), sizeof(size));
+  if (size > kMaxMessageSize) {
+    throw errors::OpenAssetIOException{"Received message exceeds maximum size"};
+  }
+  codec::Message message(size);
+  read(message.data(), message.size());
+  return message;
+}
+
+bool Channel::isOpen() const {
+  std::byte peeked{0};
+  const ssize_t received = ::recv(socketFd_, &peeked, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (received == 0) {
+    return false;
+  }
+  return received > 0 || errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+}
+
+void Channel::shutdown() { ::shutdown(socketFd_, SHUT_RDWR); }
+
+void Channel::write(const std::byte* data, std::size_t size) {
+  checkNotCorrupt();
+  const Ring& ring = outgoing_;
+  while (size > 0) {
+    const std::uint64_t tail = ring.indices->tail.load(std::memory_order_relaxed);
+    const std::uint64_t head = ring.indices->head.load(std::memory_order_acquire);
+    checkIndices(ring, head, tail);
+    const std::uint64_t space = ring.capacity - (tail - head);
+    if (space == 0) {
+      waitForDoorbell();
+      continue;
+    }
+    const std::size_t chunk = std::min<std::uint64_t>(space, size);
+    const std::size_t offset = tail % ring.capacity;
+    const std::size_t firstPart = std::min<std::uint64_t>(chunk, ring.capacity - offset);
+    std::memcpy(ring.data + offset, data, firstPart);
+    std::memcpy(ring.data, data + firstPart, chunk - firstPart);
+    ring.indices->tail.store(tail + chunk, std::memory_order_release);
+    ringDoorbell();
+    data += chunk;
+    size -= chunk;
+  }
+}
+
+void Channel::read(std::byte* data, std::size_t size) {
+  checkNotCorrupt();
+  const Ring& ring = incoming_;
+  while (size > 0) {
+    const std::uint64_t head = ring.indices->head.load(std::memory_order_relaxed);
+    const std::uint64_t tail = ring.indices->tail.load(std::memory_order_acquire);
+    checkIndices(ring, head, tail);
+    const std::uint64_t available = tail - head;
+    if (available == 0) {
+      waitForDoorbell();
+      continue;
+    }
+    const std::size_t chunk = std::min<std::uint64_t>(available, size);
+    const std::size_t offset = head % ring.capacity;
+    const std::size_t firstPart = std::min<std::uint64_t>(chunk, ring.capacity - offset);
+    std::memcpy(data, ring.data + offset, firstPart);
+    std::memcpy(data + firstPart, ring.data, chunk - firstPart);
+    ring.indices->head.store(head + chunk, std::memory_order_release);
+    ringDoorbell();
+    data += chunk;
+    size -= chunk;
+  }
+}
+
+void Channel::checkIndices(const Ring& ring, const std::uint64_t head,
+                           const std::uint64_t tail) {
+  // A corrupt index would otherwise lead to copying out of bounds of
+  // the ring, so a misbehaving peer could corrupt this process.
+  // Unsigned wraparound means this also catches `tail < head`.
+  if (tail - head <= ring.capacity) {
+    return;
+  }
+  isCorrupt_ = true;
+  shutdown();
+  throw errors::OpenAssetIOException{"Remote peer corrupted shared memory ring"};
+}
+
+void Channel::checkNotCorrupt() const {
+  if (isCorrupt_) {
+    throw errors::OpenAssetIOException{"Remote peer previously corrupted shared memory ring"};
+  }
+}
+
+void Channel::ringDoorbell() {
+  const std::byte doorbell{1};
+  while (::send(socketFd_, &doorbell, 1, kSendFlags) < 0) {
+    if (errno == EINTR) {
+      continue;
+    }
+    // A full socket buffer means the peer has unread doorbells
+    // pending already, so will wake regardless.
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return;
+    }
+    if (errno == EPIPE || errno == ECONNRESET) {
+      throwDisconnected();
+    }
+    throwSystemError("Failed to notify remote peer");
+  }
+}
+
+void Channel::waitForDoorbell() {
+  // Doorbells are only ever rung after a ring is updated, so any that
+  // arrive between checking the ring and blocking here are left
+  // pending in the socket, and we cannot miss a wakeup. Drain as many
+  // as are available, since the caller re-checks the ring anyway.
+  std::array<std::byte, 64> doorbells{};
+  const ssize_t received = ::recv(socketFd_, doorbells.data(), doorbells.size(), 0);
+  if (received > 0 || (received < 0 && errno == EINTR)) {
+    return;
+  }
+  if (received == 0 || errno == ECONNRESET) {
+    throwDisconnected();
+  }
+  throwSystemError("Failed to wait for remote peer");
+}
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
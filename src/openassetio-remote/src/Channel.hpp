@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+#include "codec.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+/**
+ * Bidirectional message channel between two processes on the same
+ * host.
+ *
+ * Message payloads are copied through a pair of single-producer,
+ * single-consumer ring buffers in a shared memory segment, one for
+ * each direction. A connected Unix domain socket is used to hand the
+ * segment to the peer, to wake a peer blocked waiting on a ring, and
+ * to detect the peer going away.
+ *
+ * The segment is created by the connecting (client) side and unlinked
+ * immediately, so it is never visible in the filesystem and is
+ * released by the kernel once both processes have unmapped it, even
+ * if either crashes.
+ *
+ * A Channel is not thread safe. Each end must be used by only one
+ * thread at a time.
+ *
+ * All methods throw errors.OpenAssetIOException on system errors, if
+ * the peer disconnects, or if the peer corrupts the ring indices in
+ * shared memory. After such an error the channel is unusable.
+ */
+class Channel final {
+ public:
+  /// Default size, in bytes, of each ring buffer.
+  static constexpr std::size_t kDefaultRingCapacity = std::size_t{1} << 20U;
+
+  /**
+   * Producer/consumer indices of a ring, in shared memory.
+   *
+   * Indices count bytes since the start of the connection and are never
+   * wrapped, so `tail - head` is always the number of unread bytes.
+   * Each is on its own cache line to avoid false sharing between the
+   * producer and consumer.
+   */
+  struct RingIndices {
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "Lock-free 64-bit atomics are required for shared memory rings");
+    /// Count of bytes consumed. Written only by the consumer.
+    alignas(64) std::atomic<std::uint64_t> head{0};
+    /// Count of bytes produced. Written only by the producer.
+    alignas(64) std::atomic<std::uint64_t> tail{0};
+  };
+
+  /// Layout of the start of the shared memory segment.
+  struct Segment {
+    std::uint64_t capacity;
+    /// Client-to-server and server-to-client rings, respectively.
+    std::array<RingIndices, 2> indices;
+    // Ring data follows, `capacity` bytes for each ring in turn.
+  };
+
+  /**
+   * Connect to a server listening at the given socket path, creating
+   * a shared memory segment with rings of the given capacity.
+   */
+  static std::unique_ptr<Channel> connect(const Str& socketPath,
+                                          std::size_t ringCapacity = kDefaultRingCapacity);
+
+  /**
+   * Accept a pending connection on a listening socket, mapping the
+   * shared memory segment provided by the client.
+   */
+  static std::unique_ptr<Channel> accept(int listenFd);
+
+  ~Channel();
+
+  Channel(const Channel&) = delete;
+  Channel(Channel&&) noexcept = delete;
+  Channel& operator=(const Channel&) = delete;
+  Channel& operator=(Channel&&) noexcept = delete;
+
+  /// Send a complete message, blocking whilst the ring is full.
+  void send(const codec::Message& message);
+
+  /// Receive a complete message, blocking until one is available.
+  codec::Message receive();
+
+  /**
+   * Check, without blocking, whether the peer is still connected.
+   *
+   * Allows a connection whose peer has since gone away to be
+   * discarded before attempting to use it.
+   */
+  [[nodiscard]] bool isOpen() const;
+
+  /**
+   * Shut down the underlying socket, waking any blocked call on
+   * either end. Safe to call from another thread.
+   */
+  void shutdown();
+
+ private:
+  /// Process-local view of a ring in the shared memory segment.
+  struct Ring {
+    RingIndices* indices;
+    std::byte* data;
+    std::uint64_t capacity;
+  };
+
+  Channel(int socketFd, void* mapping, std::size_t mappingSize, bool isClient);
+
+  void write(const std::byte* data, std::size_t size);
+  void read(std::byte* data, std::size_t size);
+
+  /**
+   * Check that indices loaded from a ring are consistent, since the
+   * peer can write to them. Otherwise, shut down and throw, leaving
+   * the channel unusable.
+   */
+  void checkIndices(const Ring& ring, std::uint64_t head, std::uint64_t tail);
+  /// Throw if the channel was previously found to be corrupt.
+  void checkNotCorrupt() const;
+
+  /// Notify the peer that a ring has changed.
+  void ringDoorbell();
+  /// Block until the peer notifies us that a ring has changed.
+  void waitForDoorbell();
+
+  int socketFd_;
+  void* mapping_;
+  std::size_t mappingSize_;
+  Ring outgoing_;
+  Ring incoming_;
+  bool isCorrupt_{false};
+};
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
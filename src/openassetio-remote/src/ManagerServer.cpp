@@ -0,0 +1,430 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/remote/ManagerServer.hpp>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "Channel.hpp"
+#include "codec.hpp"
+#include "protocol.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+
+using protocol::Opcode;
+using protocol::Response;
+
+namespace {
+using Capability = managerApi::ManagerInterface::Capability;
+using Severity = log::LoggerInterface::Severity;
+
+/**
+ * Size, in bytes, above which buffered batch results are sent to the
+ * client, rather than waiting for the batch to complete.
+ */
+constexpr std::size_t kFlushThreshold = std::size_t{64} << 10U;
+
+/// Host as described by the client, for use in the manager's session.
+class RemoteHostInterface final : public hostApi::HostInterface {
+ public:
+  RemoteHostInterface(Identifier identifier, Str displayName, InfoDictionary info)
+      : identifier_{std::move(identifier)},
+        displayName_{std::move(displayName)},
+        info_{std::move(info)} {}
+
+  [[nodiscard]] Identifier identifier() const override { return identifier_; }
+  [[nodiscard]] Str displayName() const override { return displayName_; }
+  [[nodiscard]] InfoDictionary info() override { return info_; }
+
+ private:
+  Identifier identifier_;
+  Str displayName_;
+  InfoDictionary info_;
+};
+
+managerApi::HostSessionPtr makeHostSession(Identifier identifier, Str displayName,
+                                           InfoDictionary info, log::LoggerInterfacePtr logger) {
+  return managerApi::HostSession::make(
+      managerApi::Host::make(std::make_shared<RemoteHostInterface>(
+          std::move(identifier), std::move(displayName), std::move(info))),
+      std::move(logger));
+}
+
+ContextConstPtr readContext(codec::Reader& reader) {
+  trait::TraitsDataPtr locale = reader.readTraitsData();
+  return Context::make(locale ? std::move(locale) : trait::TraitsData::make());
+}
+
+/**
+ * Encodes the elements of a batch response, sending them to the client
+ * in chunks as they accumulate.
+ */
+class BatchWriter {
+ public:
+  BatchWriter(Channel& channel, codec::Writer& writer) : channel_{channel}, writer_{writer} {}
+
+  template <class Value>
+  void success(const std::size_t index, const Value& value) {
+    writer_.writeU8(static_cast<std::uint8_t>(Response::kSuccess));
+    writer_.writeU32(static_cast<std::uint32_t>(index));
+    if constexpr (std::is_same_v<Value, bool>) {
+      writer_.writeBool(value);
+    } else if constexpr (std::is_same_v<Value, trait::TraitSet>) {
+      writer_.writeTraitSet(value);
+    } else {
+      writer_.writeTraitsData(value);
+    }
+    flushIfFull();
+  }
+
+  void error(const std::size_t index, const errors::BatchElementError& error) {
+    writer_.writeU8(static_cast<std::uint8_t>(Response::kError));
+    writer_.writeU32(static_cast<std::uint32_t>(index));
+    writer_.writeBatchElementError(error);
+    flushIfFull();
+  }
+
+ private:
+  void flushIfFull() {
+    if (writer_.message().size() >= kFlushThreshold) {
+      channel_.send(writer_.take());
+    }
+  }
+
+  Channel& channel_;
+  codec::Writer& writer_;
+};
+
+void writeEnd(codec::Writer& writer) {
+  writer.writeU8(static_cast<std::uint8_t>(Response::kEnd));
+}
+}  // namespace
+
+struct ManagerServer::Session {
+  std::unique_ptr<Channel> channel;
+  std::thread thread;
+  std::atomic<bool> isFinished{false};
+};
+
+ManagerServerPtr ManagerServer::make(managerApi::ManagerInterfacePtr managerInterface,
+                                     log::LoggerInterfacePtr logger) {
+  if (!managerInterface) {
+    throw errors::InputValidationException{"Manager interface cannot be null."};
+  }
+  if (!logger) {
+    throw errors::InputValidationException{"Logger cannot be null."};
+  }
+  return ManagerServerPtr{new ManagerServer{std::move(managerInterface), std::move(logger)}};
+}
+
+ManagerServer::ManagerServer(managerApi::ManagerInterfacePtr managerInterface,
+                             log::LoggerInterfacePtr logger)
+    : managerInterface_{std::move(managerInterface)}, logger_{std::move(logger)} {
+  const InfoDictionary info = managerInterface_->info();
+  const auto isThreadSafeIter = info.find(Str{constants::kInfoKey_IsThreadSafe});
+  isThreadSafe_ = isThreadSafeIter != info.end() &&
+                  std::holds_alternative<Bool>(isThreadSafeIter->second) &&
+                  std::get<Bool>(isThreadSafeIter->second);
+
+  if (::pipe(stopFds_.data()) != 0) {
+    throw errors::OpenAssetIOException{Str{"Failed to create pipe: "} + std::strerror(errno)};
+  }
+  for (const int stopFd : stopFds_) {
+    ::fcntl(stopFd, F_SETFD, FD_CLOEXEC);
+  }
+}
+
+ManagerServer::~ManagerServer() {
+  if (listenFd_ >= 0) {
+    ::close(listenFd_);
+    ::unlink(socketPath_.c_str());
+  }
+  for (const int stopFd : stopFds_) {
+    ::close(stopFd);
+  }
+}
+
+void ManagerServer::listen(const Str& socketPath) {
+  if (listenFd_ >= 0) {
+    throw errors::InputValidationException{"Server is already listening."};
+  }
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socketPath.size() >= sizeof(address.sun_path)) {
+    throw errors::InputValidationException{"Socket path too long: " + socketPath};
+  }
+  std::memcpy(static_cast<char*>(address.sun_path), socketPath.data(), socketPath.size());
+
+  const int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listenFd < 0) {
+    throw errors::OpenAssetIOException{Str{"Failed to create socket: "} + std::strerror(errno)};
+  }
+  ::fcntl(listenFd, F_SETFD, FD_CLOEXEC);
+  // Remove any stale socket left behind by a previous server.
+  ::unlink(socketPath.c_str());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+      ::listen(listenFd, SOMAXCONN) != 0) {
+    const int error = errno;
+    ::close(listenFd);
+    throw errors::OpenAssetIOException{"Failed to listen on '" + socketPath +
+                                       "': " + std::strerror(error)};
+  }
+  listenFd_ = listenFd;
+  socketPath_ = socketPath;
+}
+
+void ManagerServer::serve() {
+  if (listenFd_ < 0) {
+    throw errors::InputValidationException{"listen() must be called before serve()."};
+  }
+
+  while (true) {
+    std::array<pollfd, 2> pollFds{{{listenFd_, POLLIN, 0}, {stopFds_[0], POLLIN, 0}}};
+    if (::poll(pollFds.data(), pollFds.size(), -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      logger_->log(Severity::kError, Str{"ManagerServer: poll failed: "} + std::strerror(errno));
+      break;
+    }
+    if (pollFds[1].revents != 0) {
+      char stopByte = 0;
+      [[maybe_unused]] const ssize_t numRead = ::read(stopFds_[0], &stopByte, 1);
+      break;
+    }
+    if (pollFds[0].revents == 0) {
+      continue;
+    }
+
+    std::unique_ptr<Channel> channel;
+    try {
+      channel = Channel::accept(listenFd_);
+    } catch (const errors::OpenAssetIOException& exc) {
+      logger_->log(Severity::kWarning, Str{"ManagerServer: "} + exc.what());
+      continue;
+    }
+    reapSessions();
+    const std::lock_guard lock{sessionsMutex_};
+    Session& session = sessions_.emplace_back();
+    session.channel = std::move(channel);
+    session.thread = std::thread{[this, &session] {
+      serveSession(*session.channel);
+      session.isFinished = true;
+    }};
+  }
+
+  // Wake any sessions blocked waiting on their client, then wait for
+  // them to finish.
+  const std::lock_guard lock{sessionsMutex_};
+  for (Session& session : sessions_) {
+    session.channel->shutdown();
+  }
+  for (Session& session : sessions_) {
+    session.thread.join();
+  }
+  sessions_.clear();
+}
+
+void ManagerServer::stop() const {
+  const char stopByte = 0;
+  [[maybe_unused]] const ssize_t numWritten = ::write(stopFds_[1], &stopByte, 1);
+}
+
+void ManagerServer::reapSessions() {
+  const std::lock_guard lock{sessionsMutex_};
+  for (auto iter = sessions_.begin(); iter != sessions_.end();) {
+    if (iter->isFinished) {
+      iter->thread.join();
+      iter = sessions_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+void ManagerServer::serveSession(Channel& channel) {
+  // Replaced once the client tells us who the host is.
+  managerApi::HostSessionPtr hostSession =
+      makeHostSession("org.openassetio.remote.unknownHost", "Unknown Host", {}, logger_);
+
+  while (true) {
+    codec::Message request;
+    try {
+      request = channel.receive();
+    } catch (const errors::OpenAssetIOException&) {
+      // Client disconnected.
+      return;
+    }
+
+    codec::Reader reader{request};
+    codec::Writer response;
+    std::unique_lock managerLock{managerMutex_, std::defer_lock};
+    if (!isThreadSafe_) {
+      managerLock.lock();
+    }
+    try {
+      BatchWriter batchWriter{channel, response};
+      const auto successCallback = [&batchWriter](const std::size_t index, const auto& value) {
+        batchWriter.success(index, value);
+      };
+      const auto errorCallback = [&batchWriter](const std::size_t index,
+                                                const errors::BatchElementError& error) {
+        batchWriter.error(index, error);
+      };
+
+      switch (static_cast<Opcode>(reader.readU8())) {
+        case Opcode::kHello: {
+          writeEnd(response);
+          response.writeStr(managerInterface_->identifier());
+          response.writeStr(managerInterface_->displayName());
+          break;
+        }
+        case Opcode::kInfo: {
+          const InfoDictionary info = managerInterface_->info();
+          writeEnd(response);
+          response.writeInfoDictionary(info);
+          break;
+        }
+        case Opcode::kSettings: {
+          const InfoDictionary settings = managerInterface_->settings(hostSession);
+          writeEnd(response);
+          response.writeInfoDictionary(settings);
+          break;
+        }
+        case Opcode::kInitialize: {
+          Identifier hostIdentifier = reader.readStr();
+          Str hostDisplayName = reader.readStr();
+          InfoDictionary hostInfo = reader.readInfoDictionary();
+          InfoDictionary managerSettings = reader.readInfoDictionary();
+          hostSession = makeHostSession(std::move(hostIdentifier), std::move(hostDisplayName),
+                                        std::move(hostInfo), logger_);
+          {
+            // Other connections may be using the manager, so only
+            // initialize it once.
+            const std::lock_guard initializeLock{initializeMutex_};
+            if (!initializedSettings_) {
+              managerInterface_->initialize(managerSettings, hostSession);
+              initializedSettings_ = std::move(managerSettings);
+            } else if (*initializedSettings_ != managerSettings) {
+              logger_->log(Severity::kWarning,
+                           "ManagerServer: Manager is already initialized, ignoring different"
+                           " settings provided by a subsequent client");
+            }
+          }
+
+          std::uint32_t capabilities = 0;
+          for (std::size_t capability = 0;
+               capability < managerApi::ManagerInterface::kCapabilityNames.size(); ++capability) {
+            if (managerInterface_->hasCapability(static_cast<Capability>(capability))) {
+              capabilities |= std::uint32_t{1} << capability;
+            }
+          }
+          writeEnd(response);
+          response.writeU32(capabilities);
+          break;
+        }
+        case Opcode::kFlushCaches: {
+          managerInterface_->flushCaches(hostSession);
+          writeEnd(response);
+          break;
+        }
+        case Opcode::kManagementPolicy: {
+          const auto policyAccess = static_cast<access::PolicyAccess>(reader.readU8());
+          const ContextConstPtr context = readContext(reader);
+          const trait::TraitSets traitSets = reader.readTraitSets();
+          const trait::TraitsDatas policies =
+              managerInterface_->managementPolicy(traitSets, policyAccess, context, hostSession);
+          writeEnd(response);
+          response.writeTraitsDatas(policies);
+          break;
+        }
+        case Opcode::kAreEntityReferenceStrings: {
+          const std::uint32_t count = reader.readU32();
+          std::vector<Str> someStrings;
+          someStrings.reserve(count);
+          for (std::uint32_t idx = 0; idx < count; ++idx) {
+            someStrings.push_back(reader.readStr());
+          }
+          const std::vector<bool> results = managerInterface_->areEntityReferenceStrings(
+              {someStrings.begin(), someStrings.end()}, hostSession);
+          writeEnd(response);
+          response.writeU32(static_cast<std::uint32_t>(results.size()));
+          for (const bool result : results) {
+            response.writeBool(result);
+          }
+          break;
+        }
+        case Opcode::kEntityExists: {
+          const ContextConstPtr context = readContext(reader);
+          const EntityReferences entityReferences = reader.readEntityReferences();
+          managerInterface_->entityExists(entityReferences, context, hostSession,
+                                          successCallback, errorCallback);
+          writeEnd(response);
+          break;
+        }
+        case Opcode::kEntityTraits: {
+          const auto entityTraitsAccess = static_cast<access::EntityTraitsAccess>(reader.readU8());
+          const ContextConstPtr context = readContext(reader);
+          const EntityReferences entityReferences = reader.readEntityReferences();
+          managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context,
+                                          hostSession, successCallback, errorCallback);
+          writeEnd(response);
+          break;
+        }
+        case Opcode::kResolve: {
+          const trait::TraitSet traitSet = reader.readTraitSet();
+          const auto resolveAccess = static_cast<access::ResolveAccess>(reader.readU8());
+          const ContextConstPtr context = readContext(reader);
+          const EntityReferences entityReferences = reader.readEntityReferences();
+          managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context,
+                                     hostSession, successCallback, errorCallback);
+          writeEnd(response);
+          break;
+        }
+        default:
+          throw errors::InputValidationException{"Unknown remote manager request."};
+      }
+    } catch (...) {
+      protocol::writeException(response, std::current_exception());
+    }
+    if (managerLock.owns_lock()) {
+      managerLock.unlock();
+    }
+
+    try {
+      channel.send(response.message());
+    } catch (const errors::OpenAssetIOException&) {
+      // Client disconnected.
+      return;
+    }
+  }
+}
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
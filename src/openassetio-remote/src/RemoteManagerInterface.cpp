@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <openassetio/remote/RemoteManagerInterface.hpp>
+
+#include <array>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "Channel.hpp"
+#include "codec.hpp"
+#include "protocol.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+
+using protocol::Opcode;
+using protocol::Response;
+
+namespace {
+using Capability = managerApi::ManagerInterface::Capability;
+using BatchElementErrorCallback = managerApi::ManagerInterface::BatchElementErrorCallback;
+
+constexpr std::uint32_t capabilityBit(const Capability capability) {
+  return std::uint32_t{1} << static_cast<std::underlying_type_t<Capability>>(capability);
+}
+
+/// Capabilities whose methods can be forwarded to a remote manager.
+constexpr std::uint32_t kForwardedCapabilities =
+    capabilityBit(Capability::kEntityReferenceIdentification) |
+    capabilityBit(Capability::kManagementPolicyQueries) |
+    capabilityBit(Capability::kEntityTraitIntrospection) |
+    capabilityBit(Capability::kResolution) | capabilityBit(Capability::kExistenceQueries);
+
+codec::Writer makeRequest(const Opcode opcode) {
+  codec::Writer writer;
+  writer.writeU8(static_cast<std::uint8_t>(opcode));
+  return writer;
+}
+
+void writeContext(codec::Writer& writer, const ContextConstPtr& context) {
+  writer.writeTraitsData(context ? context->locale : nullptr);
+}
+
+/**
+ * Construct a handler for streamed batch elements, decoding success
+ * values using `readValue` and forwarding them to the appropriate
+ * callback.
+ */
+template <class SuccessCallback, class ReadValue>
+auto makeElementHandler(const std::size_t batchSize, const SuccessCallback& successCallback,
+                        const BatchElementErrorCallback& errorCallback,
+                        const ReadValue& readValue) {
+  return [batchSize, &successCallback, &errorCallback, &readValue](
+             const bool isError, const std::size_t index, codec::Reader& reader) {
+    if (index >= batchSize) {
+      throw errors::InputValidationException{
+          "Malformed message: batch element index out of range."};
+    }
+    if (isError) {
+      errorCallback(index, reader.readBatchElementError());
+    } else {
+      successCallback(index, readValue(reader));
+    }
+  };
+}
+}  // namespace
+
+struct RemoteManagerInterface::Connection {
+  Str socketPath;
+  /// Null if not currently connected.
+  std::unique_ptr<Channel> channel;
+};
+
+RemoteManagerInterfacePtr RemoteManagerInterface::make(SocketPaths socketPaths,
+                                                       const std::size_t ringCapacity) {
+  if (socketPaths.empty()) {
+    throw errors::InputValidationException{"At least one socket path must be provided."};
+  }
+  if (ringCapacity == 0) {
+    throw errors::InputValidationException{"Ring capacity must be greater than zero."};
+  }
+  return RemoteManagerInterfacePtr{
+      new RemoteManagerInterface{std::move(socketPaths), ringCapacity}};
+}
+
+RemoteManagerInterface::RemoteManagerInterface(SocketPaths socketPaths,
+                                               const std::size_t ringCapacity)
+    : ringCapacity_{ringCapacity} {
+  connections_.reserve(socketPaths.size());
+  for (auto& socketPath : socketPaths) {
+    connections_.push_back(std::make_unique<Connection>(Connection{std::move(socketPath), {}}));
+    ensureConnected(*connections_.back());
+    idleConnections_.push_back(connections_.back().get());
+  }
+}
+
+RemoteManagerInterface::~RemoteManagerInterface() = default;
+
+void RemoteManagerInterface::ensureConnected(Connection& connection) {
+  if (connection.channel && connection.channel->isOpen()) {
+    return;
+  }
+  connection.channel.reset();
+  connection.channel = Channel::connect(connection.socketPath, ringCapacity_);
+  try {
+    callOn(
+        connection, makeRequest(Opcode::kHello).message(),
+        [this](codec::Reader& reader) {
+          Identifier identifier = reader.readStr();
+          Str displayName = reader.readStr();
+          if (identifier_.empty()) {
+            identifier_ = std::move(identifier);
+            displayName_ = std::move(displayName);
+          } else if (identifier != identifier_) {
+            throw errors::InputValidationException{
+                "Remote managers must all have the same identifier: expected '" + identifier_ +
+                "' but got '" + identifier + "'."};
+          }
+        },
+        {});
+
+    std::optional<codec::Message> initializeRequest;
+    {
+      const std::lock_guard lock{initializeMutex_};
+      initializeRequest = initializeRequest_;
+    }
+    if (initializeRequest) {
+      callOn(connection, *initializeRequest, {}, {});
+    }
+  } catch (...) {
+    connection.channel.reset();
+    throw;
+  }
+}
+
+void RemoteManagerInterface::callOn(Connection& connection, const codec::Message& request,
+                                    const ResultHandler& resultHandler,
+                                    const ElementHandler& elementHandler) {
+  std::exception_ptr remoteException;
+  try {
+    connection.channel->send(request);
+    bool isComplete = false;
+    while (!isComplete) {
+      const codec::Message message = connection.channel->receive();
+      codec::Reader reader{message};
+      while (!isComplete && !reader.atEnd()) {
+        const auto response = static_cast<Response>(reader.readU8());
+        switch (response) {
+          case Response::kSuccess:
+          case Response::kError: {
+            const std::size_t index = reader.readU32();
+            if (!elementHandler) {
+              throw errors::InputValidationException{
+                  "Malformed message: unexpected batch element."};
+            }
+            elementHandler(response == Response::kError, index, reader);
+            break;
+          }
+          case Response::kEnd:
+            if (resultHandler) {
+              resultHandler(reader);
+            }
+            isComplete = true;
+            break;
+          case Response::kException:
+            try {
+              protocol::throwException(reader);
+            } catch (...) {
+              remoteException = std::current_exception();
+            }
+            isComplete = true;
+            break;
+          default:
+            throw errors::InputValidationException{"Malformed message: unknown response."};
+        }
+      }
+    }
+  } catch (...) {
+    // The response stream is in an unknown state, or the worker has
+    // gone away, so the connection cannot be reused.
+    connection.channel.reset();
+    throw;
+  }
+  if (remoteException) {
+    std::rethrow_exception(remoteException);
+  }
+}
+
+void RemoteManagerInterface::call(const codec::Message& request,
+                                  const ResultHandler& resultHandler,
+                                  const ElementHandler& elementHandler) {
+  std::size_t numFailures = 0;
+  while (true) {
+    Connection& connection = acquireConnection();
+    try {
+      ensureConnected(connection);
+    } catch (const errors::OpenAssetIOException& exc) {
+      releaseConnection(connection);
+      if (++numFailures >= connections_.size()) {
+        throw errors::OpenAssetIOException{
+            Str{"Unable to connect to any remote manager worker: "} + exc.what()};
+      }
+      continue;
+    }
+    try {
+      callOn(connection, request, resultHandler, elementHandler);
+    } catch (...) {
+      releaseConnection(connection);
+      throw;
+    }
+    releaseConnection(connection);
+    return;
+  }
+}
+
+void RemoteManagerInterface::callAll(const codec::Message& request,
+                                     const ResultHandler& resultHandler) {
+  // Wait for exclusive use of every connection.
+  std::deque<Connection*> connections;
+  {
+    std::unique_lock lock{poolMutex_};
+    poolCondition_.wait(lock,
+                        [this] { return idleConnections_.size() == connections_.size(); });
+    connections.swap(idleConnections_);
+  }
+  const auto releaseAll = [this, &connections] {
+    {
+      const std::lock_guard lock{poolMutex_};
+      idleConnections_.swap(connections);
+    }
+    poolCondition_.notify_all();
+  };
+
+  bool isAnyConnected = false;
+  Str lastError;
+  for (Connection* connection : connections) {
+    try {
+      ensureConnected(*connection);
+      callOn(*connection, request, resultHandler, {});
+      isAnyConnected = true;
+    } catch (const errors::OpenAssetIOException& exc) {
+      if (connection->channel) {
+        // Connection is healthy, so the manager itself raised.
+        releaseAll();
+        throw;
+      }
+      // Skip unreachable workers. They will be initialized when they
+      // are reconnected.
+      lastError = exc.what();
+    } catch (...) {
+      releaseAll();
+      throw;
+    }
+  }
+  releaseAll();
+  if (!isAnyConnected) {
+    throw errors::OpenAssetIOException{"Unable to connect to any remote manager worker: " +
+                                       lastError};
+  }
+}
+
+RemoteManagerInterface::Connection& RemoteManagerInterface::acquireConnection() {
+  std::unique_lock lock{poolMutex_};
+  poolCondition_.wait(lock, [this] { return !idleConnections_.empty(); });
+  Connection* connection = idleConnections_.front();
+  idleConnections_.pop_front();
+  return *connection;
+}
+
+void RemoteManagerInterface::releaseConnection(Connection& connection) {
+  {
+    const std::lock_guard lock{poolMutex_};
+    // Return to the back of the queue, so connections are used in turn.
+    idleConnections_.push_back(&connection);
+  }
+  poolCondition_.notify_one();
+}
+
+Identifier RemoteManagerInterface::identifier() const { return identifier_; }
+
+Str RemoteManagerInterface::displayName() const { return displayName_; }
+
+InfoDictionary RemoteManagerInterface::info() {
+  InfoDictionary info;
+  call(makeRequest(Opcode::kInfo).message(),
+       [&info](codec::Reader& reader) { info = reader.readInfoDictionary(); });
+  return info;
+}
+
+InfoDictionary RemoteManagerInterface::settings(
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  InfoDictionary settings;
+  call(makeRequest(Opcode::kSettings).message(),
+       [&settings](codec::Reader& reader) { settings = reader.readInfoDictionary(); });
+  return settings;
+}
+
+void RemoteManagerInterface::initialize(InfoDictionary managerSettings,
+                                        const managerApi::HostSessionPtr& hostSession) {
+  const managerApi::HostPtr& host = hostSession->host();
+  codec::Writer request = makeRequest(Opcode::kInitialize);
+  request.writeStr(host->identifier());
+  request.writeStr(host->displayName());
+  request.writeInfoDictionary(host->info());
+  request.writeInfoDictionary(managerSettings);
+
+  std::uint32_t capabilities = 0;
+  callAll(request.message(),
+          [&capabilities](codec::Reader& reader) { capabilities = reader.readU32(); });
+  capabilities_ = capabilities & kForwardedCapabilities;
+
+  const std::lock_guard lock{initializeMutex_};
+  initializeRequest_ = request.take();
+}
+
+void RemoteManagerInterface::flushCaches(
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  callAll(makeRequest(Opcode::kFlushCaches).message());
+}
+
+bool RemoteManagerInterface::hasCapability(const Capability capability) {
+  return (capabilities_ & capabilityBit(capability)) != 0;
+}
+
+trait::TraitsDatas RemoteManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  codec::Writer request = makeRequest(Opcode::kManagementPolicy);
+  request.writeU8(static_cast<std::uint8_t>(policyAccess));
+  writeContext(request, context);
+  request.writeTraitSets(traitSets);
+
+  trait::TraitsDatas policies;
+  call(request.message(),
+       [&policies](codec::Reader& reader) { policies = reader.readTraitsDatas(); });
+  return policies;
+}
+
+bool RemoteManagerInterface::isEntityReferenceString(
+    const Str& someString, const managerApi::HostSessionPtr& hostSession) {
+  return areEntityReferenceStrings({someString}, hostSession).front();
+}
+
+std::vector<bool> RemoteManagerInterface::areEntityReferenceStrings(
+    const std::vector<std::string_view>& someStrings,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  codec::Writer request = makeRequest(Opcode::kAreEntityReferenceStrings);
+  request.writeU32(static_cast<std::uint32_t>(someStrings.size()));
+  for (const auto& someString : someStrings) {
+    request.writeStr(someString);
+  }
+
+  std::vector<bool> results;
+  call(request.message(), [&results, &someStrings](codec::Reader& reader) {
+    const std::uint32_t count = reader.readU32();
+    if (count != someStrings.size()) {
+      throw errors::InputValidationException{"Malformed message: unexpected result count."};
+    }
+    results.reserve(count);
+    for (std::uint32_t idx = 0; idx < count; ++idx) {
+      results.push_back(reader.readBool());
+    }
+  });
+  return results;
+}
+
+void RemoteManagerInterface::entityExists(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const ExistsSuccessCallback& successCallback, const BatchElementErrorCallback& errorCallback) {
+  codec::Writer request = makeRequest(Opcode::kEntityExists);
+  writeContext(request, context);
+  request.writeEntityReferences(entityReferences);
+
+  const auto readValue = [](codec::Reader& reader) { return reader.readBool(); };
+  call(request.message(), {},
+       makeElementHandler(entityReferences.size(), successCallback, errorCallback, readValue));
+}
+
+void RemoteManagerInterface::entityTraits(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const EntityTraitsSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  codec::Writer request = makeRequest(Opcode::kEntityTraits);
+  request.writeU8(static_cast<std::uint8_t>(entityTraitsAccess));
+  writeContext(request, context);
+  request.writeEntityReferences(entityReferences);
+
+  const auto readValue = [](codec::Reader& reader) { return reader.readTraitSet(); };
+  call(request.message(), {},
+       makeElementHandler(entityReferences.size(), successCallback, errorCallback, readValue));
+}
+
+void RemoteManagerInterface::resolve(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  codec::Writer request = makeRequest(Opcode::kResolve);
+  request.writeTraitSet(traitSet);
+  request.writeU8(static_cast<std::uint8_t>(resolveAccess));
+  writeContext(request, context);
+  request.writeEntityReferences(entityReferences);
+
+  const auto readValue = [](codec::Reader& reader) { return reader.readTraitsData(); };
+  call(request.message(), {},
+       makeElementHandler(entityReferences.size(), successCallback, errorCallback, readValue));
+}
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
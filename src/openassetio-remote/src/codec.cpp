@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include "codec.hpp"
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote::codec {
+namespace {
+/// Tag preceding each encoded variant value, matching variant index.
+enum ValueTag : std::uint8_t { kBoolTag = 0, kIntTag, kFloatTag, kStrTag };
+
+std::uint32_t checkedCount(const std::size_t count) {
+  if (count > std::numeric_limits<std::uint32_t>::max()) {
+    throw errors::InputValidationException{"Collection too large to encode."};
+  }
+  return static_cast<std::uint32_t>(count);
+}
+
+/// Encode a variant of Bool, Int, Float or Str.
+template <class Variant>
+void writeValue(Writer& writer, const Variant& value) {
+  static_assert(std::is_same_v<std::variant_alternative_t<kBoolTag, Variant>, Bool>);
+  static_assert(std::is_same_v<std::variant_alternative_t<kIntTag, Variant>, Int>);
+  static_assert(std::is_same_v<std::variant_alternative_t<kFloatTag, Variant>, Float>);
+  static_assert(std::is_same_v<std::variant_alternative_t<kStrTag, Variant>, Str>);
+
+  writer.writeU8(static_cast<std::uint8_t>(value.index()));
+  std::visit(
+      [&writer](const auto& alternative) {
+        using T = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<T, Bool>) {
+          writer.writeBool(alternative);
+        } else if constexpr (std::is_same_v<T, Int>) {
+          writer.writeInt(alternative);
+        } else if constexpr (std::is_same_v<T, Float>) {
+          writer.writeFloat(alternative);
+        } else {
+          writer.writeStr(alternative);
+        }
+      },
+      value);
+}
+
+/// Decode a variant of Bool, Int, Float or Str.
+template <class Variant>
+Variant readValue(Reader& reader) {
+  switch (reader.readU8()) {
+    case kBoolTag:
+      return reader.readBool();
+    case kIntTag:
+      return reader.readInt();
+    case kFloatTag:
+      return reader.readFloat();
+    case kStrTag:
+      return reader.readStr();
+    default:
+      throw errors::InputValidationException{"Malformed message: unknown value type."};
+  }
+}
+}  // namespace
+
+void Writer::writeStr(const std::string_view value) {
+  writeU32(checkedCount(value.size()));
+  const std::size_t offset = message_.size();
+  message_.resize(offset + value.size());
+  std::memcpy(message_.data() + offset, value.data(), value.size());
+}
+
+void Writer::writeEntityReferences(const EntityReferences& entityReferences) {
+  writeU32(checkedCount(entityReferences.size()));
+  for (const auto& entityReference : entityReferences) {
+    writeStr(entityReference.toString());
+  }
+}
+
+void Writer::writeTraitSet(const trait::TraitSet& traitSet) {
+  writeU32(checkedCount(traitSet.size()));
+  for (const auto& traitId : traitSet) {
+    writeStr(traitId);
+  }
+}
+
+void Writer::writeTraitSets(const trait::TraitSets& traitSets) {
+  writeU32(checkedCount(traitSets.size()));
+  for (const auto& traitSet : traitSets) {
+    writeTraitSet(traitSet);
+  }
+}
+
+void Writer::writeTraitsData(const trait::TraitsDataPtr& traitsData) {
+  writeBool(traitsData != nullptr);
+  if (!traitsData) {
+    return;
+  }
+  const trait::TraitSet traitSet = traitsData->traitSet();
+  writeU32(checkedCount(traitSet.size()));
+  for (const auto& traitId : traitSet) {
+    writeStr(traitId);
+    const trait::property::KeySet keys = traitsData->traitPropertyKeys(traitId);
+    writeU32(checkedCount(keys.size()));
+    for (const auto& key : keys) {
+      trait::property::Value value;
+      traitsData->getTraitProperty(&value, traitId, key);
+      writeStr(key);
+      writeValue(*this, value);
+    }
+  }
+}
+
+void Writer::writeTraitsDatas(const trait::TraitsDatas& traitsDatas) {
+  writeU32(checkedCount(traitsDatas.size()));
+  for (const auto& traitsData : traitsDatas) {
+    writeTraitsData(traitsData);
+  }
+}
+
+void Writer::writeInfoDictionary(const InfoDictionary& infoDictionary) {
+  writeU32(checkedCount(infoDictionary.size()));
+  for (const auto& [key, value] : infoDictionary) {
+    writeStr(key);
+    writeValue(*this, value);
+  }
+}
+
+void Writer::writeBatchElementError(const errors::BatchElementError& error) {
+  writeU32(static_cast<std::uint32_t>(error.code));
+  writeStr(error.message);
+}
+
+void Reader::require(const std::size_t numBytes) const {
+  if (numBytes > size_ - offset_) {
+    throw errors::InputValidationException{"Malformed message: unexpected end of data."};
+  }
+}
+
+std::uint32_t Reader::readCount() {
+  const std::uint32_t count = readU32();
+  // Every element takes at least one byte, so reject counts that
+  // cannot possibly fit, rather than attempting a huge allocation.
+  require(count);
+  return count;
+}
+
+Str Reader::readStr() {
+  const std::uint32_t size = readCount();
+  Str value{reinterpret_cast<const char*>(data_ + offset_), size};
+  offset_ += size;
+  return value;
+}
+
+EntityReferences Reader::readEntityReferences() {
+  const std::uint32_t count = readCount();
+  EntityReferences entityReferences;
+  entityReferences.reserve(count);
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    entityReferences.emplace_back(readStr());
+  }
+  return entityReferences;
+}
+
+trait::TraitSet Reader::readTraitSet() {
+  const std::uint32_t count = readCount();
+  trait::TraitSet traitSet;
+  traitSet.reserve(count);
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    traitSet.insert(readStr());
+  }
+  return traitSet;
+}
+
+trait::TraitSets Reader::readTraitSets() {
+  const std::uint32_t count = readCount();
+  trait::TraitSets traitSets;
+  traitSets.reserve(count);
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    traitSets.push_back(readTraitSet());
+  }
+  return traitSets;
+}
+
+trait::TraitsDataPtr Reader::readTraitsData() {
+  if (!readBool()) {
+    return nullptr;
+  }
+  auto traitsData = trait::TraitsData::make();
+  const std::uint32_t numTraits = readCount();
+  for (std::uint32_t traitIdx = 0; traitIdx < numTraits; ++traitIdx) {
+    const Str traitId = readStr();
+    traitsData->addTrait(traitId);
+    const std::uint32_t numProperties = readCount();
+    for (std::uint32_t propertyIdx = 0; propertyIdx < numProperties; ++propertyIdx) {
+      Str key = readStr();
+      traitsData->setTraitProperty(traitId, key, readValue<trait::property::Value>(*this));
+    }
+  }
+  return traitsData;
+}
+
+trait::TraitsDatas Reader::readTraitsDatas() {
+  const std::uint32_t count = readCount();
+  trait::TraitsDatas traitsDatas;
+  traitsDatas.reserve(count);
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    traitsDatas.push_back(readTraitsData());
+  }
+  return traitsDatas;
+}
+
+InfoDictionary Reader::readInfoDictionary() {
+  const std::uint32_t count = readCount();
+  InfoDictionary infoDictionary;
+  infoDictionary.reserve(count);
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    Str key = readStr();
+    infoDictionary.insert_or_assign(std::move(key), readValue<InfoDictionaryValue>(*this));
+  }
+  return infoDictionary;
+}
+
+errors::BatchElementError Reader::readBatchElementError() {
+  const auto code = static_cast<errors::BatchElementError::ErrorCode>(readU32());
+  return errors::BatchElementError{code, readStr()};
+}
+}  // namespace remote::codec
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/export.h>
+#include <openassetio/remote/export.h>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+OPENASSETIO_FWD_DECLARE(trait, TraitsData)
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+/**
+ * Compact binary encoding of OpenAssetIO types, for passing messages
+ * between processes.
+ *
+ * Integers are written in native byte order, since both ends of a
+ * connection are always on the same host. Strings are length-prefixed
+ * and collections are count-prefixed.
+ */
+namespace codec {
+/// Raw encoded message.
+using Message = std::vector<std::byte>;
+
+/**
+ * Appends encoded values to a message.
+ */
+class OPENASSETIO_REMOTE_EXPORT Writer {
+ public:
+  void writeU8(std::uint8_t value) { writePod(value); }
+  void writeU32(std::uint32_t value) { writePod(value); }
+  void writeU64(std::uint64_t value) { writePod(value); }
+  void writeBool(bool value) { writeU8(value ? 1 : 0); }
+  void writeInt(Int value) { writePod(value); }
+  void writeFloat(Float value) { writePod(value); }
+  void writeStr(std::string_view value);
+
+  void writeEntityReferences(const EntityReferences& entityReferences);
+  void writeTraitSet(const trait::TraitSet& traitSet);
+  void writeTraitSets(const trait::TraitSets& traitSets);
+  /// Null pointers are encoded, and decoded as null.
+  void writeTraitsData(const trait::TraitsDataPtr& traitsData);
+  void writeTraitsDatas(const trait::TraitsDatas& traitsDatas);
+  void writeInfoDictionary(const InfoDictionary& infoDictionary);
+  void writeBatchElementError(const errors::BatchElementError& error);
+
+  /// Encoded message so far.
+  [[nodiscard]] const Message& message() const { return message_; }
+
+  /// Take ownership of the encoded message, resetting the writer.
+  [[nodiscard]] Message take() {
+    Message message;
+    message.swap(message_);
+    return message;
+  }
+
+ private:
+  template <class T>
+  void writePod(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const std::size_t offset = message_.size();
+    message_.resize(offset + sizeof(T));
+    std::memcpy(message_.data() + offset, &value, sizeof(T));
+  }
+
+  Message message_;
+};
+
+/**
+ * Decodes values from a message, in the order they were written.
+ *
+ * @throws errors.InputValidationException If the message is
+ * truncated or otherwise malformed.
+ */
+class OPENASSETIO_REMOTE_EXPORT Reader {
+ public:
+  explicit Reader(const Message& message) : data_{message.data()}, size_{message.size()} {}
+
+  std::uint8_t readU8() { return readPod<std::uint8_t>(); }
+  std::uint32_t readU32() { return readPod<std::uint32_t>(); }
+  std::uint64_t readU64() { return readPod<std::uint64_t>(); }
+  bool readBool() { return readU8() != 0; }
+  Int readInt() { return readPod<Int>(); }
+  Float readFloat() { return readPod<Float>(); }
+  Str readStr();
+
+  EntityReferences readEntityReferences();
+  trait::TraitSet readTraitSet();
+  trait::TraitSets readTraitSets();
+  trait::TraitsDataPtr readTraitsData();
+  trait::TraitsDatas readTraitsDatas();
+  InfoDictionary readInfoDictionary();
+  errors::BatchElementError readBatchElementError();
+
+  /// Whether the whole message has been consumed.
+  [[nodiscard]] bool atEnd() const { return offset_ == size_; }
+
+ private:
+  void require(std::size_t numBytes) const;
+
+  /// Read a collection count, validating it against remaining bytes.
+  std::uint32_t readCount();
+
+  template <class T>
+  T readPod() {
+    static_assert(std::is_trivially_copyable_v<T>);
+    require(sizeof(T));
+    T value;
+    std::memcpy(&value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return value;
+  }
+
+  const std::byte* data_;
+  std::size_t size_;
+  std::size_t offset_{0};
+};
+}  // namespace codec
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
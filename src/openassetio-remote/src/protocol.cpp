@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include "protocol.hpp"
+
+#include <stdexcept>
+
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote::protocol {
+
+void writeException(codec::Writer& writer, const std::exception_ptr& exception) {
+  writer.writeU8(static_cast<std::uint8_t>(Response::kException));
+  ExceptionType type = ExceptionType::kOther;
+  Str message;
+  try {
+    std::rethrow_exception(exception);
+  } catch (const errors::ConfigurationException& exc) {
+    type = ExceptionType::kConfiguration;
+    message = exc.what();
+  } catch (const errors::InputValidationException& exc) {
+    type = ExceptionType::kInputValidation;
+    message = exc.what();
+  } catch (const errors::NotImplementedException& exc) {
+    type = ExceptionType::kNotImplemented;
+    message = exc.what();
+  } catch (const errors::UnhandledException& exc) {
+    type = ExceptionType::kUnhandled;
+    message = exc.what();
+  } catch (const errors::OpenAssetIOException& exc) {
+    type = ExceptionType::kOpenAssetIO;
+    message = exc.what();
+  } catch (const std::exception& exc) {
+    message = exc.what();
+  } catch (...) {
+    message = "Unknown non-exception object thrown";
+  }
+  writer.writeU8(static_cast<std::uint8_t>(type));
+  writer.writeStr(message);
+}
+
+void throwException(codec::Reader& reader) {
+  const auto type = static_cast<ExceptionType>(reader.readU8());
+  Str message = reader.readStr();
+  switch (type) {
+    case ExceptionType::kOpenAssetIO:
+      throw errors::OpenAssetIOException{message};
+    case ExceptionType::kInputValidation:
+      throw errors::InputValidationException{message};
+    case ExceptionType::kConfiguration:
+      throw errors::ConfigurationException{message};
+    case ExceptionType::kNotImplemented:
+      throw errors::NotImplementedException{message};
+    case ExceptionType::kUnhandled:
+      throw errors::UnhandledException{message};
+    case ExceptionType::kOther:
+      break;
+  }
+  throw errors::UnhandledException{"Exception in remote manager: " + message};
+}
+}  // namespace remote::protocol
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#pragma once
+#include <cstdint>
+#include <exception>
+
+#include <openassetio/export.h>
+
+#include "codec.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace remote {
+/**
+ * Wire protocol between RemoteManagerInterface and ManagerServer.
+ *
+ * Each request is a single message, beginning with an @ref Opcode.
+ *
+ * Non-batch requests receive a single response message, beginning
+ * with a @ref Response kind of either @ref Response::kEnd, followed by
+ * the result, or @ref Response::kException.
+ *
+ * Batch requests receive a stream of response messages, one per
+ * element as soon as the manager provides it, each beginning with
+ * @ref Response::kSuccess or @ref Response::kError followed by the
+ * element index and payload. The stream is terminated by a message
+ * beginning with @ref Response::kEnd or @ref Response::kException.
+ */
+namespace protocol {
+/// Request types.
+enum class Opcode : std::uint8_t {
+  /// Returns the manager identifier and display name.
+  kHello = 0,
+  kInfo,
+  kSettings,
+  /// Returns the bitmask of supported capabilities.
+  kInitialize,
+  kFlushCaches,
+  kManagementPolicy,
+  kAreEntityReferenceStrings,
+  kEntityExists,
+  kEntityTraits,
+  kResolve,
+};
+
+/// Response message kinds.
+enum class Response : std::uint8_t {
+  kSuccess = 0,
+  kError,
+  kEnd,
+  kException,
+};
+
+/// Exception types that are reconstructed on the client.
+enum class ExceptionType : std::uint8_t {
+  kOpenAssetIO = 0,
+  kInputValidation,
+  kConfiguration,
+  kNotImplemented,
+  kUnhandled,
+  /// Any other exception, raised as an UnhandledException.
+  kOther,
+};
+
+/**
+ * Encode the given exception as a complete @ref Response::kException
+ * message.
+ */
+void writeException(codec::Writer& writer, const std::exception_ptr& exception);
+
+/**
+ * Decode an exception from the remainder of a @ref
+ * Response::kException message, and throw it.
+ */
+[[noreturn]] void throwException(codec::Reader& reader);
+}  // namespace protocol
+}  // namespace remote
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/exceptions.hpp>
+
+// Private headers.
+#include <Channel.hpp>
+
+namespace {
+using openassetio::remote::Channel;
+
+/**
+ * Server end of a connection that maps the client's shared memory
+ * segment directly, rather than via a Channel, in order to simulate a
+ * misbehaving peer.
+ */
+struct RawServer {
+  RawServer() {
+    socketPath = "/tmp/openassetio-channel-test-" + std::to_string(::getpid());
+    ::unlink(socketPath.c_str());
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::memcpy(static_cast<char*>(address.sun_path), socketPath.data(), socketPath.size());
+    listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    REQUIRE(::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(::listen(listenFd, 1) == 0);
+  }
+
+  ~RawServer() {
+    if (segment != nullptr) {
+      ::munmap(segment, mappingSize);
+    }
+    if (socketFd >= 0) {
+      ::close(socketFd);
+    }
+    ::close(listenFd);
+    ::unlink(socketPath.c_str());
+  }
+
+  RawServer(const RawServer&) = delete;
+  RawServer(RawServer&&) noexcept = delete;
+  RawServer& operator=(const RawServer&) = delete;
+  RawServer& operator=(RawServer&&) noexcept = delete;
+
+  /// Accept a pending connection and map the client's segment.
+  void accept() {
+    socketFd = ::accept(listenFd, nullptr, nullptr);
+    REQUIRE(socketFd >= 0);
+
+    std::byte payload{0};
+    iovec iov{&payload, 1};
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int))> control{};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.data();
+    msg.msg_controllen = control.size();
+    REQUIRE(::recvmsg(socketFd, &msg, 0) == 1);
+    const cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    REQUIRE(cmsg != nullptr);
+    int segmentFd = -1;
+    std::memcpy(&segmentFd, CMSG_DATA(cmsg), sizeof(int));
+
+    struct stat segmentStat {};
+    REQUIRE(::fstat(segmentFd, &segmentStat) == 0);
+    mappingSize = static_cast<std::size_t>(segmentStat.st_size);
+    void* mapping =
+        ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, segmentFd, 0);
+    ::close(segmentFd);
+    REQUIRE(mapping != MAP_FAILED);
+    segment = static_cast<Channel::Segment*>(mapping);
+  }
+
+  /// Whether the client has shut down its end of the socket.
+  [[nodiscard]] bool isClientShutDown() const {
+    std::array<std::byte, 64> received{};
+    ssize_t numReceived = 0;
+    // Skip any doorbells rung before the shutdown.
+    do {
+      numReceived = ::recv(socketFd, received.data(), received.size(), MSG_DONTWAIT);
+    } while (numReceived > 0);
+    return numReceived == 0;
+  }
+
+  std::string socketPath;
+  int listenFd{-1};
+  int socketFd{-1};
+  Channel::Segment* segment{nullptr};
+  std::size_t mappingSize{0};
+};
+
+constexpr std::size_t kRingCapacity = 64;
+constexpr std::size_t kClientToServer = 0;
+constexpr std::size_t kServerToClient = 1;
+}  // namespace
+
+SCENARIO("Channel with a peer that corrupts the shared memory ring indices") {
+  GIVEN("a client channel connected to a misbehaving server") {
+    RawServer server;
+    const std::unique_ptr<Channel> channel = Channel::connect(server.socketPath, kRingCapacity);
+    server.accept();
+    REQUIRE(server.segment->capacity == kRingCapacity);
+
+    WHEN("the server claims to have written more than the ring capacity") {
+      server.segment->indices[kServerToClient].tail = 10 * kRingCapacity;
+
+      THEN("receiving throws, shuts down the socket and leaves the channel unusable") {
+        CHECK_THROWS_MATCHES(
+            channel->receive(), openassetio::errors::OpenAssetIOException,
+            Catch::Message("Remote peer corrupted shared memory ring"));
+        CHECK(server.isClientShutDown());
+
+        server.segment->indices[kServerToClient].tail = 0;
+        CHECK_THROWS_MATCHES(
+            channel->receive(), openassetio::errors::OpenAssetIOException,
+            Catch::Message("Remote peer previously corrupted shared memory ring"));
+      }
+    }
+
+    WHEN("the server claims to have consumed more than the client has written") {
+      server.segment->indices[kClientToServer].head = 1;
+
+      THEN("sending throws and shuts down the socket") {
+        CHECK_THROWS_MATCHES(
+            channel->send(openassetio::remote::codec::Message(8)),
+            openassetio::errors::OpenAssetIOException,
+            Catch::Message("Remote peer corrupted shared memory ring"));
+        CHECK(server.isClientShutDown());
+      }
+    }
+  }
+}
@@ -0,0 +1,526 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/HostInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/remote/ManagerServer.hpp>
+#include <openassetio/remote/RemoteManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+namespace {
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::Str;
+using openassetio::errors::BatchElementError;
+using openassetio::managerApi::ManagerInterface;
+using openassetio::remote::ManagerServer;
+using openassetio::remote::RemoteManagerInterface;
+
+using Capability = ManagerInterface::Capability;
+
+struct StubHostInterface : openassetio::hostApi::HostInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.test.host";
+  }
+  [[nodiscard]] Str displayName() const override { return "Test Host"; }
+};
+
+struct StubLoggerInterface : openassetio::log::LoggerInterface {
+  void log([[maybe_unused]] Severity severity, [[maybe_unused]] const Str& message) override {}
+};
+
+/**
+ * Manager whose behaviour is determined by the entity reference.
+ *
+ * - `test://missing` does not exist.
+ * - `test://error` results in a batch element error.
+ * - `test://throw` causes the whole batch to throw.
+ * - `test://crash` terminates the process.
+ * - `test://wait` blocks until another call is in progress
+ *   concurrently, recording the maximum concurrency seen.
+ */
+struct FakeManagerInterface : ManagerInterface {
+  [[nodiscard]] openassetio::Identifier identifier() const override {
+    return "org.openassetio.test.remote";
+  }
+  [[nodiscard]] Str displayName() const override { return "Remote Test"; }
+  [[nodiscard]] openassetio::InfoDictionary info() override {
+    return {{"someInfo", openassetio::Int{1}}};
+  }
+  [[nodiscard]] openassetio::InfoDictionary settings(
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    return {{"someSetting", openassetio::Str{"value"}}};
+  }
+  [[nodiscard]] bool hasCapability([[maybe_unused]] Capability capability) override {
+    return true;
+  }
+
+  void initialize(openassetio::InfoDictionary managerSettings,
+                  const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    const std::lock_guard lock{mutex};
+    initializeSettings = std::move(managerSettings);
+    initializeHostIdentifier = hostSession->host()->identifier();
+    ++initializeCount;
+  }
+
+  [[nodiscard]] openassetio::trait::TraitsDatas managementPolicy(
+      const openassetio::trait::TraitSets& traitSets,
+      [[maybe_unused]] openassetio::access::PolicyAccess policyAccess,
+      [[maybe_unused]] const openassetio::ContextConstPtr& context,
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    openassetio::trait::TraitsDatas policies;
+    for (const auto& traitSet : traitSets) {
+      policies.push_back(openassetio::trait::TraitsData::make(traitSet));
+    }
+    return policies;
+  }
+
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString,
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    return someString.rfind("test://", 0) == 0;
+  }
+
+  void entityExists(const EntityReferences& entityReferences,
+                    [[maybe_unused]] const openassetio::ContextConstPtr& context,
+                    [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref == "test://error") {
+        errorCallback(idx, {BatchElementError::ErrorCode::kMalformedEntityReference, ref});
+      } else {
+        successCallback(idx, ref != "test://missing");
+      }
+    }
+  }
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    [[maybe_unused]] openassetio::access::EntityTraitsAccess entityTraitsAccess,
+                    [[maybe_unused]] const openassetio::ContextConstPtr& context,
+                    [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      successCallback(idx, {"someTrait"});
+    }
+  }
+
+  void resolve(const EntityReferences& entityReferences,
+               const openassetio::trait::TraitSet& traitSet,
+               [[maybe_unused]] openassetio::access::ResolveAccess resolveAccess,
+               const openassetio::ContextConstPtr& context,
+               [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    for (std::size_t idx = 0; idx < entityReferences.size(); ++idx) {
+      const Str& ref = entityReferences[idx].toString();
+      if (ref == "test://error") {
+        errorCallback(idx, {BatchElementError::ErrorCode::kEntityResolutionError, ref});
+        continue;
+      }
+      if (ref == "test://throw") {
+        throw openassetio::errors::ConfigurationException{"Bad configuration"};
+      }
+      if (ref == "test://crash") {
+        std::_Exit(EXIT_FAILURE);
+      }
+      if (ref == "test://wait") {
+        waitForConcurrentCall();
+      }
+      auto traitsData = openassetio::trait::TraitsData::make(traitSet);
+      for (const auto& traitId : traitSet) {
+        traitsData->setTraitProperty(traitId, "ref", ref);
+      }
+      // Echo the locale, to check it was forwarded.
+      if (context->locale && context->locale->hasTrait("localeTrait")) {
+        traitsData->addTrait("localeTrait");
+      }
+      successCallback(idx, traitsData);
+    }
+  }
+
+  void waitForConcurrentCall() {
+    std::unique_lock lock{mutex};
+    ++numActive;
+    maxActive = std::max(maxActive, numActive);
+    condition.notify_all();
+    condition.wait_for(lock, std::chrono::seconds{5}, [this] { return numActive > 1; });
+    --numActive;
+  }
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::size_t numActive{0};
+  std::size_t maxActive{0};
+
+  std::size_t initializeCount{0};
+  openassetio::InfoDictionary initializeSettings;
+  openassetio::Identifier initializeHostIdentifier;
+};
+
+/// Unique, short enough, socket path for a test server.
+Str makeSocketPath() {
+  static std::atomic<std::size_t> counter{0};
+  return "/tmp/openassetio-remote-test-" + std::to_string(::getpid()) + "-" +
+         std::to_string(counter++) + ".sock";
+}
+
+/// A ManagerServer servicing connections on a background thread.
+struct ServerThread {
+  ServerThread(openassetio::managerApi::ManagerInterfacePtr managerInterface, Str socketPath_)
+      : socketPath{std::move(socketPath_)},
+        server{ManagerServer::make(std::move(managerInterface),
+                                   std::make_shared<StubLoggerInterface>())} {
+    server->listen(socketPath);
+    thread = std::thread{[this] { server->serve(); }};
+  }
+
+  ~ServerThread() {
+    server->stop();
+    thread.join();
+  }
+
+  ServerThread(const ServerThread&) = delete;
+  ServerThread(ServerThread&&) noexcept = delete;
+  ServerThread& operator=(const ServerThread&) = delete;
+  ServerThread& operator=(ServerThread&&) noexcept = delete;
+
+  Str socketPath;
+  openassetio::remote::ManagerServerPtr server;
+  std::thread thread;
+};
+
+openassetio::managerApi::HostSessionPtr makeHostSession() {
+  return openassetio::managerApi::HostSession::make(
+      openassetio::managerApi::Host::make(std::make_shared<StubHostInterface>()),
+      std::make_shared<StubLoggerInterface>());
+}
+
+EntityReferences makeRefs(const std::vector<Str>& refs) {
+  EntityReferences entityReferences;
+  for (const auto& ref : refs) {
+    entityReferences.emplace_back(ref);
+  }
+  return entityReferences;
+}
+}  // namespace
+
+SCENARIO("RemoteManagerInterface construction") {
+  WHEN("constructed with no socket paths") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(RemoteManagerInterface::make({}),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  WHEN("constructed with a path that is not being served") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(RemoteManagerInterface::make({makeSocketPath()}),
+                      openassetio::errors::OpenAssetIOException);
+    }
+  }
+
+  GIVEN("servers hosting different managers") {
+    struct OtherManagerInterface : FakeManagerInterface {
+      [[nodiscard]] openassetio::Identifier identifier() const override {
+        return "org.openassetio.test.other";
+      }
+    };
+    const ServerThread server{std::make_shared<FakeManagerInterface>(), makeSocketPath()};
+    const ServerThread otherServer{std::make_shared<OtherManagerInterface>(), makeSocketPath()};
+
+    WHEN("constructed with both paths") {
+      THEN("an exception is thrown") {
+        CHECK_THROWS_AS(
+            RemoteManagerInterface::make({server.socketPath, otherServer.socketPath}),
+            openassetio::errors::InputValidationException);
+      }
+    }
+  }
+}
+
+SCENARIO("RemoteManagerInterface forwarding") {
+  GIVEN("a remote manager") {
+    const auto manager = std::make_shared<FakeManagerInterface>();
+    const ServerThread server{manager, makeSocketPath()};
+    const auto remote = RemoteManagerInterface::make({server.socketPath});
+    const auto hostSession = makeHostSession();
+    const auto context = openassetio::Context::make();
+
+    THEN("introspection is forwarded") {
+      CHECK(remote->identifier() == "org.openassetio.test.remote");
+      CHECK(remote->displayName() == "Remote Test");
+      CHECK(remote->info() == openassetio::InfoDictionary{{"someInfo", openassetio::Int{1}}});
+      CHECK(remote->settings(hostSession) ==
+            openassetio::InfoDictionary{{"someSetting", openassetio::Str{"value"}}});
+    }
+
+    WHEN("the remote manager is initialized") {
+      remote->initialize({{"key", openassetio::Float{1.5}}}, hostSession);
+
+      THEN("the manager is initialized with the settings and host") {
+        CHECK(manager->initializeCount == 1);
+        CHECK(manager->initializeSettings ==
+              openassetio::InfoDictionary{{"key", openassetio::Float{1.5}}});
+        CHECK(manager->initializeHostIdentifier == "org.openassetio.test.host");
+      }
+
+      AND_THEN("only capabilities that can be forwarded are advertised") {
+        CHECK(remote->hasCapability(Capability::kEntityReferenceIdentification));
+        CHECK(remote->hasCapability(Capability::kManagementPolicyQueries));
+        CHECK(remote->hasCapability(Capability::kEntityTraitIntrospection));
+        CHECK(remote->hasCapability(Capability::kResolution));
+        CHECK(remote->hasCapability(Capability::kExistenceQueries));
+        CHECK_FALSE(remote->hasCapability(Capability::kStatefulContexts));
+        CHECK_FALSE(remote->hasCapability(Capability::kPublishing));
+        CHECK_FALSE(remote->hasCapability(Capability::kRelationshipQueries));
+      }
+    }
+
+    WHEN("multiple clients initialize the remote manager") {
+      remote->initialize({{"key", openassetio::Float{1.5}}}, hostSession);
+      const auto otherRemote = RemoteManagerInterface::make({server.socketPath});
+      otherRemote->initialize({{"key", openassetio::Float{2.5}}}, hostSession);
+
+      THEN("the shared manager is initialized only once, by the first client") {
+        CHECK(manager->initializeCount == 1);
+        CHECK(manager->initializeSettings ==
+              openassetio::InfoDictionary{{"key", openassetio::Float{1.5}}});
+        CHECK(otherRemote->hasCapability(Capability::kResolution));
+        CHECK(otherRemote->isEntityReferenceString("test://a", hostSession));
+      }
+    }
+
+    WHEN("non-batch queries are made") {
+      THEN("results are returned") {
+        const auto policies = remote->managementPolicy(
+            {{"a"}, {"b", "c"}}, openassetio::access::PolicyAccess::kRead, context, hostSession);
+        REQUIRE(policies.size() == 2);
+        CHECK(policies[0]->traitSet() == openassetio::trait::TraitSet{"a"});
+        CHECK(policies[1]->traitSet() == openassetio::trait::TraitSet{"b", "c"});
+
+        CHECK(remote->isEntityReferenceString("test://a", hostSession));
+        CHECK_FALSE(remote->isEntityReferenceString("other://a", hostSession));
+        CHECK(remote->areEntityReferenceStrings({"test://a", "other://a"}, hostSession) ==
+              std::vector<bool>{true, false});
+      }
+    }
+
+    WHEN("batch queries are made") {
+      THEN("successes and errors are forwarded to the appropriate callback") {
+        std::vector<std::pair<std::size_t, bool>> exists;
+        std::vector<std::pair<std::size_t, BatchElementError>> errors;
+        remote->entityExists(
+            makeRefs({"test://a", "test://missing", "test://error"}), context, hostSession,
+            [&](std::size_t idx, bool value) { exists.emplace_back(idx, value); },
+            [&](std::size_t idx, BatchElementError error) { errors.emplace_back(idx, error); });
+        CHECK(exists == std::vector<std::pair<std::size_t, bool>>{{0, true}, {1, false}});
+        REQUIRE(errors.size() == 1);
+        CHECK(errors[0].first == 2);
+        CHECK(errors[0].second ==
+              BatchElementError{BatchElementError::ErrorCode::kMalformedEntityReference,
+                                "test://error"});
+
+        std::vector<openassetio::trait::TraitSet> traitSets;
+        remote->entityTraits(
+            makeRefs({"test://a"}), openassetio::access::EntityTraitsAccess::kRead, context,
+            hostSession,
+            [&](std::size_t, openassetio::trait::TraitSet traitSet) {
+              traitSets.push_back(std::move(traitSet));
+            },
+            [](std::size_t, const BatchElementError&) { FAIL(); });
+        CHECK(traitSets == std::vector<openassetio::trait::TraitSet>{{"someTrait"}});
+
+        context->locale->addTrait("localeTrait");
+        std::vector<openassetio::trait::TraitsDataPtr> resolved(2);
+        remote->resolve(
+            makeRefs({"test://a", "test://error"}), {"t1", "t2"},
+            openassetio::access::ResolveAccess::kRead, context, hostSession,
+            [&](std::size_t idx, openassetio::trait::TraitsDataPtr data) { resolved[idx] = data; },
+            [&](std::size_t idx, BatchElementError error) { errors.emplace_back(idx, error); });
+        REQUIRE(resolved[0]);
+        CHECK(resolved[0]->traitSet() ==
+              openassetio::trait::TraitSet{"t1", "t2", "localeTrait"});
+        openassetio::trait::property::Value value;
+        CHECK(resolved[0]->getTraitProperty(&value, "t2", "ref"));
+        CHECK(value == openassetio::trait::property::Value{Str{"test://a"}});
+        CHECK(resolved[1] == nullptr);
+        REQUIRE(errors.size() == 2);
+        CHECK(errors[1].first == 1);
+        CHECK(errors[1].second.code == BatchElementError::ErrorCode::kEntityResolutionError);
+      }
+    }
+
+    WHEN("the manager throws during a batch") {
+      THEN("the exception type and message are preserved") {
+        CHECK_THROWS_MATCHES(
+            remote->resolve(
+                makeRefs({"test://throw"}), {"t1"}, openassetio::access::ResolveAccess::kRead,
+                context, hostSession, [](auto&&...) {}, [](auto&&...) {}),
+            openassetio::errors::ConfigurationException,
+            Catch::Message("Bad configuration"));
+
+        AND_THEN("the connection remains usable") {
+          CHECK(remote->isEntityReferenceString("test://a", hostSession));
+        }
+      }
+    }
+
+    WHEN("a batch is much larger than the shared memory buffer") {
+      const auto smallRemote = RemoteManagerInterface::make({server.socketPath}, 64);
+      constexpr std::size_t kBatchSize = 5000;
+      std::vector<Str> refs;
+      for (std::size_t idx = 0; idx < kBatchSize; ++idx) {
+        refs.push_back("test://" + std::to_string(idx));
+      }
+
+      std::vector<Str> resolvedRefs(kBatchSize);
+      smallRemote->resolve(
+          makeRefs(refs), {"t1"}, openassetio::access::ResolveAccess::kRead, context,
+          hostSession,
+          [&](std::size_t idx, const openassetio::trait::TraitsDataPtr& data) {
+            openassetio::trait::property::Value value;
+            data->getTraitProperty(&value, "t1", "ref");
+            resolvedRefs[idx] = std::get<Str>(value);
+          },
+          [](std::size_t, const BatchElementError&) { FAIL(); });
+
+      THEN("all results are streamed through intact") { CHECK(resolvedRefs == refs); }
+    }
+  }
+}
+
+SCENARIO("RemoteManagerInterface concurrency") {
+  GIVEN("a remote manager served by two workers") {
+    const auto manager = std::make_shared<FakeManagerInterface>();
+    const ServerThread server1{manager, makeSocketPath()};
+    const ServerThread server2{manager, makeSocketPath()};
+    const auto remote = RemoteManagerInterface::make({server1.socketPath, server2.socketPath});
+    const auto hostSession = makeHostSession();
+    const auto context = openassetio::Context::make();
+
+    WHEN("two host threads make calls concurrently") {
+      std::atomic<std::size_t> successCount{0};
+      {
+        std::vector<std::thread> threads;
+        for (std::size_t idx = 0; idx < 2; ++idx) {
+          threads.emplace_back([&] {
+            remote->resolve(
+                makeRefs({"test://wait"}), {"t1"}, openassetio::access::ResolveAccess::kRead,
+                context, hostSession, [&](std::size_t, auto&&) { ++successCount; },
+                [](std::size_t, const BatchElementError&) {});
+          });
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      }
+
+      THEN("the calls are serviced in parallel by different workers") {
+        CHECK(successCount == 2);
+        CHECK(manager->maxActive == 2);
+      }
+    }
+  }
+}
+
+SCENARIO("RemoteManagerInterface worker failure") {
+  GIVEN("an initialized remote manager") {
+    const auto manager = std::make_shared<FakeManagerInterface>();
+    const Str socketPath = makeSocketPath();
+    auto server = std::make_unique<ServerThread>(manager, socketPath);
+    const auto remote = RemoteManagerInterface::make({socketPath});
+    const auto hostSession = makeHostSession();
+    remote->initialize({}, hostSession);
+    REQUIRE(manager->initializeCount == 1);
+
+    WHEN("the worker goes away") {
+      server.reset();
+
+      THEN("calls fail with an exception") {
+        CHECK_THROWS_AS(remote->isEntityReferenceString("test://a", hostSession),
+                        openassetio::errors::OpenAssetIOException);
+        CHECK_THROWS_AS(remote->isEntityReferenceString("test://a", hostSession),
+                        openassetio::errors::OpenAssetIOException);
+      }
+
+      AND_WHEN("a new worker is started") {
+        server = std::make_unique<ServerThread>(manager, socketPath);
+
+        THEN("calls succeed and the manager has been reinitialized") {
+          CHECK(remote->isEntityReferenceString("test://a", hostSession));
+          CHECK(manager->initializeCount == 2);
+        }
+      }
+    }
+  }
+
+  GIVEN("a remote manager in a separate worker process") {
+    const Str socketPath = makeSocketPath();
+    const pid_t workerPid = ::fork();
+    REQUIRE(workerPid >= 0);
+    if (workerPid == 0) {
+      const auto server = ManagerServer::make(std::make_shared<FakeManagerInterface>(),
+                                              std::make_shared<StubLoggerInterface>());
+      server->listen(socketPath);
+      server->serve();
+      std::_Exit(EXIT_SUCCESS);
+    }
+
+    openassetio::remote::RemoteManagerInterfacePtr remote;
+    for (std::size_t attempt = 0; attempt < 100 && !remote; ++attempt) {
+      try {
+        remote = RemoteManagerInterface::make({socketPath});
+      } catch (const openassetio::errors::OpenAssetIOException&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      }
+    }
+    REQUIRE(remote);
+    const auto hostSession = makeHostSession();
+
+    WHEN("the worker process crashes mid-call") {
+      THEN("an exception is raised in the host, rather than the host crashing") {
+        CHECK_THROWS_AS(remote->resolve(makeRefs({"test://a", "test://crash"}), {"t1"},
+                                        openassetio::access::ResolveAccess::kRead,
+                                        openassetio::Context::make(), hostSession,
+                                        [](auto&&...) {}, [](auto&&...) {}),
+                        openassetio::errors::OpenAssetIOException);
+
+        int status = 0;
+        CHECK(::waitpid(workerPid, &status, 0) == workerPid);
+        CHECK(WIFEXITED(status));
+        CHECK(WEXITSTATUS(status) == EXIT_FAILURE);
+
+        AND_THEN("subsequent calls also raise") {
+          CHECK_THROWS_AS(remote->isEntityReferenceString("test://a", hostSession),
+                          openassetio::errors::OpenAssetIOException);
+        }
+      }
+    }
+    ::unlink(socketPath.c_str());
+  }
+}
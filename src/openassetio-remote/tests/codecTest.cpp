@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <codec.hpp>
+
+namespace codec = openassetio::remote::codec;
+using openassetio::errors::BatchElementError;
+
+SCENARIO("Encoding and decoding values") {
+  GIVEN("a writer") {
+    codec::Writer writer;
+
+    WHEN("primitive values are written") {
+      writer.writeU8(0xAB);
+      writer.writeU32(0xDEADBEEF);
+      writer.writeU64(0x0123456789ABCDEF);
+      writer.writeBool(true);
+      writer.writeInt(-42);
+      writer.writeFloat(1.5);
+      writer.writeStr("some string");
+      writer.writeStr("");
+
+      THEN("they are read back in the same order") {
+        codec::Reader reader{writer.message()};
+        CHECK(reader.readU8() == 0xAB);
+        CHECK(reader.readU32() == 0xDEADBEEF);
+        CHECK(reader.readU64() == 0x0123456789ABCDEF);
+        CHECK(reader.readBool() == true);
+        CHECK(reader.readInt() == -42);
+        CHECK(reader.readFloat() == 1.5);
+        CHECK(reader.readStr() == "some string");
+        CHECK(reader.readStr().empty());
+        CHECK(reader.atEnd());
+      }
+    }
+
+    WHEN("API types are written") {
+      const openassetio::EntityReferences entityReferences{openassetio::EntityReference{"a"},
+                                                           openassetio::EntityReference{"b"}};
+      const openassetio::trait::TraitSets traitSets{{"t1", "t2"}, {}};
+
+      auto traitsData = openassetio::trait::TraitsData::make();
+      traitsData->setTraitProperty("t1", "bool", openassetio::Bool{true});
+      traitsData->setTraitProperty("t1", "int", openassetio::Int{7});
+      traitsData->setTraitProperty("t2", "float", openassetio::Float{2.5});
+      traitsData->setTraitProperty("t2", "str", openassetio::Str{"value"});
+      traitsData->addTrait("t3");
+
+      const openassetio::InfoDictionary infoDictionary{{"a", openassetio::Int{1}},
+                                                       {"b", openassetio::Str{"two"}}};
+      const BatchElementError error{BatchElementError::ErrorCode::kEntityAccessError, "denied"};
+
+      writer.writeEntityReferences(entityReferences);
+      writer.writeTraitSets(traitSets);
+      writer.writeTraitsDatas({traitsData, nullptr});
+      writer.writeInfoDictionary(infoDictionary);
+      writer.writeBatchElementError(error);
+
+      THEN("they are read back equal") {
+        codec::Reader reader{writer.message()};
+        CHECK(reader.readEntityReferences() == entityReferences);
+        CHECK(reader.readTraitSets() == traitSets);
+        const openassetio::trait::TraitsDatas traitsDatas = reader.readTraitsDatas();
+        REQUIRE(traitsDatas.size() == 2);
+        CHECK(*traitsDatas[0] == *traitsData);
+        CHECK(traitsDatas[1] == nullptr);
+        CHECK(reader.readInfoDictionary() == infoDictionary);
+        CHECK(reader.readBatchElementError() == error);
+        CHECK(reader.atEnd());
+      }
+    }
+  }
+}
+
+SCENARIO("Decoding malformed messages") {
+  GIVEN("a truncated message") {
+    codec::Writer writer;
+    writer.writeStr("some string");
+    codec::Message message = writer.take();
+    message.pop_back();
+
+    THEN("reading throws") {
+      codec::Reader reader{message};
+      CHECK_THROWS_AS(reader.readStr(), openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("a message with an implausibly large collection count") {
+    codec::Writer writer;
+    writer.writeU32(0xFFFFFFFF);
+
+    THEN("reading throws rather than attempting to allocate") {
+      codec::Reader reader{writer.message()};
+      CHECK_THROWS_AS(reader.readEntityReferences(),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  GIVEN("a message with an unknown property value type") {
+    codec::Writer writer;
+    writer.writeU32(1);
+    writer.writeStr("key");
+    writer.writeU8(0xFF);
+
+    THEN("reading throws") {
+      codec::Reader reader{writer.message()};
+      CHECK_THROWS_AS(reader.readInfoDictionary(), openassetio::errors::InputValidationException);
+    }
+  }
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2024 The Foundry Visionmongers Ltd
+/**
+ * @file
+ *
+ * Worker process hosting a manager plugin, for use by
+ * RemoteManagerInterface.
+ *
+ * Usage:
+ *
+ *   openassetio-remote-worker --socket PATH --identifier ID [--python]
+ *
+ * The plugin is loaded using the C++ plugin system, or the Python
+ * plugin system if `--python` is given, using the usual
+ * `OPENASSETIO_PLUGIN_PATH` environment variable to locate it.
+ */
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string_view>
+
+#include <openassetio/log/ConsoleLogger.hpp>
+#include <openassetio/log/SeverityFilter.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerImplementationFactory.hpp>
+#include <openassetio/remote/ManagerServer.hpp>
+#include <openassetio/typedefs.hpp>
+
+#ifdef OPENASSETIO_REMOTE_WORKER_ENABLE_PYTHON
+#include <pybind11/embed.h>
+
+#include <openassetio/python/hostApi.hpp>
+#endif
+
+namespace {
+namespace log = openassetio::log;
+namespace remote = openassetio::remote;
+
+/// Server to stop on SIGINT/SIGTERM. Lock-free, so signal safe.
+std::atomic<remote::ManagerServer*> gServer{nullptr};
+
+extern "C" void handleStopSignal([[maybe_unused]] int signal) {
+  if (remote::ManagerServer* server = gServer.load()) {
+    server->stop();
+  }
+}
+
+void serve(const openassetio::managerApi::ManagerInterfacePtr& managerInterface,
+           const log::LoggerInterfacePtr& logger, const openassetio::Str& socketPath) {
+  const auto server = remote::ManagerServer::make(managerInterface, logger);
+  server->listen(socketPath);
+  gServer = server.get();
+  std::signal(SIGINT, handleStopSignal);
+  std::signal(SIGTERM, handleStopSignal);
+  logger->log(log::LoggerInterface::Severity::kInfo,
+              "Serving '" + managerInterface->identifier() + "' on " + socketPath);
+  server->serve();
+  std::signal(SIGINT, SIG_DFL);
+  std::signal(SIGTERM, SIG_DFL);
+  gServer = nullptr;
+}
+
+int usage(const char* argv0) {
+  std::cerr << "Usage: " << argv0 << " --socket PATH --identifier ID";
+#ifdef OPENASSETIO_REMOTE_WORKER_ENABLE_PYTHON
+  std::cerr << " [--python]";
+#endif
+  std::cerr << "\n";
+  return EXIT_FAILURE;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  openassetio::Str socketPath;
+  openassetio::Identifier identifier;
+  bool usePython = false;
+
+  for (int argIdx = 1; argIdx < argc; ++argIdx) {
+    const std::string_view arg{argv[argIdx]};
+    if (arg == "--socket" && argIdx + 1 < argc) {
+      socketPath = argv[++argIdx];
+    } else if (arg == "--identifier" && argIdx + 1 < argc) {
+      identifier = argv[++argIdx];
+#ifdef OPENASSETIO_REMOTE_WORKER_ENABLE_PYTHON
+    } else if (arg == "--python") {
+      usePython = true;
+#endif
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (socketPath.empty() || identifier.empty()) {
+    return usage(argv[0]);
+  }
+
+  const log::LoggerInterfacePtr logger = log::SeverityFilter::make(log::ConsoleLogger::make());
+
+  try {
+    if (!usePython) {
+      const auto factory =
+          openassetio::pluginSystem::CppPluginSystemManagerImplementationFactory::make(logger);
+      serve(factory->instantiate(identifier), logger, socketPath);
+      return EXIT_SUCCESS;
+    }
+
+#ifdef OPENASSETIO_REMOTE_WORKER_ENABLE_PYTHON
+    namespace py = pybind11;
+    const py::scoped_interpreter interpreter{};
+    const auto factory =
+        openassetio::python::hostApi::createPythonPluginSystemManagerImplementationFactory(
+            logger);
+    const openassetio::managerApi::ManagerInterfacePtr managerInterface =
+        factory->instantiate(identifier);
+    {
+      // The Python manager acquires the GIL as required.
+      const py::gil_scoped_release release{};
+      serve(managerInterface, logger, socketPath);
+    }
+#endif
+  } catch (const std::exception& exc) {
+    logger->log(log::LoggerInterface::Severity::kCritical, exc.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}